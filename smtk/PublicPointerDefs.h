@@ -240,6 +240,7 @@ class Manager;
 class PhraseContent;
 class PhraseListContent;
 class PhraseModel;
+class PhraseTitleIndex;
 class ResourcePhraseContent;
 class Selection;
 class SubphraseGenerator;
@@ -657,6 +658,8 @@ typedef smtk::shared_ptr<const smtk::view::PhraseContent> ConstPhraseContentPtr;
 typedef smtk::shared_ptr<smtk::view::PhraseListContent> PhraseListContentPtr;
 /// @see smtk::view::ComponentPhraseContent
 typedef smtk::shared_ptr<smtk::view::ComponentPhraseContent> ComponentPhraseContentPtr;
+/// @see smtk::view::PhraseTitleIndex
+typedef smtk::shared_ptr<smtk::view::PhraseTitleIndex> PhraseTitleIndexPtr;
 /// @see smtk::view::ResourcePhraseContent
 typedef smtk::shared_ptr<smtk::view::ResourcePhraseContent> ResourcePhraseContentPtr;
 } // namespace view
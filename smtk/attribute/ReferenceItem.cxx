@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <map>
 #include <sstream>
 
 namespace smtk
@@ -1142,12 +1143,13 @@ bool ReferenceItem::resolve() const
   // are not, then something unexpected has occured.
   assert(m_keys.size() == m_cache->size());
 
+  access_reference accessReference;
+
   const auto* def = static_cast<const ReferenceItemDefinition*>(this->definition().get());
 
   // Iterate over the objects' keys and values.
   auto key = m_keys.begin();
   auto value = m_cache->begin();
-  access_reference accessReference;
   for (; value != m_cache->end(); ++value, ++key)
   {
     // If a value is not currently resolved...
@@ -1188,6 +1190,106 @@ bool ReferenceItem::resolve() const
   return allResolved;
 }
 
+bool ReferenceItem::resolve(const std::vector<ConstReferenceItemPtr>& items)
+{
+  static const Key nullKey = Key();
+
+  // A value to be looked up: its item and position within the item.
+  struct Pending
+  {
+    const ReferenceItem* item;
+    std::size_t index;
+  };
+  // All of the values whose keys are held by a single attribute resource.
+  struct Batch
+  {
+    smtk::attribute::ResourcePtr resource;
+    std::vector<Pending> pending;
+    std::vector<Key> keys;
+  };
+
+  bool allResolved = true;
+  std::map<const smtk::attribute::Resource*, Batch> batches;
+  access_reference accessReference;
+  for (const auto& item : items)
+  {
+    if (item == nullptr)
+    {
+      continue;
+    }
+    AttributePtr myAtt = item->m_referencedAttribute.lock();
+    smtk::attribute::ResourcePtr attResource = myAtt ? myAtt->attributeResource() : nullptr;
+    if (attResource == nullptr)
+    {
+      allResolved = false;
+      continue;
+    }
+    assert(item->m_keys.size() == item->m_cache->size());
+
+    const auto* def = static_cast<const ReferenceItemDefinition*>(item->definition().get());
+    bool managed = attResource->manager() != nullptr;
+    Batch& batch = batches[attResource.get()];
+    batch.resource = attResource;
+    for (std::size_t ii = 0; ii < item->m_keys.size(); ++ii)
+    {
+      // Values are looked up under the same conditions as resolve() uses.
+      const Key& key = item->m_keys[ii];
+      auto reference = boost::apply_visitor(accessReference, (*item->m_cache)[ii]);
+      if ((reference == nullptr) || (!def->holdReference() && key != nullKey && managed))
+      {
+        batch.pending.push_back(Pending{ item.get(), ii });
+        batch.keys.push_back(key);
+      }
+    }
+  }
+
+  for (auto& entry : batches)
+  {
+    Batch& batch = entry.second;
+    if (batch.keys.empty())
+    {
+      continue;
+    }
+    auto objects = batch.resource->guardedLinks()->linkedObjects(batch.keys);
+
+    // As in value(key), objects held by the attribute resource itself may
+    // only resolve once the resource's links to itself have been resolved.
+    std::vector<std::size_t> retry;
+    for (std::size_t ii = 0; ii < objects.size(); ++ii)
+    {
+      if (objects[ii] == nullptr && !batch.keys[ii].first.isNull())
+      {
+        retry.push_back(ii);
+      }
+    }
+    if (!retry.empty() && batch.resource->guardedLinks()->resolve(batch.resource))
+    {
+      std::vector<Key> retryKeys;
+      retryKeys.reserve(retry.size());
+      for (const auto& ii : retry)
+      {
+        retryKeys.push_back(batch.keys[ii]);
+      }
+      auto retried = batch.resource->guardedLinks()->linkedObjects(retryKeys);
+      for (std::size_t jj = 0; jj < retry.size(); ++jj)
+      {
+        objects[retry[jj]] = retried[jj];
+      }
+    }
+
+    for (std::size_t ii = 0; ii < objects.size(); ++ii)
+    {
+      batch.pending[ii].item->assignToCache(batch.pending[ii].index, objects[ii]);
+      if (objects[ii] == nullptr)
+      {
+        allResolved = false;
+      }
+    }
+  }
+
+  return allResolved;
+}
+
 void ReferenceItem::assignToCache(std::size_t i, const PersistentObjectPtr& obj) const
 {
   const auto* def = static_cast<const ReferenceItemDefinition*>(this->definition().get());
@@ -153,6 +153,20 @@ public:
   /// Return the maximum number of values allowed by this item's definition (or 0).
   std::size_t maxNumberOfValues() const;
 
+  /**\brief Resolve the values of many items at once.
+    *
+    * Rather than looking up each value through its owning attribute's links
+    * one at a time, keys from all of the \a items are grouped by the resource
+    * they reference and resolved together; each item's cache is then filled
+    * in place. As with resolve(), values of items that do not hold their
+    * references are looked up again by later validity checks when the
+    * attribute resource is managed.
+    *
+    * Return true if every value of every item was resolved.
+    * See smtk::attribute::Resource::resolveReferences().
+    */
+  static bool resolve(const std::vector<ConstReferenceItemPtr>& items);
+
   /// Return true if the ReferenceItem contains a reference to the given object.
   bool contains(const smtk::resource::PersistentObjectPtr& obj) const;
 
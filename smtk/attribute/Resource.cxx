@@ -276,6 +276,22 @@ void Resource::attributes(std::vector<smtk::attribute::AttributePtr>& result) co
   }
 }
 
+bool Resource::resolveReferences() const
+{
+  std::vector<smtk::attribute::ConstReferenceItemPtr> items;
+  for (const auto& entry : m_attributeIdMap)
+  {
+    const auto& att = entry.second;
+    if (auto associations = att->associations())
+    {
+      items.push_back(associations);
+    }
+    att->filterItems(
+      items, [](const smtk::attribute::ConstReferenceItemPtr&) { return true; }, false);
+  }
+  return ReferenceItem::resolve(items);
+}
+
 // For Reader classes - Note that since these methods are restoring an attribute
 // into the resource it does not call setClean(false)
 smtk::attribute::AttributePtr Resource::createAttribute(
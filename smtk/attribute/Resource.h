@@ -13,6 +13,7 @@
 
 #include "smtk/common/Factory.h"
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDContainers.h"
 
 #include "smtk/geometry/Resource.h"
 
@@ -328,6 +329,16 @@ public:
   //Get a list of all attributes in the Resource
   void attributes(std::vector<smtk::attribute::AttributePtr>& result) const;
 
+  /**\brief Resolve the associations and reference items of every attribute at once.
+    *
+    * ReferenceItems normally look up their values one at a time as they are
+    * accessed. Call this before iterating over many attributes (e.g., to
+    * check their validity or export them) so that all of the values are
+    * resolved in bulk; see ReferenceItem::resolve(). Returns true if every
+    * referenced object was found.
+    */
+  bool resolveReferences() const;
+
   smtk::attribute::EvaluatorFactory& evaluatorFactory() { return m_evaluatorFactory; }
 
   const smtk::attribute::EvaluatorFactory& evaluatorFactory() const { return m_evaluatorFactory; }
@@ -462,7 +473,7 @@ protected:
   std::map<std::string, std::set<smtk::attribute::AttributePtr, Attribute::CompareByName>>
     m_attributeClusters;
   std::map<std::string, smtk::attribute::AttributePtr> m_attributes;
-  std::map<smtk::common::UUID, smtk::attribute::AttributePtr> m_attributeIdMap;
+  smtk::common::UUIDHashMap<smtk::attribute::AttributePtr> m_attributeIdMap;
 
   std::map<
     smtk::attribute::DefinitionPtr,
@@ -515,8 +526,7 @@ inline smtk::attribute::AttributePtr Resource::findAttribute(const std::string&
 
 inline smtk::attribute::AttributePtr Resource::findAttribute(const smtk::common::UUID& attId) const
 {
-  std::map<smtk::common::UUID, AttributePtr>::const_iterator it;
-  it = m_attributeIdMap.find(attId);
+  auto it = m_attributeIdMap.find(attId);
   return (it == m_attributeIdMap.end()) ? smtk::attribute::AttributePtr() : it->second;
 }
 
@@ -86,6 +86,7 @@ inline PySharedPtrClass< smtk::attribute::Resource> pybind11_init_smtk_attribute
     .def("passActiveCategoryCheck", (bool (smtk::attribute::Resource::*) (const smtk::attribute::Categories& cats) const) &smtk::attribute::Resource::passActiveCategoryCheck, py::arg("categories"))
     .def("removeAttribute", &smtk::attribute::Resource::removeAttribute, py::arg("att"))
     .def("rename", &smtk::attribute::Resource::rename, py::arg("att"), py::arg("newName"))
+    .def("resolveReferences", &smtk::attribute::Resource::resolveReferences)
     .def("resetDefaultNameSeparator", &smtk::attribute::Resource::resetDefaultNameSeparator)
     .def("setActiveCategories", &smtk::attribute::Resource::setActiveCategories, py::arg("categories"))
     .def("setActiveCategoriesEnabled", &smtk::attribute::Resource::setActiveCategoriesEnabled, py::arg("mode"))
@@ -0,0 +1,126 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/ComponentItemDefinition.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/ReferenceItem.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/resource/Manager.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <string>
+#include <vector>
+
+using namespace smtk::attribute;
+
+int unitResolveReferences(int /*unused*/, char** const /*unused*/)
+{
+  const std::size_t numberOfTargets = 50;
+
+  // I. Create a resource of target attributes and a resource of attributes
+  //    that reference them (both via associations and a component item).
+  ResourcePtr targetResource = Resource::create();
+  DefinitionPtr targetDef = targetResource->createDefinition("target");
+  std::vector<AttributePtr> targets;
+  for (std::size_t ii = 0; ii < numberOfTargets; ++ii)
+  {
+    targets.push_back(targetResource->createAttribute("target-" + std::to_string(ii), targetDef));
+  }
+
+  ResourcePtr sourceResource = Resource::create();
+  DefinitionPtr sourceDef = sourceResource->createDefinition("source");
+  auto associationRule = sourceDef->createLocalAssociationRule();
+  associationRule->setAcceptsEntries(
+    "smtk::attribute::Resource", "attribute[type='target']", true);
+  associationRule->setNumberOfRequiredValues(0);
+  associationRule->setIsExtensible(true);
+  auto compDef = sourceDef->addItemDefinition<ComponentItemDefinition>("reference");
+  compDef->setAcceptsEntries("smtk::attribute::Resource", "attribute[type='target']", true);
+  compDef->setNumberOfRequiredValues(1);
+  sourceResource->finalizeDefinitions();
+
+  std::vector<AttributePtr> sources;
+  for (std::size_t ii = 0; ii < numberOfTargets; ++ii)
+  {
+    auto source = sourceResource->createAttribute("source-" + std::to_string(ii), sourceDef);
+    smtkTest(source->associate(targets[ii]), "Could not associate target " << ii << ".");
+    smtkTest(
+      source->findComponent("reference")->setValue(targets[(ii + 1) % numberOfTargets]),
+      "Could not reference target " << ii << ".");
+    sources.push_back(source);
+  }
+
+  // II. Resolve all references at once and verify each item holds the object
+  //     its keys refer to.
+  smtkTest(sourceResource->resolveReferences(), "Not all references were resolved.");
+  for (std::size_t ii = 0; ii < numberOfTargets; ++ii)
+  {
+    auto associations = sources[ii]->associations();
+    smtkTest(
+      associations->value() == targets[ii], "Association " << ii << " resolved incorrectly.");
+    smtkTest(
+      sources[ii]->findComponent("reference")->value() == targets[(ii + 1) % numberOfTargets],
+      "Reference " << ii << " resolved incorrectly.");
+    smtkTest(sources[ii]->isValid(), "Source " << ii << " should be valid.");
+  }
+
+  // III. Items whose values cannot be resolved are reported.
+  auto unset = sourceResource->createAttribute("unset", sourceDef);
+  smtkTest(
+    !ReferenceItem::resolve({ unset->findComponent("reference") }),
+    "An unset reference should not resolve.");
+  smtkTest(!sourceResource->resolveReferences(), "Unresolved references were not reported.");
+  smtkTest(!unset->isValid(), "An attribute with an unset reference should be invalid.");
+
+  // IV. Changing a key after bulk resolution must not report a stale value.
+  smtkTest(sourceResource->removeAttribute(unset), "Could not remove unset attribute.");
+  smtkTest(sourceResource->resolveReferences(), "Not all references were resolved.");
+  auto reference = sources[0]->findComponent("reference");
+  reference->setObjectKey(0, ReferenceItem::Key());
+  smtkTest(!sources[0]->isValid(), "A reference with a null key should be invalid.");
+
+  // V. Appending, removing, or resizing values after bulk resolution must
+  //    not report the values resolved in bulk.
+  smtkTest(reference->setValue(targets[1]), "Could not restore reference.");
+  smtkTest(sourceResource->resolveReferences(), "Not all references were resolved.");
+  auto associations = sources[1]->associations();
+  smtkTest(associations->appendValue(targets[0]), "Could not append an association.");
+  smtkTest(associations->isValid(false), "An appended association should resolve.");
+  smtkTest(associations->value(1) == targets[0], "Appended association is incorrect.");
+  smtkTest(associations->removeValue(0), "Could not remove an association.");
+  smtkTest(associations->isValid(false), "Remaining associations should resolve.");
+  smtkTest(associations->value(0) == targets[0], "Remaining association is incorrect.");
+
+  smtkTest(sourceResource->resolveReferences(), "Not all references were resolved.");
+  smtkTest(associations->setNumberOfValues(2), "Could not resize associations.");
+  smtkTest(!associations->isValid(false), "An unset association should not resolve.");
+  smtkTest(associations->removeValue(1), "Could not remove an unset association.");
+  smtkTest(associations->isValid(false), "Remaining associations should resolve.");
+
+  // VI. Removing a referenced component after bulk resolution must be
+  //     reported by the next validity check of a managed resource, even
+  //     while the removed component is still alive.
+  auto resourceManager = smtk::resource::Manager::create();
+  resourceManager->registerResource<smtk::attribute::Resource>();
+  smtkTest(resourceManager->add(targetResource), "Could not manage target resource.");
+  smtkTest(resourceManager->add(sourceResource), "Could not manage source resource.");
+  smtkTest(sourceResource->resolveReferences(), "Not all references were resolved.");
+  smtkTest(targetResource->removeAttribute(targets[2]), "Could not remove target 2.");
+  smtkTest(
+    !sources[2]->associations()->isValid(false), "A removed association should not resolve.");
+  smtkTest(!sources[1]->isValid(), "A source referencing a removed target should be invalid.");
+  smtkTest(sources[3]->isValid(), "Source 3 should be unaffected by removing target 2.");
+
+  return 0;
+}
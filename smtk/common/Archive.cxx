@@ -46,6 +46,7 @@ struct Archive::Internals
   std::string archivePath;
   std::map<std::string, std::string> filePaths;
   bool archived;
+  bool compressed{ false };
   mutable std::set<std::string> temporaryDirectories;
 };
 
@@ -83,6 +84,16 @@ bool Archive::insert(const std::string& filePath, const std::string& archivedPat
   return true;
 }
 
+void Archive::setCompressed(bool compressed)
+{
+  m_internals->compressed = compressed;
+}
+
+bool Archive::compressed() const
+{
+  return m_internals->compressed;
+}
+
 bool Archive::archive() const
 {
   struct archive* a;
@@ -94,8 +105,14 @@ bool Archive::archive() const
 
   a = archive_write_new();
 
-  // do not use compression
-  archive_write_add_filter_none(a);
+  if (m_internals->compressed)
+  {
+    archive_write_add_filter_gzip(a);
+  }
+  else
+  {
+    archive_write_add_filter_none(a);
+  }
 
   // from libarchive's doc
   // (https://github.com/libarchive/libarchive/wiki/Examples):
@@ -227,6 +244,7 @@ bool Archive::extract()
   a = archive_read_new();
 
   // read all supported filter types
+  archive_read_support_filter_all(a);
   archive_read_support_format_all(a);
 
   // the second "archive" is a disk archive (i.e. it restores the files to disk)
@@ -51,6 +51,12 @@ public:
   /// success.
   bool insert(const std::string& filePath, const std::string& archivedPath);
 
+  /// Set whether the archive is gzip-compressed when it is serialized to disk.
+  /// Archives are uncompressed by default; compressed archives are detected
+  /// automatically when they are extracted.
+  void setCompressed(bool compressed);
+  bool compressed() const;
+
   /// Serialize the files that comprise the archive to a contiguous block of
   /// memory on disk (located at \a archivePath ). Return true upon success.
   bool archive() const;
@@ -12,10 +12,12 @@
 #define smtk_common_Links_h
 
 #include "smtk/common/CompilerInformation.h"
+#include "smtk/common/Visit.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include <boost/multi_index/composite_key.hpp>
 #include <boost/multi_index/global_fun.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index_container.hpp>
@@ -108,6 +110,12 @@ struct Right
 struct Role
 {
 };
+struct LeftRole
+{
+};
+struct RightRole
+{
+};
 
 using namespace boost::multi_index;
 
@@ -115,6 +123,11 @@ using namespace boost::multi_index;
 /// right and role indexing. A link_type is also expected; users are optionally
 /// able to use template classes that inherit from Link and augment its storage
 /// and utility.
+///
+/// The Left and Right indices are ordered by (value, role) so they may be
+/// queried by value alone; the LeftRole and RightRole indices hash the same
+/// (value, role) pairs so that the most common queries (all links from or to
+/// an object with a given role) take constant time.
 template<
   typename id_type,
   typename left_type,
@@ -159,7 +172,33 @@ using LinkContainer = boost::multi_index_container<
         member<
           Link<id_type, left_type, right_type, role_type, base_type>,
           role_type,
-          &Link<id_type, left_type, right_type, role_type, base_type>::role>>>>>;
+          &Link<id_type, left_type, right_type, role_type, base_type>::role>>>,
+    hashed_non_unique<
+      tag<LeftRole>,
+      composite_key<
+        Link<id_type, left_type, right_type, role_type, base_type>,
+        member<
+          Link<id_type, left_type, right_type, role_type, base_type>,
+          left_type,
+          &Link<id_type, left_type, right_type, role_type, base_type>::left>,
+        member<
+          Link<id_type, left_type, right_type, role_type, base_type>,
+          role_type,
+          &Link<id_type, left_type, right_type, role_type, base_type>::role>>,
+      composite_key_hash<std::hash<left_type>, std::hash<role_type>>>,
+    hashed_non_unique<
+      tag<RightRole>,
+      composite_key<
+        Link<id_type, left_type, right_type, role_type, base_type>,
+        member<
+          Link<id_type, left_type, right_type, role_type, base_type>,
+          right_type,
+          &Link<id_type, left_type, right_type, role_type, base_type>::right>,
+        member<
+          Link<id_type, left_type, right_type, role_type, base_type>,
+          role_type,
+          &Link<id_type, left_type, right_type, role_type, base_type>::role>>,
+      composite_key_hash<std::hash<right_type>, std::hash<role_type>>>>>;
 
 /// Traits classes for Links. We key off of the tags to return sane responses
 /// in the Links class.
@@ -182,6 +221,7 @@ struct LinkTraits<id_type, left_type, right_type, role_type, base_type, Left>
 {
   typedef Link<id_type, left_type, right_type, role_type, base_type> Link_;
   typedef Right OtherTag;
+  typedef LeftRole RoleTag;
   typedef left_type type;
   typedef right_type other_type;
   static const type& value(const Link_& a) { return a.left; }
@@ -198,6 +238,7 @@ struct LinkTraits<id_type, left_type, right_type, role_type, base_type, Right>
 {
   typedef Link<id_type, left_type, right_type, role_type, base_type> Link_;
   typedef Left OtherTag;
+  typedef RightRole RoleTag;
   typedef right_type type;
   typedef left_type other_type;
   static const type& value(const Link_& a) { return a.right; }
@@ -249,6 +290,10 @@ public:
   using Left = detail::Left;
   using Right = detail::Right;
   using Role = detail::Role;
+  /// The "LeftRole" and "RightRole" tags provide hashed views keyed on
+  /// (left, role) and (right, role) tuples, respectively.
+  using LeftRole = detail::LeftRole;
+  using RightRole = detail::RightRole;
 
   /// We expose a subset of the base class's types and methods because we use
   /// them for untagged interaction (i.e. methods that do not use a tag) with
@@ -342,7 +387,7 @@ public:
   template<typename tag>
   bool erase_all(const std::tuple<typename LinkTraits<tag>::type, role_type>& value)
   {
-    auto& self = this->Parent::template get<tag>();
+    auto& self = this->Parent::template get<typename LinkTraits<tag>::RoleTag>();
     auto to_erase = self.equal_range(value);
 
     // No elements match |value|, or |self| is empty.
@@ -498,7 +543,7 @@ public:
       std::less<const typename traits::other_type>>
       values;
 
-    auto& self = this->Parent::template get<tag>();
+    auto& self = this->Parent::template get<typename traits::RoleTag>();
     auto range = self.equal_range(std::make_tuple(value, role));
     for (auto it = range.first; it != range.second; ++it)
     {
@@ -506,6 +551,43 @@ public:
     }
     return values;
   }
+
+  /// Given a Left or Right tag, an associated value and a role, invoke \a visitor
+  /// on each link from (or to) the input value with the role value.
+  ///
+  /// Unlike linked_to(), this does not construct a set and the visitor is passed
+  /// the entire link (so it may inspect the id or base type). The visitor may
+  /// return smtk::common::Visit::Halt to terminate iteration early.
+  template<typename tag, typename Functor>
+  smtk::common::Visited
+  visit_links(const typename LinkTraits<tag>::type& value, const role_type& role, Functor&& visitor)
+    const
+  {
+    smtk::common::VisitorFunctor<Functor> decoratedVisitor(visitor);
+    auto& self = this->Parent::template get<typename LinkTraits<tag>::RoleTag>();
+    auto range = self.equal_range(std::make_tuple(value, role));
+    if (range.first == range.second)
+    {
+      return smtk::common::Visited::Empty;
+    }
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      if (decoratedVisitor(*it) == smtk::common::Visit::Halt)
+      {
+        return smtk::common::Visited::Some;
+      }
+    }
+    return smtk::common::Visited::All;
+  }
+
+  /// Given a Left or Right tag, an associated value and a role, return the
+  /// number of links from (or to) the input value with the role value.
+  template<typename tag>
+  std::size_t size(const typename LinkTraits<tag>::type& value, const role_type& role) const
+  {
+    auto& self = this->Parent::template get<typename LinkTraits<tag>::RoleTag>();
+    return self.count(std::make_tuple(value, role));
+  }
 };
 
 template<
@@ -10,6 +10,8 @@
 #ifndef smtk_common_Observers_h
 #define smtk_common_Observers_h
 
+#include "smtk/common/Tracing.h"
+
 #include <functional>
 #include <iostream>
 #include <limits>
@@ -247,6 +249,8 @@ public:
         }
         if (entry.first.assigned())
         {
+          // Time each observer (identified by its description) when tracing.
+          ScopedSpan span("observer", "observer", this->traceName(entry.first));
           result |= entry.second(std::forward<Types>(args)...);
         }
       }
@@ -299,6 +303,8 @@ public:
         }
         if (entry.first.assigned())
         {
+          // Time each observer (identified by its description) when tracing.
+          ScopedSpan span("observer", "observer", this->traceName(entry.first));
           entry.second(std::forward<Types>(args)...);
         }
       }
@@ -386,6 +392,7 @@ public:
     }
 
     m_descriptions.insert(std::make_pair(handle, description));
+    m_traceNames[handle] = Tracing::intern(description);
     if (DebugObservers)
     {
       std::cerr << "Inserting observer (" << handle.first << ", " << handle.second
@@ -469,14 +476,31 @@ private:
   {
     std::unique_lock<std::mutex> lock(m_mutex);
     m_keys.erase(key);
+    m_traceNames.erase(key);
     return m_observers.erase(key);
   }
 
+  // Return the name under which an observer's calls are traced, or nullptr
+  // when tracing is disabled.
+  const char* traceName(const InternalKey& key) const
+  {
+    if (!Tracing::enabled())
+    {
+      return nullptr;
+    }
+    auto name = m_traceNames.find(key);
+    return name == m_traceNames.end() ? nullptr : name->second;
+  }
+
   bool m_observing{ false };
   std::set<InternalKey> m_toErase;
 
   std::mutex m_mutex;
   std::map<InternalKey, Key*> m_keys;
+
+  // Each observer's description, interned when the observer is inserted so
+  // that tracing its calls does not copy or look up the string.
+  std::map<InternalKey, const char*> m_traceNames;
 };
 } // namespace common
 } // namespace smtk
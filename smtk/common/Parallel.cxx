@@ -0,0 +1,116 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/Parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace smtk
+{
+namespace common
+{
+
+namespace
+{
+// The progress of a call to runChunks(). Workers on the shared pool hold it by
+// shared pointer, since a worker may start after every chunk has been claimed
+// and runChunks() has returned; such a worker finds no chunk left to claim and
+// never touches the task.
+struct ChunkState
+{
+  ChunkState(std::size_t count, const std::function<void(std::size_t)>& task)
+    : m_numberOfChunks(count)
+    , m_task(task)
+  {
+  }
+
+  const std::size_t m_numberOfChunks;
+  const std::function<void(std::size_t)>& m_task;
+  std::atomic<std::size_t> m_next{ 0 };
+  std::size_t m_completed{ 0 };
+  std::exception_ptr m_error;
+  std::mutex m_mutex;
+  std::condition_variable m_done;
+};
+
+// Claim and run chunks until none are left.
+void work(ChunkState& state)
+{
+  for (std::size_t chunk = state.m_next++; chunk < state.m_numberOfChunks;
+       chunk = state.m_next++)
+  {
+    std::exception_ptr error;
+    try
+    {
+      state.m_task(chunk);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(state.m_mutex);
+    if (error && !state.m_error)
+    {
+      state.m_error = error;
+    }
+    if (++state.m_completed == state.m_numberOfChunks)
+    {
+      state.m_done.notify_all();
+    }
+  }
+}
+} // namespace
+
+unsigned int numberOfThreads()
+{
+  unsigned int numberOfThreads = std::thread::hardware_concurrency();
+  return numberOfThreads == 0 ? 1 : numberOfThreads;
+}
+
+ThreadPool<>& sharedThreadPool()
+{
+  static ThreadPool<> pool(numberOfThreads());
+  return pool;
+}
+
+namespace detail
+{
+void runChunks(std::size_t numberOfChunks, const std::function<void(std::size_t)>& task)
+{
+  auto state = std::make_shared<ChunkState>(numberOfChunks, task);
+
+  // The calling thread is one of the workers, so it never waits on a chunk
+  // that has not been started.
+  const std::size_t helpers =
+    std::min<std::size_t>(smtk::common::numberOfThreads(), numberOfChunks) - 1;
+  auto& pool = sharedThreadPool();
+  for (std::size_t ii = 0; ii < helpers; ++ii)
+  {
+    pool([state]() { work(*state); });
+  }
+  work(*state);
+
+  std::unique_lock<std::mutex> lock(state->m_mutex);
+  state->m_done.wait(lock, [&state]() { return state->m_completed == state->m_numberOfChunks; });
+  if (state->m_error)
+  {
+    std::rethrow_exception(state->m_error);
+  }
+}
+} // namespace detail
+
+} // namespace common
+} // namespace smtk
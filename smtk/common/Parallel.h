@@ -0,0 +1,81 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_common_Parallel_h
+#define smtk_common_Parallel_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/common/ThreadPool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+namespace smtk
+{
+namespace common
+{
+
+/// Return the number of threads to use for data-parallel work (at least 1).
+SMTKCORE_EXPORT unsigned int numberOfThreads();
+
+/// Return the thread pool that forEachChunk() distributes work to. It holds
+/// numberOfThreads() threads and is created upon first use.
+SMTKCORE_EXPORT ThreadPool<>& sharedThreadPool();
+
+/// Return the number of chunks forEachChunk() divides [0, \a size) into.
+/// There is always at least one chunk, even when \a size is 0.
+inline std::size_t numberOfChunks(std::size_t size, std::size_t chunkSize)
+{
+  return chunkSize == 0 ? 1 : std::max<std::size_t>(1, (size + chunkSize - 1) / chunkSize);
+}
+
+namespace detail
+{
+/// Call \a task(chunk) for each chunk in [0, \a numberOfChunks) on the calling
+/// thread and the shared thread pool, returning once all chunks are done.
+/// The first exception thrown by a task is rethrown.
+SMTKCORE_EXPORT void runChunks(
+  std::size_t numberOfChunks,
+  const std::function<void(std::size_t)>& task);
+} // namespace detail
+
+/**\brief Call \a functor(chunk, begin, end) for each of the consecutive chunks
+  *       of [0, \a size) that are \a chunkSize entries long.
+  *
+  * When there is more than one chunk, they are processed concurrently by the
+  * calling thread and the sharedThreadPool(). Because the calling thread also
+  * processes chunks, \a functor may itself call forEachChunk() (or be called
+  * from a task running on the shared pool) without exhausting the pool.
+  * Chunk indices are dense, so \a functor may accumulate per-chunk results
+  * into an array of numberOfChunks(size, chunkSize) entries. Returns the
+  * number of chunks.
+  */
+template<typename Functor>
+std::size_t forEachChunk(std::size_t size, std::size_t chunkSize, const Functor& functor)
+{
+  const std::size_t chunks = numberOfChunks(size, chunkSize);
+  if (chunks == 1)
+  {
+    functor(std::size_t(0), std::size_t(0), size);
+    return 1;
+  }
+
+  detail::runChunks(chunks, [&functor, size, chunkSize](std::size_t chunk) {
+    const std::size_t begin = chunk * chunkSize;
+    functor(chunk, begin, std::min(size, begin + chunkSize));
+  });
+  return chunks;
+}
+
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_Parallel_h
@@ -0,0 +1,470 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Tracing.h"
+
+#include "smtk/common/Environment.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace smtk
+{
+namespace common
+{
+
+std::atomic<bool> Tracing::s_enabled{ false };
+
+namespace
+{
+// A span as stored in a ring buffer. Its fields are atomic so that spans may be
+// collected while their thread continues to record (without a data race);
+// relaxed accesses compile to plain loads and stores on common hardware.
+// <sequence> is one more than the index of the span held by the slot, or 0
+// while the slot is being written.
+struct Slot
+{
+  std::atomic<std::uint64_t> sequence{ 0 };
+  std::atomic<const char*> name;
+  std::atomic<const char*> category;
+  std::atomic<const char*> detail;
+  std::atomic<std::uint64_t> start;
+  std::atomic<std::uint64_t> duration;
+};
+
+// The spans recorded by a single thread. Only the owning thread writes slots
+// and advances <head>.
+struct ThreadBuffer
+{
+  ThreadBuffer(std::size_t capacity, std::uint32_t thread)
+    : slots(new Slot[capacity])
+    , capacity(capacity)
+    , thread(thread)
+  {
+  }
+
+  std::unique_ptr<Slot[]> slots;
+  const std::size_t capacity;
+  const std::uint32_t thread;
+  std::atomic<std::uint64_t> head{ 0 };
+  // Spans before <tail> have been discarded by Tracing::clear().
+  std::atomic<std::uint64_t> tail{ 0 };
+};
+
+struct Registry
+{
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  std::size_t capacity{ 1 << 14 };
+  std::unordered_set<std::string> strings;
+};
+
+// The registry is never destroyed so that threads (and the exit handler
+// below) may record and collect spans during static destruction.
+Registry& registry()
+{
+  static Registry* instance = new Registry;
+  return *instance;
+}
+
+ThreadBuffer& threadBuffer()
+{
+  thread_local ThreadBuffer* buffer = nullptr;
+  if (!buffer)
+  {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.buffers.emplace_back(
+      new ThreadBuffer(reg.capacity, static_cast<std::uint32_t>(reg.buffers.size())));
+    buffer = reg.buffers.back().get();
+  }
+  return *buffer;
+}
+
+bool endsWith(const std::string& text, const std::string& suffix)
+{
+  return text.size() >= suffix.size() &&
+    text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Enable tracing when the SMTK_TRACE environment variable names an output
+// file, and write the trace to it at exit.
+struct TraceFromEnvironment
+{
+  TraceFromEnvironment()
+    : filename(Environment::getVariable("SMTK_TRACE"))
+  {
+    if (!filename.empty())
+    {
+      Tracing::setEnabled(true);
+    }
+  }
+
+  ~TraceFromEnvironment()
+  {
+    if (!filename.empty())
+    {
+      if (endsWith(filename, ".json"))
+      {
+        Tracing::writeChromeTrace(filename);
+      }
+      else
+      {
+        Tracing::writeBinary(filename);
+      }
+    }
+  }
+
+  std::string filename;
+};
+TraceFromEnvironment s_traceFromEnvironment;
+
+void writeEscaped(std::ostream& stream, const char* text)
+{
+  stream << '"';
+  for (const char* cc = text; cc && *cc; ++cc)
+  {
+    switch (*cc)
+    {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(*cc) < 0x20)
+        {
+          char code[8];
+          std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(*cc));
+          stream << code;
+        }
+        else
+        {
+          stream << *cc;
+        }
+    }
+  }
+  stream << '"';
+}
+
+void writeInteger(std::ostream& stream, std::uint64_t value, int bytes)
+{
+  char data[8];
+  for (int ii = 0; ii < bytes; ++ii)
+  {
+    data[ii] = static_cast<char>((value >> (8 * ii)) & 0xff);
+  }
+  stream.write(data, bytes);
+}
+
+bool readInteger(std::istream& stream, std::uint64_t& value, int bytes)
+{
+  unsigned char data[8];
+  if (!stream.read(reinterpret_cast<char*>(data), bytes))
+  {
+    return false;
+  }
+  value = 0;
+  for (int ii = 0; ii < bytes; ++ii)
+  {
+    value |= static_cast<std::uint64_t>(data[ii]) << (8 * ii);
+  }
+  return true;
+}
+
+const char s_signature[] = "SMTKTRC1";
+const std::uint32_t s_noString = 0xffffffff;
+} // namespace
+
+void Tracing::setEnabled(bool enable)
+{
+  s_enabled.store(enable, std::memory_order_relaxed);
+}
+
+void Tracing::setCapacity(std::size_t spansPerThread)
+{
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  reg.capacity = std::max<std::size_t>(spansPerThread, 1);
+}
+
+std::size_t Tracing::capacity()
+{
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  return reg.capacity;
+}
+
+std::uint64_t Tracing::now()
+{
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::steady_clock::now().time_since_epoch())
+                                      .count());
+}
+
+void Tracing::record(
+  const char* name,
+  const char* category,
+  const char* detail,
+  std::uint64_t start,
+  std::uint64_t end)
+{
+  ThreadBuffer& buffer = threadBuffer();
+  const std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+  Slot& slot = buffer.slots[head % buffer.capacity];
+  // Mark the slot as busy before (and as holding span <head> after) its
+  // fields are written, so readers can discard spans that change under them.
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.category.store(category, std::memory_order_relaxed);
+  slot.detail.store(detail, std::memory_order_relaxed);
+  slot.start.store(start, std::memory_order_relaxed);
+  slot.duration.store(end > start ? end - start : 0, std::memory_order_relaxed);
+  slot.sequence.store(head + 1, std::memory_order_release);
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+const char* Tracing::intern(const std::string& text)
+{
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  return reg.strings.insert(text).first->c_str();
+}
+
+std::vector<Tracing::Span> Tracing::spans()
+{
+  std::vector<Span> result;
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (const auto& buffer : reg.buffers)
+  {
+    const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+    const std::uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+    std::uint64_t first = head > buffer->capacity ? head - buffer->capacity : 0;
+    first = std::max(first, tail);
+    for (std::uint64_t ii = first; ii < head; ++ii)
+    {
+      const Slot& slot = buffer->slots[ii % buffer->capacity];
+      if (slot.sequence.load(std::memory_order_acquire) != ii + 1)
+      {
+        continue;
+      }
+      Span span{ slot.name.load(std::memory_order_relaxed),
+                 slot.category.load(std::memory_order_relaxed),
+                 slot.detail.load(std::memory_order_relaxed),
+                 slot.start.load(std::memory_order_relaxed),
+                 slot.duration.load(std::memory_order_relaxed),
+                 buffer->thread };
+      // The thread may have kept recording while the span was copied; skip
+      // the span if its slot has been (or is being) overwritten.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) == ii + 1)
+      {
+        result.push_back(span);
+      }
+    }
+  }
+  std::stable_sort(result.begin(), result.end(), [](const Span& a, const Span& b) {
+    return a.start < b.start;
+  });
+  return result;
+}
+
+void Tracing::clear()
+{
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (const auto& buffer : reg.buffers)
+  {
+    buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+}
+
+void Tracing::writeChromeTrace(std::ostream& stream)
+{
+  std::vector<Span> spans = Tracing::spans();
+  const std::uint64_t origin = spans.empty() ? 0 : spans.front().start;
+
+  stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  stream << std::fixed << std::setprecision(3);
+  bool first = true;
+  for (const auto& span : spans)
+  {
+    stream << (first ? "\n" : ",\n") << "{\"name\":";
+    first = false;
+    writeEscaped(stream, span.name);
+    stream << ",\"cat\":";
+    writeEscaped(stream, span.category);
+    stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << span.thread
+           << ",\"ts\":" << (span.start - origin) * 1.e-3 << ",\"dur\":" << span.duration * 1.e-3;
+    if (span.detail)
+    {
+      stream << ",\"args\":{\"detail\":";
+      writeEscaped(stream, span.detail);
+      stream << "}";
+    }
+    stream << "}";
+  }
+  stream << "\n]}\n";
+}
+
+bool Tracing::writeChromeTrace(const std::string& filename)
+{
+  std::ofstream stream(filename);
+  if (!stream)
+  {
+    return false;
+  }
+  Tracing::writeChromeTrace(stream);
+  return static_cast<bool>(stream);
+}
+
+bool Tracing::writeBinary(const std::string& filename)
+{
+  std::ofstream stream(filename, std::ios::binary);
+  if (!stream)
+  {
+    return false;
+  }
+
+  std::vector<Span> spans = Tracing::spans();
+
+  // Assign each distinct string an index (strings are compared by address,
+  // since spans refer to literals or interned copies).
+  std::unordered_map<const char*, std::uint32_t> indices;
+  std::vector<const char*> strings;
+  auto index = [&](const char* text) {
+    if (!text)
+    {
+      return s_noString;
+    }
+    auto inserted =
+      indices.insert(std::make_pair(text, static_cast<std::uint32_t>(strings.size())));
+    if (inserted.second)
+    {
+      strings.push_back(text);
+    }
+    return inserted.first->second;
+  };
+  std::vector<std::uint32_t> references;
+  references.reserve(3 * spans.size());
+  for (const auto& span : spans)
+  {
+    references.push_back(index(span.name));
+    references.push_back(index(span.category));
+    references.push_back(index(span.detail));
+  }
+
+  stream.write(s_signature, 8);
+  writeInteger(stream, strings.size(), 4);
+  for (const char* text : strings)
+  {
+    const std::string value(text);
+    writeInteger(stream, value.size(), 4);
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+  }
+  writeInteger(stream, spans.size(), 8);
+  for (std::size_t ii = 0; ii < spans.size(); ++ii)
+  {
+    writeInteger(stream, references[3 * ii], 4);
+    writeInteger(stream, references[3 * ii + 1], 4);
+    writeInteger(stream, references[3 * ii + 2], 4);
+    writeInteger(stream, spans[ii].thread, 4);
+    writeInteger(stream, spans[ii].start, 8);
+    writeInteger(stream, spans[ii].duration, 8);
+  }
+  return static_cast<bool>(stream);
+}
+
+bool Tracing::readBinary(const std::string& filename, std::vector<Span>& spans)
+{
+  std::ifstream stream(filename, std::ios::binary);
+  char signature[8];
+  if (!stream.read(signature, 8) || !std::equal(signature, signature + 8, s_signature))
+  {
+    return false;
+  }
+
+  std::uint64_t count;
+  if (!readInteger(stream, count, 4))
+  {
+    return false;
+  }
+  std::vector<const char*> strings;
+  strings.reserve(static_cast<std::size_t>(count));
+  for (std::uint64_t ii = 0; ii < count; ++ii)
+  {
+    std::uint64_t length;
+    if (!readInteger(stream, length, 4))
+    {
+      return false;
+    }
+    std::string text(static_cast<std::size_t>(length), '\0');
+    if (!stream.read(&text[0], static_cast<std::streamsize>(length)))
+    {
+      return false;
+    }
+    strings.push_back(Tracing::intern(text));
+  }
+  auto lookup = [&strings](std::uint64_t index, const char*& text) {
+    if (index == s_noString)
+    {
+      text = nullptr;
+      return true;
+    }
+    if (index >= strings.size())
+    {
+      return false;
+    }
+    text = strings[static_cast<std::size_t>(index)];
+    return true;
+  };
+
+  if (!readInteger(stream, count, 8))
+  {
+    return false;
+  }
+  spans.clear();
+  for (std::uint64_t ii = 0; ii < count; ++ii)
+  {
+    std::uint64_t name, category, detail, thread;
+    Span span;
+    if (
+      !readInteger(stream, name, 4) || !readInteger(stream, category, 4) ||
+      !readInteger(stream, detail, 4) || !readInteger(stream, thread, 4) ||
+      !readInteger(stream, span.start, 8) || !readInteger(stream, span.duration, 8) ||
+      !lookup(name, span.name) || !lookup(category, span.category) ||
+      !lookup(detail, span.detail))
+    {
+      return false;
+    }
+    span.thread = static_cast<std::uint32_t>(thread);
+    spans.push_back(span);
+  }
+  return true;
+}
+
+} // namespace common
+} // namespace smtk
@@ -0,0 +1,155 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_common_Tracing_h
+#define smtk_common_Tracing_h
+
+#include "smtk/CoreExports.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief Record timed spans of work for performance analysis.
+  *
+  * Tracing is always compiled in but disabled by default; while disabled,
+  * instrumented code pays only for a relaxed atomic load per span. When
+  * enabled, each thread records its spans into its own fixed-size ring
+  * buffer without locking, so the most recent spans of every thread are
+  * retained and older ones are overwritten.
+  *
+  * Recorded spans may be exported as a Chrome trace (JSON suitable for
+  * chrome://tracing or Perfetto) or as a compact binary file.
+  *
+  * Setting the SMTK_TRACE environment variable to a filename enables tracing
+  * at startup and writes the trace to that file when the process exits. A
+  * filename ending in ".json" produces a Chrome trace; any other produces the
+  * binary format.
+  *
+  * Span names, categories and details are not copied, so they must remain
+  * valid for the life of the process. Use string literals or intern() them.
+  */
+class SMTKCORE_EXPORT Tracing
+{
+public:
+  /// A completed span of work. Times are in nanoseconds.
+  struct Span
+  {
+    const char* name;
+    const char* category;
+    const char* detail; //!< May be null.
+    std::uint64_t start;
+    std::uint64_t duration;
+    std::uint32_t thread; //!< A small integer assigned to each recording thread.
+  };
+
+  /// Return true if spans are being recorded.
+  static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+  static void setEnabled(bool enable);
+
+  /// Set the number of spans retained per thread. This applies to threads
+  /// that record their first span after the call.
+  static void setCapacity(std::size_t spansPerThread);
+  static std::size_t capacity();
+
+  /// Return the current time (in nanoseconds on a monotonic clock).
+  static std::uint64_t now();
+
+  /// Record a span in the calling thread's buffer. Most code should use
+  /// ScopedSpan instead.
+  static void record(
+    const char* name,
+    const char* category,
+    const char* detail,
+    std::uint64_t start,
+    std::uint64_t end);
+
+  /// Return a pointer to a copy of \a text that remains valid for the life of
+  /// the process. Equal strings share a single copy.
+  static const char* intern(const std::string& text);
+
+  /// Return the spans currently retained by all threads, ordered by start time.
+  static std::vector<Span> spans();
+
+  /// Discard all retained spans.
+  static void clear();
+
+  ///@{
+  /// Write the retained spans as a Chrome trace.
+  static void writeChromeTrace(std::ostream& stream);
+  static bool writeChromeTrace(const std::string& filename);
+  ///@}
+
+  ///@{
+  /**\brief Write or read the retained spans in a compact binary format.
+    *
+    * The file holds the 8-byte signature "SMTKTRC1", a table of the unique
+    * strings referenced by spans, and then one fixed-size record per span
+    * (with strings replaced by indices into the table). Integers are stored
+    * little-endian. Spans read from a file have interned strings.
+    */
+  static bool writeBinary(const std::string& filename);
+  static bool readBinary(const std::string& filename, std::vector<Span>& spans);
+  ///@}
+
+private:
+  static std::atomic<bool> s_enabled;
+};
+
+/**\brief Record the lifetime of an object as a span.
+  *
+  * Whether tracing is enabled is checked once, at construction; if it is not,
+  * the span does nothing.
+  */
+class SMTKCORE_EXPORT ScopedSpan
+{
+public:
+  ScopedSpan(const char* name, const char* category = "smtk", const char* detail = nullptr)
+    : m_name(Tracing::enabled() ? name : nullptr)
+    , m_category(category)
+    , m_detail(detail)
+    , m_start(m_name ? Tracing::now() : 0)
+  {
+  }
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+  ~ScopedSpan() { this->finish(); }
+
+  /// Return true if this span will be recorded.
+  bool active() const { return m_name != nullptr; }
+
+  /// Record the span now rather than on destruction.
+  void finish()
+  {
+    if (m_name)
+    {
+      Tracing::record(m_name, m_category, m_detail, m_start, Tracing::now());
+      m_name = nullptr;
+    }
+  }
+
+private:
+  const char* m_name;
+  const char* m_category;
+  const char* m_detail;
+  std::uint64_t m_start;
+};
+
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_Tracing_h
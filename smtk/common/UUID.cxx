@@ -11,7 +11,6 @@
 #include "smtk/common/UUIDGenerator.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
-#include <boost/functional/hash.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
@@ -117,24 +116,6 @@ std::string UUID::toString() const
   return boost::uuids::to_string(m_data);
 }
 
-/// Compare two UUIDs for inequality.
-bool UUID::operator!=(const UUID& other) const
-{
-  return m_data != other.m_data;
-}
-
-/// Compare two UUIDs for equality.
-bool UUID::operator==(const UUID& other) const
-{
-  return m_data == other.m_data;
-}
-
-/// Compare two UUIDs for ordering.
-bool UUID::operator<(const UUID& other) const
-{
-  return m_data < other.m_data;
-}
-
 /// Assignment operator.
 UUID& UUID::operator=(const UUID& other) = default;
 
@@ -144,13 +125,6 @@ UUID::operator bool() const
   return !this->isNull();
 }
 
-/// Return a hash of a UUID.
-std::size_t UUID::hash() const
-{
-  boost::hash<boost::uuids::uuid> uuid_hasher;
-  return uuid_hasher(m_data);
-}
-
 /// Write a UUID to a stream (as a string).
 std::ostream& operator<<(std::ostream& stream, const UUID& uid)
 {
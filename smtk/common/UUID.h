@@ -19,6 +19,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 #include <boost/uuid/uuid.hpp>
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <cstdint>
 #include <cstring>
 #include <iosfwd>
 #include <set>
@@ -68,17 +69,68 @@ public:
 
   std::string toString() const;
 
-  bool operator!=(UUID const& other) const;
-  bool operator==(UUID const& other) const;
-  bool operator<(UUID const& other) const;
+  ///@{
+  /**\brief Compare UUIDs.
+    *
+    * These compare the 16 bytes of each UUID as two 64-bit words rather
+    * than byte-by-byte. Ordering is lexicographic by byte (as with
+    * Boost's UUID), so sorted containers keep their existing order.
+    */
+  bool operator!=(UUID const& other) const { return !(*this == other); }
+  bool operator==(UUID const& other) const
+  {
+    return ((this->word(0) ^ other.word(0)) | (this->word(1) ^ other.word(1))) == 0;
+  }
+  bool operator<(UUID const& other) const
+  {
+    std::uint64_t aa = this->bigEndianWord(0);
+    std::uint64_t bb = other.bigEndianWord(0);
+    return aa < bb || (aa == bb && this->bigEndianWord(1) < other.bigEndianWord(1));
+  }
+  ///@}
 
   UUID& operator=(UUID const& other);
 
   operator bool() const;
 
-  std::size_t hash() const;
+  /**\brief Return a hash of the UUID.
+    *
+    * Both 64-bit halves of the UUID are mixed so that every bit
+    * (including the version and variant bits, which are constant for
+    * random UUIDs) affects the result. This is also the hash used
+    * by std::hash<UUID> and thus by UUID-keyed unordered containers.
+    */
+  std::size_t hash() const
+  {
+    std::uint64_t hh = this->word(0) ^ (this->word(1) * 0x9e3779b97f4a7c15ULL);
+    hh ^= hh >> 32;
+    hh *= 0xd6e8feb86659fd93ULL;
+    hh ^= hh >> 32;
+    return static_cast<std::size_t>(hh);
+  }
 
 protected:
+  /// Return half \a ii (0 or 1) of the UUID's bytes as a native-endian word.
+  std::uint64_t word(int ii) const
+  {
+    std::uint64_t result;
+    std::memcpy(&result, m_data.begin() + 8 * ii, sizeof(result));
+    return result;
+  }
+
+  /// Return half \a ii (0 or 1) of the UUID's bytes as a big-endian word.
+  ///
+  /// Compilers reduce this to a load and a byte swap (where needed).
+  std::uint64_t bigEndianWord(int ii) const
+  {
+    const std::uint8_t* bytes = m_data.begin() + 8 * ii;
+    return (static_cast<std::uint64_t>(bytes[0]) << 56) |
+      (static_cast<std::uint64_t>(bytes[1]) << 48) | (static_cast<std::uint64_t>(bytes[2]) << 40) |
+      (static_cast<std::uint64_t>(bytes[3]) << 32) | (static_cast<std::uint64_t>(bytes[4]) << 24) |
+      (static_cast<std::uint64_t>(bytes[5]) << 16) | (static_cast<std::uint64_t>(bytes[6]) << 8) |
+      static_cast<std::uint64_t>(bytes[7]);
+  }
+
   // Implemented using Boost's UUID library.
   boost::uuids::uuid m_data;
 };
@@ -100,17 +152,7 @@ namespace std
 template<>
 struct hash<smtk::common::UUID>
 {
-  size_t operator()(const smtk::common::UUID& uid) const
-  {
-    size_t hash;
-    // Use the last sizeof(size_t) bytes as the hash since UUIDs
-    // put their version number in the 4 LSBs of the 8th byte, which
-    // causes collisions when sizeof(size_t) == 8.
-    // This will need to be revisited if we switch to node-based
-    // UUIDs, but for random UUIDs it works well.
-    memmove(&hash, uid.begin() + smtk::common::UUID::size() - sizeof(hash), sizeof(hash));
-    return hash;
-  }
+  size_t operator()(const smtk::common::UUID& uid) const noexcept { return uid.hash(); }
 };
 
 } // namespace std
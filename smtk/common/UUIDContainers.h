@@ -0,0 +1,139 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_common_UUIDContainers_h
+#define smtk_common_UUIDContainers_h
+
+#include "smtk/common/UUID.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief A hash map keyed by UUID.
+  *
+  * Prefer this to std::map<UUID, T> for lookup-heavy containers whose
+  * iteration order does not matter; it uses UUID::hash(), which mixes
+  * both halves of the UUID.
+  * It is the same type as std::unordered_map<UUID, T>, so it may be
+  * passed to any API that accepts one.
+  */
+template<typename T>
+using UUIDHashMap = std::unordered_map<UUID, T>;
+
+/// A hash set of UUIDs (the same type as std::unordered_set<UUID>).
+using UUIDHashSet = std::unordered_set<UUID>;
+
+/**\brief A set of UUIDs stored in a sorted, contiguous array.
+  *
+  * For sets that are built once (or rarely modified) and then queried
+  * or iterated often, this uses a quarter of the memory of std::set<UUID>
+  * (no per-node allocation) and searches are cache-friendly binary searches.
+  * Iteration order is the same as std::set<UUID>.
+  * Insertion and removal of single entries are linear in the size of the set;
+  * use the range insert() to add many entries at once.
+  */
+class UUIDFlatSet
+{
+public:
+  using value_type = UUID;
+  using size_type = std::size_t;
+  using const_iterator = std::vector<UUID>::const_iterator;
+  using iterator = const_iterator;
+
+  UUIDFlatSet() = default;
+  template<typename InputIterator>
+  UUIDFlatSet(InputIterator first, InputIterator last)
+  {
+    this->insert(first, last);
+  }
+  UUIDFlatSet(std::initializer_list<UUID> entries)
+    : UUIDFlatSet(entries.begin(), entries.end())
+  {
+  }
+
+  const_iterator begin() const { return m_data.begin(); }
+  const_iterator end() const { return m_data.end(); }
+  size_type size() const { return m_data.size(); }
+  bool empty() const { return m_data.empty(); }
+  void clear() { m_data.clear(); }
+  void reserve(size_type count) { m_data.reserve(count); }
+
+  /// Return an iterator to the first entry not ordered before \a uid.
+  const_iterator lower_bound(const UUID& uid) const
+  {
+    return std::lower_bound(m_data.begin(), m_data.end(), uid);
+  }
+
+  /// Return an iterator to \a uid or end() if it is not present.
+  const_iterator find(const UUID& uid) const
+  {
+    auto it = this->lower_bound(uid);
+    return (it != m_data.end() && *it == uid) ? it : m_data.end();
+  }
+
+  size_type count(const UUID& uid) const { return this->find(uid) == m_data.end() ? 0 : 1; }
+  bool contains(const UUID& uid) const { return this->find(uid) != m_data.end(); }
+
+  /// Insert \a uid, returning its location and whether it was inserted.
+  std::pair<const_iterator, bool> insert(const UUID& uid)
+  {
+    auto it = std::lower_bound(m_data.begin(), m_data.end(), uid);
+    if (it != m_data.end() && *it == uid)
+    {
+      return std::make_pair(const_iterator(it), false);
+    }
+    return std::make_pair(const_iterator(m_data.insert(it, uid)), true);
+  }
+
+  /// Insert many UUIDs at once (sorting and removing duplicates once).
+  template<typename InputIterator>
+  void insert(InputIterator first, InputIterator last)
+  {
+    auto middle = static_cast<std::ptrdiff_t>(m_data.size());
+    m_data.insert(m_data.end(), first, last);
+    std::sort(m_data.begin() + middle, m_data.end());
+    std::inplace_merge(m_data.begin(), m_data.begin() + middle, m_data.end());
+    m_data.erase(std::unique(m_data.begin(), m_data.end()), m_data.end());
+  }
+
+  /// Remove \a uid, returning the number of entries removed (0 or 1).
+  size_type erase(const UUID& uid)
+  {
+    auto it = this->find(uid);
+    if (it == m_data.end())
+    {
+      return 0;
+    }
+    m_data.erase(it);
+    return 1;
+  }
+
+  /// Remove the entry at \a position, returning an iterator to the next entry.
+  const_iterator erase(const_iterator position) { return m_data.erase(position); }
+
+  bool operator==(const UUIDFlatSet& other) const { return m_data == other.m_data; }
+  bool operator!=(const UUIDFlatSet& other) const { return m_data != other.m_data; }
+
+protected:
+  std::vector<UUID> m_data;
+};
+
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_UUIDContainers_h
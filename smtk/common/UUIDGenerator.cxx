@@ -9,14 +9,15 @@
 //=========================================================================
 #include "smtk/common/UUIDGenerator.h"
 
-#include "smtk/common/CompilerInformation.h"
-
-SMTK_THIRDPARTY_PRE_INCLUDE
-#include <boost/uuid/uuid_generators.hpp>
-SMTK_THIRDPARTY_POST_INCLUDE
-
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib> // for getenv()/_dupenv_s()
-#include <ctime>   // for time()
+#include <cstring>
+#include <ctime> // for time()
+#include <functional>
+#include <random>
+#include <thread>
 
 namespace
 {
@@ -32,6 +33,49 @@ bool checkenv(const char* vname)
   return valid;
 #endif
 }
+
+// SplitMix64, used to expand seeds into the generator's state.
+std::uint64_t splitmix64(std::uint64_t& state)
+{
+  std::uint64_t zz = (state += 0x9e3779b97f4a7c15ULL);
+  zz = (zz ^ (zz >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  zz = (zz ^ (zz >> 27)) * 0x94d049bb133111ebULL;
+  return zz ^ (zz >> 31);
+}
+
+inline std::uint64_t rotl(std::uint64_t xx, int kk)
+{
+  return (xx << kk) | (xx >> (64 - kk));
+}
+
+// Masks that force the version (4) and variant (RFC4122) bits of a UUID
+// whose 16 bytes are stored as two native-endian 64-bit words.
+struct VersionMasks
+{
+  VersionMasks()
+  {
+    std::array<std::uint8_t, 16> keep;
+    std::array<std::uint8_t, 16> set;
+    keep.fill(0xff);
+    set.fill(0x00);
+    keep[6] = 0x0f; // version occupies the high nibble of byte 6
+    set[6] = 0x40;
+    keep[8] = 0x3f; // variant occupies the two high bits of byte 8
+    set[8] = 0x80;
+    std::memcpy(m_keep, keep.data(), sizeof(m_keep));
+    std::memcpy(m_set, set.data(), sizeof(m_set));
+  }
+
+  std::uint64_t m_keep[2];
+  std::uint64_t m_set[2];
+};
+
+const VersionMasks& versionMasks()
+{
+  static const VersionMasks masks;
+  return masks;
+}
+
 } // namespace
 
 namespace smtk
@@ -42,25 +86,79 @@ namespace common
 class UUIDGenerator::Internal
 {
 public:
+  // The number of UUIDs generated at a time on behalf of random().
+  static constexpr std::size_t BlockSize = 64;
+
   Internal()
   {
+    std::uint64_t seed;
     if (checkenv("SMTK_IN_VALGRIND"))
     {
       // This is a poor technique for seeding or
       // we would initialize this way all the time.
-      m_mtseed.seed(static_cast<boost::mt19937::result_type>(time(nullptr)));
-      m_randomGenerator = new boost::uuids::basic_random_generator<boost::mt19937>(&m_mtseed);
+      seed = static_cast<std::uint64_t>(time(nullptr));
     }
     else
     {
-      m_randomGenerator = new boost::uuids::basic_random_generator<boost::mt19937>;
+      std::random_device entropy;
+      seed = (static_cast<std::uint64_t>(entropy()) << 32) ^ entropy();
+      seed ^= static_cast<std::uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    }
+    // Threads seeded at the same instant must not share a sequence.
+    seed ^= static_cast<std::uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    seed ^= static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(this));
+    for (auto& word : m_state)
+    {
+      word = splitmix64(seed);
     }
   }
-  ~Internal() { delete m_randomGenerator; }
 
-  boost::mt19937 m_mtseed;
-  boost::uuids::basic_random_generator<boost::mt19937>* m_randomGenerator;
-  boost::uuids::nil_generator m_nullGenerator;
+  // xoshiro256** (Blackman and Vigna).
+  std::uint64_t next()
+  {
+    const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+    const std::uint64_t tt = m_state[1] << 17;
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= tt;
+    m_state[3] = rotl(m_state[3], 45);
+    return result;
+  }
+
+  // Fill \a destination with \a count version-4 UUIDs.
+  void fill(UUID* destination, std::size_t count)
+  {
+    const auto& masks = versionMasks();
+    std::uint64_t words[2 * BlockSize];
+    while (count > 0)
+    {
+      std::size_t chunk = count < BlockSize ? count : BlockSize;
+      for (std::size_t ii = 0; ii < 2 * chunk; ++ii)
+      {
+        words[ii] = this->next();
+      }
+      // Stamp the version and variant bits on every UUID in the chunk with
+      // branch-free word operations the compiler can vectorize.
+      for (std::size_t ii = 0; ii < 2 * chunk; ii += 2)
+      {
+        words[ii] = (words[ii] & masks.m_keep[0]) | masks.m_set[0];
+        words[ii + 1] = (words[ii + 1] & masks.m_keep[1]) | masks.m_set[1];
+      }
+      for (std::size_t ii = 0; ii < chunk; ++ii)
+      {
+        std::memcpy(destination[ii].begin(), words + 2 * ii, UUID::SIZE);
+      }
+      destination += chunk;
+      count -= chunk;
+    }
+  }
+
+  std::uint64_t m_state[4];
+  UUID m_block[BlockSize];
+  std::size_t m_available = 0;
 };
 
 UUIDGenerator::UUIDGenerator()
@@ -75,13 +173,36 @@ UUIDGenerator::~UUIDGenerator()
 
 UUID UUIDGenerator::random()
 {
-  return UUID((*this->P->m_randomGenerator)());
+  if (this->P->m_available == 0)
+  {
+    this->P->fill(this->P->m_block, Internal::BlockSize);
+    this->P->m_available = Internal::BlockSize;
+  }
+  return this->P->m_block[--this->P->m_available];
 }
 
 /// Generate a nil UUID.
 UUID UUIDGenerator::null()
 {
-  return UUID(this->P->m_nullGenerator());
+  return UUID();
+}
+
+void UUIDGenerator::random(UUID* destination, std::size_t count)
+{
+  if (destination)
+  {
+    this->P->fill(destination, count);
+  }
+}
+
+UUIDArray UUIDGenerator::random(std::size_t count)
+{
+  UUIDArray result(count);
+  if (count > 0)
+  {
+    this->P->fill(result.data(), count);
+  }
+  return result;
 }
 
 static thread_local UUIDGenerator s_generator;
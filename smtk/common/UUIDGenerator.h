@@ -17,10 +17,21 @@ namespace smtk
 namespace common
 {
 
+/**\brief Generate random (RFC4122, version 4) and nil UUIDs.
+  *
+  * Each generator owns a small, fast pseudo-random number generator
+  * (xoshiro256**) seeded from the operating system's entropy source.
+  * A generator is not thread-safe; instead, instance() returns a
+  * generator private to the calling thread, so worker threads may
+  * create UUIDs concurrently without locking.
+  *
+  * UUIDs are produced in blocks: random() hands out UUIDs from a block
+  * refilled as needed, and the batch methods fill many UUIDs at once.
+  */
 class SMTKCORE_EXPORT UUIDGenerator
 {
 public:
-  /// Returns a static instance of a UUID Generator
+  /// Returns a thread-local instance of a UUID Generator
   static UUIDGenerator& instance();
 
   UUIDGenerator();
@@ -28,9 +39,22 @@ public:
   UUIDGenerator(const UUIDGenerator&) = delete;
   UUIDGenerator& operator=(const UUIDGenerator&) = delete;
 
+  /// Generate a single random UUID.
   UUID random();
+  /// Generate a nil UUID.
   UUID null();
 
+  ///@{
+  /**\brief Generate \a count random UUIDs at once.
+    *
+    * This is considerably faster than calling random() \a count times
+    * when creating many objects (e.g., graph nodes or attributes)
+    * whose UUIDs are known to be needed up front.
+    */
+  void random(UUID* destination, std::size_t count);
+  UUIDArray random(std::size_t count);
+  ///@}
+
 protected:
   class Internal;
   Internal* P;
@@ -12,6 +12,7 @@
 #define pybind_smtk_common_UUIDGenerator_h
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 #include "smtk/common/UUIDGenerator.h"
 
@@ -26,7 +27,8 @@ inline py::class_< smtk::common::UUIDGenerator > pybind11_init_smtk_common_UUIDG
   py::class_< smtk::common::UUIDGenerator > instance(m, "UUIDGenerator");
   instance
     .def(py::init<>())
-    .def("random", &smtk::common::UUIDGenerator::random)
+    .def("random", (smtk::common::UUID (smtk::common::UUIDGenerator::*)()) &smtk::common::UUIDGenerator::random)
+    .def("random", (smtk::common::UUIDArray (smtk::common::UUIDGenerator::*)(std::size_t)) &smtk::common::UUIDGenerator::random)
     .def("null", &smtk::common::UUIDGenerator::null)
     ;
   return instance;
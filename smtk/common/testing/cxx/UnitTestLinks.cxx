@@ -120,6 +120,25 @@ void UnitTest()
   smtkTest(links.contains<MyLinks::Right>(1) == false, "Should not have a right value of 1.");
   smtkTest(links.contains(7) == true, "Should  have an id value of 7.");
 
+  // Query links by (value, role) through the hashed indices.
+  {
+    smtkTest(links.size<MyLinks::Left>(3, 100) == 1, "Should have 1 link from 3 with role 100.");
+    smtkTest(links.size<MyLinks::Right>(5, 100) == 1, "Should have 1 link to 5 with role 100.");
+    smtkTest(links.size<MyLinks::Left>(3, 102) == 0, "Should have no links with role 102.");
+    std::vector<int> visitedIds;
+    auto visited = links.visit_links<MyLinks::Left>(
+      3, 101, [&visitedIds](const MyLinks::Link& link) { visitedIds.push_back(link.id); });
+    smtkTest(
+      visited == smtk::common::Visited::All && visitedIds.size() == 1 && visitedIds[0] == 1,
+      "Should visit link 1 from 3 with role 101.");
+    visited = links.visit_links<MyLinks::Right>(
+      5, 100, [](const MyLinks::Link&) { return smtk::common::Visit::Halt; });
+    smtkTest(visited == smtk::common::Visited::Some, "Visitation should halt early.");
+    visited = links.visit_links<MyLinks::Right>(
+      5, 102, [](const MyLinks::Link&) { return smtk::common::Visit::Continue; });
+    smtkTest(visited == smtk::common::Visited::Empty, "Should visit no links with role 102.");
+  }
+
   // Erase all links associated with a "right" value of 5
   bool erased = links.erase_all<MyLinks::Right>(5);
   smtkTest(erased && links.size() == 2, "Should have 2 links.");
@@ -296,6 +315,25 @@ void MoveOnlyTest()
   smtkTest(links.contains<MyLinks::Right>(1) == false, "Should not have a right value of 1.");
   smtkTest(links.contains(7) == true, "Should  have an id value of 7.");
 
+  // Query links by (value, role) through the hashed indices.
+  {
+    smtkTest(links.size<MyLinks::Left>(3, 100) == 1, "Should have 1 link from 3 with role 100.");
+    smtkTest(links.size<MyLinks::Right>(5, 100) == 1, "Should have 1 link to 5 with role 100.");
+    smtkTest(links.size<MyLinks::Left>(3, 102) == 0, "Should have no links with role 102.");
+    std::vector<int> visitedIds;
+    auto visited = links.visit_links<MyLinks::Left>(
+      3, 101, [&visitedIds](const MyLinks::Link& link) { visitedIds.push_back(link.id); });
+    smtkTest(
+      visited == smtk::common::Visited::All && visitedIds.size() == 1 && visitedIds[0] == 1,
+      "Should visit link 1 from 3 with role 101.");
+    visited = links.visit_links<MyLinks::Right>(
+      5, 100, [](const MyLinks::Link&) { return smtk::common::Visit::Halt; });
+    smtkTest(visited == smtk::common::Visited::Some, "Visitation should halt early.");
+    visited = links.visit_links<MyLinks::Right>(
+      5, 102, [](const MyLinks::Link&) { return smtk::common::Visit::Continue; });
+    smtkTest(visited == smtk::common::Visited::Empty, "Should visit no links with role 102.");
+  }
+
   // Erase all links associated with a "right" value of 5
   bool erased = links.erase_all<MyLinks::Right>(5);
   smtkTest(erased && links.size() == 2, "Should have 2 links.");
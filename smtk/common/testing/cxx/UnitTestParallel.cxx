@@ -0,0 +1,101 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Parallel.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using smtk::common::forEachChunk;
+using smtk::common::numberOfChunks;
+
+int UnitTestParallel(int /*unused*/, char** const /*unused*/)
+{
+  smtkTest(smtk::common::numberOfThreads() >= 1, "Expected at least one thread.");
+  smtkTest(numberOfChunks(0, 16) == 1, "An empty range should have one chunk.");
+  smtkTest(numberOfChunks(33, 16) == 3, "Expected 3 chunks.");
+
+  // Every entry is visited once, and chunk indices are dense.
+  {
+    const std::size_t size = 100003;
+    std::vector<int> visits(size, 0);
+    std::vector<std::size_t> sums(numberOfChunks(size, 1000), 0);
+    std::size_t chunks =
+      forEachChunk(size, 1000, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        for (std::size_t ii = begin; ii < end; ++ii)
+        {
+          ++visits[ii];
+          sums[chunk] += ii;
+        }
+      });
+    smtkTest(chunks == sums.size(), "Unexpected number of chunks " << chunks << ".");
+    smtkTest(
+      std::all_of(visits.begin(), visits.end(), [](int count) { return count == 1; }),
+      "Each entry should be visited once.");
+    smtkTest(
+      std::accumulate(sums.begin(), sums.end(), std::size_t(0)) == size * (size - 1) / 2,
+      "Unexpected sum.");
+  }
+
+  // Calls may be nested, and may be made from tasks on the shared pool,
+  // without waiting on work that cannot start.
+  {
+    std::atomic<std::size_t> count{ 0 };
+    auto nested = [&count]() {
+      forEachChunk(64, 1, [&count](std::size_t, std::size_t, std::size_t) {
+        forEachChunk(1000, 10, [&count](std::size_t, std::size_t begin, std::size_t end) {
+          count += end - begin;
+        });
+      });
+    };
+    std::vector<std::future<void>> futures;
+    for (unsigned int ii = 0; ii < 2 * smtk::common::numberOfThreads(); ++ii)
+    {
+      futures.push_back(smtk::common::sharedThreadPool()(nested));
+    }
+    nested();
+    for (auto& future : futures)
+    {
+      future.get();
+    }
+    smtkTest(
+      count == (2 * smtk::common::numberOfThreads() + 1) * 64 * 1000,
+      "Unexpected count " << count << ".");
+  }
+
+  // Exceptions thrown by a chunk are rethrown once all chunks are done.
+  {
+    std::atomic<std::size_t> count{ 0 };
+    bool caught = false;
+    try
+    {
+      forEachChunk(100, 1, [&count](std::size_t chunk, std::size_t, std::size_t) {
+        ++count;
+        if (chunk == 50)
+        {
+          throw std::runtime_error("chunk 50");
+        }
+      });
+    }
+    catch (const std::runtime_error&)
+    {
+      caught = true;
+    }
+    smtkTest(caught, "Expected an exception.");
+    smtkTest(count == 100, "All chunks should run, got " << count << ".");
+  }
+
+  return 0;
+}
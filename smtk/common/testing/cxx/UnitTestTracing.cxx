@@ -0,0 +1,168 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Observers.h"
+#include "smtk/common/Tracing.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using smtk::common::ScopedSpan;
+using smtk::common::Tracing;
+
+namespace
+{
+//SMTK_SCRATCH_DIR is defined by cmake
+std::string write_root = SMTK_SCRATCH_DIR;
+
+std::size_t countSpans(const std::vector<Tracing::Span>& spans, const char* name)
+{
+  std::size_t count = 0;
+  for (const auto& span : spans)
+  {
+    count += std::strcmp(span.name, name) == 0 ? 1 : 0;
+  }
+  return count;
+}
+
+void TestDisabled()
+{
+  Tracing::setEnabled(false);
+  Tracing::clear();
+  {
+    ScopedSpan span("disabled");
+    smtkTest(!span.active(), "Span should be inactive while tracing is disabled.");
+  }
+  smtkTest(Tracing::spans().empty(), "No spans should be recorded while tracing is disabled.");
+}
+
+void TestNesting()
+{
+  Tracing::setEnabled(true);
+  Tracing::clear();
+  {
+    ScopedSpan outer("outer", "test", "some \"detail\"");
+    ScopedSpan inner("inner", "test");
+  }
+  auto spans = Tracing::spans();
+  smtkTest(spans.size() == 2, "Expected 2 spans, got " << spans.size());
+  smtkTest(std::strcmp(spans[0].name, "outer") == 0, "Spans should be ordered by start time.");
+  smtkTest(std::strcmp(spans[0].detail, "some \"detail\"") == 0, "Detail was not recorded.");
+  smtkTest(spans[1].detail == nullptr, "Inner span should have no detail.");
+  smtkTest(
+    spans[1].start >= spans[0].start &&
+      spans[1].start + spans[1].duration <= spans[0].start + spans[0].duration,
+    "Inner span should be nested in outer span.");
+  smtkTest(spans[0].thread == spans[1].thread, "Spans should share a thread.");
+}
+
+void TestThreads()
+{
+  // Threads that record for the first time use the new capacity.
+  const std::size_t capacity = Tracing::capacity();
+  Tracing::setCapacity(64);
+  Tracing::setEnabled(true);
+  Tracing::clear();
+
+  const std::size_t numberOfThreads = 4;
+  std::vector<std::thread> threads;
+  for (std::size_t ii = 0; ii < numberOfThreads; ++ii)
+  {
+    threads.emplace_back([]() {
+      for (int jj = 0; jj < 1000; ++jj)
+      {
+        ScopedSpan span("worker");
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  Tracing::setCapacity(capacity);
+
+  // Each thread retains only its most recent spans.
+  auto spans = Tracing::spans();
+  smtkTest(
+    countSpans(spans, "worker") == numberOfThreads * 64,
+    "Expected " << numberOfThreads * 64 << " spans, got " << countSpans(spans, "worker"));
+}
+
+void TestObservers()
+{
+  Tracing::setEnabled(true);
+  Tracing::clear();
+
+  smtk::common::Observers<std::function<void()>> observers;
+  auto key = observers.insert([]() {}, "my observer");
+  observers();
+
+  auto spans = Tracing::spans();
+  smtkTest(countSpans(spans, "observer") == 1, "Expected the observer call to be recorded.");
+  smtkTest(
+    spans[0].detail && std::strcmp(spans[0].detail, "my observer") == 0,
+    "Observer span should be described by the observer's description.");
+}
+
+void TestExport()
+{
+  Tracing::setEnabled(true);
+  Tracing::clear();
+  {
+    ScopedSpan span("exported", "test", Tracing::intern("line\nbreak"));
+    ScopedSpan other("other", "test");
+  }
+  Tracing::setEnabled(false);
+
+  std::ostringstream chrome;
+  Tracing::writeChromeTrace(chrome);
+  smtkTest(chrome.str().find("\"traceEvents\":[") != std::string::npos, "Missing trace events.");
+  smtkTest(chrome.str().find("\"name\":\"exported\"") != std::string::npos, "Missing span.");
+  smtkTest(chrome.str().find("line\\nbreak") != std::string::npos, "Detail was not escaped.");
+
+  const std::string filename = write_root + "/UnitTestTracing.trace";
+  smtkTest(Tracing::writeBinary(filename), "Could not write binary trace.");
+  std::vector<Tracing::Span> read;
+  smtkTest(Tracing::readBinary(filename, read), "Could not read binary trace.");
+  std::remove(filename.c_str());
+
+  auto spans = Tracing::spans();
+  smtkTest(read.size() == spans.size(), "Expected " << spans.size() << " spans, read " << read.size());
+  for (std::size_t ii = 0; ii < spans.size(); ++ii)
+  {
+    smtkTest(std::strcmp(read[ii].name, spans[ii].name) == 0, "Name mismatch.");
+    smtkTest(std::strcmp(read[ii].category, spans[ii].category) == 0, "Category mismatch.");
+    smtkTest(
+      (read[ii].detail == nullptr) == (spans[ii].detail == nullptr) &&
+        (!read[ii].detail || std::strcmp(read[ii].detail, spans[ii].detail) == 0),
+      "Detail mismatch.");
+    smtkTest(
+      read[ii].start == spans[ii].start && read[ii].duration == spans[ii].duration &&
+        read[ii].thread == spans[ii].thread,
+      "Timing mismatch.");
+  }
+}
+} // namespace
+
+int UnitTestTracing(int /*unused*/, char** const /*unused*/)
+{
+  TestDisabled();
+  TestNesting();
+  TestThreads();
+  TestObservers();
+  TestExport();
+  Tracing::setEnabled(false);
+  return 0;
+}
@@ -0,0 +1,78 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/UUID.h"
+#include "smtk/common/UUIDContainers.h"
+#include "smtk/common/UUIDGenerator.h"
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+using smtk::common::UUID;
+using smtk::common::UUIDFlatSet;
+using smtk::common::UUIDHashMap;
+
+int UnitTestUUIDContainers(int /*unused*/, char** const /*unused*/)
+{
+  // Word-wise ordering must match byte-wise (lexicographic) ordering.
+  std::vector<std::string> ordered{ "00000000-0000-0000-0000-000000000000",
+                                    "00000000-0000-0000-0000-0000000000ff",
+                                    "00000000-0000-0000-0100-000000000000",
+                                    "00000000-0000-0001-0000-000000000000",
+                                    "0000000f-0000-0000-ffff-ffffffffffff",
+                                    "ff000000-0000-0000-0000-000000000000" };
+  for (std::size_t ii = 0; ii + 1 < ordered.size(); ++ii)
+  {
+    UUID aa(ordered[ii]);
+    UUID bb(ordered[ii + 1]);
+    smtkTest(aa < bb && !(bb < aa), "Expected " << aa << " < " << bb << ".");
+    smtkTest(aa != bb && !(aa == bb), "Expected " << aa << " != " << bb << ".");
+    smtkTest(
+      std::lexicographical_compare(aa.begin(), aa.end(), bb.begin(), bb.end()),
+      "Ordering disagrees with byte-wise comparison.");
+  }
+  UUID copy(ordered[4]);
+  test(copy == UUID(ordered[4]) && !(copy < UUID(ordered[4])), "Equal UUIDs compare unequal.");
+  test(copy.hash() == UUID(ordered[4]).hash(), "Equal UUIDs must hash equally.");
+  test(
+    std::hash<UUID>()(copy) == copy.hash(), "std::hash<UUID> should match UUID::hash().");
+
+  // The flat set behaves like (and iterates in the same order as) std::set<UUID>.
+  auto ids = smtk::common::UUIDGenerator::instance().random(500);
+  std::set<UUID> reference(ids.begin(), ids.begin() + 250);
+  UUIDFlatSet flat(ids.begin(), ids.begin() + 250);
+  test(flat.size() == 250, "Range construction produced the wrong size.");
+  test(!flat.insert(ids[0]).second, "Duplicate insertion should fail.");
+  test(flat.insert(ids[300]).second, "Insertion should succeed.");
+  reference.insert(ids[300]);
+  flat.insert(ids.begin() + 200, ids.end()); // overlaps existing entries
+  reference.insert(ids.begin() + 200, ids.end());
+  test(flat.erase(ids[10]) == 1 && flat.erase(ids[10]) == 0, "Unexpected erase result.");
+  reference.erase(ids[10]);
+  test(
+    std::equal(flat.begin(), flat.end(), reference.begin(), reference.end()),
+    "Flat set does not match std::set.");
+  test(flat.contains(ids[20]) && !flat.contains(ids[10]), "Unexpected membership.");
+  test(flat.find(UUID::null()) == flat.end(), "Found an entry that was never inserted.");
+
+  // The hash map is a drop-in replacement for std::unordered_map<UUID, T>.
+  UUIDHashMap<int> map;
+  for (std::size_t ii = 0; ii < ids.size(); ++ii)
+  {
+    map[ids[ii]] = static_cast<int>(ii);
+  }
+  std::unordered_map<UUID, int>& plain(map);
+  test(plain.size() == ids.size() && plain[ids[42]] == 42, "Unexpected hash map contents.");
+
+  return 0;
+}
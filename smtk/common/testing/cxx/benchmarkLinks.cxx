@@ -0,0 +1,152 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Links.h"
+#include "smtk/common/UUID.h"
+#include "smtk/common/UUIDGenerator.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tuple>
+
+using namespace smtk::common;
+
+namespace
+{
+
+struct Empty
+{
+  virtual ~Empty() = default;
+};
+
+// Links shaped like resource links: UUID ids and endpoints, integer roles.
+typedef Links<UUID, UUID, UUID, int, Empty> UUIDLinks;
+
+class Timer
+{
+public:
+  void mark() { m_start = std::chrono::steady_clock::now(); }
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+protected:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+void report(const std::string& label, std::size_t count, double seconds, std::size_t checksum)
+{
+  std::cout << "  " << label << ": " << seconds << " seconds, " << (count / seconds)
+            << " queries/sec (" << checksum << " links)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  // An association-heavy workload: many sources, each linked to a few
+  // targets in each of several roles.
+  std::size_t sources = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 100000;
+  const int roles = 4;
+  const std::size_t perRole = 3;
+
+  UUIDArray lefts = UUIDGenerator::instance().random(sources);
+  UUIDArray rights = UUIDGenerator::instance().random(sources);
+  UUIDArray ids = UUIDGenerator::instance().random(sources * roles * perRole);
+
+  UUIDLinks links;
+  Timer timer;
+  timer.mark();
+  std::size_t next = 0;
+  for (std::size_t ii = 0; ii < sources; ++ii)
+  {
+    for (int role = 0; role < roles; ++role)
+    {
+      for (std::size_t jj = 0; jj < perRole; ++jj)
+      {
+        links.insert(ids[next++], lefts[ii], rights[(ii + jj * 7919) % sources], role);
+      }
+    }
+  }
+  std::cout << "Insertion\n";
+  report("insert", links.size(), timer.elapsed(), links.size());
+
+  const int role = roles / 2;
+  std::size_t checksum;
+
+  std::cout << "Links from each source with one role\n";
+  checksum = 0;
+  timer.mark();
+  for (const auto& left : lefts)
+  {
+    // The ordered (left, role) index; the only option before hashed indices.
+    auto range = links.get<UUIDLinks::Left>().equal_range(std::make_tuple(left, role));
+    checksum += static_cast<std::size_t>(std::distance(range.first, range.second));
+  }
+  report("ordered equal_range", sources, timer.elapsed(), checksum);
+
+  checksum = 0;
+  timer.mark();
+  for (const auto& left : lefts)
+  {
+    checksum += links.linked_to<UUIDLinks::Left>(left, role).size();
+  }
+  report("linked_to (set)", sources, timer.elapsed(), checksum);
+
+  checksum = 0;
+  timer.mark();
+  for (const auto& left : lefts)
+  {
+    links.visit_links<UUIDLinks::Left>(left, role, [&checksum](const UUIDLinks::Link&) {
+      ++checksum;
+    });
+  }
+  report("visit_links", sources, timer.elapsed(), checksum);
+
+  checksum = 0;
+  timer.mark();
+  for (const auto& left : lefts)
+  {
+    checksum += links.size<UUIDLinks::Left>(left, role);
+  }
+  report("size(value, role)", sources, timer.elapsed(), checksum);
+
+  std::cout << "Existence test (stop at first link)\n";
+  checksum = 0;
+  timer.mark();
+  for (const auto& right : rights)
+  {
+    checksum += links.linked_to<UUIDLinks::Right>(right, role).empty() ? 0 : 1;
+  }
+  report("linked_to (set)", sources, timer.elapsed(), checksum);
+
+  checksum = 0;
+  timer.mark();
+  for (const auto& right : rights)
+  {
+    links.visit_links<UUIDLinks::Right>(right, role, [&checksum](const UUIDLinks::Link&) {
+      ++checksum;
+      return Visit::Halt;
+    });
+  }
+  report("visit_links (halt)", sources, timer.elapsed(), checksum);
+
+  std::cout << "Removal of all links from each source with one role\n";
+  timer.mark();
+  for (const auto& left : lefts)
+  {
+    links.erase_all<UUIDLinks::Left>(std::make_tuple(left, role));
+  }
+  report("erase_all", sources, timer.elapsed(), links.size());
+
+  return 0;
+}
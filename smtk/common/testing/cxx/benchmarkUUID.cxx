@@ -0,0 +1,160 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/UUID.h"
+#include "smtk/common/UUIDContainers.h"
+#include "smtk/common/UUIDGenerator.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace smtk::common;
+
+namespace
+{
+
+// The hash std::hash<UUID> used previously: the last 8 bytes of the UUID.
+struct TrailingBytesHash
+{
+  std::size_t operator()(const UUID& uid) const
+  {
+    std::size_t hash;
+    std::memcpy(&hash, uid.begin() + UUID::size() - sizeof(hash), sizeof(hash));
+    return hash;
+  }
+};
+
+// Byte-wise comparison, as boost::uuids::uuid performs it.
+struct BytewiseLess
+{
+  bool operator()(const UUID& aa, const UUID& bb) const
+  {
+    return std::memcmp(aa.begin(), bb.begin(), UUID::size()) < 0;
+  }
+};
+
+class Timer
+{
+public:
+  void mark() { m_start = std::chrono::steady_clock::now(); }
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+protected:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+void report(const std::string& label, std::size_t count, double seconds)
+{
+  std::cout << "  " << label << ": " << seconds << " seconds, " << (count / seconds)
+            << " ops/sec\n";
+}
+
+// Time lookups (hits, then misses) in an associative container.
+template<typename Container>
+void benchmarkLookup(const Container& container, const UUIDArray& keys, const UUIDArray& misses)
+{
+  Timer timer;
+  std::size_t found = 0;
+  timer.mark();
+  for (const auto& key : keys)
+  {
+    found += container.count(key);
+  }
+  report("hits", keys.size(), timer.elapsed());
+
+  timer.mark();
+  for (const auto& key : misses)
+  {
+    found += container.count(key);
+  }
+  report("misses", misses.size(), timer.elapsed());
+  if (found != keys.size())
+  {
+    std::cerr << "  ERROR: found " << found << " of " << keys.size() << " keys.\n";
+  }
+}
+
+// Time insertion (one key at a time) and lookup in an associative container.
+template<typename Container>
+void benchmarkContainer(const std::string& label, const UUIDArray& keys, const UUIDArray& misses)
+{
+  Timer timer;
+  Container container;
+  std::cout << label << "\n";
+  timer.mark();
+  for (const auto& key : keys)
+  {
+    container.insert(key);
+  }
+  report("insert", keys.size(), timer.elapsed());
+  benchmarkLookup(container, keys, misses);
+}
+
+// Adapt maps to the insert(key) interface used above.
+template<typename Map>
+struct MapAsSet : Map
+{
+  void insert(const UUID& key) { (*this)[key] = 0; }
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t count = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 1000000;
+  Timer timer;
+
+  // ### UUID generation ###
+  std::cout << "Generation\n";
+  timer.mark();
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    (void)UUID::random();
+  }
+  report("UUID::random()", count, timer.elapsed());
+  timer.mark();
+  UUIDArray keys = UUIDGenerator::instance().random(count);
+  report("UUIDGenerator::random(count)", count, timer.elapsed());
+  UUIDArray misses = UUIDGenerator::instance().random(count);
+
+  // ### Sets (before and after) ###
+  benchmarkContainer<std::set<UUID, BytewiseLess>>("std::set (byte-wise less)", keys, misses);
+  benchmarkContainer<std::set<UUID>>("std::set (word-wise less)", keys, misses);
+  {
+    // Inserting keys one at a time is quadratic; flat sets are built in bulk.
+    std::cout << "UUIDFlatSet\n";
+    timer.mark();
+    UUIDFlatSet flat(keys.begin(), keys.end());
+    report("insert (range)", keys.size(), timer.elapsed());
+    benchmarkLookup(flat, keys, misses);
+  }
+  benchmarkContainer<std::unordered_set<UUID, TrailingBytesHash>>(
+    "std::unordered_set (trailing-bytes hash)", keys, misses);
+  benchmarkContainer<UUIDHashSet>("UUIDHashSet (mixed hash)", keys, misses);
+
+  // ### Maps (before and after) ###
+  benchmarkContainer<MapAsSet<std::map<UUID, int, BytewiseLess>>>(
+    "std::map (byte-wise less)", keys, misses);
+  benchmarkContainer<MapAsSet<std::map<UUID, int>>>("std::map (word-wise less)", keys, misses);
+  benchmarkContainer<MapAsSet<std::unordered_map<UUID, int, TrailingBytesHash>>>(
+    "std::unordered_map (trailing-bytes hash)", keys, misses);
+  benchmarkContainer<MapAsSet<UUIDHashMap<int>>>("UUIDHashMap (mixed hash)", keys, misses);
+
+  return 0;
+}
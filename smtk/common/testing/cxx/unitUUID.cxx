@@ -8,13 +8,28 @@
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDGenerator.h"
 
 #include "smtk/common/testing/cxx/helpers.h"
 
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
 
 using smtk::common::UUID;
+using smtk::common::UUIDArray;
+using smtk::common::UUIDGenerator;
+
+namespace
+{
+// Return true if \a uid is an RFC4122 version-4 UUID.
+bool isVersion4(const UUID& uid)
+{
+  const auto* bytes = uid.begin();
+  return (bytes[6] & 0xf0) == 0x40 && (bytes[8] & 0xc0) == 0x80;
+}
+} // namespace
 
 int main(int argc, char* argv[])
 {
@@ -71,5 +86,30 @@ int main(int argc, char* argv[])
   test(!f, "Cast of null UUID to boolean should be false");
   test(b, "Cast of non-null UUID to boolean should be true");
 
+  // Batch generation produces distinct version-4 UUIDs.
+  std::unordered_set<UUID> seen;
+  UUIDArray batch = UUIDGenerator::instance().random(1000);
+  test(batch.size() == 1000, "Batch generation produced the wrong number of UUIDs");
+  for (const auto& uid : batch)
+  {
+    test(isVersion4(uid), "Batch-generated UUID is not version 4");
+    test(seen.insert(uid).second, "Batch-generated UUIDs must be unique");
+  }
+  for (int ii = 0; ii < 100; ++ii)
+  {
+    UUID uid = UUID::random();
+    test(isVersion4(uid), "Random UUID is not version 4");
+    test(seen.insert(uid).second, "Random UUIDs must be unique");
+  }
+
+  // Each thread has its own generator; their sequences must not overlap.
+  UUIDArray fromThread;
+  std::thread worker([&fromThread]() { fromThread = UUIDGenerator::instance().random(1000); });
+  worker.join();
+  for (const auto& uid : fromThread)
+  {
+    test(seen.insert(uid).second, "UUIDs generated on different threads must be unique");
+  }
+
   return 0;
 }
@@ -781,10 +781,32 @@ void GeometricVisibilityBadge::updateObserver(
     return; // the phrase doesn't exist in the cache
   }
 
-  if (event == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE)
+  // Collect the rows of children about to be removed or just inserted.
+  std::vector<int> rows;
+  if (
+    event == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE ||
+    event == smtk::view::PhraseModelEvent::INSERT_FINISHED)
   {
-    std::size_t deltaVis = 0, deltaInvis = 0, deltaNeither = 0;
     for (int i = range[0]; i <= range[1]; i++)
+    {
+      rows.push_back(i);
+    }
+  }
+  else if (event == smtk::view::PhraseModelEvent::ABOUT_TO_UPDATE)
+  {
+    rows = smtk::view::PhraseModelDelta::decode(range).removed;
+  }
+  else if (event == smtk::view::PhraseModelEvent::UPDATE_FINISHED)
+  {
+    rows = smtk::view::PhraseModelDelta::decode(range).inserted;
+  }
+
+  if (
+    event == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE ||
+    event == smtk::view::PhraseModelEvent::ABOUT_TO_UPDATE)
+  {
+    std::size_t deltaVis = 0, deltaInvis = 0, deltaNeither = 0;
+    for (int i : rows)
     {
       auto* childPhrase = phrase->subphrases()[i].get();
       auto childIt = phraseInfos.find(childPhrase);
@@ -811,9 +833,11 @@ void GeometricVisibilityBadge::updateObserver(
     pcache.updateForRemoval(phrase.get(), deltaVis, deltaInvis, deltaNeither);
     return;
   }
-  if (event == smtk::view::PhraseModelEvent::INSERT_FINISHED)
+  if (
+    event == smtk::view::PhraseModelEvent::INSERT_FINISHED ||
+    event == smtk::view::PhraseModelEvent::UPDATE_FINISHED)
   {
-    for (int i = range[0]; i <= range[1]; i++)
+    for (int i : rows)
     {
       auto* childPhrase = phrase->subphrases()[i].get();
       pcache.insertNewPhrase(childPhrase);
@@ -177,7 +177,7 @@ void vtkSMTKEncodeSelection::ProcessRawSelection(
     // Manually notify observers that the selection has changed.
     // We do this here so that a single ParaView selection does
     // not generate many SMTK selection events.
-    smtkSelection->observers()(selnSource, smtkSelection);
+    smtkSelection->notifyObservers(selnSource);
   }
 #ifdef SMTK_DEBUG_SELECTION
   std::cout << "-- paraview selection (o)***\n";
@@ -0,0 +1,168 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/extension/paraview/server/vtkSMTKResourceRepresentation.h"
+#include "smtk/extension/paraview/server/vtkSMTKWrapper.h"
+#include "smtk/extension/vtk/source/vtkResourceMultiBlockSource.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/view/Selection.h"
+
+#include <vtkCompositeDataDisplayAttributes.h>
+#include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPolyData.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+class Timer
+{
+public:
+  void mark() { m_start = std::chrono::steady_clock::now(); }
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+protected:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+// Expose the steps a render request takes to update selection highlighting
+// so that they may be run without a view or render window.
+class vtkHeadlessResourceRepresentation : public vtkSMTKResourceRepresentation
+{
+public:
+  static vtkHeadlessResourceRepresentation* New();
+  vtkTypeMacro(vtkHeadlessResourceRepresentation, vtkSMTKResourceRepresentation);
+
+  void UpdateHighlighting(vtkMultiBlockDataSet* components)
+  {
+    this->UpdateRenderableData(components, nullptr);
+    this->UpdateDisplayAttributesFromSelection(components, nullptr);
+  }
+};
+vtkStandardNewMacro(vtkHeadlessResourceRepresentation);
+
+using Objects = std::vector<smtk::resource::PersistentObjectPtr>;
+
+bool isHighlighted(vtkHeadlessResourceRepresentation* representation, vtkDataObject* block)
+{
+  auto* attributes = representation->GetSelectedEntityMapperDisplayAttributes();
+  return attributes->HasBlockVisibility(block) && attributes->GetBlockVisibility(block);
+}
+
+bool benchmark(std::size_t numberOfBlocks, int repetitions)
+{
+  // One attribute per block stands in for the components of a resource.
+  auto resource = smtk::attribute::Resource::create();
+  auto definition = resource->createDefinition("block");
+  Objects objects;
+  objects.reserve(numberOfBlocks);
+  vtkNew<vtkMultiBlockDataSet> components;
+  components->SetNumberOfBlocks(static_cast<unsigned int>(numberOfBlocks));
+  for (std::size_t ii = 0; ii < numberOfBlocks; ++ii)
+  {
+    auto attribute = resource->createAttribute(definition);
+    objects.push_back(attribute);
+    vtkNew<vtkPolyData> block;
+    components->SetBlock(static_cast<unsigned int>(ii), block);
+    vtkResourceMultiBlockSource::SetDataObjectUUID(
+      components->GetMetaData(static_cast<unsigned int>(ii)), attribute->id());
+  }
+
+  vtkNew<vtkSMTKWrapper> wrapper;
+  auto selection = smtk::view::Selection::create();
+  wrapper->GetManagersPtr()->insert_or_assign(selection);
+
+  vtkNew<vtkHeadlessResourceRepresentation> representation;
+  representation->SetResource(resource);
+  representation->SetWrapper(wrapper);
+
+  // Half of the blocks start out selected.
+  const std::string source = "benchmark";
+  selection->modifySelection(
+    Objects(objects.begin(), objects.begin() + numberOfBlocks / 2),
+    source,
+    1,
+    smtk::view::SelectionAction::UNFILTERED_REPLACE);
+
+  Timer timer;
+  timer.mark();
+  representation->UpdateHighlighting(components);
+  const double fullTime = timer.elapsed();
+
+  // Toggle a single unselected block.
+  const std::size_t index = numberOfBlocks - 1;
+  Objects toggled = { objects[index] };
+  vtkDataObject* block = components->GetBlock(static_cast<unsigned int>(index));
+  double selectTime = 0.;
+  double deselectTime = 0.;
+  for (int ii = 0; ii < repetitions; ++ii)
+  {
+    timer.mark();
+    selection->modifySelection(toggled, source, 1, smtk::view::SelectionAction::UNFILTERED_ADD);
+    representation->UpdateHighlighting(components);
+    selectTime += timer.elapsed();
+    if (!isHighlighted(representation, block))
+    {
+      std::cerr << "Selected block is not highlighted.\n";
+      return false;
+    }
+
+    timer.mark();
+    selection->modifySelection(
+      toggled, source, 1, smtk::view::SelectionAction::UNFILTERED_SUBTRACT);
+    representation->UpdateHighlighting(components);
+    deselectTime += timer.elapsed();
+    if (isHighlighted(representation, block))
+    {
+      std::cerr << "Deselected block is still highlighted.\n";
+      return false;
+    }
+  }
+
+  std::cout << numberOfBlocks << " blocks: full update " << fullTime * 1.e3 << " ms, select "
+            << selectTime / repetitions * 1.e3 << " ms, deselect "
+            << deselectTime / repetitions * 1.e3 << " ms\n";
+
+  representation->SetWrapper(nullptr);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  int repetitions = argc > 1 ? std::atoi(argv[1]) : 100;
+  if (repetitions < 1)
+  {
+    repetitions = 1;
+  }
+
+  for (std::size_t numberOfBlocks : { 100, 1000, 10000, 100000 })
+  {
+    if (!benchmark(numberOfBlocks, repetitions))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
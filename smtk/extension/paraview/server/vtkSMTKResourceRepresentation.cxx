@@ -69,6 +69,8 @@
 #include "smtk/view/Selection.h"
 
 #include <type_traits>
+#include <unordered_set>
+#include <utility>
 
 namespace
 {
@@ -204,6 +206,52 @@ void AddRenderables(
   mbit->Delete();
 }
 
+// Insert the objects whose geometry should be highlighted when object is
+// selected into footprint.
+void GetSelectionFootprint(
+  const smtk::resource::PersistentObjectPtr& object,
+  std::unordered_set<smtk::resource::PersistentObject*>& footprint)
+{
+  // If the selected item is a resource, ask for its footprint directly.
+  auto resource = std::dynamic_pointer_cast<smtk::resource::Resource>(object);
+  if (resource)
+  {
+    if (resource->queries().contains<smtk::geometry::SelectionFootprint>())
+    {
+      auto& query = resource->queries().get<smtk::geometry::SelectionFootprint>();
+      query(*resource, footprint, smtk::extension::vtk::geometry::Backend());
+    }
+    else
+    {
+      // resource has no footprint query. Try inserting the resource itself.
+      footprint.insert(resource.get());
+    }
+  }
+
+  // If the selected item is a component, ask its resource for the footprint.
+  auto component = std::dynamic_pointer_cast<smtk::resource::Component>(object);
+  if (component && component->resource())
+  {
+    if (component->resource()->queries().contains<smtk::geometry::SelectionFootprint>())
+    {
+      auto& query = component->resource()->queries().get<smtk::geometry::SelectionFootprint>();
+      query(*component, footprint, smtk::extension::vtk::geometry::Backend());
+    }
+    else
+    {
+      // component has no footprint query. Try inserting the component itself.
+      footprint.insert(component.get());
+    }
+  }
+}
+
+// Instanced model entities are rendered by the glyph mappers.
+bool IsGlyphed(smtk::resource::PersistentObject* object)
+{
+  auto entity = object->as<smtk::model::Entity>();
+  return entity && entity->isInstance();
+}
+
 // The API of vtkPVRenderView has changed. Report whether the API is
 // new (value == true) or old (value == false) in a struct:
 template<typename RenderView>
@@ -604,20 +652,32 @@ bool vtkSMTKResourceRepresentation::SetEntityVisibility(
     if (dataIt != this->RenderableData.end())
     {
       // Tell both the entity and glyph mappers that, should they encounter the data object,
-      // use the provided visibility.
+      // use the provided visibility. Highlighted blocks are rendered by the selection mappers.
+      auto count = this->FootprintCounts.find(csit->first);
+      bool selected = count != this->FootprintCounts.end() && count->second > 0;
       this->EntityMapper->GetCompositeDataDisplayAttributes()->SetBlockVisibility(
-        dataIt->second, !!csit->second.m_visibility);
+        dataIt->second, visible && !selected);
       this->SelectedEntityMapper->GetCompositeDataDisplayAttributes()->SetBlockVisibility(
-        dataIt->second, !csit->second.m_visibility);
+        dataIt->second, visible && selected);
       this->GlyphMapper->GetBlockAttributes()->SetBlockVisibility(
-        dataIt->second, !!csit->second.m_visibility);
+        dataIt->second, visible && !selected);
       this->SelectedGlyphMapper->GetBlockAttributes()->SetBlockVisibility(
-        dataIt->second, !csit->second.m_visibility);
+        dataIt->second, visible && selected);
+      if (selected)
+      {
+        // The block may have been hidden when it was highlighted.
+        this->SelectedEntityMapper->GetCompositeDataDisplayAttributes()->SetBlockColor(
+          dataIt->second, this->SelectionColor);
+        this->SelectedGlyphMapper->GetBlockAttributes()->SetBlockColor(
+          dataIt->second, this->SelectionColor);
+      }
       // Mark the mappers as modified or the new visibility info will not be updated:
       this->EntityMapper->Modified();
       this->GlyphMapper->Modified();
+      this->SelectedEntityMapper->Modified();
+      this->SelectedGlyphMapper->Modified();
       // mark the selection modified, so UpdateDisplayAttributesFromSelection will fix
-      // the selection visibility
+      // the selection visibility when a custom style is in use
       this->SelectionModified();
     }
   }
@@ -664,38 +724,8 @@ bool vtkSMTKResourceRepresentation::ApplyDefaultStyle(
       continue;
     }
 
-    // If the selected item is a resource, ask for its footprint directly.
     std::unordered_set<smtk::resource::PersistentObject*> footprint;
-    auto resource = std::dynamic_pointer_cast<smtk::resource::Resource>(item.first);
-    if (resource)
-    {
-      if (resource->queries().contains<smtk::geometry::SelectionFootprint>())
-      {
-        auto& query = resource->queries().get<smtk::geometry::SelectionFootprint>();
-        query(*resource, footprint, smtk::extension::vtk::geometry::Backend());
-      }
-      else
-      {
-        // resource has no footprint query. Try inserting the resource itself.
-        footprint.insert(resource.get());
-      }
-    }
-
-    // If the selected item is a component, ask its resource for the footprint.
-    auto component = std::dynamic_pointer_cast<smtk::resource::Component>(item.first);
-    if (component && component->resource())
-    {
-      if (component->resource()->queries().contains<smtk::geometry::SelectionFootprint>())
-      {
-        auto& query = component->resource()->queries().get<smtk::geometry::SelectionFootprint>();
-        query(*component, footprint, smtk::extension::vtk::geometry::Backend());
-      }
-      else
-      {
-        // component has no footprint query. Try inserting the component itself.
-        footprint.insert(component.get());
-      }
-    }
+    GetSelectionFootprint(item.first, footprint);
 
     for (const auto& obj : footprint)
     {
@@ -718,8 +748,7 @@ bool vtkSMTKResourceRepresentation::SelectComponentFootprint(
   }
 
   // Determine the actor-pair we are dealing with (normal or instanced):
-  auto entity = item->as<smtk::model::Entity>();
-  bool isGlyphed = entity && entity->isInstance();
+  bool isGlyphed = IsGlyphed(item);
 
   // Determine if the user has hidden the entity
   const auto& smap = this->GetComponentState();
@@ -833,8 +862,7 @@ void vtkSMTKResourceRepresentation::UpdateRenderableData(
 {
   if (
     (resourceData && resourceData->GetMTime() > this->RenderableTime) ||
-    (instanceData && instanceData->GetMTime() > this->RenderableTime) ||
-    (this->SelectionTime > this->RenderableTime))
+    (instanceData && instanceData->GetMTime() > this->RenderableTime))
   {
     this->RenderableData.clear();
     AddRenderables(instanceData, this->RenderableData);
@@ -868,14 +896,26 @@ void vtkSMTKResourceRepresentation::UpdateDisplayAttributesFromSelection(
     return;
   }
 
-  if (
-    resourceData->GetMTime() < this->ApplyStyleTime &&
-    (!instanceData || instanceData->GetMTime() < this->ApplyStyleTime) &&
-    this->RenderableTime < this->ApplyStyleTime && this->SelectionTime < this->ApplyStyleTime)
+  bool dataModified = resourceData->GetMTime() > this->ApplyStyleTime ||
+    (instanceData && instanceData->GetMTime() > this->ApplyStyleTime) ||
+    this->RenderableTime > this->ApplyStyleTime;
+  if (!dataModified && this->SelectionTime < this->ApplyStyleTime)
   {
     return;
   }
 
+  // Custom styles are passed the entire selection, so only the default
+  // style can be applied to just the objects whose selection changed.
+  auto resource = this->GetResource();
+  vtkSMTKRepresentationStyleGenerator generator;
+  bool defaultStyle = resource && !generator(resource);
+  if (defaultStyle && !dataModified && !this->SelectionResetRequired)
+  {
+    this->UpdateDisplayAttributesFromSelectionDelta();
+    this->ApplyStyleTime.Modified();
+    return;
+  }
+
   // We are about to manually set block visibilities for the selection,
   // so reset what's there now to reflect nothing being selected (i.e.,
   // only blocks hidden by user should have visibility entries and those
@@ -908,10 +948,30 @@ void vtkSMTKResourceRepresentation::UpdateDisplayAttributesFromSelection(
     // it will always be false (no selection being processed yet).
   }
 
-  // Finally, ask our "style" functor to update selection visibility/color info
-  // on the mappers by calling SetSelectedState() on entries in this->RenderableData.
-  bool atLeastOneSelected = this->ApplyStyle(sm, this->RenderableData, this);
-  (void)atLeastOneSelected;
+  // Finally, update selection visibility/color info on the mappers by calling
+  // SetSelectedState() on entries in this->RenderableData. The default style
+  // records the footprint of each selected object so that later selection
+  // changes can be applied incrementally; custom "style" functors are asked
+  // to restyle the entire selection.
+  this->PendingSelection.clear();
+  this->SelectedFootprints.clear();
+  this->FootprintCounts.clear();
+  if (defaultStyle)
+  {
+    for (const auto& item : sm->currentSelection())
+    {
+      if (item.second > 0)
+      {
+        this->HighlightSelectedFootprint(item.first);
+      }
+    }
+    this->SelectionResetRequired = false;
+  }
+  else
+  {
+    this->ApplyStyle(sm, this->RenderableData, this);
+    this->SelectionResetRequired = true;
+  }
 
   // This is necessary to force an update in the mapper
   this->Entities->GetMapper()->Modified();
@@ -922,6 +982,132 @@ void vtkSMTKResourceRepresentation::UpdateDisplayAttributesFromSelection(
   this->ApplyStyleTime.Modified();
 }
 
+void vtkSMTKResourceRepresentation::HighlightSelectedFootprint(
+  const smtk::resource::PersistentObjectPtr& object)
+{
+  if (!object)
+  {
+    return;
+  }
+  std::unordered_set<smtk::resource::PersistentObject*> footprint;
+  GetSelectionFootprint(object, footprint);
+  std::vector<SelectedRenderable> highlighted;
+  for (const auto& item : footprint)
+  {
+    if (!item || this->RenderableData.find(item->id()) == this->RenderableData.end())
+    {
+      continue;
+    }
+    highlighted.push_back({ item->id(), IsGlyphed(item) });
+    // Only the first selected object to include a renderable needs to style it.
+    if (++this->FootprintCounts[item->id()] == 1)
+    {
+      this->SelectComponentFootprint(item, /*selnBit TODO*/ 1, this->RenderableData);
+    }
+  }
+  // Objects with nothing to highlight here (such as those owned by other
+  // resources) are not tracked.
+  if (!highlighted.empty())
+  {
+    this->SelectedFootprints[object->id()] = std::move(highlighted);
+  }
+}
+
+void vtkSMTKResourceRepresentation::UpdateDisplayAttributesFromSelectionDelta()
+{
+  if (this->PendingSelection.empty())
+  {
+    return;
+  }
+
+  // Remember whether each renderable in the footprint of a changed object was
+  // highlighted before the changes, so that only blocks whose state differs
+  // afterward are restyled.
+  smtk::common::UUIDHashMap<bool> wasSelected;
+  std::vector<SelectedRenderable> touched;
+
+  for (const auto& entry : this->PendingSelection)
+  {
+    auto previous = this->SelectedFootprints.find(entry.first);
+    if (previous != this->SelectedFootprints.end())
+    {
+      for (const auto& renderable : previous->second)
+      {
+        auto count = this->FootprintCounts.find(renderable.Id);
+        bool selected = count != this->FootprintCounts.end() && count->second > 0;
+        if (wasSelected.emplace(renderable.Id, selected).second)
+        {
+          touched.push_back(renderable);
+        }
+        if (selected && --count->second == 0)
+        {
+          this->FootprintCounts.erase(count);
+        }
+      }
+      this->SelectedFootprints.erase(previous);
+    }
+
+    auto object = entry.second.Object.lock();
+    if (!entry.second.Selected || !object)
+    {
+      continue;
+    }
+    std::unordered_set<smtk::resource::PersistentObject*> footprint;
+    GetSelectionFootprint(object, footprint);
+    std::vector<SelectedRenderable> highlighted;
+    for (const auto& item : footprint)
+    {
+      if (!item || this->RenderableData.find(item->id()) == this->RenderableData.end())
+      {
+        continue;
+      }
+      SelectedRenderable renderable{ item->id(), IsGlyphed(item) };
+      int& count = this->FootprintCounts[renderable.Id];
+      if (wasSelected.emplace(renderable.Id, count > 0).second)
+      {
+        touched.push_back(renderable);
+      }
+      ++count;
+      highlighted.push_back(renderable);
+    }
+    if (!highlighted.empty())
+    {
+      this->SelectedFootprints[entry.first] = std::move(highlighted);
+    }
+  }
+  this->PendingSelection.clear();
+
+  bool didChange = false;
+  for (const auto& renderable : touched)
+  {
+    auto count = this->FootprintCounts.find(renderable.Id);
+    bool selected = count != this->FootprintCounts.end() && count->second > 0;
+    if (selected == wasSelected[renderable.Id])
+    {
+      continue;
+    }
+    auto dataIt = this->RenderableData.find(renderable.Id);
+    if (dataIt == this->RenderableData.end())
+    {
+      continue;
+    }
+    auto cstate = this->ComponentState.find(renderable.Id);
+    bool hidden = (cstate != this->ComponentState.end() && !cstate->second.m_visibility);
+    this->SetSelectedState(
+      dataIt->second, hidden ? -1 : (selected ? /*selnBit TODO*/ 1 : 0), renderable.IsGlyphed);
+    didChange = true;
+  }
+
+  if (didChange)
+  {
+    // This is necessary to force an update in the mapper
+    this->Entities->GetMapper()->Modified();
+    this->GlyphEntities->GetMapper()->Modified();
+    this->SelectedEntities->GetMapper()->Modified();
+    this->SelectedGlyphEntities->GetMapper()->Modified();
+  }
+}
+
 void vtkSMTKResourceRepresentation::UpdateSelection(
   vtkMultiBlockDataSet* data,
   vtkCompositeDataDisplayAttributes* blockAttr,
@@ -953,7 +1139,7 @@ void vtkSMTKResourceRepresentation::UpdateSelection(
     {
       continue;
     }
-    auto* matchedBlock = this->FindNode(data, item.first->id().toString());
+    auto* matchedBlock = this->FindNode(data, item.first->id());
     if (matchedBlock)
     {
       propVis = 1;
@@ -1043,6 +1229,7 @@ void vtkSMTKResourceRepresentation::ClearSelection(vtkMapper* mapper)
 void vtkSMTKResourceRepresentation::SetResource(const smtk::resource::ResourcePtr& res)
 {
   this->Resource = res;
+  this->SelectionResetRequired = true;
 }
 
 smtk::resource::ResourcePtr vtkSMTKResourceRepresentation::GetResource() const
@@ -1082,6 +1269,33 @@ void vtkSMTKResourceRepresentation::SelectionModified()
   this->SelectionTime.Modified();
 }
 
+void vtkSMTKResourceRepresentation::SelectionModified(const smtk::view::SelectionDelta& delta)
+{
+  // When the next render restyles the entire selection, there is no need to
+  // record which objects changed.
+  if (this->SelectionResetRequired)
+  {
+    this->SelectionModified();
+    return;
+  }
+  // Objects whose value changed but remain selected keep their highlighting.
+  for (const auto& entry : delta.added)
+  {
+    if (entry.first)
+    {
+      this->PendingSelection[entry.first->id()] = { entry.first, true };
+    }
+  }
+  for (const auto& entry : delta.removed)
+  {
+    if (entry.first)
+    {
+      this->PendingSelection[entry.first->id()] = { entry.first, false };
+    }
+  }
+  this->SelectionModified();
+}
+
 void vtkSMTKResourceRepresentation::SetWrapper(vtkSMTKWrapper* wrapper)
 {
   if (wrapper == this->Wrapper)
@@ -1093,26 +1307,34 @@ void vtkSMTKResourceRepresentation::SetWrapper(vtkSMTKWrapper* wrapper)
     auto oldSeln = this->Wrapper->GetSelection();
     if (oldSeln)
     {
-      oldSeln->observers().erase(this->SelectionObserver);
+      oldSeln->deltaObservers().erase(this->SelectionObserver);
     }
-    this->SelectionObserver = smtk::view::SelectionObservers::Key();
+    this->SelectionObserver = smtk::view::SelectionDeltaObservers::Key();
     this->Wrapper->UnRegister(this);
   }
   this->Wrapper = wrapper;
   if (this->Wrapper)
   {
     this->Wrapper->Register(this);
-    // Observe the Wrapper's selection and mark when we need
-    // to rebuild visual properties (due to selection changes).
+    // Observe the Wrapper's selection and record which objects need their
+    // visual properties updated (due to selection changes). There is no need
+    // to be told about the current selection since it is restyled in full.
     auto newSeln = this->Wrapper->GetSelection();
     this->SelectionObserver = newSeln
-      ? newSeln->observers().insert(
-          [this](const std::string& /*unused*/, smtk::view::Selection::Ptr /*unused*/) {
-            this->SelectionModified();
-          },
+      ? newSeln->deltaObservers().insert(
+          [this](
+            const std::string& /*unused*/,
+            const smtk::view::SelectionDelta& delta,
+            smtk::view::Selection::Ptr /*unused*/) { this->SelectionModified(delta); },
+          smtk::view::SelectionDeltaObservers::Default,
+          false,
           "vtkSMTKResourceRepresentation: Update visual properties to reflect selection change.")
-      : smtk::view::SelectionObservers::Key();
+      : smtk::view::SelectionDeltaObservers::Key();
   }
+  // Highlighting must be rebuilt from the new wrapper's selection.
+  this->PendingSelection.clear();
+  this->SelectionResetRequired = true;
+  this->SelectionModified();
   this->Modified();
 }
 
@@ -17,6 +17,7 @@
 
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDContainers.h"
 #include "smtk/extension/paraview/server/smtkPVServerExtModule.h"
 #include "smtk/extension/vtk/filter/vtkApplyTransforms.h"
 #include "smtk/view/SelectionObserver.h"
@@ -25,6 +26,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class vtkSMTKWrapper;
 
@@ -275,6 +277,11 @@ public:
   /// SMTK selection. You should never call it yourself.
   void SelectionModified();
 
+  /// This method is used internally to record the objects whose selection
+  /// changed so that only their blocks are restyled the next time the
+  /// representation is rendered. You should never call it yourself.
+  void SelectionModified(const smtk::view::SelectionDelta& delta);
+
   /**
    * Internal attributes are set through color block proxy properties.
    */
@@ -370,6 +377,15 @@ protected:
   void UpdateDisplayAttributesFromSelection(
     vtkMultiBlockDataSet* modelData,
     vtkMultiBlockDataSet* instanceData);
+  /**
+   * Restyle only the blocks whose selected state changed since the last call,
+   * using the objects recorded by SelectionModified(const SelectionDelta&).
+   * This is only valid when the default style is in use and the renderable
+   * data has not changed since highlighting was last applied.
+   */
+  void UpdateDisplayAttributesFromSelectionDelta();
+  /// Record \a object as selected and highlight its footprint.
+  void HighlightSelectedFootprint(const smtk::resource::PersistentObjectPtr& object);
   void UpdateSelection(
     vtkMultiBlockDataSet* data,
     vtkCompositeDataDisplayAttributes* blockAttr,
@@ -439,8 +455,9 @@ protected:
     * + in certain coloring modes, such as when coloring by volume.
     */
   vtkSMTKWrapper* Wrapper{ nullptr };
-  /// If Wrapper is non-null, SelectionObserver is the handle of an observer of Wrapper->GetSelection().
-  smtk::view::SelectionObservers::Key SelectionObserver;
+  /// If Wrapper is non-null, SelectionObserver is the handle of a delta observer of
+  /// Wrapper->GetSelection().
+  smtk::view::SelectionDeltaObservers::Key SelectionObserver;
   /**
    * Provides access to entities in the model. This is useful when coloring by
    * certain modes (e.g. in order to query the color of a volume with a given UUID).
@@ -518,6 +535,36 @@ protected:
   /// Timestamp for when highlighting styles related to the selection were last applied.
   vtkTimeStamp ApplyStyleTime;
 
+  //@{
+  /**
+   * Incremental selection highlighting.
+   *
+   * Selection deltas accumulate in PendingSelection until the next render
+   * (unless SelectionResetRequired is already true).
+   * When the default style is in use, SelectedFootprints holds the UUIDs of
+   * the renderables highlighted for each selected object and FootprintCounts
+   * holds the number of selected objects whose footprint includes each
+   * renderable, so that deselecting one of several objects sharing a
+   * footprint leaves it highlighted.
+   * When SelectionResetRequired is true, highlighting is rebuilt from the
+   * entire selection instead.
+   */
+  struct PendingSelectionChange
+  {
+    std::weak_ptr<smtk::resource::PersistentObject> Object;
+    bool Selected;
+  };
+  struct SelectedRenderable
+  {
+    smtk::common::UUID Id;
+    bool IsGlyphed;
+  };
+  smtk::common::UUIDHashMap<PendingSelectionChange> PendingSelection;
+  smtk::common::UUIDHashMap<std::vector<SelectedRenderable>> SelectedFootprints;
+  smtk::common::UUIDHashMap<int> FootprintCounts;
+  bool SelectionResetRequired = true;
+  //@}
+
   /// The name of the active assembly.
   char* ActiveAssembly{ nullptr };
 };
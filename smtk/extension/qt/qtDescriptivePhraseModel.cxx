@@ -44,6 +44,7 @@
 #include <deque>
 #include <iomanip>
 #include <map>
+#include <set>
 #include <sstream>
 
 // The following is used to ensure that the QRC file
@@ -94,6 +95,12 @@ public:
     * with QModelIndex entries.
     */
   std::map<unsigned int, view::WeakDescriptivePhrasePtr> ptrs;
+
+  /// Parents whose children are being updated (empty when the root is being updated).
+  QList<QPersistentModelIndex> updatingParents;
+  /// Persistent indices affected by the update and the phrase each will refer
+  /// to afterward (or null when the phrase is being removed).
+  std::vector<std::pair<QModelIndex, view::DescriptivePhrasePtr>> updatingIndices;
 };
 
 qtDescriptivePhraseModel::qtDescriptivePhraseModel(QObject* owner)
@@ -261,6 +268,22 @@ int qtDescriptivePhraseModel::rowCount(const QModelIndex& owner) const
   return count;
 }
 
+bool qtDescriptivePhraseModel::canFetchMore(const QModelIndex& owner) const
+{
+  view::DescriptivePhrasePtr ownerPhrase = this->getItem(owner);
+  return m_model && ownerPhrase && m_model->canFetchMoreSubphrases(ownerPhrase);
+}
+
+/// Page in more children of \a owner; the phrase model signals the row insertion.
+void qtDescriptivePhraseModel::fetchMore(const QModelIndex& owner)
+{
+  view::DescriptivePhrasePtr ownerPhrase = this->getItem(owner);
+  if (m_model && ownerPhrase)
+  {
+    m_model->fetchMoreSubphrases(ownerPhrase);
+  }
+}
+
 /// Return something to display in the table header.
 QVariant qtDescriptivePhraseModel::headerData(int section, Qt::Orientation orientation, int role)
   const
@@ -507,8 +530,6 @@ void qtDescriptivePhraseModel::updateObserver(
   const std::vector<int>& dst,
   const std::vector<int>& range)
 {
-  (void)phrase;
-
   using smtk::view::PhraseModelEvent;
 
   switch (event)
@@ -535,6 +556,103 @@ void qtDescriptivePhraseModel::updateObserver(
     case PhraseModelEvent::PHRASE_MODIFIED:
       Q_EMIT this->dataChanged(this->indexFromPath(src), this->indexFromPath(dst));
       break;
+    case PhraseModelEvent::ABOUT_TO_UPDATE:
+      this->aboutToUpdateChildren(phrase, this->indexFromPath(src), range);
+      break;
+    case PhraseModelEvent::UPDATE_FINISHED:
+      this->childrenUpdated(phrase, this->indexFromPath(src), range);
+      break;
+  }
+}
+
+void qtDescriptivePhraseModel::aboutToUpdateChildren(
+  const smtk::view::DescriptivePhrasePtr& parent,
+  const QModelIndex& qparent,
+  const std::vector<int>& range)
+{
+  auto delta = smtk::view::PhraseModelDelta::decode(range);
+  const auto& children = parent->subphrases();
+  std::set<view::DescriptivePhrase*> removed;
+  for (const auto& row : delta.removed)
+  {
+    removed.insert(children[row].get());
+  }
+
+  this->P->updatingParents.clear();
+  if (qparent.isValid())
+  {
+    this->P->updatingParents.push_back(QPersistentModelIndex(qparent));
+  }
+  Q_EMIT this->layoutAboutToBeChanged(this->P->updatingParents);
+
+  // Rather than signaling each row inserted, removed, or moved, remap the
+  // persistent indices (which hold the selection and expansion state of views)
+  // of the parent's children; indices inside removed subtrees are invalidated.
+  this->P->updatingIndices.clear();
+  for (const auto& qidx : this->persistentIndexList())
+  {
+    view::DescriptivePhrasePtr phrase = this->getItem(qidx);
+    view::DescriptivePhrasePtr child = phrase;
+    while (child && child->parent() != parent)
+    {
+      child = child->parent();
+    }
+    if (!child)
+    {
+      continue; // The index is not beneath the parent.
+    }
+    if (removed.find(child.get()) != removed.end())
+    {
+      this->P->updatingIndices.emplace_back(qidx, nullptr);
+    }
+    else if (child == phrase)
+    {
+      this->P->updatingIndices.emplace_back(qidx, phrase);
+    }
+  }
+}
+
+void qtDescriptivePhraseModel::childrenUpdated(
+  const smtk::view::DescriptivePhrasePtr& parent,
+  const QModelIndex& qparent,
+  const std::vector<int>& range)
+{
+  std::map<view::DescriptivePhrase*, int> rows;
+  if (!this->P->updatingIndices.empty())
+  {
+    int row = 0;
+    for (const auto& child : parent->subphrases())
+    {
+      rows[child.get()] = row++;
+    }
+  }
+  for (const auto& entry : this->P->updatingIndices)
+  {
+    auto it = entry.second ? rows.find(entry.second.get()) : rows.end();
+    if (it == rows.end())
+    {
+      this->changePersistentIndex(entry.first, QModelIndex());
+      continue;
+    }
+    this->P->ptrs[entry.second->phraseId()] = entry.second;
+    this->changePersistentIndex(
+      entry.first, this->createIndex(it->second, entry.first.column(), entry.second->phraseId()));
+  }
+  this->P->updatingIndices.clear();
+  Q_EMIT this->layoutChanged(this->P->updatingParents);
+
+  // Report modified children, one run of adjacent rows at a time.
+  auto delta = smtk::view::PhraseModelDelta::decode(range);
+  for (std::size_t ii = 0; ii < delta.modified.size();)
+  {
+    std::size_t jj = ii + 1;
+    while (jj < delta.modified.size() && delta.modified[jj] == delta.modified[jj - 1] + 1)
+    {
+      ++jj;
+    }
+    Q_EMIT this->dataChanged(
+      this->index(delta.modified[ii], 0, qparent), this->index(delta.modified[jj - 1], 0, qparent));
+    ii = jj;
   }
 }
 } // namespace extension
@@ -84,6 +84,10 @@ public:
   bool hasChildren(const QModelIndex& parent) const override;
 
   int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  /// Return true when the phrase at \a parent has paged children yet to be materialized.
+  bool canFetchMore(const QModelIndex& parent) const override;
+  /// Materialize the next page of children of the phrase at \a parent.
+  void fetchMore(const QModelIndex& parent) override;
   int columnCount(const QModelIndex& inParent = QModelIndex()) const override
   {
     (void)inParent;
@@ -135,6 +139,17 @@ protected:
     const std::vector<int>& dst,
     const std::vector<int>& range);
 
+  /// Prepare views for a coalesced update of \a parent's children (see PhraseModelDelta).
+  void aboutToUpdateChildren(
+    const smtk::view::DescriptivePhrasePtr& parent,
+    const QModelIndex& qparent,
+    const std::vector<int>& range);
+  /// Remap persistent indices once \a parent's children have been updated.
+  void childrenUpdated(
+    const smtk::view::DescriptivePhrasePtr& parent,
+    const QModelIndex& qparent,
+    const std::vector<int>& range);
+
   smtk::view::PhraseModelPtr m_model;
   smtk::view::PhraseModelObservers::Key m_modelObserver;
   bool m_deleteOnRemoval; // remove UUIDs from mesh when they are removed from the list?
@@ -881,7 +881,9 @@ void qtReferenceItem::checkRemovedComponents(
 {
   (void)phr;
   (void)dst;
-  if (evt == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE)
+  if (
+    evt == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE ||
+    evt == smtk::view::PhraseModelEvent::ABOUT_TO_UPDATE)
   {
     bool didChange = false;
     auto itm = this->itemAs<smtk::attribute::ReferenceItem>();
@@ -893,7 +895,10 @@ void qtReferenceItem::checkRemovedComponents(
     }
 
     auto qidx = m_p->m_qtModel->indexFromPath(src);
-    for (auto ref : refs)
+    std::vector<int> rows = evt == smtk::view::PhraseModelEvent::ABOUT_TO_UPDATE
+      ? smtk::view::PhraseModelDelta::decode(refs).removed
+      : refs;
+    for (auto ref : rows)
     {
       auto ridx = m_p->m_qtModel->index(ref, 0, qidx);
       auto rphr = ridx.data(smtk::extension::qtDescriptivePhraseModel::PhrasePtrRole)
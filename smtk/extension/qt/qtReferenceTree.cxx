@@ -791,7 +791,9 @@ void qtReferenceTree::checkRemovedComponents(
   (void)phr;
   (void)dst;
   bool didChange = false;
-  if (evt == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE)
+  if (
+    evt == smtk::view::PhraseModelEvent::ABOUT_TO_REMOVE ||
+    evt == smtk::view::PhraseModelEvent::ABOUT_TO_UPDATE)
   {
     auto itm = this->itemAs<smtk::attribute::ReferenceItem>();
     // If the application releases its hold on the attribute
@@ -802,7 +804,10 @@ void qtReferenceTree::checkRemovedComponents(
     }
 
     auto qidx = m_p->m_qtModel->indexFromPath(src);
-    for (auto ref : refs)
+    std::vector<int> rows = evt == smtk::view::PhraseModelEvent::ABOUT_TO_UPDATE
+      ? smtk::view::PhraseModelDelta::decode(refs).removed
+      : refs;
+    for (auto ref : rows)
     {
       auto ridx = m_p->m_qtModel->index(ref, 0, qidx);
       auto rphr = ridx.data(smtk::extension::qtDescriptivePhraseModel::PhrasePtrRole)
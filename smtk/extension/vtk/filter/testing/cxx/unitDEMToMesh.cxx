@@ -0,0 +1,204 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/extension/vtk/filter/vtkDEMToMesh.h"
+
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkUniformGrid.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+// The triangulation of a DEM computed one sample at a time.
+struct SerialMesh
+{
+  std::vector<std::array<double, 3>> points;
+  std::vector<double> elevations;
+  std::vector<std::array<vtkIdType, 3>> triangles;
+};
+
+// Triangulate every visible sample of \a img (whose extent starts at the
+// origin), as the filter did before it generated points and triangles
+// concurrently.
+SerialMesh serialMesh(vtkUniformGrid* img, bool useScalerForZ)
+{
+  SerialMesh mesh;
+  int* extent = img->GetExtent();
+  int sizex = extent[1] - extent[0] + 2;
+  int sizey = extent[3] - extent[2] + 2;
+  std::vector<std::vector<vtkIdType>> ptsGrid(sizex, std::vector<vtkIdType>(sizey, -1));
+
+  int xyz[3] = { 0, 0, 0 };
+  for (int x = extent[0]; x <= extent[1]; ++x)
+  {
+    xyz[0] = x;
+    for (int y = extent[2]; y <= extent[3]; ++y)
+    {
+      xyz[1] = y;
+      vtkIdType id = img->ComputePointId(xyz);
+      if (img->IsPointVisible(id))
+      {
+        std::array<double, 3> pt;
+        img->GetPoint(id, pt.data());
+        double elevation = img->GetScalarComponentAsDouble(x, y, 0, 0);
+        if (useScalerForZ)
+        {
+          pt[2] = elevation;
+        }
+        ptsGrid[x][y] = static_cast<vtkIdType>(mesh.points.size());
+        mesh.points.push_back(pt);
+        mesh.elevations.push_back(elevation);
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < ptsGrid.size() - 1; ++i)
+  {
+    for (std::size_t j = 0; j < ptsGrid[i].size() - 1; ++j)
+    {
+      vtkIdType ids[] = {
+        ptsGrid[i][j], ptsGrid[i][j + 1], ptsGrid[i + 1][j], ptsGrid[i + 1][j + 1]
+      };
+      if (ids[0] == -1 || ids[1] == -1 || ids[2] == -1 || ids[3] == -1)
+      {
+        continue;
+      }
+      if (i % 2 == j % 2)
+      {
+        mesh.triangles.push_back({ ids[0], ids[3], ids[1] });
+        mesh.triangles.push_back({ ids[0], ids[2], ids[3] });
+      }
+      else
+      {
+        mesh.triangles.push_back({ ids[0], ids[2], ids[1] });
+        mesh.triangles.push_back({ ids[1], ids[2], ids[3] });
+      }
+    }
+  }
+  return mesh;
+}
+
+void compareWithSerial(vtkUniformGrid* img, bool useScalerForZ)
+{
+  vtkNew<vtkDEMToMesh> filter;
+  filter->SetInputData(img);
+  filter->SetUseScalerForZ(useScalerForZ ? 1 : 0);
+  filter->Update();
+  vtkPolyData* output = filter->GetOutput();
+
+  SerialMesh expected = serialMesh(img, useScalerForZ);
+  const vtkIdType numPoints = static_cast<vtkIdType>(expected.points.size());
+  const vtkIdType numTriangles = static_cast<vtkIdType>(expected.triangles.size());
+  smtkTest(
+    output->GetNumberOfPoints() == numPoints,
+    "Expected " << numPoints << " points, got " << output->GetNumberOfPoints() << ".");
+  smtkTest(
+    output->GetNumberOfPolys() == numTriangles,
+    "Expected " << numTriangles << " triangles, got " << output->GetNumberOfPolys() << ".");
+
+  double bounds[6];
+  output->GetBounds(bounds);
+  for (int i = 0; i < 3; ++i)
+  {
+    double lo = expected.points[0][i];
+    double hi = expected.points[0][i];
+    for (const auto& pt : expected.points)
+    {
+      lo = std::min(lo, pt[i]);
+      hi = std::max(hi, pt[i]);
+    }
+    smtkTest(
+      bounds[2 * i] == lo && bounds[2 * i + 1] == hi, "Bounds differ along axis " << i << ".");
+  }
+
+  vtkDataArray* elevation = output->GetPointData()->GetScalars();
+  smtkTest(elevation != nullptr, "No elevation array.");
+  for (vtkIdType i :
+       { vtkIdType(0), numPoints / 5, numPoints / 2, numPoints - numPoints / 4, numPoints - 1 })
+  {
+    double pt[3];
+    output->GetPoint(i, pt);
+    smtkTest(
+      pt[0] == expected.points[i][0] && pt[1] == expected.points[i][1] &&
+        pt[2] == expected.points[i][2],
+      "Point " << i << " differs from the serial triangulation.");
+    smtkTest(
+      elevation->GetTuple1(i) == expected.elevations[i],
+      "Elevation " << i << " is " << elevation->GetTuple1(i) << ", expected "
+                   << expected.elevations[i] << ".");
+  }
+
+  vtkNew<vtkIdList> cellPoints;
+  for (vtkIdType i = 0; i < numTriangles; ++i)
+  {
+    output->GetCellPoints(i, cellPoints);
+    smtkTest(
+      cellPoints->GetNumberOfIds() == 3 && cellPoints->GetId(0) == expected.triangles[i][0] &&
+        cellPoints->GetId(1) == expected.triangles[i][1] &&
+        cellPoints->GetId(2) == expected.triangles[i][2],
+      "Triangle " << i << " differs from the serial triangulation.");
+  }
+}
+} // namespace
+
+int unitDEMToMesh(int /*unused*/, char** const /*unused*/)
+{
+  // Use enough samples that the columns are split across several threads.
+  const int nx = 157;
+  const int ny = 113;
+  vtkNew<vtkUniformGrid> img;
+  img->SetExtent(0, nx - 1, 0, ny - 1, 0, 0);
+  img->SetOrigin(100., -50., 0.);
+  img->SetSpacing(2., 3., 1.);
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Elevation");
+  scalars->SetNumberOfTuples(static_cast<vtkIdType>(nx) * ny);
+  for (int y = 0; y < ny; ++y)
+  {
+    for (int x = 0; x < nx; ++x)
+    {
+      double elevation = 10. * std::sin(0.07 * x) + 0.1 * y * std::cos(0.05 * x);
+      scalars->SetValue(static_cast<vtkIdType>(y) * nx + x, elevation);
+    }
+  }
+  img->GetPointData()->SetScalars(scalars);
+
+  // Blank a rectangle and a scattering of samples so that some quads are
+  // skipped and point IDs must be renumbered.
+  for (int y = 20; y < 35; ++y)
+  {
+    for (int x = 40; x < 70; ++x)
+    {
+      img->BlankPoint(static_cast<vtkIdType>(y) * nx + x);
+    }
+  }
+  for (vtkIdType id = 5; id < static_cast<vtkIdType>(nx) * ny; id += 97)
+  {
+    img->BlankPoint(id);
+  }
+
+  compareWithSerial(img, true);
+  compareWithSerial(img, false);
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/extension/vtk/filter/vtkLIDARElevationFilter.h"
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTransform.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+const double lowPoint[3] = { 0., 0., -1. };
+const double highPoint[3] = { 0., 0., 4. };
+const double scalarRange[2] = { -10., 10. };
+
+// Compute elevations one point at a time through the transform itself, as
+// the filter did before it processed points concurrently.
+std::vector<float> serialElevations(vtkDataSet* input, vtkTransform* transform)
+{
+  double diffVector[3] = { highPoint[0] - lowPoint[0],
+                           highPoint[1] - lowPoint[1],
+                           highPoint[2] - lowPoint[2] };
+  double length2 = vtkMath::Dot(diffVector, diffVector);
+  std::vector<float> elevations;
+  double p[3];
+  double x[3];
+  for (vtkIdType i = 0; i < input->GetNumberOfPoints(); ++i)
+  {
+    input->GetPoint(i, p);
+    if (transform)
+    {
+      transform->TransformPoint(p, x);
+    }
+    else
+    {
+      std::copy(p, p + 3, x);
+    }
+    double v[3] = { x[0] - lowPoint[0], x[1] - lowPoint[1], x[2] - lowPoint[2] };
+    double s = vtkMath::Dot(v, diffVector) / length2;
+    s = (s < 0.0 ? 0.0 : s > 1.0 ? 1.0 : s);
+    elevations.push_back(
+      static_cast<float>(scalarRange[0] + s * (scalarRange[1] - scalarRange[0])));
+  }
+  return elevations;
+}
+
+void compareWithSerial(vtkPolyData* input, vtkTransform* transform)
+{
+  vtkNew<vtkLIDARElevationFilter> filter;
+  filter->SetInputData(input);
+  filter->SetLowPoint(lowPoint[0], lowPoint[1], lowPoint[2]);
+  filter->SetHighPoint(highPoint[0], highPoint[1], highPoint[2]);
+  filter->SetScalarRange(scalarRange[0], scalarRange[1]);
+  if (transform)
+  {
+    filter->SetTransform(transform);
+  }
+  filter->Update();
+  vtkDataSet* output = filter->GetOutput();
+
+  smtkTest(
+    output->GetNumberOfPoints() == input->GetNumberOfPoints(),
+    "Expected " << input->GetNumberOfPoints() << " points, got " << output->GetNumberOfPoints()
+                << ".");
+
+  // The filter does not move points, even when it transforms them.
+  double inputBounds[6];
+  double outputBounds[6];
+  input->GetBounds(inputBounds);
+  output->GetBounds(outputBounds);
+  for (int i = 0; i < 6; ++i)
+  {
+    smtkTest(inputBounds[i] == outputBounds[i], "Bounds differ at " << i << ".");
+  }
+
+  vtkDataArray* elevation = output->GetPointData()->GetArray("Elevation");
+  smtkTest(elevation != nullptr, "No elevation array.");
+  smtkTest(
+    elevation->GetNumberOfTuples() == output->GetNumberOfPoints(),
+    "Expected one elevation per point.");
+
+  std::vector<float> expected = serialElevations(input, transform);
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  for (vtkIdType i : { vtkIdType(0), numPts / 7, numPts / 2, numPts - numPts / 3, numPts - 1 })
+  {
+    smtkTest(
+      std::abs(elevation->GetTuple1(i) - expected[i]) < 1.e-5,
+      "Elevation " << i << " is " << elevation->GetTuple1(i) << ", expected " << expected[i]
+                   << ".");
+  }
+
+  double range[2];
+  elevation->GetRange(range);
+  float expectedRange[2] = { expected[0], expected[0] };
+  for (float value : expected)
+  {
+    expectedRange[0] = std::min(expectedRange[0], value);
+    expectedRange[1] = std::max(expectedRange[1], value);
+  }
+  smtkTest(
+    std::abs(range[0] - expectedRange[0]) < 1.e-5 && std::abs(range[1] - expectedRange[1]) < 1.e-5,
+    "Elevation range differs from the serial computation.");
+}
+} // namespace
+
+int unitLIDARElevationFilter(int /*unused*/, char** const /*unused*/)
+{
+  // Use enough points that they are split across several batches and threads.
+  const int nx = 301;
+  const int ny = 257;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  for (int j = 0; j < ny; ++j)
+  {
+    for (int i = 0; i < nx; ++i)
+    {
+      points->InsertNextPoint(0.1 * i, 0.2 * j, std::sin(0.05 * i) * std::cos(0.03 * j));
+    }
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  compareWithSerial(input, nullptr);
+
+  vtkNew<vtkTransform> transform;
+  transform->Translate(1., -2., 0.5);
+  transform->RotateX(20.);
+  transform->RotateY(-35.);
+  transform->Scale(1., 1., 2.);
+  compareWithSerial(input, transform);
+
+  return 0;
+}
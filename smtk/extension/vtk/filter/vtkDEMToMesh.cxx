@@ -20,24 +20,65 @@
 #include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkPointData.h"
-#include "vtkPointLocator.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUniformGrid.h"
-#include "vtkVector.h"
-#include "vtkXMLPolyDataWriter.h"
 
 #include "vtkObjectFactory.h"
 
-#include <map>
-#include <sstream>
+#include <algorithm>
+#include <vector>
 
 vtkStandardNewMacro(vtkDEMToMesh);
 
+namespace
+{
+// Return the subsampling step that keeps the number of triangles generated
+// for the whole \a extent under about two million.
+int SubSampleStep(const int extent[6], int step)
+{
+  double estimatedNumberOfPoly = (extent[1] - extent[0] + 1.0) * (extent[3] - extent[2] + 1.0) * 2;
+  while (estimatedNumberOfPoly / (step * step) > 2000000)
+  {
+    step++;
+  }
+  return step;
+}
+
+// Return the first and last sample rows triangulated by a piece.
+// Adjacent pieces share a row of samples so that their union is seamless.
+void PieceRows(int numRows, int piece, int numPieces, int& first, int& last)
+{
+  long long numQuadRows = std::max(numRows - 1, 0);
+  first = static_cast<int>(numQuadRows * piece / numPieces);
+  last = static_cast<int>(numQuadRows * (piece + 1) / numPieces);
+}
+
+void UpdatePiece(vtkInformation* outInfo, int& piece, int& numPieces)
+{
+  piece = 0;
+  numPieces = 1;
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES()))
+  {
+    numPieces =
+      std::max(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES()), 1);
+    piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  }
+}
+
+// Return the index of the first sample at or after \a coord.
+int FirstSampleAtOrAfter(int coord, int origin, int step)
+{
+  return coord <= origin ? 0 : (coord - origin + step - 1) / step;
+}
+} // namespace
+
 vtkDEMToMesh::vtkDEMToMesh()
 {
   UseScalerForZ = true;
-  SubSampleStepSize = 1; //TODO this should be 1
+  SubSampleStepSize = 1;
 }
 
 vtkDEMToMesh::~vtkDEMToMesh() = default;
@@ -48,12 +89,46 @@ int vtkDEMToMesh::FillInputPortInformation(int /*port*/, vtkInformation* info)
   return 1;
 }
 
+int vtkDEMToMesh::RequestUpdateExtent(
+  vtkInformation* request,
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if (!inInfo->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+  {
+    return this->Superclass::RequestUpdateExtent(request, inputVector, outputVector);
+  }
+
+  // Ask for the band of rows the requested piece will triangulate.
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  int piece;
+  int numPieces;
+  UpdatePiece(outInfo, piece, numPieces);
+  int step = SubSampleStep(wholeExtent, 1);
+  int first;
+  int last;
+  PieceRows((wholeExtent[3] - wholeExtent[2]) / step + 1, piece, numPieces, first, last);
+
+  int updateExtent[6] = { wholeExtent[0],
+                          wholeExtent[1],
+                          wholeExtent[2] + first * step,
+                          wholeExtent[2] + last * step,
+                          wholeExtent[4],
+                          wholeExtent[4] };
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent, 6);
+  return 1;
+}
+
 int vtkDEMToMesh::RequestData(
   vtkInformation* /*request*/,
   vtkInformationVector** inputVector,
   vtkInformationVector* outputVector)
 {
   vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
   vtkPolyData* pdOut = vtkPolyData::GetData(outputVector, 0);
   vtkDataSet* input = vtkDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
 
@@ -79,97 +154,203 @@ int vtkDEMToMesh::RequestData(
     return 0;
   }
 
-  vtkPoints* points = vtkPoints::New();
-  vtkDoubleArray* scalers = nullptr;
-  scalers = vtkDoubleArray::New();
-  scalers->SetName("Elevation");
-  scalers->SetNumberOfComponents(1);
-
-  points->SetDataTypeToDouble();
-
+  // Samples are indexed relative to the whole extent (so that pieces line up)
+  // but only those inside both the requested piece and the input's extent are used.
   int* extent = img->GetExtent();
-  double estimatedNumberOfPoly = (extent[1] - extent[0] + 1.0) * (extent[3] - extent[2] + 1.0) * 2;
-  while (estimatedNumberOfPoly / (SubSampleStepSize * SubSampleStepSize) > 2000000)
+  int wholeExtent[6];
+  if (inInfo->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+  {
+    inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  }
+  else
   {
-    SubSampleStepSize++;
+    std::copy(extent, extent + 6, wholeExtent);
   }
+  this->SubSampleStepSize = SubSampleStep(wholeExtent, 1);
+  const int step = this->SubSampleStepSize;
 
-  int sizex = (extent[1] - extent[0] + 1) / SubSampleStepSize + 2;
-  int sizey = (extent[3] - extent[2] + 1) / SubSampleStepSize + 2;
+  int piece;
+  int numPieces;
+  UpdatePiece(outInfo, piece, numPieces);
+  int numRows = (wholeExtent[3] - wholeExtent[2]) / step + 1;
+  int firstRow;
+  int lastRow;
+  PieceRows(numRows, piece, numPieces, firstRow, lastRow);
+  if (firstRow == lastRow && piece > 0)
+  {
+    // More pieces than rows of triangles; this piece is empty.
+    return 1;
+  }
+  firstRow = std::max(firstRow, FirstSampleAtOrAfter(extent[2], wholeExtent[2], step));
+  lastRow = std::min(lastRow, (extent[3] - wholeExtent[2]) / step);
+  int firstColumn = FirstSampleAtOrAfter(extent[0], wholeExtent[0], step);
+  int lastColumn = (extent[1] - wholeExtent[0]) / step;
+  if (firstRow > lastRow || firstColumn > lastColumn)
+  {
+    return 1;
+  }
+  const vtkIdType nx = lastColumn - firstColumn + 1;
+  const vtkIdType ny = lastRow - firstRow + 1;
 
-  std::vector<std::vector<int>> ptsGrid(sizex, std::vector<int>(sizey, -1));
+  // Return the input point ID of a sample.
+  auto inputPointId = [&](vtkIdType ii, vtkIdType jj) {
+    int xyz[3] = { wholeExtent[0] + static_cast<int>(firstColumn + ii) * step,
+                   wholeExtent[2] + static_cast<int>(firstRow + jj) * step,
+                   extent[4] };
+    return img->ComputePointId(xyz);
+  };
 
-  int xyz[3];
-  xyz[2] = 0;
-  double pt[] = { 0, 0, 0 };
-  double min = 1e23;
-  double max = -1e23;
-  for (int x = extent[0]; x <= extent[1]; x += SubSampleStepSize)
+  // Some data-set methods cache information on first use, so call them here
+  // before any are called concurrently.
+  double pt[3];
+  img->GetPoint(0, pt);
+  if (ugrid)
   {
-    int i = x / SubSampleStepSize;
-    xyz[0] = x;
-    for (int y = extent[2]; y <= extent[3]; y += SubSampleStepSize)
+    ugrid->GetPointGhostArray();
+  }
+  vtkDataArray* inScalars = img->GetPointData()->GetScalars();
+
+  // I. Number the visible samples in column-major order (so output point IDs
+  //    match a serial traversal). Each column is counted concurrently, then
+  //    offset by the number of points in the columns before it.
+  std::vector<vtkIdType> ptsGrid(static_cast<std::size_t>(nx * ny), -1);
+  std::vector<vtkIdType> columnOffsets(static_cast<std::size_t>(nx + 1), 0);
+  vtkSMPTools::For(0, nx, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType ii = begin; ii < end; ++ii)
     {
-      int j = y / SubSampleStepSize;
-      xyz[1] = y;
-      vtkIdType id = img->ComputePointId(xyz);
-      if (ugrid == nullptr || ugrid->IsPointVisible(id))
+      vtkIdType count = 0;
+      for (vtkIdType jj = 0; jj < ny; ++jj)
       {
-        img->GetPoint(id, pt);
-        if (UseScalerForZ)
+        if (ugrid == nullptr || ugrid->IsPointVisible(inputPointId(ii, jj)))
         {
-          pt[2] = img->GetScalarComponentAsDouble(x, y, 0, 0);
-          if (pt[2] < min)
-            min = pt[2];
-          if (pt[2] > max)
-            max = pt[2];
+          ptsGrid[ii * ny + jj] = count++;
         }
-        double v[] = { img->GetScalarComponentAsDouble(x, y, 0, 0) };
-        scalers->InsertNextTuple(v);
-        ptsGrid[i][j] = points->InsertNextPoint(pt);
       }
+      columnOffsets[ii + 1] = count;
     }
+  });
+  for (vtkIdType ii = 0; ii < nx; ++ii)
+  {
+    columnOffsets[ii + 1] += columnOffsets[ii];
   }
+  const vtkIdType numPoints = columnOffsets[nx];
+  this->UpdateProgress(0.25);
 
-  vtkCellArray* cells = vtkCellArray::New();
-
-  for (size_t i = 0; i < ptsGrid.size() - 1; ++i)
-  {
-    for (size_t j = 0; j < ptsGrid[i].size() - 1; ++j)
+  // II. Fill the (preallocated) point coordinates and elevations.
+  vtkNew<vtkDoubleArray> coords;
+  coords->SetNumberOfComponents(3);
+  coords->SetNumberOfTuples(numPoints);
+  vtkNew<vtkDoubleArray> scalers;
+  scalers->SetName("Elevation");
+  scalers->SetNumberOfComponents(1);
+  scalers->SetNumberOfTuples(numPoints);
+  double* coordPtr = coords->GetPointer(0);
+  double* scalerPtr = scalers->GetPointer(0);
+  const bool useScalerForZ = this->UseScalerForZ != 0;
+  vtkSMPTools::For(0, nx, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType ii = begin; ii < end; ++ii)
     {
-      int ids[] = { ptsGrid[i][j], ptsGrid[i][j + 1], ptsGrid[i + 1][j], ptsGrid[i + 1][j + 1] };
-      if (ids[0] == -1 || ids[1] == -1 || ids[2] == -1 || ids[3] == -1)
+      for (vtkIdType jj = 0; jj < ny; ++jj)
       {
-        continue;
+        vtkIdType& id = ptsGrid[ii * ny + jj];
+        if (id < 0)
+        {
+          continue;
+        }
+        id += columnOffsets[ii];
+        vtkIdType inputId = inputPointId(ii, jj);
+        img->GetPoint(inputId, x);
+        double elevation = inScalars ? inScalars->GetComponent(inputId, 0) : 0.0;
+        if (useScalerForZ)
+        {
+          x[2] = elevation;
+        }
+        std::copy(x, x + 3, coordPtr + 3 * id);
+        scalerPtr[id] = elevation;
       }
-      if ((i % 2 == 0 && j % 2 == 0) || (i % 2 != 0 && j % 2 != 0))
+    }
+  });
+  this->UpdateProgress(0.5);
+  if (this->GetAbortExecute())
+  {
+    return 1;
+  }
+
+  // III. Split each quad whose corners are all visible into two triangles,
+  //      counting and then filling each column of quads concurrently.
+  std::vector<vtkIdType> quadOffsets(static_cast<std::size_t>(nx), 0);
+  auto quadCorners = [&](vtkIdType ii, vtkIdType jj, vtkIdType ids[4]) {
+    ids[0] = ptsGrid[ii * ny + jj];
+    ids[1] = ptsGrid[ii * ny + jj + 1];
+    ids[2] = ptsGrid[(ii + 1) * ny + jj];
+    ids[3] = ptsGrid[(ii + 1) * ny + jj + 1];
+    return ids[0] >= 0 && ids[1] >= 0 && ids[2] >= 0 && ids[3] >= 0;
+  };
+  vtkSMPTools::For(0, nx - 1, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdType ids[4];
+    for (vtkIdType ii = begin; ii < end; ++ii)
+    {
+      vtkIdType count = 0;
+      for (vtkIdType jj = 0; jj < ny - 1; ++jj)
       {
-        vtkIdType tri1[] = { ids[0], ids[3], ids[1] };
-        vtkIdType tri2[] = { ids[0], ids[2], ids[3] };
-        cells->InsertNextCell(3, tri1);
-        cells->InsertNextCell(3, tri2);
+        count += quadCorners(ii, jj, ids) ? 1 : 0;
       }
-      else
+      quadOffsets[ii + 1] = count;
+    }
+  });
+  for (vtkIdType ii = 1; ii < nx; ++ii)
+  {
+    quadOffsets[ii] += quadOffsets[ii - 1];
+  }
+  const vtkIdType numTriangles = 2 * quadOffsets[nx - 1];
+
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfTuples(numTriangles + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfTuples(3 * numTriangles);
+  vtkIdType* offsetPtr = offsets->GetPointer(0);
+  vtkIdType* connPtr = connectivity->GetPointer(0);
+  vtkSMPTools::For(0, nx - 1, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdType ids[4];
+    for (vtkIdType ii = begin; ii < end; ++ii)
+    {
+      vtkIdType tri = 2 * quadOffsets[ii];
+      for (vtkIdType jj = 0; jj < ny - 1; ++jj)
       {
-        vtkIdType tri1[] = { ids[0], ids[2], ids[1] };
-        vtkIdType tri2[] = { ids[1], ids[2], ids[3] };
-        cells->InsertNextCell(3, tri1);
-        cells->InsertNextCell(3, tri2);
+        if (!quadCorners(ii, jj, ids))
+        {
+          continue;
+        }
+        // Alternate the diagonal (using indices relative to the whole extent
+        // so that it is consistent across pieces).
+        vtkIdType* conn = connPtr + 3 * tri;
+        if ((firstColumn + ii) % 2 == (firstRow + jj) % 2)
+        {
+          vtkIdType tris[] = { ids[0], ids[3], ids[1], ids[0], ids[2], ids[3] };
+          std::copy(tris, tris + 6, conn);
+        }
+        else
+        {
+          vtkIdType tris[] = { ids[0], ids[2], ids[1], ids[1], ids[2], ids[3] };
+          std::copy(tris, tris + 6, conn);
+        }
+        offsetPtr[tri] = 3 * tri;
+        offsetPtr[tri + 1] = 3 * tri + 3;
+        tri += 2;
       }
     }
-  }
+  });
+  offsetPtr[numTriangles] = 3 * numTriangles;
 
+  vtkNew<vtkPoints> points;
+  points->SetData(coords);
   pdOut->SetPoints(points);
-  points->Delete();
-
-  if (scalers)
-  {
-    pdOut->GetPointData()->SetScalars(scalers);
-    scalers->Delete();
-  }
+  pdOut->GetPointData()->SetScalars(scalers);
 
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
   pdOut->SetPolys(cells);
-  cells->Delete();
 
   return 1;
 }
@@ -13,6 +13,18 @@
 #include "smtk/extension/vtk/filter/vtkSMTKFilterExtModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+/**\brief Triangulate a digital elevation model (DEM) image.
+  *
+  * Each (sub)sample of the image becomes a point (whose z coordinate is the
+  * image's scalar value when UseScalerForZ is set) and each quad of visible
+  * samples becomes two triangles. Points and triangles are generated
+  * concurrently into arrays that are allocated once.
+  *
+  * Requests for a piece of the output are translated into a band of rows of
+  * the input image (sharing a row with the neighboring bands), so rasters too
+  * large to fit in memory may be triangulated one tile at a time by a
+  * streaming consumer.
+  */
 class VTKSMTKFILTEREXT_EXPORT vtkDEMToMesh : public vtkPolyDataAlgorithm
 {
 public:
@@ -30,6 +42,11 @@ protected:
 
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
+  int RequestUpdateExtent(
+    vtkInformation* req,
+    vtkInformationVector** inInfo,
+    vtkInformationVector* outInfo) override;
+
   int RequestData(vtkInformation* req, vtkInformationVector** inInfo, vtkInformationVector* outInfo)
     override;
 
@@ -15,11 +15,15 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTransform.h"
 
+#include <algorithm>
+
 vtkStandardNewMacro(vtkLIDARElevationFilter);
 vtkCxxSetObjectMacro(vtkLIDARElevationFilter, Transform, vtkTransform);
 
@@ -108,36 +112,61 @@ int vtkLIDARElevationFilter::RequestData(
     length2 = 1.0;
   }
 
-  // Support progress and abort.
-  vtkIdType tenth = (numPts >= 10 ? numPts / 10 : 1);
-  double numPtsInv = 1.0 / numPts;
-  int abort = 0;
+  // Copy the transform's matrix once so that points may be transformed
+  // concurrently (vtkTransform::TransformPoint locks on each call).
+  bool transformPoints = this->Transform != nullptr;
+  double matrix[16];
+  if (transformPoints)
+  {
+    vtkMatrix4x4::DeepCopy(matrix, this->Transform->GetMatrix());
+  }
 
   // Compute parametric coordinate and map into scalar range.
   double diffScalar = this->ScalarRange[1] - this->ScalarRange[0];
-  vtkDebugMacro("Generating elevation scalars!");
-  for (vtkIdType i = 0; i < numPts && !abort; ++i)
-  {
-    // Periodically update progress and check for an abort request.
-    if (i % tenth == 0)
+  const double* lowPoint = this->LowPoint;
+  float* scalars = newScalars->GetPointer(0);
+  auto computeElevation = [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    double y[3];
+    for (vtkIdType i = begin; i < end; ++i)
     {
-      this->UpdateProgress((i + 1) * numPtsInv);
-      abort = this->GetAbortExecute();
+      // Project this input point into the 1D system.
+      input->GetPoint(i, x);
+      if (transformPoints)
+      {
+        for (int r = 0; r < 3; ++r)
+        {
+          y[r] = matrix[4 * r] * x[0] + matrix[4 * r + 1] * x[1] + matrix[4 * r + 2] * x[2] +
+            matrix[4 * r + 3];
+        }
+        std::copy(y, y + 3, x);
+      }
+      double v[3] = { x[0] - lowPoint[0], x[1] - lowPoint[1], x[2] - lowPoint[2] };
+      double s = vtkMath::Dot(v, diffVector) / length2;
+      s = (s < 0.0 ? 0.0 : s > 1.0 ? 1.0 : s);
+
+      // Store the resulting scalar value.
+      scalars[i] = static_cast<float>(this->ScalarRange[0] + s * diffScalar);
     }
-
-    // Project this input point into the 1D system.
-    double x[3];
-    input->GetPoint(i, x);
-    if (this->Transform)
+  };
+
+  // Points are processed concurrently in (up to) ten batches; progress is
+  // reported and abort requests are checked on this thread between batches.
+  // vtkDataSet::GetPoint is only thread-safe after it has been called once
+  // from a single thread, so do that up front.
+  double unused[3];
+  input->GetPoint(0, unused);
+  vtkIdType batchSize = (numPts >= 10 ? numPts / 10 : numPts);
+  vtkDebugMacro("Generating elevation scalars!");
+  for (vtkIdType begin = 0; begin < numPts; begin += batchSize)
+  {
+    vtkIdType end = std::min(begin + batchSize, numPts);
+    vtkSMPTools::For(begin, end, computeElevation);
+    this->UpdateProgress(static_cast<double>(end) / numPts);
+    if (this->GetAbortExecute())
     {
-      this->Transform->TransformPoint(x, x);
+      break;
     }
-    double v[3] = { x[0] - this->LowPoint[0], x[1] - this->LowPoint[1], x[2] - this->LowPoint[2] };
-    double s = vtkMath::Dot(v, diffVector) / length2;
-    s = (s < 0.0 ? 0.0 : s > 1.0 ? 1.0 : s);
-
-    // Store the resulting scalar value.
-    newScalars->SetValue(i, this->ScalarRange[0] + s * diffScalar);
   }
 
   // Add the new scalars array to the output.
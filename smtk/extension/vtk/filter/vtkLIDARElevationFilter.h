@@ -18,6 +18,9 @@
 // are generated by computing a projection of each dataset point onto
 // a line. The line can be oriented arbitrarily. A typical example is
 // to generate scalars based on elevation or height above a plane.
+//
+// Points are processed concurrently (via vtkSMPTools) and the scalars are
+// written directly into a single, preallocated array.
 
 #ifndef __vtkLIDARElevationFilter_h
 #define __vtkLIDARElevationFilter_h
@@ -0,0 +1,271 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/extension/vtk/io/vtkMedReader.h"
+#include "smtk/extension/vtk/io/vtkMedWriter.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArraySelection.h"
+#include "vtkIdList.h"
+#include "vtkInformation.h"
+#include "vtkIntArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include "vtksys/SystemTools.hxx"
+
+#include <map>
+#include <set>
+#include <string>
+
+namespace
+{
+std::string write_root = SMTK_SCRATCH_DIR;
+
+// The sizes are chosen so that neither the number of points nor the number
+// of cells is a multiple of the chunk sizes used below.
+const int nx = 10;
+const int ny = 8;
+
+// Group names mapped to the global IDs of the triangles in each group.
+using GroupCells = std::map<std::string, std::set<int>>;
+
+// Create a triangulated grid of points along with two overlapping groups of
+// triangles, laid out as vtkMedWriter expects.
+vtkSmartPointer<vtkMultiBlockDataSet> createMesh(GroupCells& groupCells)
+{
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  vtkNew<vtkIntArray> pointIds;
+  for (int i = 0; i < nx; ++i)
+  {
+    for (int j = 0; j < ny; ++j)
+    {
+      points->InsertNextPoint(1.5 * i, 0.5 * j, 0.25 * i * j);
+      pointIds->InsertNextValue(static_cast<int>(points->GetNumberOfPoints()));
+    }
+  }
+
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->Allocate();
+  grid->SetPoints(points);
+  grid->GetPointData()->SetGlobalIds(pointIds);
+  vtkNew<vtkIntArray> cellIds;
+  std::map<std::string, vtkSmartPointer<vtkUnstructuredGrid>> groups;
+  for (const char* name : { "left", "bottom" })
+  {
+    groups[name] = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    groups[name]->Allocate();
+    groups[name]->SetPoints(points);
+    groups[name]->GetCellData()->SetGlobalIds(vtkSmartPointer<vtkIntArray>::New());
+  }
+  for (int i = 0; i < nx - 1; ++i)
+  {
+    for (int j = 0; j < ny - 1; ++j)
+    {
+      vtkIdType corner = i * ny + j;
+      vtkIdType triangles[2][3] = { { corner, corner + ny, corner + ny + 1 },
+                                    { corner, corner + ny + 1, corner + 1 } };
+      for (auto& triangle : triangles)
+      {
+        grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+        int globalId = static_cast<int>(grid->GetNumberOfCells());
+        cellIds->InsertNextValue(globalId);
+        for (const auto& group : groups)
+        {
+          if ((group.first == "left" && i < 3) || (group.first == "bottom" && j < 2))
+          {
+            group.second->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+            vtkIntArray::SafeDownCast(group.second->GetCellData()->GetGlobalIds())
+              ->InsertNextValue(globalId);
+            groupCells[group.first].insert(globalId);
+          }
+        }
+      }
+    }
+  }
+  grid->GetCellData()->SetGlobalIds(cellIds);
+
+  vtkNew<vtkMultiBlockDataSet> master;
+  master->SetNumberOfBlocks(1);
+  master->SetBlock(0, grid);
+  vtkNew<vtkMultiBlockDataSet> groupBlock;
+  groupBlock->SetNumberOfBlocks(static_cast<unsigned int>(groups.size()));
+  unsigned int index = 0;
+  for (const auto& group : groups)
+  {
+    groupBlock->SetBlock(index, group.second);
+    groupBlock->GetMetaData(index++)->Set(vtkCompositeDataSet::NAME(), group.first.c_str());
+  }
+
+  auto mesh = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  mesh->SetNumberOfBlocks(2);
+  mesh->SetBlock(0, master);
+  mesh->SetBlock(1, groupBlock);
+  mesh->GetInformation()->Set(vtkCompositeDataSet::NAME(), "grid");
+  return mesh;
+}
+
+// Verify that the group block read from the file holds the expected groups,
+// each with the expected cells (compared by global ID with the original grid).
+void verifyGroups(
+  vtkMultiBlockDataSet* groupBlock,
+  vtkUnstructuredGrid* original,
+  const GroupCells& expected)
+{
+  smtkTest(
+    groupBlock->GetNumberOfBlocks() == expected.size(),
+    "Expected " << expected.size() << " groups, got " << groupBlock->GetNumberOfBlocks() << ".");
+  vtkNew<vtkIdList> readIds;
+  vtkNew<vtkIdList> originalIds;
+  for (unsigned int i = 0; i < groupBlock->GetNumberOfBlocks(); ++i)
+  {
+    std::string name = groupBlock->GetMetaData(i)->Get(vtkCompositeDataSet::NAME());
+    auto it = expected.find(name);
+    smtkTest(it != expected.end(), "Unexpected group \"" << name << "\".");
+    auto* group = vtkUnstructuredGrid::SafeDownCast(groupBlock->GetBlock(i));
+    smtkTest(group != nullptr, "Group \"" << name << "\" is not an unstructured grid.");
+    smtkTest(
+      group->GetNumberOfCells() == static_cast<vtkIdType>(it->second.size()),
+      "Group \"" << name << "\" has " << group->GetNumberOfCells() << " cells, expected "
+                 << it->second.size() << ".");
+    auto* globalIds = vtkIntArray::SafeDownCast(group->GetCellData()->GetGlobalIds());
+    smtkTest(globalIds != nullptr, "Group \"" << name << "\" has no global IDs.");
+    std::set<int> cells;
+    for (vtkIdType j = 0; j < group->GetNumberOfCells(); ++j)
+    {
+      int globalId = globalIds->GetValue(j);
+      cells.insert(globalId);
+      group->GetCellPoints(j, readIds);
+      original->GetCellPoints(globalId - 1, originalIds);
+      smtkTest(
+        group->GetCellType(j) == VTK_TRIANGLE && readIds->GetNumberOfIds() == 3 &&
+          readIds->GetId(0) == originalIds->GetId(0) &&
+          readIds->GetId(1) == originalIds->GetId(1) &&
+          readIds->GetId(2) == originalIds->GetId(2),
+        "Cell " << globalId << " of group \"" << name << "\" differs from the original.");
+    }
+    smtkTest(cells == it->second, "Group \"" << name << "\" holds the wrong cells.");
+  }
+}
+} // namespace
+
+int UnitTestMedReadWrite(int /*unused*/, char** const /*unused*/)
+{
+  GroupCells groupCells;
+  vtkSmartPointer<vtkMultiBlockDataSet> mesh = createMesh(groupCells);
+  auto* original = vtkUnstructuredGrid::SafeDownCast(
+    vtkMultiBlockDataSet::SafeDownCast(mesh->GetBlock(0))->GetBlock(0));
+  const vtkIdType numberOfPoints = original->GetNumberOfPoints();
+  const vtkIdType numberOfCells = original->GetNumberOfCells();
+
+  // I. Write the mesh a few cells at a time.
+  std::string fileName = write_root + "/UnitTestMedReadWrite.med";
+  {
+    vtkNew<vtkMedWriter> writer;
+    writer->SetFileName(fileName);
+    writer->SetChunkSize(11);
+    writer->SetInputData(mesh);
+    writer->Update();
+  }
+  smtkTest(vtksys::SystemTools::FileExists(fileName), "No file was written.");
+
+  // II. Read every cell back, a different number of cells at a time.
+  {
+    vtkNew<vtkMedReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->SetChunkSize(13);
+    reader->Update();
+    vtkMultiBlockDataSet* output = reader->GetOutput();
+    smtkTest(output->GetNumberOfBlocks() == 1, "Expected one mesh.");
+    auto* meshBlock = vtkMultiBlockDataSet::SafeDownCast(output->GetBlock(0));
+    smtkTest(
+      meshBlock != nullptr && meshBlock->GetNumberOfBlocks() == 2,
+      "Expected a block of cells and a block of groups.");
+    auto* master = vtkMultiBlockDataSet::SafeDownCast(meshBlock->GetBlock(0));
+    smtkTest(
+      master != nullptr && master->GetNumberOfBlocks() == 1, "Expected one block of cells.");
+    auto* grid = vtkUnstructuredGrid::SafeDownCast(master->GetBlock(0));
+    smtkTest(grid != nullptr, "The block of cells is not an unstructured grid.");
+
+    smtkTest(
+      grid->GetNumberOfPoints() == numberOfPoints,
+      "Expected " << numberOfPoints << " points, got " << grid->GetNumberOfPoints() << ".");
+    for (vtkIdType i = 0; i < numberOfPoints; ++i)
+    {
+      double readPoint[3];
+      double originalPoint[3];
+      grid->GetPoint(i, readPoint);
+      original->GetPoint(i, originalPoint);
+      smtkTest(
+        readPoint[0] == originalPoint[0] && readPoint[1] == originalPoint[1] &&
+          readPoint[2] == originalPoint[2],
+        "Point " << i << " differs from the original.");
+    }
+
+    smtkTest(
+      grid->GetNumberOfCells() == numberOfCells,
+      "Expected " << numberOfCells << " cells, got " << grid->GetNumberOfCells() << ".");
+    auto* globalIds = vtkIntArray::SafeDownCast(grid->GetCellData()->GetGlobalIds());
+    smtkTest(globalIds != nullptr, "The cells have no global IDs.");
+    vtkNew<vtkIdList> readIds;
+    vtkNew<vtkIdList> originalIds;
+    for (vtkIdType i = 0; i < numberOfCells; ++i)
+    {
+      grid->GetCellPoints(i, readIds);
+      original->GetCellPoints(i, originalIds);
+      smtkTest(
+        grid->GetCellType(i) == VTK_TRIANGLE && readIds->GetNumberOfIds() == 3 &&
+          readIds->GetId(0) == originalIds->GetId(0) &&
+          readIds->GetId(1) == originalIds->GetId(1) &&
+          readIds->GetId(2) == originalIds->GetId(2) && globalIds->GetValue(i) == i + 1,
+        "Cell " << i << " differs from the original.");
+    }
+
+    verifyGroups(vtkMultiBlockDataSet::SafeDownCast(meshBlock->GetBlock(1)), original, groupCells);
+  }
+
+  // III. Read only the cells of one group.
+  {
+    vtkNew<vtkMedReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->SetChunkSize(17);
+    reader->ReadAllCellsOff();
+    reader->UpdateInformation();
+    vtkDataArraySelection* selection = reader->GetGroupSelection();
+    smtkTest(
+      selection->ArrayExists("left") && selection->ArrayExists("bottom"),
+      "The group selection does not list the file's groups.");
+    selection->DisableArray("left");
+    reader->Update();
+
+    auto* meshBlock = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutput()->GetBlock(0));
+    smtkTest(meshBlock != nullptr, "Expected one mesh.");
+    auto* master = vtkMultiBlockDataSet::SafeDownCast(meshBlock->GetBlock(0));
+    smtkTest(
+      master != nullptr && master->GetNumberOfBlocks() == 0,
+      "No cells should be read outside of groups.");
+
+    GroupCells bottom;
+    bottom["bottom"] = groupCells["bottom"];
+    verifyGroups(vtkMultiBlockDataSet::SafeDownCast(meshBlock->GetBlock(1)), original, bottom);
+  }
+
+  vtksys::SystemTools::RemoveFile(fileName);
+  return 0;
+}
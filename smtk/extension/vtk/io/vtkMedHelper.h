@@ -21,6 +21,7 @@
 
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 class vtkCellArray;
 class vtkCellData;
@@ -119,6 +120,70 @@ public:
 
 using HdfNodeIterator = std::list<HdfNode*>::iterator;
 
+// Med stores multi-component data one component at a time
+// (x1, x2, ..., y1, y2, ..., z1, z2, ...). Select rows [first, first + count)
+// of every column of a dataset with numRows rows and numColumns columns.
+inline hid_t medSelectRows(
+  const hid_t dataset,
+  const vtkIdType numRows,
+  const vtkIdType numColumns,
+  const vtkIdType first,
+  const vtkIdType count)
+{
+  const hid_t fileSpace = H5Dget_space(dataset);
+  const hsize_t start = static_cast<hsize_t>(first);
+  const hsize_t stride = static_cast<hsize_t>(numRows);
+  const hsize_t blocks = static_cast<hsize_t>(numColumns);
+  const hsize_t block = static_cast<hsize_t>(count);
+  H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, &start, &stride, &blocks, &block);
+  return fileSpace;
+}
+
+// Read rows [first, first + count) of a column-major dataset into buffer,
+// column by column (count values per column).
+template<typename T>
+bool medReadRows(
+  const hid_t dataset,
+  const hid_t memType,
+  const vtkIdType numRows,
+  const vtkIdType numColumns,
+  const vtkIdType first,
+  const vtkIdType count,
+  std::vector<T>& buffer)
+{
+  buffer.resize(static_cast<std::size_t>(count * numColumns));
+  const hid_t fileSpace = medSelectRows(dataset, numRows, numColumns, first, count);
+  const hsize_t size = static_cast<hsize_t>(buffer.size());
+  const hid_t memSpace = H5Screate_simple(1, &size, nullptr);
+  const herr_t status =
+    H5Dread(dataset, memType, memSpace, fileSpace, H5P_DEFAULT, buffer.data());
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  return status >= 0;
+}
+
+// Write rows [first, first + count) of a column-major dataset from buffer
+// (laid out as for medReadRows).
+template<typename T>
+bool medWriteRows(
+  const hid_t dataset,
+  const hid_t memType,
+  const vtkIdType numRows,
+  const vtkIdType numColumns,
+  const vtkIdType first,
+  const vtkIdType count,
+  const std::vector<T>& buffer)
+{
+  const hid_t fileSpace = medSelectRows(dataset, numRows, numColumns, first, count);
+  const hsize_t size = static_cast<hsize_t>(count * numColumns);
+  const hid_t memSpace = H5Screate_simple(1, &size, nullptr);
+  const herr_t status =
+    H5Dwrite(dataset, memType, memSpace, fileSpace, H5P_DEFAULT, buffer.data());
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  return status >= 0;
+}
+
 // Builds a dynamic tree from a Hdf5 file, must be deleted by user
 SMTKIOVTK_EXPORT HdfNode* rootBuildTree(hid_t rootId);
 
@@ -9,9 +9,13 @@
 //=========================================================================
 #include "smtk/extension/vtk/io/vtkMedReader.h"
 
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkDataArraySelection.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkIntArray.h"
 #include "vtkMedHelper.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkPointData.h"
@@ -19,8 +23,159 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
+
 vtkStandardNewMacro(vtkMedReader);
 
+vtkMedReader::vtkMedReader()
+{
+  this->FileName = nullptr;
+  this->GroupSelection = vtkDataArraySelection::New();
+  this->ReadAllCells = true;
+  this->ChunkSize = 1 << 20;
+}
+
+vtkMedReader::~vtkMedReader()
+{
+  delete[] this->FileName;
+  this->GroupSelection->Delete();
+}
+
+vtkMTimeType vtkMedReader::GetMTime()
+{
+  return std::max(this->Superclass::GetMTime(), this->GroupSelection->GetMTime());
+}
+
+namespace
+{
+// The cells of one type in a mesh.
+struct MedCellBlock
+{
+  HdfNode* nodNode = nullptr;
+  std::string cellType;
+  vtkIdType vertexCount = 0;
+  vtkSmartPointer<vtkIntArray> families;
+  vtkSmartPointer<vtkIntArray> nums;
+  // Whether any cell is in a selected group.
+  bool inGroup = false;
+};
+
+// The cells (and points) of one group, allocated once they have been counted.
+struct MedGroup
+{
+  std::string name;
+  std::string cellType;
+  vtkIdType numberOfCells = 0;
+  vtkIdType connectivitySize = 0;
+  vtkSmartPointer<vtkIdTypeArray> offsets;
+  vtkSmartPointer<vtkIdTypeArray> connectivity;
+  vtkSmartPointer<vtkIntArray> globalIds;
+  vtkIdType nextCell = 0;
+  vtkIdType nextPoint = 0;
+
+  void count(const std::string& type, vtkIdType numberOfPoints)
+  {
+    this->cellType = type;
+    ++this->numberOfCells;
+    this->connectivitySize += numberOfPoints;
+  }
+
+  void allocate()
+  {
+    this->offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    this->offsets->SetNumberOfValues(this->numberOfCells + 1);
+    this->offsets->SetValue(this->numberOfCells, this->connectivitySize);
+    this->connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    this->connectivity->SetNumberOfValues(this->connectivitySize);
+    this->globalIds = vtkSmartPointer<vtkIntArray>::New();
+    this->globalIds->SetName("NUM");
+    this->globalIds->SetNumberOfValues(this->numberOfCells);
+  }
+
+  // Append a cell whose i-th point ID is pointIds[i * stride].
+  void insert(vtkIdType numberOfPoints, const int* pointIds, vtkIdType stride, int globalId)
+  {
+    this->offsets->SetValue(this->nextCell, this->nextPoint);
+    this->globalIds->SetValue(this->nextCell++, globalId);
+    vtkIdType* conn = this->connectivity->GetPointer(this->nextPoint);
+    for (vtkIdType i = 0; i < numberOfPoints; ++i)
+    {
+      conn[i] = pointIds[i * stride] - 1;
+    }
+    this->nextPoint += numberOfPoints;
+  }
+};
+
+// Open a dataset, checking the class of its type and reading its NBR attribute.
+hid_t openCountedDataset(
+  const hid_t fileId,
+  HdfNode* node,
+  H5T_class_t typeClass,
+  int& count,
+  const char* what,
+  vtkSmartPointer<vtkObject> const& self)
+{
+  const hid_t dataset = H5Dopen(fileId, node->path.c_str(), H5P_DEFAULT);
+  const hid_t attributeId = H5Aopen_name(dataset, "NBR");
+  count = -1;
+  const bool haveCount = H5Aread(attributeId, H5T_NATIVE_INT, &count) == 0;
+  H5Aclose(attributeId);
+  if (!haveCount)
+  {
+    vtkWarningWithObjectMacro(
+      self, << "Failed to read " << what << ", error reading NBR attribute");
+    H5Dclose(dataset);
+    return -1;
+  }
+
+  const hid_t datatype = H5Dget_type(dataset);
+  const bool typeMatches = H5Tget_class(datatype) == typeClass;
+  H5Tclose(datatype);
+  if (!typeMatches)
+  {
+    vtkWarningWithObjectMacro(self, << "Failed to read " << what << ", unexpected data type");
+    H5Dclose(dataset);
+    return -1;
+  }
+  return dataset;
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> newGrid(
+  const vtkMedPointData& medPoints,
+  int cellType,
+  vtkCellArray* cells,
+  vtkDataArray* cellFams,
+  vtkDataArray* cellNums)
+{
+  vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+
+  // Set the points, fams, and global ids
+  grid->SetPoints(medPoints.points);
+  vtkDataArray* ptFams = medPoints.pointData->GetArray("FAM");
+  if (ptFams != nullptr)
+  {
+    grid->GetPointData()->AddArray(ptFams);
+  }
+  vtkDataArray* ptNums = medPoints.pointData->GetGlobalIds();
+  if (ptNums != nullptr)
+  {
+    grid->GetPointData()->SetGlobalIds(ptNums);
+  }
+
+  // Set the cells
+  grid->SetCells(cellType, cells);
+  if (cellFams != nullptr)
+  {
+    grid->GetCellData()->AddArray(cellFams);
+  }
+  if (cellNums != nullptr)
+  {
+    grid->GetCellData()->SetGlobalIds(cellNums);
+  }
+  return grid;
+}
+} // namespace
+
 // Reads all the integers in a FAM node
 static bool readFamilies(
   const hid_t fileId,
@@ -94,119 +249,146 @@ static bool readNums(
   return true;
 }
 
-// Reads all the vertices in a COO node
+// Reads all the vertices in a COO node, chunkSize points at a time
 static bool readPoints(
   const hid_t fileId,
   HdfNode* cooNode,
+  vtkIdType chunkSize,
   vtkSmartPointer<vtkPoints> const& points,
   vtkSmartPointer<vtkObject> const& self)
 {
-  // Open the points dataset
-  const hid_t dataset = H5Dopen(fileId, cooNode->path.c_str(), H5P_DEFAULT);
-
-  // Read the number of points attribute NBR, NOE->COO->NBR
-  const hid_t attributeId = H5Aopen_name(dataset, "NBR");
+  // Open the points dataset and read the number of points attribute NBR, NOE->COO->NBR
   int numberOfPoints = -1;
-  if (H5Aread(attributeId, H5T_NATIVE_INT, &numberOfPoints) != 0)
-  {
-    vtkWarningWithObjectMacro(self, << "Failed to read points, error reading NBR attribute");
-    return false;
-  }
-  H5Aclose(attributeId);
-
-  // Check the datatype
-  const hid_t datatype = H5Dget_type(dataset);
-  const hid_t type = H5Tget_class(datatype);
-  if (type != H5T_FLOAT)
+  const hid_t dataset =
+    openCountedDataset(fileId, cooNode, H5T_FLOAT, numberOfPoints, "points", self);
+  if (dataset < 0)
   {
-    vtkWarningWithObjectMacro(self, << "Failed to read points, not H5T_FLOAT");
     return false;
   }
 
   // Med vertices are not strided like VTKs, so we copy
   // (not x1, y1, z1, x2, y2, z2, ... but x1, x2, ..., y1, y2, ..., z1, z2, ...)
-  auto* pts = new double[numberOfPoints * 3];
-  H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, pts);
-  H5Dclose(dataset);
+  points->SetDataTypeToDouble();
   points->SetNumberOfPoints(numberOfPoints);
-  for (vtkIdType i = 0; i < numberOfPoints; i++)
+  auto* pts = static_cast<double*>(points->GetVoidPointer(0));
+  std::vector<double> buffer;
+  for (vtkIdType first = 0; first < numberOfPoints; first += chunkSize)
   {
-    points->SetPoint(i, pts[i], pts[i + numberOfPoints], pts[i + 2 * numberOfPoints]);
+    const vtkIdType count = std::min<vtkIdType>(chunkSize, numberOfPoints - first);
+    if (!medReadRows(dataset, H5T_NATIVE_DOUBLE, numberOfPoints, 3, first, count, buffer))
+    {
+      vtkWarningWithObjectMacro(self, << "Failed to read points");
+      H5Dclose(dataset);
+      return false;
+    }
+    for (vtkIdType i = 0; i < count; i++)
+    {
+      double* pt = pts + 3 * (first + i);
+      pt[0] = buffer[i];
+      pt[1] = buffer[i + count];
+      pt[2] = buffer[i + 2 * count];
+    }
   }
-  delete[] pts;
+  H5Dclose(dataset);
   return true;
 }
 
-// Reads all the cells in a NOD node
+// Reads the cells in a NOD node chunkSize cells at a time, adding them to
+// the cell type's (master) connectivity when it is non-null and to the
+// groups of their families.
 static bool readCells(
   const hid_t fileId,
-  HdfNode* nodNode,
-  const std::string& cellType,
-  vtkSmartPointer<vtkCellArray> const& cells,
+  const MedCellBlock& cellBlock,
+  vtkIdType chunkSize,
+  const std::unordered_map<int, std::vector<size_t>>& familyGroups,
+  std::vector<MedGroup>& groups,
+  vtkIdTypeArray* offsets,
+  vtkIdTypeArray* connectivity,
   vtkSmartPointer<vtkObject> const& self)
 {
-  // Open the cells
-  const hid_t dataset = H5Dopen(fileId, nodNode->path.c_str(), H5P_DEFAULT);
-
-  // Read the number of cells attribute, MAI->CellTypeGroup->NOD->NBR
-  const hid_t nbrId = H5Aopen_name(dataset, "NBR");
+  // Open the cells and read the number of cells attribute, MAI->CellTypeGroup->NOD->NBR
   int numberOfCells = -1;
-  if (H5Aread(nbrId, H5T_NATIVE_INT, &numberOfCells) != 0)
+  const hid_t dataset =
+    openCountedDataset(fileId, cellBlock.nodNode, H5T_INTEGER, numberOfCells, "cells", self);
+  if (dataset < 0)
   {
-    vtkWarningWithObjectMacro(self, << "Failed to read cells, error reading NBR attribute");
     return false;
   }
-  H5Aclose(nbrId);
-
-  // Check the datatype
-  const hid_t datatype = H5Dget_type(dataset);
-  const hid_t type = H5Tget_class(datatype);
-  if (type != H5T_INTEGER)
+  if (numberOfCells != cellBlock.families->GetNumberOfValues())
   {
-    vtkWarningWithObjectMacro(self, << "Failed to read cells, not H5T_INTEGER");
+    vtkWarningWithObjectMacro(self, << "Failed to read cells, NOD and FAM sizes differ");
+    H5Dclose(dataset);
     return false;
   }
 
-  // Check cell type is supported
-  if (vertexCount.find(cellType) == vertexCount.end())
+  const vtkIdType cellVertexCount = cellBlock.vertexCount;
+  const int* families = cellBlock.families->GetPointer(0);
+  const int* nums = cellBlock.nums->GetPointer(0);
+  std::vector<int> indices;
+  for (vtkIdType first = 0; first < numberOfCells; first += chunkSize)
   {
-    vtkWarningWithObjectMacro(
-      self, << "Failed to read cells, \"" << cellType << "\" cell type not supported.");
-    return false;
-  }
-  const vtkIdType cellVertexCount = vertexCount[cellType];
-  int* indices = new int[numberOfCells * cellVertexCount];
-  H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, indices);
-  H5Dclose(dataset);
+    const vtkIdType count = std::min<vtkIdType>(chunkSize, numberOfCells - first);
+    // Skip chunks with no cells of interest.
+    if (
+      !connectivity &&
+      std::none_of(families + first, families + first + count, [&familyGroups](int fam) {
+        return fam != 0 && familyGroups.find(fam) != familyGroups.end();
+      }))
+    {
+      continue;
+    }
+    if (!medReadRows(
+          dataset, H5T_NATIVE_INT, numberOfCells, cellVertexCount, first, count, indices))
+    {
+      vtkWarningWithObjectMacro(self, << "Failed to read cells");
+      H5Dclose(dataset);
+      return false;
+    }
 
-  // Copy into VTKs cell datastruct
-  // Like the vertices the cells are not strided either
-  size_t iter = 0;
-  cells->AllocateEstimate(numberOfCells, cellVertexCount);
-  for (vtkIdType i = 0; i < numberOfCells; i++)
-  {
-    iter = i;
-    cells->InsertNextCell(cellVertexCount);
-    for (vtkIdType j = 0; j < cellVertexCount; j++)
+    // Like the vertices the cells are not strided either
+    for (vtkIdType i = 0; i < count; i++)
     {
-      cells->InsertCellPoint(indices[iter] - 1);
-      iter += numberOfCells;
+      const vtkIdType cell = first + i;
+      if (connectivity)
+      {
+        offsets->SetValue(cell, cell * cellVertexCount);
+        vtkIdType* conn = connectivity->GetPointer(cell * cellVertexCount);
+        for (vtkIdType j = 0; j < cellVertexCount; j++)
+        {
+          conn[j] = indices[i + j * count] - 1;
+        }
+      }
+      const int fam = families[cell];
+      auto groupIt = fam == 0 ? familyGroups.end() : familyGroups.find(fam);
+      if (groupIt == familyGroups.end())
+      {
+        continue;
+      }
+      for (auto const groupIndex : groupIt->second)
+      {
+        groups[groupIndex].insert(cellVertexCount, &indices[i], count, nums[cell]);
+      }
     }
   }
-  delete[] indices;
+  H5Dclose(dataset);
   return true;
 }
 
-// Reads all the points, cells, pointData, cellData from a mesh node
+// Reads the points and the cells of a mesh node.
+// Every cell is added to the master block when readAllCells is true;
+// cells (and points) in the families of groups that are selected are
+// added to the group block.
 static bool readMesh(
   const hid_t fileId,
   HdfNode* meshNode,
-  vtkMedPointData& medPoints,
-  std::list<vtkMedCellData>& medCells,
+  std::unordered_map<int, vtkSmartPointer<vtkStringArray>>& meshTags,
+  vtkDataArraySelection* groupSelection,
+  bool readAllCells,
+  vtkIdType chunkSize,
+  vtkMultiBlockDataSet* masterBlock,
+  vtkMultiBlockDataSet* groupBlock,
   vtkSmartPointer<vtkObject> const& self)
 {
-  medCells.clear();
-
   // Under each mesh node should exist timepoints, assume only usage of the default
   HdfNode* defaultTimePtNode = meshNode->findChild("-0000000000000000001-0000000000000000001");
   if (defaultTimePtNode == nullptr)
@@ -224,6 +406,7 @@ static bool readMesh(
     return false;
   }
 
+  vtkMedPointData medPoints;
   {
     // Under NOE (points) there should exist COO (vertices), FAM (scalars), & NUM (index/unused)
     HdfNode* noeCooNode = noeNode->findChild("COO");
@@ -240,7 +423,7 @@ static bool readMesh(
     medPoints.points = vtkSmartPointer<vtkPoints>::New();
     medPoints.pointData = vtkSmartPointer<vtkPointData>::New();
 
-    if (!readPoints(fileId, noeCooNode, medPoints.points, self))
+    if (!readPoints(fileId, noeCooNode, chunkSize, medPoints.points, self))
     {
       vtkWarningWithObjectMacro(self, << "Failed to read mesh, points could not be read");
       return false;
@@ -265,49 +448,194 @@ static bool readMesh(
     medPoints.pointData->AddArray(pointFamilies);
   }
 
-  // Under MAI (cells) there should exist a set of hdf groups for each cell
-  for (auto* maiNodeChild : maiNode->children)
+  // Establish a group (output block) for every selected group name and
+  // the list of groups each family belongs to.
+  std::vector<MedGroup> groups;
+  std::unordered_map<std::string, size_t> groupNameToIndex;
+  std::unordered_map<int, std::vector<size_t>> familyGroups;
+  for (auto& i : meshTags)
   {
-    vtkMedCellData medCell;
-    medCell.cells = vtkSmartPointer<vtkCellArray>::New();
-    medCell.cellData = vtkSmartPointer<vtkCellData>::New();
-    medCell.cellType = maiNodeChild->name;
+    vtkSmartPointer<vtkStringArray> stringArr = i.second;
+    for (vtkIdType j = 0; j < stringArr->GetNumberOfValues(); j++)
+    {
+      const std::string& val = stringArr->GetValue(j);
+      if (groupSelection->ArrayExists(val.c_str()) && !groupSelection->ArrayIsEnabled(val.c_str()))
+      {
+        continue;
+      }
+      auto it = groupNameToIndex.find(val);
+      if (it == groupNameToIndex.end())
+      {
+        it = groupNameToIndex.emplace(val, groups.size()).first;
+        groups.emplace_back();
+        groups.back().name = val;
+      }
+      familyGroups[i.first].push_back(it->second);
+    }
+  }
 
-    HdfNode* maiNodNode = maiNodeChild->findChild("NOD");
+  // Under MAI (cells) there should exist a set of hdf groups for each cell.
+  // Read the (small) family and number arrays first so that the cells in
+  // each group may be counted before any connectivity is read.
+  std::vector<MedCellBlock> cellBlocks;
+  for (auto* maiNodeChild : maiNode->children)
+  {
+    MedCellBlock cellBlock;
+    cellBlock.cellType = maiNodeChild->name;
+    cellBlock.nodNode = maiNodeChild->findChild("NOD");
     HdfNode* maiFamNode = maiNodeChild->findChild("FAM");
     HdfNode* maiNumNode = maiNodeChild->findChild("NUM");
-    if (maiNodNode == nullptr || maiFamNode == nullptr || maiNumNode == nullptr)
+    if (cellBlock.nodNode == nullptr || maiFamNode == nullptr || maiNumNode == nullptr)
     {
       vtkWarningWithObjectMacro(
         self, << "Failed to read mesh, missing either NOD, FAM, or NUM groups");
       return false;
     }
 
-    // Read the cells
-    if (!readCells(fileId, maiNodNode, medCell.cellType, medCell.cells, self))
+    // Check cell type is supported
+    auto vertexCountIt = vertexCount.find(cellBlock.cellType);
+    if (vertexCountIt == vertexCount.end())
     {
-      vtkWarningWithObjectMacro(self, << "Failed to read mesh, cells could not be read");
+      vtkWarningWithObjectMacro(
+        self, << "Failed to read cells, \"" << cellBlock.cellType << "\" cell type not supported.");
       return false;
     }
+    cellBlock.vertexCount = vertexCountIt->second;
+
     // Read the nums/global ids
-    vtkSmartPointer<vtkIntArray> cellNums = vtkSmartPointer<vtkIntArray>::New();
-    cellNums->SetName("NUM");
-    if (!readNums(fileId, maiNumNode, cellNums, self))
+    cellBlock.nums = vtkSmartPointer<vtkIntArray>::New();
+    cellBlock.nums->SetName("NUM");
+    if (!readNums(fileId, maiNumNode, cellBlock.nums, self))
     {
       vtkWarningWithObjectMacro(self, << "Failed to read mesh, cellData could not be read");
       return false;
     }
-    medCell.cellData->SetGlobalIds(cellNums);
     // Read the cell scalars
-    vtkSmartPointer<vtkIntArray> cellFamilies = vtkSmartPointer<vtkIntArray>::New();
-    cellFamilies->SetName("FAM");
-    if (!readFamilies(fileId, maiFamNode, cellFamilies, self))
+    cellBlock.families = vtkSmartPointer<vtkIntArray>::New();
+    cellBlock.families->SetName("FAM");
+    if (!readFamilies(fileId, maiFamNode, cellBlock.families, self))
     {
       vtkWarningWithObjectMacro(self, << "Failed to read mesh, cellData could not be read");
       return false;
     }
-    medCell.cellData->AddArray(cellFamilies);
-    medCells.push_back(medCell);
+
+    for (vtkIdType j = 0; j < cellBlock.families->GetNumberOfValues(); j++)
+    {
+      const int fam = cellBlock.families->GetValue(j);
+      auto groupIt = fam == 0 ? familyGroups.end() : familyGroups.find(fam);
+      if (groupIt == familyGroups.end())
+      {
+        continue;
+      }
+      cellBlock.inGroup = true;
+      for (auto const groupIndex : groupIt->second)
+      {
+        groups[groupIndex].count(cellBlock.cellType, cellBlock.vertexCount);
+      }
+    }
+    cellBlocks.push_back(cellBlock);
+  }
+
+  // Points in a group's families are given vertex cells in the group.
+  vtkIntArray* pointFams = vtkIntArray::SafeDownCast(medPoints.pointData->GetArray("FAM"));
+  vtkIntArray* pointNums = vtkIntArray::SafeDownCast(medPoints.pointData->GetGlobalIds());
+  const vtkIdType numberOfPoints = medPoints.points->GetNumberOfPoints();
+  for (vtkIdType i = 0; i < numberOfPoints; i++)
+  {
+    const int fam = pointFams->GetValue(i);
+    auto groupIt = fam == 0 ? familyGroups.end() : familyGroups.find(fam);
+    if (groupIt != familyGroups.end())
+    {
+      for (auto const groupIndex : groupIt->second)
+      {
+        groups[groupIndex].count("P01", 1);
+      }
+    }
+  }
+  for (auto& group : groups)
+  {
+    group.allocate();
+  }
+
+  // Read the cells of each type, splitting them into the groups as they are read.
+  masterBlock->SetNumberOfBlocks(readAllCells ? static_cast<unsigned int>(cellBlocks.size()) : 0);
+  unsigned int masterIndex = 0;
+  for (auto const& cellBlock : cellBlocks)
+  {
+    if (!readAllCells && !cellBlock.inGroup)
+    {
+      continue;
+    }
+    vtkSmartPointer<vtkIdTypeArray> offsets;
+    vtkSmartPointer<vtkIdTypeArray> connectivity;
+    const vtkIdType numberOfCells = cellBlock.families->GetNumberOfValues();
+    if (readAllCells)
+    {
+      offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+      offsets->SetNumberOfValues(numberOfCells + 1);
+      offsets->SetValue(numberOfCells, numberOfCells * cellBlock.vertexCount);
+      connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+      connectivity->SetNumberOfValues(numberOfCells * cellBlock.vertexCount);
+    }
+    if (!readCells(fileId, cellBlock, chunkSize, familyGroups, groups, offsets, connectivity, self))
+    {
+      vtkWarningWithObjectMacro(self, << "Failed to read mesh, cells could not be read");
+      return false;
+    }
+    if (readAllCells)
+    {
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(offsets, connectivity);
+      masterBlock->SetBlock(
+        masterIndex++,
+        newGrid(
+          medPoints,
+          medToVtkCellType[cellBlock.cellType],
+          cells,
+          cellBlock.families,
+          cellBlock.nums));
+    }
+  }
+
+  // Add the points to their groups, after any cells.
+  for (vtkIdType i = 0; i < numberOfPoints; i++)
+  {
+    const int fam = pointFams->GetValue(i);
+    auto groupIt = fam == 0 ? familyGroups.end() : familyGroups.find(fam);
+    if (groupIt == familyGroups.end())
+    {
+      continue;
+    }
+    const int pointId = static_cast<int>(i + 1);
+    for (auto const groupIndex : groupIt->second)
+    {
+      // Here, point global ids turn into cell global ids, these overlap with the other cells
+      groups[groupIndex].insert(1, &pointId, 1, pointNums->GetValue(i));
+    }
+  }
+
+  // Form the group output
+  groupBlock->SetNumberOfBlocks(static_cast<unsigned int>(groups.size()));
+  for (unsigned int i = 0; i < static_cast<unsigned int>(groups.size()); i++)
+  {
+    MedGroup& group = groups[i];
+    auto cellTypeIt = medToVtkCellType.find(group.cellType);
+    if (cellTypeIt == medToVtkCellType.end())
+    {
+      groupBlock->SetBlock(i, nullptr);
+      vtkWarningWithObjectMacro(self, << "Med cell type unsupported");
+      continue;
+    }
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(group.offsets, group.connectivity);
+    vtkSmartPointer<vtkUnstructuredGrid> mesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    mesh->SetCells(cellTypeIt->second, cells);
+    mesh->GetCellData()->SetGlobalIds(group.globalIds);
+    mesh->SetPoints(medPoints.points);
+    // copy globalIds, too.
+    mesh->GetPointData()->ShallowCopy(medPoints.pointData);
+    groupBlock->SetBlock(i, mesh);
+    groupBlock->GetMetaData(i)->Set(vtkCompositeDataSet::NAME(), group.name);
   }
   return true;
 }
@@ -487,181 +815,45 @@ static bool isValidVersion(
   return false;
 }
 
-static void setGroupBlock(
-  vtkSmartPointer<vtkMultiBlockDataSet> const& output,
-  const vtkMedPointData& medPoints,
-  std::list<vtkMedCellData>& medCells,
-  std::unordered_map<int, vtkSmartPointer<vtkStringArray>>& meshTags,
-  vtkSmartPointer<vtkObject> const& self)
+//----------------------------------------------------------------------------
+int vtkMedReader::RequestInformation(
+  vtkInformation* /*request*/,
+  vtkInformationVector** /*inputVec*/,
+  vtkInformationVector* /*outputVec*/)
 {
-  // Establish three small maps before performing the split
-  // 1.) group name -> block index (establish a block for every group)
-  // 2.) block index -> group name (inverse of above)
-  // 3.) **fam id -> N block indices** (every fam has a set of blocks/groups)
-  std::unordered_map<std::string, size_t> groupNameToBlockIndex;
-  std::unordered_map<size_t, std::string> blockIndexToGroupName;
-  std::unordered_map<size_t, std::vector<size_t>> famIntToBlockIndices;
-  for (auto& i : meshTags)
+  // Missing files are reported by RequestData
+  if (!this->FileName || !vtksys::SystemTools::FileExists(this->FileName))
   {
-    vtkSmartPointer<vtkStringArray> stringArr = i.second;
-    for (vtkIdType j = 0; j < stringArr->GetNumberOfValues(); j++)
-    {
-      const std::string& val = stringArr->GetValue(j);
-      if (!groupNameToBlockIndex.count(val))
-      {
-        size_t blockIndex = groupNameToBlockIndex.size();
-        groupNameToBlockIndex[val] = blockIndex;
-        blockIndexToGroupName[blockIndex] = val;
-      }
-      famIntToBlockIndices[i.first].push_back(groupNameToBlockIndex[val]);
-    }
-  }
-
-  // Setup each's block/groups cell array, we will build them all at once
-  const size_t numBlocks = groupNameToBlockIndex.size();
-  std::vector<vtkMedCellData> blockedCells(numBlocks);
-  for (auto& blockedCell : blockedCells)
-  {
-    blockedCell.cells = vtkSmartPointer<vtkCellArray>::New();
-    blockedCell.cells->InitTraversal();
-    blockedCell.cellData = vtkSmartPointer<vtkCellData>::New();
-    vtkSmartPointer<vtkIntArray> globalIds = vtkSmartPointer<vtkIntArray>::New();
-    globalIds->SetName("NUM");
-    blockedCell.cellData->SetGlobalIds(globalIds);
+    return 1;
   }
 
-  {
-    // Split the geometry into the cell arrays by face families (loop over all cells, copying into appropriate group)
-    for (auto& medCell : medCells)
-    {
-      vtkSmartPointer<vtkCellArray> cells = medCell.cells;
-      vtkSmartPointer<vtkCellData> cellData = medCell.cellData;
-      const std::string& cellType = medCell.cellType;
-      vtkSmartPointer<vtkIntArray> cellFams = vtkIntArray::SafeDownCast(cellData->GetArray("FAM"));
-      vtkSmartPointer<vtkIntArray> cellNums = vtkIntArray::SafeDownCast(cellData->GetGlobalIds());
-
-      cells->InitTraversal();
-      vtkNew<vtkIdList> cellIds;
-      for (vtkIdType j = 0; j < cells->GetNumberOfCells(); j++)
-      {
-        cells->GetNextCell(cellIds);
-        const int fam = cellFams->GetValue(j);
-        const int globalId = cellNums->GetValue(j);
-        if (fam == 0) // Default family
-        {
-          continue;
-        }
+  const hid_t fileId = H5Fopen(FileName, H5F_ACC_RDONLY, H5P_DEFAULT);
+  const hid_t rootGroupId = H5Gopen(fileId, ".", H5P_DEFAULT);
+  HdfNode* rootNode = rootBuildTree(rootGroupId);
 
-        // Copy this cell to all the blocks
-        const std::vector<size_t>& blockIndices = famIntToBlockIndices[fam];
-        for (auto const blockIndex : blockIndices)
-        {
-          blockedCells[blockIndex].cells->InsertNextCell(cellIds);
-          vtkIntArray::SafeDownCast(blockedCells[blockIndex].cellData->GetGlobalIds())
-            ->InsertNextValue(globalId); // Check this
-          blockedCells[blockIndex].cellType = cellType;
-        }
-      }
-    }
-  }
+  // List the groups of every mesh so they may be selected before reading
+  HdfNode* fasNode = rootNode->findChild("FAS");
+  if (fasNode)
   {
-    // Split the geometry by point families (points are given cells in the vtkCellArray)
-    vtkSmartPointer<vtkPoints> points = medPoints.points;
-    vtkSmartPointer<vtkPointData> pointData = medPoints.pointData;
-    vtkSmartPointer<vtkIntArray> pointFams = vtkIntArray::SafeDownCast(pointData->GetArray("FAM"));
-    vtkSmartPointer<vtkIntArray> pointNums = vtkIntArray::SafeDownCast(pointData->GetGlobalIds());
-    for (vtkIdType i = 0; i < points->GetNumberOfPoints(); i++)
+    for (auto* meshTagsNode : fasNode->children)
     {
-      double pt[3];
-      points->GetPoint(i, pt);
-      const int fam = pointFams->GetValue(i);
-      const int globalId = pointNums->GetValue(i);
-      if (fam == 0) // Default family
+      std::unordered_map<int, vtkSmartPointer<vtkStringArray>> meshTags;
+      if (!readMeshTags(fileId, meshTagsNode, meshTags, this))
       {
         continue;
       }
-
-      // Create point reference in the block
-      vtkSmartPointer<vtkStringArray> stringArr = meshTags[fam];
-      const std::vector<size_t>& blockIndices = famIntToBlockIndices[fam];
-      for (auto const blockIndex : blockIndices)
+      for (auto& tags : meshTags)
       {
-        vtkNew<vtkIdList> cellIds;
-        cellIds->InsertId(0, i);
-        blockedCells[blockIndex].cells->InsertNextCell(cellIds);
-        blockedCells[blockIndex].cellType = "P01";
-        // Here, point global ids turn into cell global ids, these overlap with the other cells
-        vtkIntArray::SafeDownCast(blockedCells[blockIndex].cellData->GetGlobalIds())
-          ->InsertNextValue(globalId);
+        for (vtkIdType j = 0; j < tags.second->GetNumberOfValues(); j++)
+        {
+          this->GroupSelection->AddArray(tags.second->GetValue(j).c_str());
+        }
       }
     }
   }
-  for (auto& blockedCell : blockedCells)
-  {
-    vtkIntArray::SafeDownCast(blockedCell.cellData->GetGlobalIds())->Squeeze();
-  }
-
-  // Form the output
-  output->SetNumberOfBlocks(static_cast<unsigned int>(numBlocks));
-  for (int i = 0; i < static_cast<int>(numBlocks); i++)
-  {
-    vtkSmartPointer<vtkUnstructuredGrid> mesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
-    const std::string medCellType = blockedCells[i].cellType;
-    if (medToVtkCellType.find(medCellType) == medToVtkCellType.end())
-    {
-      output->SetBlock(i, nullptr);
-      vtkWarningWithObjectMacro(self, << "Med cell type unsupported");
-      continue;
-    }
-    mesh->SetCells(medToVtkCellType[medCellType], blockedCells[i].cells);
-    mesh->GetCellData()->SetGlobalIds(blockedCells[i].cellData->GetGlobalIds());
-    mesh->SetPoints(medPoints.points);
-    // copy globalIds, too.
-    mesh->GetPointData()->ShallowCopy(medPoints.pointData);
-    output->SetBlock(i, mesh);
-    output->GetMetaData(i)->Set(vtkCompositeDataSet::NAME(), blockIndexToGroupName[i]);
-  }
-}
-
-static void setMasterBlock(
-  vtkSmartPointer<vtkMultiBlockDataSet> const& masterBlock,
-  const vtkMedPointData& medPoints,
-  const std::list<vtkMedCellData>& medCells)
-{
-  masterBlock->SetNumberOfBlocks(static_cast<unsigned int>(medCells.size()));
-  int j = 0;
-  for (auto const& medCell : medCells)
-  {
-    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-
-    // Set the points, fams, and global ids
-    grid->SetPoints(medPoints.points);
-    vtkDataArray* ptFams = medPoints.pointData->GetArray("FAM");
-    if (ptFams != nullptr)
-    {
-      grid->GetPointData()->AddArray(ptFams);
-    }
-    vtkDataArray* ptNums = medPoints.pointData->GetGlobalIds();
-    if (ptNums != nullptr)
-    {
-      grid->GetPointData()->SetGlobalIds(ptNums);
-    }
 
-    // Set the cells
-    grid->SetCells(medToVtkCellType[medCell.cellType], medCell.cells);
-    vtkDataArray* cellFams = medCell.cellData->GetArray("FAM");
-    if (cellFams != nullptr)
-    {
-      grid->GetCellData()->AddArray(cellFams);
-    }
-    vtkDataArray* cellNums = medCell.cellData->GetGlobalIds();
-    if (cellNums != nullptr)
-    {
-      grid->GetCellData()->SetGlobalIds(cellNums);
-    }
-
-    masterBlock->SetBlock(j++, grid);
-  }
+  Cleanup(fileId, rootNode);
+  return 1;
 }
 
 //----------------------------------------------------------------------------
@@ -717,11 +909,8 @@ int vtkMedReader::RequestData(
   int i = 0;
   for (auto const& iter : ensMaaNode->children)
   {
-    // Read the mesh points and cells
     HdfNode* meshNode = iter;
-    vtkMedPointData medPoints;
-    std::list<vtkMedCellData> medCells;
-    if (!meshNode || !readMesh(fileId, meshNode, medPoints, medCells, this))
+    if (!meshNode)
     {
       vtkWarningMacro("Failed to read file, mesh could not be read");
       Cleanup(fileId, rootNode);
@@ -748,11 +937,23 @@ int vtkMedReader::RequestData(
     meshOutput->SetBlock(0, masterBlock);
     meshOutput->SetBlock(1, groupBlock);
 
-    // Provide all the data per cell type in block 1
-    setMasterBlock(masterBlock, medPoints, medCells);
-
-    // Provide all the groups per group in block 2
-    setGroupBlock(groupBlock, medPoints, medCells, meshTags, this);
+    // Read the mesh, providing all the data per cell type in block 0
+    // and the selected groups in block 1
+    if (!readMesh(
+          fileId,
+          meshNode,
+          meshTags,
+          this->GroupSelection,
+          this->ReadAllCells,
+          this->ChunkSize,
+          masterBlock,
+          groupBlock,
+          this))
+    {
+      vtkWarningMacro("Failed to read file, mesh could not be read");
+      Cleanup(fileId, rootNode);
+      return 0;
+    }
     i++;
   }
 
@@ -785,5 +986,7 @@ void vtkMedReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
-  os << indent << "FileName: " << this->FileName << "\n";
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "ReadAllCells: " << (this->ReadAllCells ? "ON" : "OFF") << "\n";
+  os << indent << "ChunkSize: " << this->ChunkSize << "\n";
 }
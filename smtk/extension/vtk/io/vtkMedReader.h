@@ -15,6 +15,7 @@
 #include "vtkMultiBlockDataSetAlgorithm.h"
 
 class HdfNode;
+class vtkDataArraySelection;
 
 // vtkMedReader reads N meshes from a med file providing all the geometry
 // per cell type as well as all the groups separately
@@ -24,6 +25,11 @@ class HdfNode;
 // Each mesh block then contains 2 vtkMultiBlockDataSet blocks where:
 // Block 0 contains a vtkMultiBlockDataSet of vtkUnstructuredGrids for the entire geometry per cell type
 // Block 1 contains a vtkMultiBlockDataSet of vtkUnstructuredGrids for each group
+//
+// Groups may be selected so that only the parts of a large mesh which are
+// needed are read; when ReadAllCells is off, block 0 is left empty and cells
+// not in a selected group are never read. Connectivity and coordinates are
+// read ChunkSize cells (or points) at a time.
 class SMTKIOVTK_EXPORT vtkMedReader : public vtkMultiBlockDataSetAlgorithm
 {
 public:
@@ -44,9 +50,44 @@ public:
   vtkGetStringMacro(FileName);
   //@}
 
+  //@{
+  /**
+    * The groups to read. This is populated with the name of every group
+    * in the file when the pipeline information is updated. All groups are
+    * enabled by default; disable a group to skip it.
+    */
+  vtkGetObjectMacro(GroupSelection, vtkDataArraySelection);
+  //@}
+
+  //@{
+  /**
+    * Whether to read every cell of each mesh into block 0 (the default)
+    * or only the cells of selected groups.
+    */
+  vtkSetMacro(ReadAllCells, bool);
+  vtkGetMacro(ReadAllCells, bool);
+  vtkBooleanMacro(ReadAllCells, bool);
+  //@}
+
+  //@{
+  /**
+    * The number of cells (or points) read from the file at a time.
+    * This bounds the memory used to convert data from MED's layout.
+    */
+  vtkSetClampMacro(ChunkSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(ChunkSize, vtkIdType);
+  //@}
+
+  vtkMTimeType GetMTime() override;
+
 protected:
-  vtkMedReader() { this->FileName = nullptr; }
-  ~vtkMedReader() override { delete[] this->FileName; }
+  vtkMedReader();
+  ~vtkMedReader() override;
+
+  int RequestInformation(
+    vtkInformation* request,
+    vtkInformationVector** inputVec,
+    vtkInformationVector* outputVec) override;
 
   int RequestData(
     vtkInformation* request,
@@ -58,6 +99,9 @@ protected:
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
   char* FileName;
+  vtkDataArraySelection* GroupSelection;
+  bool ReadAllCells;
+  vtkIdType ChunkSize;
 };
 
 #endif
@@ -21,7 +21,9 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 vtkStandardNewMacro(vtkMedWriter);
 
@@ -78,6 +80,7 @@ static bool writePoints(
   const hid_t fileId,
   const std::string& groupPath,
   const vtkMedPointData& medPts,
+  vtkIdType chunkSize,
   vtkSmartPointer<vtkObject> const& self)
 {
   vtkPoints* points = medPts.points;
@@ -109,23 +112,28 @@ static bool writePoints(
       H5P_DEFAULT,
       H5P_DEFAULT,
       H5P_DEFAULT);
-    auto* vertexBuffer = new double[numPts * 3];
-    for (vtkIdType i = 0; i < numPts; i++)
+    // Write chunkSize points at a time (med vertices are not strided like VTK's)
+    std::vector<double> vertexBuffer;
+    for (vtkIdType first = 0; first < numPts; first += chunkSize)
     {
-      double pt[3];
-      points->GetPoint(i, pt);
+      const vtkIdType count = std::min<vtkIdType>(chunkSize, numPts - first);
+      vertexBuffer.resize(static_cast<std::size_t>(count * 3));
+      for (vtkIdType i = 0; i < count; i++)
+      {
+        double pt[3];
+        points->GetPoint(first + i, pt);
 
-      vertexBuffer[i] = pt[0];
-      vertexBuffer[i + numPts] = pt[1];
-      vertexBuffer[i + numPts * 2] = pt[2];
+        vertexBuffer[i] = pt[0];
+        vertexBuffer[i + count] = pt[1];
+        vertexBuffer[i + count * 2] = pt[2];
+      }
+      medWriteRows(cooDataId, H5T_NATIVE_DOUBLE, numPts, 3, first, count, vertexBuffer);
     }
-    H5Dwrite(cooDataId, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, vertexBuffer);
     writeInt32Attribute(cooDataId, "NBR", numPts);
     writeInt32Attribute(cooDataId, "CGT", 1);
 
     H5Dclose(cooDataId);
     H5Sclose(cooSpaceId);
-    delete[] vertexBuffer;
   }
 
   // Write the NUM data
@@ -175,6 +183,7 @@ static bool writeCells(
   const hid_t fileId,
   const std::string& groupPath,
   const vtkMedCellData& medCells,
+  vtkIdType chunkSize,
   vtkSmartPointer<vtkObject> const& self)
 {
   vtkCellArray* cells = medCells.cells;
@@ -224,23 +233,29 @@ static bool writeCells(
       H5P_DEFAULT,
       H5P_DEFAULT,
       H5P_DEFAULT);
-    auto* indexBuffer = new int[numCells * numPtsPerCell];
+    // Write chunkSize cells at a time (med cells are not strided like VTK's)
+    std::vector<int> indexBuffer;
     cells->InitTraversal();
     vtkNew<vtkIdList> ids;
-    for (vtkIdType i = 0; i < numCells; i++)
+    for (vtkIdType first = 0; first < numCells; first += chunkSize)
     {
-      cells->GetNextCell(ids);
-      for (vtkIdType j = 0; j < numPtsPerCell; j++)
+      const vtkIdType count = std::min<vtkIdType>(chunkSize, numCells - first);
+      indexBuffer.resize(static_cast<std::size_t>(count * numPtsPerCell));
+      for (vtkIdType i = 0; i < count; i++)
       {
-        indexBuffer[i + numCells * j] = static_cast<int>(ids->GetId(j)) + 1;
+        cells->GetNextCell(ids);
+        for (vtkIdType j = 0; j < numPtsPerCell; j++)
+        {
+          indexBuffer[i + count * j] = static_cast<int>(ids->GetId(j)) + 1;
+        }
       }
+      medWriteRows(nodDataId, H5T_NATIVE_INT, numCells, numPtsPerCell, first, count, indexBuffer);
     }
-    H5Dwrite(nodDataId, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, indexBuffer);
     writeInt32Attribute(nodDataId, "NBR", numCells);
     writeInt32Attribute(nodDataId, "CGT", 1);
 
     H5Dclose(nodDataId);
-    delete[] indexBuffer;
+    H5Sclose(nodSpaceId);
   }
 
   // Write the NUM data
@@ -493,6 +508,7 @@ static bool writeMesh(
   const std::string& meshName,
   const vtkMedPointData& medPoints,
   const std::list<vtkMedCellData>& medCells,
+  vtkIdType chunkSize,
   vtkSmartPointer<vtkObject> const& self)
 {
   // Create a group under ENS_MAA for the mesh
@@ -536,7 +552,7 @@ static bool writeMesh(
     writeInt32Attribute(maiGroupId, "CGT", 1);
     for (auto const& i : medCells)
     {
-      if (!writeCells(fileId, maiPath, i, self))
+      if (!writeCells(fileId, maiPath, i, chunkSize, self))
       {
         vtkWarningWithObjectMacro(self, << "Failed to write mesh, cells could not be written");
         return false;
@@ -553,7 +569,7 @@ static bool writeMesh(
     writeInt32Attribute(noeGroupId, "CGS", 1);
     writeInt32Attribute(noeGroupId, "CGT", 1);
     writeStringAttribute(noeGroupId, "PFL", "MED_NO_PROFILE_INTERNAL");
-    if (!writePoints(fileId, noePath, medPoints, self))
+    if (!writePoints(fileId, noePath, medPoints, chunkSize, self))
     {
       vtkWarningWithObjectMacro(self, << "Failed to write mesh, points could not be written");
       return false;
@@ -703,7 +719,7 @@ int vtkMedWriter::RequestData(
     sideSetsFilter->Update();
 
     // Write the mesh
-    if (!writeMesh(fileId, ensMaaPath, meshName, medPts, medCells, this))
+    if (!writeMesh(fileId, ensMaaPath, meshName, medPts, medCells, this->ChunkSize, this))
     {
       vtkWarningMacro(<< "Failed to write file, mesh could not be written");
       return 1;
@@ -748,4 +764,5 @@ void vtkMedWriter::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "FileName: " << this->FileName << "\n";
+  os << indent << "ChunkSize: " << this->ChunkSize << "\n";
 }
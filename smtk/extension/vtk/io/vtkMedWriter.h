@@ -27,6 +27,7 @@ class vtkMultiBlockDataSet;
 // vtkMultiBlockDataSet of vtkUnstructuredGrids
 // per cell type as well as all the groups separately
 // These groups come in a vtkMultiBlockDataSet as vtkUnstructuredGrids.
+// Points and cells are written ChunkSize at a time.
 class SMTKIOVTK_EXPORT vtkMedWriter : public vtkMultiBlockDataSetAlgorithm
 {
 public:
@@ -47,6 +48,15 @@ public:
   VTK_FILEPATH const std::string& GetFileName() const;
   //@}
 
+  //@{
+  /**
+    * The number of cells (or points) converted to MED's layout and
+    * written at a time. This bounds the memory used while writing.
+    */
+  vtkSetClampMacro(ChunkSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(ChunkSize, vtkIdType);
+  //@}
+
 protected:
   vtkMedWriter()
   {
@@ -62,6 +72,7 @@ protected:
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
   std::string FileName;
+  vtkIdType ChunkSize = 1 << 20;
 };
 
 #endif
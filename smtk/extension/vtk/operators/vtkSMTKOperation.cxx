@@ -10,13 +10,17 @@
 
 #include "smtk/extension/vtk/operators/vtkSMTKOperation.h"
 
+#include "vtkCommand.h"
 #include "vtkObjectFactory.h"
 
 vtkStandardNewMacro(vtkSMTKOperation);
 
 vtkSMTKOperation::vtkSMTKOperation() = default;
 
-vtkSMTKOperation::~vtkSMTKOperation() = default;
+vtkSMTKOperation::~vtkSMTKOperation()
+{
+  this->SetProgressText(nullptr);
+}
 
 void vtkSMTKOperation::SetSMTKOperation(smtk::operation::Operation::Ptr op)
 {
@@ -37,14 +41,48 @@ bool vtkSMTKOperation::AbleToOperate()
   return m_smtkOp.lock() ? m_smtkOp.lock()->ableToOperate() : false;
 }
 
+void vtkSMTKOperation::AbortOperation()
+{
+  if (auto op = m_smtkOp.lock())
+  {
+    op->cancel();
+  }
+}
+
 smtk::operation::Operation::Result vtkSMTKOperation::Operate()
 {
-  return m_smtkOp.lock() ? m_smtkOp.lock()->operate() : smtk::operation::Operation::Result();
+  auto op = m_smtkOp.lock();
+  if (!op)
+  {
+    return smtk::operation::Operation::Result();
+  }
+
+  // Forward progress to observers of this object (and to any handler already
+  // set on the operation) for the duration of the operation.
+  smtk::operation::Operation::ProgressHandler previousHandler = op->progressHandler();
+  op->setProgressHandler(
+    [this, previousHandler](
+      const smtk::operation::Operation& operation, double progress, const std::string& message) {
+      if (previousHandler)
+      {
+        previousHandler(operation, progress, message);
+      }
+      this->Progress = progress;
+      this->SetProgressText(message.c_str());
+      this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+    });
+
+  this->Progress = 0.;
+  auto result = op->operate();
+  op->setProgressHandler(previousHandler);
+  return result;
 }
 
 void vtkSMTKOperation::PrintSelf(ostream& os, vtkIndent indent)
 {
   os << indent << "smtk op: " << (m_smtkOp.lock() ? m_smtkOp.lock()->typeName() : "(none)") << endl;
+  os << indent << "Progress: " << this->Progress << endl;
+  os << indent << "ProgressText: " << (this->ProgressText ? this->ProgressText : "(none)") << endl;
 
   this->Superclass::PrintSelf(os, indent);
 }
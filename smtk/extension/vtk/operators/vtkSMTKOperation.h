@@ -12,6 +12,10 @@
 // This Operation class is for linking a vtk pipeline to an smtk operator.
 // For example, a vtk polydata is used as a geometry intput to an operator
 // in an smtk session where the vtk data will be converted to smtk geometry.
+//
+// While Operate() runs, the smtk operation's progress reports are forwarded
+// as vtkCommand::ProgressEvent (with the fraction complete as call data);
+// observers may call AbortOperation() to cancel the operation.
 
 #ifndef smtk_vtk_SMTKOperation_h
 #define smtk_vtk_SMTKOperation_h
@@ -46,10 +50,26 @@ public:
   virtual void SetSMTKOperation(smtk::operation::Operation::Ptr op);
   virtual smtk::operation::Operation::Ptr GetSMTKOperation();
 
+  //Description:
+  //Request that the smtk operator stop at its next safe point.
+  //This may be called from a progress observer or from another thread.
+  virtual void AbortOperation();
+
+  //Description:
+  //Get the fraction complete and the message of the most recent
+  //progress report.
+  vtkGetMacro(Progress, double);
+  vtkGetStringMacro(ProgressText);
+
 protected:
   vtkSMTKOperation();
   ~vtkSMTKOperation() override;
 
+  vtkSetStringMacro(ProgressText);
+
+  double Progress = 0.;
+  char* ProgressText = nullptr;
+
   std::weak_ptr<smtk::operation::Operation> m_smtkOp;
 };
 
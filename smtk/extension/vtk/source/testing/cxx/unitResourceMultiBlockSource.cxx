@@ -10,7 +10,15 @@
 
 #include "smtk/extension/vtk/source/vtkModelMultiBlockSource.h"
 
+#include "smtk/model/Instance.h"
+#include "smtk/model/Resource.h"
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include "vtkMultiBlockDataSet.h"
+#include "vtkIdTypeArray.h"
 #include "vtkNew.h"
+#include "vtkPointData.h"
 #include "vtkPolyData.h"
 
 #include "smtk/common/testing/cxx/helpers.h"
@@ -139,11 +147,162 @@ void TestCache()
 
   std::cout << "  ... Done.\n";
 }
+
+vtkPolyData* FindBlock(vtkMultiBlockDataSet* data, const UUID& uid)
+{
+  for (unsigned int ii = 0; ii < data->GetNumberOfBlocks(); ++ii)
+  {
+    if (
+      data->HasMetaData(ii) &&
+      vtkResourceMultiBlockSource::GetDataObjectUUID(data->GetMetaData(ii)) == uid)
+    {
+      return vtkPolyData::SafeDownCast(data->GetBlock(ii));
+    }
+    if (auto* child = vtkMultiBlockDataSet::SafeDownCast(data->GetBlock(ii)))
+    {
+      if (auto* found = FindBlock(child, uid))
+      {
+        return found;
+      }
+    }
+  }
+  return nullptr;
+}
+
+void TestIncrementalUpdate()
+{
+  std::cout << "Verify that only entities with modified tessellations are regenerated.\n";
+  auto resource = smtk::model::Resource::create();
+  smtk::common::UUIDArray uids = smtk::model::testing::createTet(resource);
+  // The first 7 entities are vertices; entity 21 is a volume.
+  const UUID& vertex = uids[0];
+  const UUID& otherVertex = uids[1];
+  const UUID& volume = uids[21];
+
+  vtkNew<vtkModelMultiBlockSource> src;
+  src->SetModelResource(resource);
+  src->Update();
+  auto* components = vtkMultiBlockDataSet::SafeDownCast(
+    src->GetOutput()->GetBlock(vtkResourceMultiBlockSource::BlockId::Components));
+  test(components != nullptr, "Expect a block of components.");
+
+  vtkDataObject* cachedVertex = src->GetCachedDataObject(vertex);
+  vtkDataObject* cachedOtherVertex = src->GetCachedDataObject(otherVertex);
+  vtkDataObject* cachedVolume = src->GetCachedDataObject(volume);
+  test(cachedVertex && cachedOtherVertex && cachedVolume, "Expect tessellations to be cached.");
+  vtkPolyData* block = FindBlock(components, volume);
+  test(block != nullptr, "Expect a block for the volume.");
+  test(block != cachedVolume, "Expect output blocks to be copies of cached data.");
+  test(
+    block->GetPoints() == vtkPolyData::SafeDownCast(cachedVolume)->GetPoints(),
+    "Expect output blocks to share points with cached data.");
+
+  // Updating without changing any tessellation reuses every cache entry.
+  src->Dirty();
+  src->Update();
+  test(
+    src->GetCachedDataObject(vertex) == cachedVertex &&
+      src->GetCachedDataObject(volume) == cachedVolume,
+    "Expect unmodified entities to reuse cached data.");
+
+  // Move a vertex.
+  resource->setTessellationAndBoundingBox(
+    vertex, smtk::model::Tessellation().addCoords(-1., -1., -1.));
+  src->Dirty();
+  src->Update();
+  components = vtkMultiBlockDataSet::SafeDownCast(
+    src->GetOutput()->GetBlock(vtkResourceMultiBlockSource::BlockId::Components));
+  test(
+    src->GetCachedDataObject(vertex) != cachedVertex, "Expect modified entity to be regenerated.");
+  test(
+    src->GetCachedDataObject(otherVertex) == cachedOtherVertex &&
+      src->GetCachedDataObject(volume) == cachedVolume,
+    "Expect unmodified entities to reuse cached data.");
+  block = FindBlock(components, vertex);
+  test(block && block->GetNumberOfPoints() == 1, "Expect a block for the modified vertex.");
+  double pt[3];
+  block->GetPoint(0, pt);
+  test(pt[0] == -1. && pt[1] == -1. && pt[2] == -1., "Expect the modified vertex's coordinates.");
+
+  // Changing a parameter used to generate the data discards the cache.
+  src->AllowNormalGenerationOff();
+  src->Update();
+  test(
+    src->GetCachedDataObject(otherVertex) != cachedOtherVertex,
+    "Expect a parameter change to regenerate all entities.");
+
+  std::cout << "  ... Done.\n";
+}
+
+void TestInstancePlacements()
+{
+  std::cout << "Verify that instance placements are cached and stored compactly.\n";
+  auto resource = smtk::model::Resource::create();
+  smtk::common::UUIDArray uids = smtk::model::testing::createTet(resource);
+  smtk::model::EntityRef volume(resource, uids[21]);
+  smtk::model::Instance instance = resource->addInstance(volume);
+  instance.setRule("tabular");
+  instance.setFloatProperty(smtk::model::Instance::placements, { 0., 0., 0., 1., 2., 3. });
+  instance.setFloatProperty(smtk::model::Instance::orientations, { 0., 0., 0., 0., 0., 90. });
+  instance.generateTessellation();
+
+  vtkNew<vtkModelMultiBlockSource> src;
+  src->SetModelResource(resource);
+  src->Update();
+  auto* instances = vtkMultiBlockDataSet::SafeDownCast(
+    src->GetOutput()->GetBlock(vtkResourceMultiBlockSource::BlockId::Instances));
+  test(instances && instances->GetNumberOfBlocks() == 1, "Expect a single instance block.");
+  auto* placements = vtkPolyData::SafeDownCast(instances->GetBlock(0));
+  test(placements && placements->GetNumberOfPoints() == 2, "Expect one point per placement.");
+  auto* pd = placements->GetPointData();
+  test(pd->GetArray(VTK_INSTANCE_ORIENTATION) != nullptr, "Expect an orientation column.");
+  test(pd->GetArray(VTK_INSTANCE_SCALE) == nullptr, "Expect no scale column (none provided).");
+  test(pd->GetArray(VTK_INSTANCE_VISIBILITY) == nullptr, "Expect no mask column.");
+  auto* source = vtkIdTypeArray::SafeDownCast(pd->GetArray(VTK_INSTANCE_SOURCE));
+  test(source && source->GetNumberOfTuples() == 2, "Expect a prototype index per placement.");
+  auto* prototypes = vtkMultiBlockDataSet::SafeDownCast(
+    src->GetOutput()->GetBlock(vtkResourceMultiBlockSource::BlockId::Prototypes));
+  test(
+    prototypes && prototypes->GetNumberOfBlocks() == 1 && source->GetValue(1) == 0,
+    "Expect placements to refer to the prototype block.");
+
+  vtkDataObject* cached = src->GetCachedDataObject(instance.entity());
+  test(cached != nullptr && cached != placements, "Expect placements to be cached.");
+  vtkDataArray* points = placements->GetPoints()->GetData();
+
+  // Updating an unmodified instance reuses its placements.
+  src->Dirty();
+  src->Update();
+  instances = vtkMultiBlockDataSet::SafeDownCast(
+    src->GetOutput()->GetBlock(vtkResourceMultiBlockSource::BlockId::Instances));
+  placements = vtkPolyData::SafeDownCast(instances->GetBlock(0));
+  test(src->GetCachedDataObject(instance.entity()) == cached, "Expect cached placements.");
+  test(placements->GetPoints()->GetData() == points, "Expect placements to be shared.");
+
+  // Regenerating the instance's tessellation updates its placements.
+  instance.setFloatProperty(
+    smtk::model::Instance::placements, { 0., 0., 0., 1., 2., 3., 4., 5., 6. });
+  instance.generateTessellation();
+  src->Dirty();
+  src->Update();
+  instances = vtkMultiBlockDataSet::SafeDownCast(
+    src->GetOutput()->GetBlock(vtkResourceMultiBlockSource::BlockId::Instances));
+  placements = vtkPolyData::SafeDownCast(instances->GetBlock(0));
+  test(src->GetCachedDataObject(instance.entity()) != cached, "Expect regenerated placements.");
+  test(placements->GetNumberOfPoints() == 3, "Expect one point per new placement.");
+  test(
+    placements->GetPointData()->GetArray(VTK_INSTANCE_ORIENTATION) == nullptr,
+    "Expect orientations that do not match placements to be ignored.");
+
+  std::cout << "  ... Done.\n";
+}
 } // namespace
 
 int unitResourceMultiBlockSource(int /*unused*/, char** const /*unused*/)
 {
   TestCache();
+  TestIncrementalUpdate();
+  TestInstancePlacements();
 
   return 0;
 }
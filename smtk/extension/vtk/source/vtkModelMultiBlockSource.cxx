@@ -9,6 +9,8 @@
 //=========================================================================
 #include "smtk/extension/vtk/source/vtkModelMultiBlockSource.h"
 
+#include "smtk/common/Parallel.h"
+
 #include "smtk/extension/vtk/geometry/Backend.h"
 #include "smtk/extension/vtk/geometry/Geometry.h"
 
@@ -41,6 +43,7 @@
 #include "vtkCellData.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
@@ -55,17 +58,21 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
 #include "vtkStringArray.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include "boost/filesystem.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <algorithm>
 #include <cerrno>
 #include <cinttypes>
 #include <cstdlib>
+#include <vector>
 
 using namespace smtk::model;
+using SequenceType = vtkResourceMultiBlockSource::SequenceType;
 
 vtkStandardNewMacro(vtkModelMultiBlockSource);
 smtkImplementTracksAllInstances(vtkModelMultiBlockSource);
@@ -82,6 +89,12 @@ vtkModelMultiBlockSource::vtkModelMultiBlockSource()
   }
   this->AllowNormalGeneration = 1;
   this->ShowAnalysisTessellation = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    this->CachedDefaultColor[i] = this->DefaultColor[i];
+  }
+  this->CachedAllowNormalGeneration = this->AllowNormalGeneration;
+  this->CachedShowAnalysisTessellation = this->ShowAnalysisTessellation;
   this->linkInstance();
 }
 
@@ -195,23 +208,46 @@ void vtkModelMultiBlockSource::Dirty()
  *  \brief Request the display tessellation be shown.
  */
 
-static void AddEntityTessToPolyData(
+/// Return the tessellation of an entity that should be rendered.
+static const smtk::model::Tessellation* TessellationToShow(
+  const smtk::model::EntityRef& entityref,
+  int showAnalysisTessellation)
+{
+  return showAnalysisTessellation ? entityref.hasAnalysisMesh() : entityref.hasTessellation();
+}
+
+/// Return the sequence number with which to cache an entity's data.
+///
+/// This is the generation number of its tessellation (plus that of its analysis
+/// mesh when it is shown) or InvalidSequence when the entity has no generation
+/// number, in which case its data cannot be reused.
+static SequenceType TessellationSequence(
   const smtk::model::EntityRef& entityref,
-  vtkPoints* pts,
-  vtkPolyData* pd,
   int showAnalysisTessellation)
 {
-  // gotMesh fetches Analysis mesh if it exists, falling back
-  // to model tessellation if not.
-  const smtk::model::Tessellation* tess =
-    showAnalysisTessellation ? entityref.hasAnalysisMesh() : entityref.hasTessellation();
+  if (!entityref.hasIntegerProperty(SMTK_TESS_GEN_PROP))
+  {
+    return vtkResourceMultiBlockSource::InvalidSequence;
+  }
+  const IntegerList& gen(entityref.integerProperty(SMTK_TESS_GEN_PROP));
+  SequenceType sequence = gen.empty() ? 0 : static_cast<SequenceType>(gen[0]);
+  if (showAnalysisTessellation && entityref.hasIntegerProperty(SMTK_MESH_GEN_PROP))
+  {
+    const IntegerList& meshGen(entityref.integerProperty(SMTK_MESH_GEN_PROP));
+    sequence += meshGen.empty() ? 0 : static_cast<SequenceType>(meshGen[0]);
+  }
+  return sequence < 0 ? 0 : sequence;
+}
+
+static void AddEntityTessToPolyData(
+  const smtk::model::Tessellation* tess,
+  vtkPoints* pts,
+  vtkPolyData* pd)
+{
   if (!tess)
     return;
 
   vtkIdType i;
-  //vtkIdType connOffset = pts->GetNumberOfPoints();
-  std::vector<vtkIdType> conn;
-  std::string uuidStr = entityref.entity().toString();
   vtkIdType npts = tess->coords().size() / 3;
   for (i = 0; i < npts; ++i)
   {
@@ -281,13 +317,12 @@ static void AddEntityTessToPolyData(
 
 static bool AddColorWithDefault(
   vtkPolyData* pd,
-  const smtk::model::EntityRef& entity,
+  const smtk::model::FloatList& rgba,
   const double defaultColor[4])
 {
   // Only create the color array if there is a valid default:
   if (defaultColor[3] >= 0.)
   {
-    FloatList rgba = entity.color();
     vtkNew<vtkUnsignedCharArray> cellColor;
     cellColor->SetNumberOfComponents(4);
     cellColor->SetNumberOfTuples(1);
@@ -302,6 +337,128 @@ static bool AddColorWithDefault(
   return false;
 }
 
+static bool AddColorWithDefault(
+  vtkPolyData* pd,
+  const smtk::model::EntityRef& entity,
+  const double defaultColor[4])
+{
+  return defaultColor[3] >= 0. && AddColorWithDefault(pd, entity.color(), defaultColor);
+}
+
+/// Return whether normals should be generated for an entity's polygons.
+static bool NeedsNormals(const smtk::model::EntityRef& entity, bool genNormals)
+{
+  if (entity.hasIntegerProperty("generate normals"))
+  { // Allow per-entity setting to override per-model setting
+    const IntegerList& prop(entity.integerProperty("generate normals"));
+    return !prop.empty() && prop[0];
+  }
+  return genNormals;
+}
+
+/// Convert a tessellation into polydata. This does not access the model
+/// resource or run a VTK pipeline, so many tessellations may be converted
+/// concurrently. Call FinishPolyData() on the result before use.
+static vtkSmartPointer<vtkPolyData> PolyDataFromTessellation(
+  const smtk::model::Tessellation* tess,
+  const smtk::model::FloatList& color,
+  const double defaultColor[4])
+{
+  vtkSmartPointer<vtkPolyData> pd = vtkSmartPointer<vtkPolyData>::New();
+  vtkNew<vtkPoints> pts;
+  pts->SetDataTypeToDouble();
+  pd->SetPoints(pts.GetPointer());
+  if (tess)
+  {
+    pts->Allocate(static_cast<vtkIdType>(tess->coords().size() / 3));
+    AddEntityTessToPolyData(tess, pts.GetPointer(), pd);
+  }
+  AddColorWithDefault(pd, color, defaultColor);
+  return pd;
+}
+
+/// Generate normals for polydata from PolyDataFromTessellation() (when asked)
+/// and add its point coordinates as an attribute.
+///
+/// Normals are generated by executing a vtkPolyDataNormals filter. Pipeline
+/// execution is not safe to run from several threads at once, so this must
+/// only be called from one thread at a time when \a genNormals is true.
+static void FinishPolyData(vtkPolyData* pd, bool genNormals)
+{
+  if (genNormals && pd->GetPolys()->GetSize() > 0)
+  {
+    vtkNew<vtkPolyDataNormals> normalGenerator;
+    normalGenerator->SetInputDataObject(pd);
+    normalGenerator->Update();
+    pd->ShallowCopy(normalGenerator->GetOutput());
+  }
+  vtkModelMultiBlockSource::AddPointsAsAttribute(pd);
+}
+
+namespace
+{
+/// An entity whose tessellation must be converted into polydata, along with
+/// everything the conversion needs from the model resource.
+struct TessellationTask
+{
+  smtk::common::UUID Entity;
+  SequenceType Sequence;
+  const smtk::model::Tessellation* Tessellation;
+  smtk::model::FloatList Color;
+  bool GenerateNormals;
+  // Where the result belongs in the output (or -1 when it is not rendered).
+  int BlockType;
+  int BlockIndex;
+  vtkSmartPointer<vtkPolyData> Data;
+};
+
+// Tessellations are converted in groups of this many per task.
+constexpr std::size_t s_tasksPerChunk = 64;
+
+/// Convert the tessellation of each task, concurrently when there are many.
+/// Normals are generated afterward on the calling thread.
+void ConvertTessellations(std::vector<TessellationTask>& tasks, const double defaultColor[4])
+{
+  smtk::common::forEachChunk(
+    tasks.size(),
+    s_tasksPerChunk,
+    [&tasks, defaultColor](std::size_t, std::size_t begin, std::size_t end) {
+      for (std::size_t ii = begin; ii < end; ++ii)
+      {
+        auto& task = tasks[ii];
+        task.Data = PolyDataFromTessellation(task.Tessellation, task.Color, defaultColor);
+        if (!task.GenerateNormals)
+        {
+          FinishPolyData(task.Data, false);
+        }
+      }
+    });
+  for (auto& task : tasks)
+  {
+    if (task.GenerateNormals)
+    {
+      FinishPolyData(task.Data, true);
+    }
+  }
+}
+
+/// Return a shallow copy of cached data for use as an output block, so that
+/// annotating the block does not modify the cache.
+vtkSmartPointer<vtkDataObject> CopyOfCachedData(vtkDataObject* cached)
+{
+  vtkSmartPointer<vtkDataObject> block;
+  block.TakeReference(cached->NewInstance());
+  block->ShallowCopy(cached);
+  vtkNew<vtkFieldData> fieldData;
+  if (cached->GetFieldData())
+  {
+    fieldData->ShallowCopy(cached->GetFieldData());
+  }
+  block->SetFieldData(fieldData);
+  return block;
+}
+} // namespace
+
 /// Add customized block info.
 /// Mapping from UUID to block id
 /// 'Volume' field array to color by volume
@@ -349,20 +506,17 @@ vtkSmartPointer<vtkDataObject> vtkModelMultiBlockSource::GenerateRepresentationF
   bool genNormals)
 {
   vtkSmartPointer<vtkDataObject> obj;
-  SequenceType gen = this->GetCachedDataSequenceNumber(entity.entity());
+  this->Visited.insert(entity.entity());
+  SequenceType sequence = TessellationSequence(entity, this->ShowAnalysisTessellation);
   if (
-    entity.hasIntegerProperty(SMTK_TESS_GEN_PROP) &&
-    entity.integerProperty(SMTK_TESS_GEN_PROP)[0] <= gen)
+    sequence != InvalidSequence && sequence <= this->GetCachedDataSequenceNumber(entity.entity()))
   {
     obj = this->GetCachedDataObject(entity.entity());
     return obj;
   }
 
   // We are going to cache what we create. Find out the cache sequence number to use.
-  int sequence = entity.hasIntegerProperty(SMTK_TESS_GEN_PROP)
-    ? entity.integerProperty(SMTK_TESS_GEN_PROP)[0]
-    : 0;
-  if (sequence < 0)
+  if (sequence == InvalidSequence)
   {
     sequence = 0;
   }
@@ -418,36 +572,19 @@ vtkSmartPointer<vtkPolyData> vtkModelMultiBlockSource::GenerateRepresentationFro
   const smtk::model::Tessellation* tess,
   bool genNormals)
 {
-  vtkSmartPointer<vtkPolyData> pd = vtkSmartPointer<vtkPolyData>::New();
-  vtkNew<vtkPoints> pts;
-  pts->SetDataTypeToDouble();
-  pd->SetPoints(pts.GetPointer());
-
-  vtkIdType npts = tess->coords().size() / 3;
-  pts->Allocate(npts);
   smtk::model::EntityPtr entrec;
-  if (entity.isValid(&entrec))
+  if (!entity.isValid(&entrec))
   {
-    AddEntityTessToPolyData(entity, pts.GetPointer(), pd, this->ShowAnalysisTessellation);
-    AddColorWithDefault(pd, entity, this->DefaultColor);
-    if (this->AllowNormalGeneration && pd->GetPolys()->GetSize() > 0)
-    {
-      bool reallyNeedNormals = genNormals;
-      if (entity.hasIntegerProperty("generate normals"))
-      { // Allow per-entity setting to override per-model setting
-        const IntegerList& prop(entity.integerProperty("generate normals"));
-        reallyNeedNormals = (!prop.empty() && prop[0]);
-      }
-      if (reallyNeedNormals)
-      {
-        this->NormalGenerator->SetInputDataObject(pd);
-        this->NormalGenerator->Update();
-        pd->ShallowCopy(this->NormalGenerator->GetOutput());
-      }
-    }
-
-    vtkModelMultiBlockSource::AddPointsAsAttribute(pd);
+    vtkSmartPointer<vtkPolyData> pd = vtkSmartPointer<vtkPolyData>::New();
+    vtkNew<vtkPoints> pts;
+    pts->SetDataTypeToDouble();
+    pts->Allocate(static_cast<vtkIdType>(tess->coords().size() / 3));
+    pd->SetPoints(pts.GetPointer());
+    return pd;
   }
+  vtkSmartPointer<vtkPolyData> pd = PolyDataFromTessellation(
+    TessellationToShow(entity, this->ShowAnalysisTessellation), entity.color(), this->DefaultColor);
+  FinishPolyData(pd, this->AllowNormalGeneration && NeedsNormals(entity, genNormals));
   return pd;
 }
 
@@ -520,7 +657,8 @@ void vtkModelMultiBlockSource::GenerateRepresentationFromModel(
   smtk::model::EntityPtr entity;
   if (entityref.isValid(&entity))
   {
-    AddEntityTessToPolyData(entityref, pts.GetPointer(), pd, this->ShowAnalysisTessellation);
+    AddEntityTessToPolyData(
+      TessellationToShow(entityref, this->ShowAnalysisTessellation), pts.GetPointer(), pd);
     AddColorWithDefault(pd, entity, this->DefaultColor);
     if (this->AllowNormalGeneration && pd->GetPolys()->GetSize() > 0)
     {
@@ -660,153 +798,157 @@ void vtkModelMultiBlockSource::PreparePrototypeOutput(
   iter->Delete();
 }
 
-/// Called by GenerateRepresentationFromModel to create a polydata per instance
+/// Called by GenerateRepresentationFromModel to create a polydata per instance.
+///
+/// Placements are cached per instance (keyed by the generation number of the
+/// instance's tessellation), so only instances whose placements have changed
+/// are regenerated. Each output block is a shallow copy of the cached data.
 void vtkModelMultiBlockSource::PrepareInstanceOutput(
   vtkMultiBlockDataSet* instanceBlocks,
   const smtk::model::InstanceSet& modelInstances,
   std::map<smtk::model::EntityRef, vtkIdType>& instancePrototypes)
 {
   instanceBlocks->SetNumberOfBlocks(static_cast<int>(modelInstances.size()));
-  int block = 0;
+  unsigned int block = 0;
   for (const auto& instance : modelInstances)
   {
-    const smtk::model::Tessellation* tess = instance.hasTessellation();
-    vtkIdType numPoints = static_cast<vtkIdType>(tess->coords().size() / 3);
+    vtkSmartPointer<vtkDataObject> instancePoly;
+    EntityRef proto = instance.prototype();
+    std::map<smtk::model::EntityRef, vtkIdType>::iterator it;
+    if (
+      !proto.isValid() ||
+      ((it = instancePrototypes.find(proto)) == instancePrototypes.end()) ||
+      it->second < 0 // Does the prototype have a valid block ID (i.e., a tessellation)?
+    )
+    {
+      smtkWarningMacro(
+        this->GetModelResource()->log(),
+        "Prototype (" << proto.name() << ") for instance (" << instance.name()
+                      << ") has no VTK dataset");
+      instancePoly = vtkSmartPointer<vtkPolyData>::New();
+    }
+    else
+    {
+      const smtk::common::UUID& uid = instance.entity();
+      this->Visited.insert(uid);
+      SequenceType sequence = TessellationSequence(instance, false);
+      auto* placements = vtkPolyData::SafeDownCast(this->GetCachedDataObject(uid));
+      if (
+        !placements || sequence == vtkResourceMultiBlockSource::InvalidSequence ||
+        this->GetCachedDataSequenceNumber(uid) != sequence)
+      {
+        vtkSmartPointer<vtkPolyData> generated = this->GenerateInstancePlacements(instance);
+        this->SetCachedData(
+          uid, generated, sequence == vtkResourceMultiBlockSource::InvalidSequence ? 0 : sequence);
+        placements = generated;
+      }
 
-    vtkNew<vtkPolyData> instancePoly;
-    vtkNew<vtkPoints> instancePts;
-    instancePts->Allocate(numPoints);
-    instancePoly->SetPoints(instancePts.GetPointer());
-    instanceBlocks->SetBlock(block, instancePoly.GetPointer());
+      // The prototype's block ID changes as other prototypes come and go without
+      // modifying the instance, so the column holding it is kept up to date here.
+      auto* source =
+        vtkIdTypeArray::SafeDownCast(placements->GetPointData()->GetArray(VTK_INSTANCE_SOURCE));
+      vtkIdType numPlacements = placements->GetNumberOfPoints();
+      if (!source || (numPlacements > 0 && source->GetValue(0) != it->second))
+      {
+        vtkNew<vtkIdTypeArray> sourceColumn;
+        sourceColumn->SetName(VTK_INSTANCE_SOURCE);
+        sourceColumn->SetNumberOfTuples(numPlacements);
+        std::fill(
+          sourceColumn->GetPointer(0), sourceColumn->GetPointer(0) + numPlacements, it->second);
+        placements->GetPointData()->AddArray(sourceColumn);
+      }
+      instancePoly = CopyOfCachedData(placements);
+    }
 
-    // const smtk::model::EntityRef entRef = instance.prototype();
+    instanceBlocks->SetBlock(block, instancePoly);
     vtkModelMultiBlockSource::SetDataObjectUUID(
       instanceBlocks->GetMetaData(block), instance.entity());
     vtkModelMultiBlockSource::SetDataObjectUUID(instancePoly->GetInformation(), instance.entity());
-    block++;
-
-    vtkNew<vtkDoubleArray> instanceOrient;
-    vtkNew<vtkDoubleArray> instanceScale;
-    vtkNew<vtkIdTypeArray> instancePrototype;  // block ID of prototype object
-    vtkNew<vtkUnsignedCharArray> instanceMask; // visibility control
-
-    instanceOrient->SetName(VTK_INSTANCE_ORIENTATION);
-    instanceScale->SetName(VTK_INSTANCE_SCALE);
-    instancePrototype->SetName(VTK_INSTANCE_SOURCE);
-    instanceMask->SetName(VTK_INSTANCE_VISIBILITY);
-
-    instanceOrient->SetNumberOfComponents(3);
-    instanceScale->SetNumberOfComponents(3);
-
-    //instanceOrient->SetNumberOfTuples(numPoints);
-    //instanceScale->SetNumberOfTuples(numPoints);
-    //instancePrototype->SetNumberOfTuples(numPoints);
-    //instanceMask->SetNumberOfTuples(numPoints);
-
-    instanceOrient->Allocate(numPoints);
-    instanceScale->Allocate(numPoints);
-    instancePrototype->Allocate(numPoints);
-    instanceMask->Allocate(numPoints);
-
-    // WARNING: Pointdata-array indices are used blindly in AddInstancePoints. Do not reorder:
-    auto* pd = instancePoly->GetPointData();
-    pd->AddArray(instanceOrient.GetPointer());
-    pd->AddArray(instanceScale.GetPointer());
-    pd->AddArray(instancePrototype.GetPointer());
-    pd->AddArray(instanceMask.GetPointer());
-
-    this->AddInstancePoints(instancePoly.GetPointer(), instance, instancePrototypes);
+    ++block;
   }
 }
 
-/// Called by GenerateRepresentationFromModel to add a glyph point per instance location.
-void vtkModelMultiBlockSource::AddInstancePoints(
-  vtkPolyData* instancePoly,
-  const smtk::model::Instance& inst,
-  std::map<smtk::model::EntityRef, vtkIdType>& instancePrototypes)
+/// Called by PrepareInstanceOutput to convert an instance's placements into glyph points.
+///
+/// Each placement attribute is stored as its own contiguous column and copied in
+/// bulk from the instance's tables (which use the same interleaved layout).
+/// Columns the instance does not provide are omitted rather than filled with
+/// default values, which saves most of the memory for large, untransformed instances.
+vtkSmartPointer<vtkPolyData> vtkModelMultiBlockSource::GenerateInstancePlacements(
+  const smtk::model::Instance& inst)
 {
-  EntityRef proto;
-  const smtk::model::Tessellation* tess;
-  std::map<smtk::model::EntityRef, vtkIdType>::iterator it;
-  if (
-    !inst.isValid() ||                      // Is the instance in the model resource?
-    !(tess = inst.hasTessellation()) ||     // Does it have a tessellation that places instances?
-    tess->coords().size() < 3 ||            // Does the tessellation contain at least 1 placement?
-    !((proto = inst.prototype()).isValid()) // Does it have a prototype entity?
-  )
+  auto instancePoly = vtkSmartPointer<vtkPolyData>::New();
+  const smtk::model::Tessellation* tess = inst.hasTessellation();
+  if (!tess)
   {
-    smtkWarningMacro(
-      this->GetModelResource()->log(),
-      "Instance " << inst.entity() << " was invalid, has no tessellation, or has no prototype.");
-    return;
+    return instancePoly;
   }
-  if (
-    ((it = instancePrototypes.find(proto)) == instancePrototypes.end()) ||
-    it->second < 0 // Does the prototype have a valid block ID (i.e., a tessellation)?
-  )
+  const std::vector<double>& coords = tess->coords();
+  std::size_t nptsThisInst = coords.size() / 3;
+  vtkIdType numPoints = static_cast<vtkIdType>(nptsThisInst);
+
+  vtkNew<vtkDoubleArray> positions;
+  positions->SetNumberOfComponents(3);
+  positions->SetNumberOfTuples(numPoints);
+  std::copy(coords.begin(), coords.begin() + 3 * nptsThisInst, positions->GetPointer(0));
+  vtkNew<vtkPoints> instancePts;
+  instancePts->SetData(positions);
+  instancePoly->SetPoints(instancePts);
+
+  // Orientation, scale, mask and color are only honored for tabular instances.
+  if (inst.rule() != "tabular")
   {
-    smtkWarningMacro(
-      this->GetModelResource()->log(),
-      "Prototype (" << proto.name() << ") for instance (" << inst.name() << ") has no VTK dataset");
-    return;
+    return instancePoly;
   }
-  vtkPoints* pts = instancePoly->GetPoints();
   auto* pd = instancePoly->GetPointData();
-  // WARNING: Array indices are hardcoded here for speed. See PrepareInstanceOutput above.
-  auto* orientArray = vtkDoubleArray::SafeDownCast(pd->GetArray(0));
-  auto* scaleArray = vtkDoubleArray::SafeDownCast(pd->GetArray(1));
-  auto* prototypeArray = vtkIdTypeArray::SafeDownCast(pd->GetArray(2));
-  auto* maskArray = vtkUnsignedCharArray::SafeDownCast(pd->GetArray(3));
 
-  std::vector<double>::const_iterator pit = tess->coords().begin();
-  size_t nptsThisInst = static_cast<size_t>(tess->coords().size() / 3);
-
-  // First check if orient, scale, mask and color has been provided in the instance
   const smtk::model::FloatList& orientations = inst.floatProperty(Instance::orientations);
-  bool hasOrientations = orientations.size() == nptsThisInst * 3 && inst.rule() == "tabular";
+  if (orientations.size() == nptsThisInst * 3)
+  {
+    vtkNew<vtkDoubleArray> instanceOrient;
+    instanceOrient->SetName(VTK_INSTANCE_ORIENTATION);
+    instanceOrient->SetNumberOfComponents(3);
+    instanceOrient->SetNumberOfTuples(numPoints);
+    std::copy(orientations.begin(), orientations.end(), instanceOrient->GetPointer(0));
+    pd->AddArray(instanceOrient);
+  }
 
   const smtk::model::FloatList& scales = inst.floatProperty(Instance::scales);
-  bool hasScales = scales.size() == nptsThisInst * 3 && inst.rule() == "tabular";
+  if (scales.size() == nptsThisInst * 3)
+  {
+    vtkNew<vtkDoubleArray> instanceScale;
+    instanceScale->SetName(VTK_INSTANCE_SCALE);
+    instanceScale->SetNumberOfComponents(3);
+    instanceScale->SetNumberOfTuples(numPoints);
+    std::copy(scales.begin(), scales.end(), instanceScale->GetPointer(0));
+    pd->AddArray(instanceScale);
+  }
 
   const smtk::model::IntegerList& masks = inst.integerProperty(Instance::masks);
-  bool hasMasks = masks.size() == nptsThisInst && inst.rule() == "tabular";
+  if (masks.size() == nptsThisInst)
+  {
+    vtkNew<vtkUnsignedCharArray> instanceMask;
+    instanceMask->SetName(VTK_INSTANCE_VISIBILITY);
+    instanceMask->SetNumberOfTuples(numPoints);
+    std::transform(masks.begin(), masks.end(), instanceMask->GetPointer(0), [](long mask) {
+      return static_cast<unsigned char>(mask);
+    });
+    pd->AddArray(instanceMask);
+  }
 
   const smtk::model::FloatList& colors = inst.floatProperty(Instance::colors);
-  bool hasColors = colors.size() == nptsThisInst * 4 && inst.rule() == "tabular";
-
-  double ptOrientDefault[3] = { 0, 0, 0 };
-  double ptScaleDefault[3] = { 1, 1, 1 };
-  vtkNew<vtkUnsignedCharArray> colorArray;
-  if (hasColors)
+  if (colors.size() == nptsThisInst * 4)
   {
+    vtkNew<vtkUnsignedCharArray> colorArray;
     colorArray->SetName(VTK_INSTANCE_COLOR);
     colorArray->SetNumberOfComponents(4);
-    colorArray->Allocate(static_cast<vtkIdType>(nptsThisInst));
-  }
-  for (size_t ii = 0; ii < nptsThisInst; ++ii, pit += 3)
-  {
-    pts->InsertNextPoint(*pit, *(pit + 1), *(pit + 2));
-    prototypeArray->InsertNextValue(it->second); // block ID
-
-    orientArray->InsertNextTuple(hasOrientations ? &orientations[3 * ii] : ptOrientDefault);
-
-    scaleArray->InsertNextTuple(hasScales ? &scales[3 * ii] : ptScaleDefault);
-
-    maskArray->InsertNextValue(hasMasks ? static_cast<unsigned char>(masks[ii]) : 1);
-
-    if (hasColors)
-    {
-      colorArray->InsertNextTuple4(
-        static_cast<unsigned char>(colors[4 * ii]),
-        static_cast<unsigned char>(colors[4 * ii + 1]),
-        static_cast<unsigned char>(colors[4 * ii + 2]),
-        static_cast<unsigned char>(colors[4 * ii + 3]));
-    }
-  }
-  if (hasColors)
-  {
+    colorArray->SetNumberOfTuples(numPoints);
+    std::transform(colors.begin(), colors.end(), colorArray->GetPointer(0), [](double component) {
+      return static_cast<unsigned char>(component);
+    });
     pd->SetScalars(colorArray);
   }
+  return instancePoly;
 }
 
 /// Create a multiblock with the right structure, find entities with tessellations, and add them.
@@ -820,6 +962,11 @@ void vtkModelMultiBlockSource::GenerateRepresentationFromModel(
   std::vector<vtkSmartPointer<vtkDataObject>> blockDatasets[NUMBER_OF_BLOCK_TYPES];
   vtkSmartPointer<vtkMultiBlockDataSet> topBlocks[NUMBER_OF_BLOCK_TYPES];
 
+  // Entities whose tessellations must be converted to polydata. These are
+  // gathered first (since the model resource must be accessed serially) and
+  // then converted concurrently.
+  std::vector<TessellationTask> tasks;
+
   smtk::model::InstanceSet modelInstances;
   // Map from an entity serving as an instance's prototype to its block ID on PROTOTYPE_PORT:
   std::map<smtk::model::EntityRef, vtkIdType> instancePrototypes;
@@ -918,14 +1065,55 @@ void vtkModelMultiBlockSource::GenerateRepresentationFromModel(
       continue;
     }
 
+    bool rendered = !eref.exclusions(Exclusions::Rendering);
+    SequenceType sequence = TessellationSequence(eref, this->ShowAnalysisTessellation);
+    smtk::model::EntityPtr entrec;
+    if (
+      (sequence == InvalidSequence ||
+       sequence > this->GetCachedDataSequenceNumber(eref.entity())) &&
+      eref.hasTessellation() && eref.isValid(&entrec))
+    {
+      // The cached data (if any) is out of date. Leave a place for the
+      // converted tessellation in the output.
+      this->Visited.insert(eref.entity());
+      TessellationTask task;
+      task.Entity = eref.entity();
+      task.Sequence = sequence == InvalidSequence ? 0 : sequence;
+      task.Tessellation = TessellationToShow(eref, this->ShowAnalysisTessellation);
+      task.Color = eref.color();
+      task.GenerateNormals =
+        this->AllowNormalGeneration && NeedsNormals(eref, modelRequiresNormals);
+      task.BlockType = rendered ? bb : -1;
+      task.BlockIndex = rendered ? static_cast<int>(blockDatasets[bb].size()) : -1;
+      tasks.push_back(task);
+      if (rendered)
+      {
+        blockDatasets[bb].push_back(nullptr);
+        blockEntities[bb].push_back(eref);
+      }
+      continue;
+    }
+
     vtkSmartPointer<vtkDataObject> data =
       this->GenerateRepresentationFromModel(eref, modelRequiresNormals);
-    if (data.GetPointer() && !eref.exclusions(Exclusions::Rendering))
+    if (data.GetPointer() && rendered)
     {
       blockDatasets[bb].push_back(data);
       blockEntities[bb].push_back(eref);
     }
   }
+
+  // Convert out-of-date tessellations concurrently and cache the results.
+  ConvertTessellations(tasks, this->DefaultColor);
+  for (const auto& task : tasks)
+  {
+    this->SetCachedData(task.Entity, task.Data, task.Sequence);
+    if (task.BlockType >= 0)
+    {
+      blockDatasets[task.BlockType][task.BlockIndex] = task.Data;
+    }
+  }
+
   // We have all the output, now set up the level-2 multiblock datasets.
   for (bb = 0; bb < NUMBER_OF_BLOCK_TYPES; ++bb)
   {
@@ -937,6 +1125,13 @@ void vtkModelMultiBlockSource::GenerateRepresentationFromModel(
     }
     for (int lb = 0; lb < nlb; ++lb)
     {
+      // Blocks are shallow copies of cached data. Since the entity's color may
+      // change without its tessellation changing, its color is updated here.
+      blockDatasets[bb][lb] = CopyOfCachedData(blockDatasets[bb][lb]);
+      if (auto* pd = vtkPolyData::SafeDownCast(blockDatasets[bb][lb]))
+      {
+        AddColorWithDefault(pd, blockEntities[bb][lb], this->DefaultColor);
+      }
       topBlocks[bb]->SetBlock(lb, blockDatasets[bb][lb].GetPointer());
       topBlocks[bb]->GetMetaData(lb)->Set(
         vtkCompositeDataSet::NAME(), blockEntities[bb][lb].name().c_str());
@@ -1022,6 +1217,12 @@ int vtkModelMultiBlockSource::RequestData(
 
   if (!this->CachedOutputMBDS)
   { // Populate a polydata with tessellation information from the model.
+    // Cached entity data is reused unless the parameters it was generated with
+    // have changed.
+    if (this->CacheParametersChanged())
+    {
+      this->ClearCache();
+    }
     vtkNew<vtkMultiBlockDataSet> rep;
     vtkNew<vtkMultiBlockDataSet> proto;
     vtkNew<vtkMultiBlockDataSet> inst;
@@ -1040,6 +1241,20 @@ int vtkModelMultiBlockSource::RequestData(
   return 1;
 }
 
+bool vtkModelMultiBlockSource::CacheParametersChanged()
+{
+  bool changed = this->CachedAllowNormalGeneration != this->AllowNormalGeneration ||
+    this->CachedShowAnalysisTessellation != this->ShowAnalysisTessellation;
+  for (int i = 0; i < 4; ++i)
+  {
+    changed |= this->CachedDefaultColor[i] != this->DefaultColor[i];
+    this->CachedDefaultColor[i] = this->DefaultColor[i];
+  }
+  this->CachedAllowNormalGeneration = this->AllowNormalGeneration;
+  this->CachedShowAnalysisTessellation = this->ShowAnalysisTessellation;
+  return changed;
+}
+
 void vtkModelMultiBlockSource::SetCachedOutput(
   vtkMultiBlockDataSet* entityTess,
   vtkMultiBlockDataSet* instances,
@@ -37,6 +37,17 @@ class vtkInformationStringKey;
   *
   * This filter generates a single block per UUID, for every UUID
   * in model resource with a tessellation entry.
+  *
+  * The data generated for each entity is cached along with the generation
+  * number of its tessellation; when the source is Dirty(), only entities whose
+  * tessellations have changed are regenerated (concurrently) and the output
+  * blocks are shallow copies of the cached data.
+  *
+  * Instances are output as one point per placement, with a column (point-data
+  * array) per placement attribute for use by a glyph mapper. Optional columns
+  * (orientation, scale, visibility and color) are only present when the instance
+  * provides them; the glyph mapper's defaults apply otherwise. Prototype geometry
+  * is never copied per placement; placements refer to prototype blocks by index.
   */
 class VTKSMTKSOURCEEXT_EXPORT vtkModelMultiBlockSource : public vtkResourceMultiBlockSource
 {
@@ -128,10 +139,7 @@ protected:
     vtkMultiBlockDataSet* instanceBlocks,
     const smtk::model::InstanceSet&,
     std::map<smtk::model::EntityRef, vtkIdType>&);
-  void AddInstancePoints(
-    vtkPolyData* instancePoly,
-    const smtk::model::Instance& inst,
-    std::map<smtk::model::EntityRef, vtkIdType>& instancePrototypes);
+  vtkSmartPointer<vtkPolyData> GenerateInstancePlacements(const smtk::model::Instance& inst);
   void GenerateRepresentationFromModel(
     vtkMultiBlockDataSet* mbds,
     vtkMultiBlockDataSet* instancePoly,
@@ -152,6 +160,10 @@ protected:
 
   void SetCachedOutput(vtkMultiBlockDataSet*, vtkMultiBlockDataSet*, vtkMultiBlockDataSet*);
 
+  /// Return true when the parameters used to generate cached entity data have
+  /// changed since the last call (and record the current parameters).
+  bool CacheParametersChanged();
+
   vtkMultiBlockDataSet* CachedOutputMBDS;
   vtkMultiBlockDataSet* CachedOutputProto;
   vtkMultiBlockDataSet* CachedOutputInst;
@@ -159,6 +171,9 @@ protected:
   int AllowNormalGeneration;
   int ShowAnalysisTessellation;
   vtkNew<vtkPolyDataNormals> NormalGenerator;
+  double CachedDefaultColor[4];
+  int CachedAllowNormalGeneration;
+  int CachedShowAnalysisTessellation;
   std::map<smtk::common::UUID, vtkIdType> UUID2BlockIdMap; // UUIDs to block index map
 
 private:
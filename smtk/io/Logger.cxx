@@ -10,6 +10,9 @@
 
 #include "smtk/io/Logger.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 
@@ -24,9 +27,15 @@ Logger& Logger::instance()
   return Logger::m_instance;
 }
 
+Logger::Logger(const Logger& logger)
+{
+  *this = logger;
+}
+
 Logger::~Logger()
 {
   this->setFlushToStream(nullptr, false, false);
+  this->setSpillToFile(std::string());
   if (m_callback)
   {
     m_callback();
@@ -35,9 +44,28 @@ Logger::~Logger()
 
 Logger& Logger::operator=(const Logger& logger)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_records = logger.m_records;
-  m_hasErrors = logger.m_hasErrors;
+  if (&logger == this)
+  {
+    return *this;
+  }
+
+  // Copy the other logger's records before locking our own mutex so that
+  // the two mutexes are never held at once.
+  std::size_t first = logger.firstRecordIndex();
+  auto records = logger.records(first, logger.numberOfRecords());
+  bool spill;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records.assign(records.begin(), records.end());
+    m_firstRecordIndex = first;
+    m_numberOfRecords = first + m_records.size();
+    m_hasErrors = logger.hasErrors();
+    spill = this->enforceCapacity();
+  }
+  if (spill)
+  {
+    this->spillPending();
+  }
   return *this;
 }
 
@@ -47,14 +75,30 @@ void Logger::addRecord(
   const std::string& fname,
   unsigned int line)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  if ((s == Logger::Error) || (s == Logger::Fatal))
+  if (!this->isEnabled(s))
   {
-    m_hasErrors = true;
+    return;
+  }
+
+  // Construct the record before acquiring the lock to keep the time other
+  // threads wait on it short.
+  Record record(s, m, fname, line);
+  bool spill;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if ((s == Logger::Error) || (s == Logger::Fatal))
+    {
+      m_hasErrors = true;
+    }
+    m_records.push_back(std::move(record));
+    std::size_t nr = ++m_numberOfRecords;
+    this->flushRecordsToStream(nr - 1, nr);
+    spill = this->enforceCapacity();
+  }
+  if (spill)
+  {
+    this->spillPending();
   }
-  m_records.emplace_back(s, m, fname, line);
-  std::size_t nr = this->numberOfRecords();
-  this->flushRecordsToStream(nr - 1, nr);
 }
 
 void Logger::append(const Logger& l)
@@ -65,14 +109,30 @@ void Logger::append(const Logger& l)
     return;
   }
 
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_records.insert(m_records.end(), l.m_records.begin(), l.m_records.end());
-  if (l.m_hasErrors)
+  auto records = l.records();
+  bool spill;
   {
-    m_hasErrors = true;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::size_t nr = this->numberOfRecords();
+    for (auto& record : records)
+    {
+      if (this->isEnabled(record.severity))
+      {
+        m_records.push_back(std::move(record));
+      }
+    }
+    m_numberOfRecords = m_firstRecordIndex + m_records.size();
+    if (l.hasErrors())
+    {
+      m_hasErrors = true;
+    }
+    this->flushRecordsToStream(nr, this->numberOfRecords());
+    spill = this->enforceCapacity();
+  }
+  if (spill)
+  {
+    this->spillPending();
   }
-  std::size_t nr = this->numberOfRecords();
-  this->flushRecordsToStream(nr - l.numberOfRecords(), nr);
 }
 
 void Logger::reset()
@@ -80,18 +140,97 @@ void Logger::reset()
   std::lock_guard<std::mutex> lock(m_mutex);
   m_hasErrors = false;
   m_records.clear();
+  m_firstRecordIndex = 0;
+  m_numberOfRecords = 0;
+}
+
+void Logger::setMinimumSeverity(Severity s)
+{
+  m_minimumSeverity = std::min(static_cast<int>(s), static_cast<int>(Logger::Error));
+}
+
+void Logger::setCapacity(std::size_t maxRecords)
+{
+  bool spill;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = maxRecords;
+    spill = this->enforceCapacity();
+  }
+  if (spill)
+  {
+    this->spillPending();
+  }
+}
+
+std::size_t Logger::capacity() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_capacity;
+}
+
+/**\brief Write records discarded because of the logger's capacity to a file.
+  *
+  * If the file already exists, records are appended to it (and count
+  * toward \a maxBytes).
+  */
+bool Logger::setSpillToFile(const std::string& filename, std::size_t maxBytes, std::size_t maxFiles)
+{
+  // Write any records still queued for the current file before replacing it.
+  this->spillPending();
+
+  std::lock_guard<std::mutex> spillLock(m_spillMutex);
+  m_spilling = false;
+  delete m_spillStream;
+  m_spillStream = nullptr;
+  m_spillFilename = filename;
+  m_spillBytes = 0;
+  m_spillMaxBytes = maxBytes;
+  m_spillMaxFiles = maxFiles;
+  if (filename.empty())
+  {
+    return true;
+  }
+
+  std::ofstream* file = new std::ofstream(filename.c_str(), std::ios::app);
+  if (!file->good())
+  {
+    delete file;
+    m_spillFilename.clear();
+    return false;
+  }
+  file->seekp(0, std::ios::end);
+  m_spillBytes = static_cast<std::size_t>(file->tellp());
+  m_spillStream = file;
+  m_spilling = true;
+  return true;
 }
 
 std::vector<Logger::Record> Logger::records() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_records;
+  return std::vector<Record>(m_records.begin(), m_records.end());
+}
+
+std::vector<Logger::Record> Logger::records(std::size_t begin, std::size_t end) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t first = m_firstRecordIndex;
+  end = std::min(std::max(end, first), first + m_records.size()) - first;
+  begin = std::min(std::max(begin, first) - first, end);
+  return std::vector<Record>(
+    m_records.begin() + static_cast<std::ptrdiff_t>(begin),
+    m_records.begin() + static_cast<std::ptrdiff_t>(end));
 }
 
 Logger::Record Logger::record(std::size_t i) const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_records[i];
+  if (i < m_firstRecordIndex || i - m_firstRecordIndex >= m_records.size())
+  {
+    return Record();
+  }
+  return m_records[i - m_firstRecordIndex];
 }
 
 std::string Logger::severityAsString(Severity s)
@@ -134,8 +273,7 @@ std::string Logger::toString(const Logger::Record& record, bool includeSourceLoc
   */
 std::string Logger::toString(std::size_t i, bool includeSourceLoc) const
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  return this->toString(m_records[i], includeSourceLoc);
+  return this->toString(this->record(i), includeSourceLoc);
 }
 
 /**\brief Convert the given log entry range to a string.
@@ -149,6 +287,10 @@ std::string Logger::toString(std::size_t i, std::size_t j, bool includeSourceLoc
 
 std::string Logger::toStringInternal(std::size_t i, std::size_t j, bool includeSourceLoc) const
 {
+  // Indices are offset by the number of records discarded.
+  std::size_t first = m_firstRecordIndex;
+  i = std::max(i, first) - first;
+  j = std::min(std::max(j, first) - first, m_records.size());
   std::stringstream ss;
   for (; i < j; i++)
   {
@@ -165,6 +307,9 @@ std::string Logger::toStringInternal(std::size_t i, std::size_t j, bool includeS
 std::string Logger::toHTML(std::size_t i, std::size_t j, bool includeSourceLoc) const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t first = m_firstRecordIndex;
+  i = std::max(i, first) - first;
+  j = std::min(std::max(j, first) - first, m_records.size());
   std::stringstream ss;
   ss << "<table>";
   for (; i < j; i++)
@@ -191,12 +336,12 @@ std::string Logger::toHTML(std::size_t i, std::size_t j, bool includeSourceLoc)
 
 std::string Logger::convertToString(bool includeSourceLoc) const
 {
-  return this->toString(0, m_records.size(), includeSourceLoc);
+  return this->toString(this->firstRecordIndex(), this->numberOfRecords(), includeSourceLoc);
 }
 
 std::string Logger::convertToHTML(bool includeSourceLog) const
 {
-  return this->toHTML(0, m_records.size(), includeSourceLog);
+  return this->toHTML(this->firstRecordIndex(), this->numberOfRecords(), includeSourceLog);
 }
 
 /**\brief Request all records be flushed to \a output as they are logged.
@@ -221,7 +366,7 @@ void Logger::setFlushToStream(std::ostream* output, bool ownFile, bool includePa
   m_stream = output;
   m_ownStream = output ? ownFile : false;
   if (includePast)
-    this->flushRecordsToStream(0, this->numberOfRecords());
+    this->flushRecordsToStream(m_firstRecordIndex, this->numberOfRecords());
 }
 
 /**\brief Request all records be flushed to a file with the given \a filename.
@@ -294,12 +439,108 @@ void Logger::setCallback(std::function<void()> fn)
 /// This is a helper routine to write records to the stream (if one has been set).
 void Logger::flushRecordsToStream(std::size_t beginRec, std::size_t endRec)
 {
-  if (m_stream && beginRec < endRec && beginRec < numberOfRecords() && endRec <= numberOfRecords())
+  if (
+    m_stream && beginRec < endRec && beginRec >= m_firstRecordIndex &&
+    endRec <= numberOfRecords())
   {
     (*m_stream) << this->toStringInternal(beginRec, endRec);
     m_stream->flush();
   }
 }
 
+/// Discard the oldest records until no more than the capacity remain. This
+/// must be called while holding m_mutex; when spilling, the discarded records
+/// are queued and true is returned so that the caller calls spillPending()
+/// once the mutex is released.
+bool Logger::enforceCapacity()
+{
+  if (m_capacity == 0)
+  {
+    return false;
+  }
+  const bool spilling = m_spilling;
+  bool queued = false;
+  while (m_records.size() > m_capacity)
+  {
+    if (spilling)
+    {
+      m_spillQueue.push_back(std::move(m_records.front()));
+      queued = true;
+    }
+    m_records.pop_front();
+    ++m_firstRecordIndex;
+  }
+  return queued;
+}
+
+/// Write the records queued by enforceCapacity() to the spill file. This must
+/// be called without holding m_mutex. The queue is taken while holding the
+/// spill mutex, so records reach the file in the order they were discarded.
+void Logger::spillPending()
+{
+  std::lock_guard<std::mutex> spillLock(m_spillMutex);
+  std::deque<Record> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pending.swap(m_spillQueue);
+  }
+  if (!m_spillStream || pending.empty())
+  {
+    return;
+  }
+  for (const auto& record : pending)
+  {
+    this->spillRecord(record);
+  }
+  if (m_spillStream)
+  {
+    m_spillStream->flush();
+  }
+}
+
+/// Write a discarded \a record to the spill file (if one has been set). The
+/// caller must hold the spill mutex.
+void Logger::spillRecord(const Record& record)
+{
+  if (!m_spillStream)
+  {
+    return;
+  }
+  std::string text = Logger::toString(record, true);
+  if (m_spillMaxBytes > 0 && m_spillBytes > 0 && m_spillBytes + text.size() > m_spillMaxBytes)
+  {
+    this->rotateSpillFile();
+    if (!m_spillStream)
+    {
+      return;
+    }
+  }
+  (*m_spillStream) << text;
+  m_spillBytes += text.size();
+}
+
+/// Rename the spill file and its predecessors and start a new spill file.
+void Logger::rotateSpillFile()
+{
+  delete m_spillStream;
+  m_spillStream = nullptr;
+  for (std::size_t ii = m_spillMaxFiles; ii > 0; --ii)
+  {
+    std::string source =
+      ii > 1 ? m_spillFilename + "." + std::to_string(ii - 1) : m_spillFilename;
+    std::string target = m_spillFilename + "." + std::to_string(ii);
+    std::remove(target.c_str());
+    std::rename(source.c_str(), target.c_str());
+  }
+  std::ofstream* file = new std::ofstream(m_spillFilename.c_str(), std::ios::trunc);
+  if (!file->good())
+  {
+    delete file;
+    return;
+  }
+  m_spillStream = file;
+  m_spillBytes = 0;
+}
+
 } // namespace io
 } // namespace smtk
@@ -13,6 +13,8 @@
 
 #include "smtk/CoreExports.h"
 #include "smtk/SystemConfig.h"
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <iosfwd>
 #include <mutex>
@@ -33,13 +35,19 @@
 /**\brief Write the expression \a x to \a logger as an error message.
   *
   * Note that \a x may use the "<<" operator.
+  * Like the other logging macros, \a x is only evaluated if \a logger
+  * keeps records of the macro's severity (see Logger::isEnabled()).
   */
 #define smtkErrorMacro(logger, x)                                                                  \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::Error, s1.str(), __FILE__, __LINE__);                     \
+    smtk::io::Logger& smtkMacroLogger = (logger);                                                  \
+    if (smtkMacroLogger.isEnabled(smtk::io::Logger::Error))                                        \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      smtkMacroLogger.addRecord(smtk::io::Logger::Error, s1.str(), __FILE__, __LINE__);            \
+    }                                                                                              \
   } while (0)
 
 /**\brief Write the expression \a x to \a logger as a warning message.
@@ -49,9 +57,13 @@
 #define smtkWarningMacro(logger, x)                                                                \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::Warning, s1.str(), __FILE__, __LINE__);                   \
+    smtk::io::Logger& smtkMacroLogger = (logger);                                                  \
+    if (smtkMacroLogger.isEnabled(smtk::io::Logger::Warning))                                      \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      smtkMacroLogger.addRecord(smtk::io::Logger::Warning, s1.str(), __FILE__, __LINE__);          \
+    }                                                                                              \
   } while (0)
 
 /**\brief Write the expression \a x to \a logger as a debug message.
@@ -61,9 +73,13 @@
 #define smtkDebugMacro(logger, x)                                                                  \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::Debug, s1.str(), __FILE__, __LINE__);                     \
+    smtk::io::Logger& smtkMacroLogger = (logger);                                                  \
+    if (smtkMacroLogger.isEnabled(smtk::io::Logger::Debug))                                        \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      smtkMacroLogger.addRecord(smtk::io::Logger::Debug, s1.str(), __FILE__, __LINE__);            \
+    }                                                                                              \
   } while (0)
 
 /**\brief Write the expression \a x to \a logger as an informational message.
@@ -76,9 +92,13 @@
 #define smtkInfoMacro(logger, x)                                                                   \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::Info, s1.str());                                          \
+    smtk::io::Logger& smtkMacroLogger = (logger);                                                  \
+    if (smtkMacroLogger.isEnabled(smtk::io::Logger::Info))                                         \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      smtkMacroLogger.addRecord(smtk::io::Logger::Info, s1.str());                                 \
+    }                                                                                              \
   } while (0)
 
 namespace smtk
@@ -90,6 +110,11 @@ namespace io
  *
  * Logger has a singleton interface to a global logger, but is also
  * constructible as a non-singleton object.
+ *
+ * Long-running processes may bound the memory a logger uses with
+ * setCapacity() (optionally spilling discarded records to a rotating
+ * file with setSpillToFile()) and may discard low-severity records
+ * before they are formatted with setMinimumSeverity().
  */
 class SMTKCORE_EXPORT Logger
 {
@@ -123,16 +148,55 @@ public:
 
   Logger() = default;
 
-  Logger(const Logger& logger)
-    : m_hasErrors(logger.m_hasErrors)
-    , m_records(logger.m_records)
-  {
-  }
+  Logger(const Logger& logger);
 
   virtual ~Logger();
 
   Logger& operator=(const Logger& logger);
-  std::size_t numberOfRecords() const { return m_records.size(); }
+
+  ///\brief Return the number of records added since the logger was last reset.
+  ///
+  /// This includes records discarded because the logger's capacity was
+  /// exceeded, so that a record's index does not change as older records
+  /// are discarded.
+  std::size_t numberOfRecords() const { return m_numberOfRecords; }
+  ///\brief Return the index of the oldest record held by the logger.
+  std::size_t firstRecordIndex() const { return m_firstRecordIndex; }
+
+  ///\brief Return true if the logger keeps records of severity \a s.
+  ///
+  /// This is inexpensive, so the logging macros call it to avoid formatting
+  /// messages that would be discarded.
+  bool isEnabled(Severity s) const
+  {
+    return static_cast<int>(s) >= m_minimumSeverity.load(std::memory_order_relaxed);
+  }
+  ///\brief Set or get the least severe records the logger keeps.
+  ///
+  /// Less severe records are discarded as they are added. Errors are always
+  /// kept (since hasErrors() reports them), so the minimum is at most Error.
+  /// By default, all records are kept.
+  void setMinimumSeverity(Severity s);
+  Severity minimumSeverity() const { return static_cast<Severity>(m_minimumSeverity.load()); }
+
+  ///\brief Set or get the maximum number of records held in memory.
+  ///
+  /// When more records are added, the oldest are discarded (or written to
+  /// the spill file, if one has been set). A capacity of 0 (the default)
+  /// holds all records.
+  void setCapacity(std::size_t maxRecords);
+  std::size_t capacity() const;
+
+  ///\brief Write records discarded because of the logger's capacity to \a filename.
+  ///
+  /// Records are appended to the file. Once it holds more than \a maxBytes
+  /// (if nonzero), the file is renamed to "<filename>.1" (with prior files
+  /// renamed to "<filename>.2" and so on, keeping at most \a maxFiles of
+  /// them) and a new file is started. An empty \a filename stops spilling.
+  ///
+  /// Returns true if the file was successfully opened.
+  bool
+  setSpillToFile(const std::string& filename, std::size_t maxBytes = 0, std::size_t maxFiles = 1);
 
   bool hasErrors() const { return m_hasErrors; }
   void clearErrors() { m_hasErrors = false; }
@@ -145,7 +209,10 @@ public:
   /// Note - the reason a copy of the records is returned instead of a reference is to make
   /// the call threadsafe
   std::vector<Record> records() const;
-  ///\brief Return a copy of the ith record in the logger
+  ///\brief Return a copy of the records in [\a begin, \a end) (clamped to the records held).
+  std::vector<Record> records(std::size_t begin, std::size_t end) const;
+  ///\brief Return a copy of the ith record in the logger (or an empty
+  /// record if it has been discarded).
   Record record(std::size_t i) const;
 
   static std::string toString(const Record& record, bool includeSourceLoc = false);
@@ -173,16 +240,35 @@ public:
 protected:
   void flushRecordsToStream(std::size_t beginRec, std::size_t endRec);
   std::string toStringInternal(std::size_t i, std::size_t j, bool includeSourceLoc = false) const;
+  bool enforceCapacity();
+  void spillPending();
+  void spillRecord(const Record& record);
+  void rotateSpillFile();
 
-  bool m_hasErrors{ false };
-  std::vector<Record> m_records;
+  std::atomic<bool> m_hasErrors{ false };
+  std::deque<Record> m_records;
+  std::atomic<std::size_t> m_firstRecordIndex{ 0 };
+  std::atomic<std::size_t> m_numberOfRecords{ 0 };
+  std::atomic<int> m_minimumSeverity{ Debug };
+  std::size_t m_capacity{ 0 };
   std::ostream* m_stream{ nullptr };
   bool m_ownStream{ false };
+  // Records discarded while holding m_mutex are queued here and written to
+  // the spill file after it is released; the spill file's state is guarded
+  // by m_spillMutex, which is never acquired while holding m_mutex.
+  std::atomic<bool> m_spilling{ false };
+  std::deque<Record> m_spillQueue;
+  std::ostream* m_spillStream{ nullptr };
+  std::string m_spillFilename;
+  std::size_t m_spillBytes{ 0 };
+  std::size_t m_spillMaxBytes{ 0 };
+  std::size_t m_spillMaxFiles{ 1 };
   std::function<void()> m_callback;
 
 private:
   static Logger m_instance;
   mutable std::mutex m_mutex;
+  std::mutex m_spillMutex;
 };
 
 template<typename J>
@@ -536,6 +536,11 @@ void XmlV2StringWriter::processAttributeInformation()
   {
     baseDefs = m_includedDefs;
   }
+  if (m_includeInstances)
+  {
+    // Resolve references in bulk rather than one at a time as each attribute is written.
+    m_resource->resolveReferences();
+  }
   std::size_t i, n = baseDefs.size();
   xml_node definitions, attributes;
   for (i = 0; i < n; i++)
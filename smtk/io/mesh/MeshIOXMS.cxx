@@ -24,16 +24,19 @@
 #include "smtk/model/EntityRef.h"
 #include "smtk/model/Resource.h"
 
-#include "smtk/Regex.h"
-
 SMTK_THIRDPARTY_PRE_INCLUDE
 #define BOOST_FILESYSTEM_VERSION 3
 #include "boost/filesystem.hpp"
 #include "boost/system/error_code.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include "smtk/common/Parallel.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <iterator>
 
@@ -165,6 +168,76 @@ std::string to_CardType(smtk::mesh::CellType type)
   return std::string("B4D");
 }
 
+// Cards are formatted (when writing) and parsed (when reading) in chunks
+// concurrently; these are the number of cells or points formatted per task
+// and the minimum number of bytes parsed per task.
+constexpr std::size_t s_cardsPerTask = 1 << 16;
+constexpr std::size_t s_bytesPerTask = 1 << 20;
+
+// Append \a value right-aligned in a field \a width characters wide (as
+// `stream << std::setw(width) << value` does).
+void appendInteger(std::string& buffer, long long value, int width = 0)
+{
+  char digits[24];
+  char* end = digits + sizeof(digits);
+  char* begin = end;
+  unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value)
+                                           : static_cast<unsigned long long>(value);
+  do
+  {
+    *--begin = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  if (value < 0)
+  {
+    *--begin = '-';
+  }
+  int length = static_cast<int>(end - begin);
+  if (length < width)
+  {
+    buffer.append(static_cast<std::size_t>(width - length), ' ');
+  }
+  buffer.append(begin, end);
+}
+
+// Append \a value in a field 12 characters wide (as
+// `stream << std::fixed << std::setw(12) << value` does with the
+// default precision of 6).
+void appendFixed(std::string& buffer, double value)
+{
+  char text[512];
+  int length = std::snprintf(text, sizeof(text), "%12.6f", value);
+  if (length > 0)
+  {
+    buffer.append(text, std::min(static_cast<std::size_t>(length), sizeof(text) - 1));
+  }
+}
+
+// Call \a format on consecutive ranges of [0, \a count) concurrently and
+// write the resulting buffers to \a stream in order. Ranges are formatted in
+// batches of a few per thread, so only one batch of buffers is held in memory
+// at a time.
+template<typename Formatter>
+void writeInParallel(std::ostream& stream, std::size_t count, const Formatter& format)
+{
+  const std::size_t cardsPerBatch = 2 * smtk::common::numberOfThreads() * s_cardsPerTask;
+  std::size_t offset = 0;
+  do
+  {
+    const std::size_t batch = std::min(cardsPerBatch, count - offset);
+    std::vector<std::string> buffers(smtk::common::numberOfChunks(batch, s_cardsPerTask));
+    smtk::common::forEachChunk(
+      batch, s_cardsPerTask, [&](std::size_t task, std::size_t begin, std::size_t end) {
+        format(offset + begin, offset + end, buffers[task]);
+      });
+    for (const auto& buffer : buffers)
+    {
+      stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    offset += batch;
+  } while (offset < count);
+}
+
 class WriteCellsPerRegion
 {
   smtk::mesh::PointSet m_PointSet;
@@ -216,17 +289,7 @@ public:
     smtk::mesh::utility::extractTessellation(cells, m_PointSet, connectivityInfo);
 
     //now we just need to write out the cells
-    std::size_t nCells = cells.size();
-    for (std::size_t i = 0; i < nCells; ++i)
-    {
-      m_Stream << cardType << " \t " << m_CellId++ << " ";
-      for (int j = 0; j < nVerts; ++j)
-      {
-        //We add 1, since the points are written out starting with index 1
-        m_Stream << std::setw(8) << 1 + conn[nVerts * i + j] << " ";
-      }
-      m_Stream << std::setw(8) << regionId << std::endl;
-    }
+    this->writeCards(conn, cells.size(), cardType, regionId, nVerts);
   }
 
   void writeCounterClockwise(
@@ -253,28 +316,50 @@ public:
     //the triangles are all planar, so we can use the shoelace formula
     //to determine if the points are in clockwise order.
     // https://en.wikipedia.org/wiki/Shoelace_formula
-    std::size_t nCells = cells.size();
-    std::size_t cIndex = 0;
-    for (std::size_t i = 0; i < nCells; ++i, cIndex += nVerts)
-    {
-
-      //determine if the triangle/quad is counterclockwise
-      //a positive sum denotes a clockwise winding
-      double sum = find_sum(conn, points, cIndex, nVerts);
-      if (sum > 0)
-      { //we have a clockwise cell that we need to reverse
-        std::reverse(&conn[cIndex], &conn[cIndex + nVerts]);
-      }
+    this->writeCards(conn, cells.size(), cardType, regionId, nVerts, &points);
+  }
 
-      //now that the connectivity is the correct order we can write it out
-      m_Stream << cardType << " \t " << m_CellId++ << " ";
-      for (int j = 0; j < nVerts; ++j)
+protected:
+  // Write one card per cell. Each task formats its range of cells into its
+  // own buffer (reorienting clockwise cells first when \a points is given).
+  void writeCards(
+    std::vector<std::int64_t>& conn,
+    std::size_t nCells,
+    const std::string& cardType,
+    int regionId,
+    int nVerts,
+    const std::vector<double>* points = nullptr)
+  {
+    const int firstCellId = m_CellId;
+    auto format = [&](std::size_t begin, std::size_t end, std::string& buffer) {
+      buffer.reserve((end - begin) * (cardType.size() + 16 + 9 * (nVerts + 1)));
+      for (std::size_t i = begin; i < end; ++i)
       {
-        //We add 1, since the points are written out starting with index 1
-        m_Stream << std::setw(8) << 1 + conn[cIndex + j] << " ";
+        std::size_t cIndex = i * nVerts;
+        //determine if the triangle/quad is counterclockwise
+        //a positive sum denotes a clockwise winding
+        if (points && find_sum(conn, *points, cIndex, nVerts) > 0)
+        { //we have a clockwise cell that we need to reverse
+          std::reverse(&conn[cIndex], &conn[cIndex + nVerts]);
+        }
+
+        //now that the connectivity is the correct order we can write it out
+        buffer += cardType;
+        buffer += " \t ";
+        appendInteger(buffer, firstCellId + static_cast<long long>(i));
+        buffer += ' ';
+        for (int j = 0; j < nVerts; ++j)
+        {
+          //We add 1, since the points are written out starting with index 1
+          appendInteger(buffer, 1 + conn[cIndex + j], 8);
+          buffer += ' ';
+        }
+        appendInteger(buffer, regionId, 8);
+        buffer += '\n';
       }
-      m_Stream << std::setw(8) << regionId << std::endl;
-    }
+    };
+    writeInParallel(m_Stream, nCells, format);
+    m_CellId += static_cast<int>(nCells);
   }
 };
 
@@ -433,12 +518,22 @@ bool write_dm(
   std::vector<double> xyz(numPoints * 3);
   pointSet.get(xyz.data()); //fill our buffer
 
-  for (std::size_t i = 0; i < numPoints; ++i)
-  {
-    stream << "ND \t " << std::setw(8) << 1 + i << " " << std::fixed << std::setw(12) << xyz[3 * i]
-           << " " << std::setw(12) << xyz[(3 * i) + 1] << " " << std::setw(12) << xyz[(3 * i) + 2]
-           << std::endl;
-  }
+  auto format = [&xyz](std::size_t begin, std::size_t end, std::string& buffer) {
+    buffer.reserve((end - begin) * 56);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      buffer += "ND \t ";
+      appendInteger(buffer, static_cast<long long>(1 + i), 8);
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        buffer += ' ';
+        appendFixed(buffer, xyz[(3 * i) + j]);
+      }
+      buffer += '\n';
+    }
+  };
+  writeInParallel(stream, numPoints, format);
+  stream.flush();
 
   return true;
 }
@@ -484,100 +579,6 @@ bool write_dm(
   return write_dm(meshes, stream, type);
 }
 
-std::size_t computeNumberOfPoints(std::istream& stream)
-{
-  std::size_t nPts = 0;
-  std::size_t counter = 0;
-  bool fromComment = false;
-
-  smtk::regex re("\\s+");
-
-  std::string line;
-  while (std::getline(stream, line))
-  {
-    // .*dm files often have a commented out "NNODE" field. Other readers seem
-    // to key off of this commented value, so we do the same (even though we
-    // could just count nodes instead of depending on comment strings).
-
-    // passing -1 as the submatch index parameter performs splitting
-    smtk::sregex_token_iterator first{ line.begin(), line.end(), re, -1 };
-    if (*first == "#NNODE")
-    {
-      fromComment = true;
-      nPts = std::stoul(*(++first));
-      break;
-    }
-    else if (*first == "ND")
-    {
-      ++counter;
-      std::size_t tmp = std::stoul(*(++first));
-      nPts = (nPts < tmp ? tmp : nPts);
-    }
-  }
-
-  // reset the stream to the beginning of the file
-  stream.clear();
-  stream.seekg(0, std::istream::beg);
-
-  if (!fromComment && counter != nPts)
-  {
-    smtkErrorMacro(smtk::io::Logger::instance(), "Unexpected number of points.");
-  }
-  assert(fromComment || counter == nPts);
-
-  return nPts;
-}
-
-bool readPoints(std::istream& stream, const smtk::mesh::BufferedCellAllocatorPtr& bcAllocator)
-{
-  std::string line;
-
-  std::size_t nPts = computeNumberOfPoints(stream);
-
-  bcAllocator->reserveNumberOfCoordinates(nPts);
-
-  smtk::regex re("\\s+");
-
-  std::size_t index;
-  double xyz[3];
-  while (std::getline(stream, line))
-  {
-    // passing -1 as the submatch index parameter performs splitting
-    smtk::sregex_token_iterator first{ line.begin(), line.end(), re, -1 }, last;
-    if (*first == "ND")
-    {
-      // ensure that the file format is at least as long as we expect
-      // (ND <index> <x> <y> <z>)
-      if (std::distance(first, last) < 5)
-      {
-        std::cout << "ERROR: points should have at least 5 fields." << std::endl;
-        return false;
-      }
-
-      // access the point index and shift it from 1-based to 0-based indexing
-      index = std::stoul(*(++first)) - 1;
-
-      // ensure that the index falls within the precomputed range of points
-      assert(index < nPts);
-
-      // access the x, y and z coordiantes
-      for (std::size_t i = 0; i < 3; i++)
-      {
-        xyz[i] = std::stod(*(++first));
-      }
-
-      // set the coordinates
-      bcAllocator->setCoordinate(index, xyz);
-    }
-  }
-
-  // reset the stream to the beginning of the file
-  stream.clear();
-  stream.seekg(0, std::istream::beg);
-
-  return true;
-}
-
 smtk::mesh::CellType to_CellType(const std::string& type)
 {
 
@@ -635,63 +636,337 @@ void condenseMeshsetsByDomain(smtk::mesh::ResourcePtr& meshResource)
   }
 }
 
-bool readCells(
-  std::istream& stream,
-  const smtk::mesh::BufferedCellAllocatorPtr& bcAllocator,
-  smtk::mesh::ResourcePtr& meshResource)
+// Read the entire file at \a filePath into \a buffer with a single read.
+bool readFile(const std::string& filePath, std::string& buffer)
 {
-  smtk::regex re("\\s+");
+  std::ifstream ifs(filePath.c_str(), std::ifstream::in | std::ifstream::binary);
+  if (!ifs)
+  {
+    return false;
+  }
+  ifs.seekg(0, std::ifstream::end);
+  std::streamoff size = ifs.tellg();
+  if (size < 0)
+  {
+    return false;
+  }
+  ifs.seekg(0, std::ifstream::beg);
+  buffer.resize(static_cast<std::size_t>(size));
+  return size == 0 || static_cast<bool>(ifs.read(&buffer[0], size));
+}
 
-  std::string line;
-  std::vector<long long int> connectivity;
-  smtk::mesh::HandleRange cellsWithMaterials = bcAllocator->cells();
-  int currentMaterialId = -1;
-  int materialId;
+// A whitespace-delimited field on a line of a .*dm file.
+struct Field
+{
+  const char* begin{ nullptr };
+  const char* end{ nullptr };
+
+  bool operator==(const char* text) const
+  {
+    std::size_t length = std::strlen(text);
+    return static_cast<std::size_t>(end - begin) == length &&
+      std::equal(begin, end, text);
+  }
+};
+
+bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
 
-  while (std::getline(stream, line))
+// Advance \a cursor past the next field on the line ending at \a lineEnd.
+bool nextField(const char*& cursor, const char* lineEnd, Field& field)
+{
+  while (cursor < lineEnd && isSpace(*cursor))
+  {
+    ++cursor;
+  }
+  if (cursor == lineEnd)
   {
-    // passing -1 as the submatch index parameter performs splitting
-    smtk::sregex_token_iterator first{ line.begin(), line.end(), re, -1 }, last;
-    if (std::string(*first)[0] == 'E')
+    return false;
+  }
+  field.begin = cursor;
+  while (cursor < lineEnd && !isSpace(*cursor))
+  {
+    ++cursor;
+  }
+  field.end = cursor;
+  return true;
+}
+
+// Parse the integer at the start of \a field (as std::stol does), without
+// constructing a string.
+bool parseInteger(const Field& field, long long& value)
+{
+  const char* cursor = field.begin;
+  bool negative = false;
+  if (cursor < field.end && (*cursor == '-' || *cursor == '+'))
+  {
+    negative = (*cursor == '-');
+    ++cursor;
+  }
+  if (cursor == field.end || *cursor < '0' || *cursor > '9')
+  {
+    return false;
+  }
+  unsigned long long magnitude = 0;
+  for (; cursor < field.end && *cursor >= '0' && *cursor <= '9'; ++cursor)
+  {
+    magnitude = 10 * magnitude + static_cast<unsigned long long>(*cursor - '0');
+  }
+  value = negative ? -static_cast<long long>(magnitude) : static_cast<long long>(magnitude);
+  return true;
+}
+
+// Parse the floating-point value at the start of \a field (as std::stod does).
+// The file buffer is null-terminated and fields end in whitespace, so strtod
+// never reads past the field.
+bool parseDouble(const Field& field, double& value)
+{
+  char* end = nullptr;
+  value = std::strtod(field.begin, &end);
+  return end != field.begin;
+}
+
+// The cards parsed from a range of lines of a .*dm file.
+struct ParsedChunk
+{
+  // "ND" cards: 0-based point indices and their coordinates.
+  std::vector<std::size_t> pointIds;
+  std::vector<double> coordinates;
+  std::size_t maxPointId{ 0 };
+  // The value of the first "#NNODE" comment, if any.
+  bool hasNodeCount{ false };
+  std::size_t nodeCount{ 0 };
+  // Element cards (in file order) up to an "END" card.
+  std::vector<smtk::mesh::CellType> cellTypes;
+  std::vector<int> materialIds;
+  std::vector<long long> connectivity;
+  bool foundEnd{ false };
+  // Errors in point cards are always fatal; errors in element cards are
+  // ignored if an earlier chunk ended with an "END" card.
+  std::string pointError;
+  std::string cellError;
+};
+
+// Parse the fields of an element card of the given \a type that follow its
+// name. If the card is incomplete, \a chunk is left unchanged and false is returned.
+bool parseElementCard(
+  smtk::mesh::CellType type,
+  const char* cursor,
+  const char* lineEnd,
+  ParsedChunk& chunk)
+{
+  // ensure that the file format is at least as long as we expect
+  // (E#X <index> <conn_1> <conn_2> ... <conn_n> <group>)
+  const std::size_t start = chunk.connectivity.size();
+  std::size_t nVerticesPerCell = smtk::mesh::verticesPerCell(type);
+  Field field;
+  bool complete = nextField(cursor, lineEnd, field); // skip the cell index.
+  long long value;
+  for (std::size_t i = 0; complete && i < nVerticesPerCell; ++i)
+  {
+    // access the point index and shift it from 1-based to 0-based indexing
+    complete = nextField(cursor, lineEnd, field) && parseInteger(field, value);
+    if (complete)
     {
-      smtk::mesh::CellType type = to_CellType(*first);
+      chunk.connectivity.push_back(value - 1);
+    }
+  }
+  // access the cell's material id
+  complete = complete && nextField(cursor, lineEnd, field) && parseInteger(field, value);
+  if (!complete)
+  {
+    chunk.connectivity.resize(start);
+    return false;
+  }
+  chunk.cellTypes.push_back(type);
+  chunk.materialIds.push_back(static_cast<int>(value));
+  return true;
+}
+
+void parseChunk(const char* begin, const char* end, ParsedChunk& chunk)
+{
+  Field field;
+  for (const char* line = begin; line < end;)
+  {
+    const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+    lineEnd = lineEnd ? lineEnd : end;
+    const char* cursor = line;
+    line = lineEnd + 1;
+
+    // Lines that begin with whitespace have an empty first field and are skipped.
+    if (cursor == lineEnd || isSpace(*cursor) || !nextField(cursor, lineEnd, field))
+    {
+      continue;
+    }
+
+    if (field == "ND")
+    {
+      // ensure that the file format is at least as long as we expect
+      // (ND <index> <x> <y> <z>)
+      long long index;
+      double xyz[3];
+      if (
+        !nextField(cursor, lineEnd, field) || !parseInteger(field, index) ||
+        !nextField(cursor, lineEnd, field) || !parseDouble(field, xyz[0]) ||
+        !nextField(cursor, lineEnd, field) || !parseDouble(field, xyz[1]) ||
+        !nextField(cursor, lineEnd, field) || !parseDouble(field, xyz[2]))
+      {
+        chunk.pointError = "points should have at least 5 fields.";
+        return;
+      }
+      if (index < 1)
+      {
+        chunk.pointError = "point indices must start at 1.";
+        return;
+      }
+      // shift the point index from 1-based to 0-based indexing
+      chunk.pointIds.push_back(static_cast<std::size_t>(index - 1));
+      chunk.coordinates.insert(chunk.coordinates.end(), xyz, xyz + 3);
+      chunk.maxPointId = std::max(chunk.maxPointId, static_cast<std::size_t>(index));
+    }
+    else if (field == "#NNODE")
+    {
+      // .*dm files often have a commented out "NNODE" field. Other readers seem
+      // to key off of this commented value, so we do the same (even though we
+      // could just count nodes instead of depending on comment strings).
+      long long count;
+      if (!chunk.hasNodeCount && nextField(cursor, lineEnd, field) && parseInteger(field, count))
+      {
+        chunk.hasNodeCount = true;
+        chunk.nodeCount = static_cast<std::size_t>(count);
+      }
+    }
+    else if (*field.begin == 'E' && !chunk.foundEnd && chunk.cellError.empty())
+    {
+      std::string card(field.begin, field.end);
+      smtk::mesh::CellType type = to_CellType(card);
       if (type == smtk::mesh::CellType_MAX)
       {
         // Have we reached an "END" string?
-        if (*first == "END")
+        if (card == "END")
         {
-          break;
+          chunk.foundEnd = true;
+          continue;
         }
-        std::cout << "ERROR: Unsupported cell type \"" << *first << "\"." << std::endl;
-        return false;
+        chunk.cellError = "Unsupported cell type \"" + card + "\".";
+        continue;
       }
 
-      std::size_t nVerticesPerCell = smtk::mesh::verticesPerCell(type);
-
-      // ensure that the file format is at least as long as we expect
-      // (E#X <index> <conn_1> <conn_2> ... <conn_n> <group>)
-      typedef std::iterator_traits<smtk::sregex_token_iterator>::difference_type diff_type;
-      if (std::distance(first, last) < static_cast<diff_type>(nVerticesPerCell + 3))
+      if (!parseElementCard(type, cursor, lineEnd, chunk))
       {
-        std::cout << "ERROR: cell type \"" << *first << "\" should have at least "
-                  << nVerticesPerCell + 3 << " fields." << std::endl;
-        return false;
+        chunk.cellError = "cell type \"" + card + "\" should have at least " +
+          std::to_string(smtk::mesh::verticesPerCell(type) + 3) + " fields.";
       }
+    }
+  }
+}
 
-      connectivity.resize(nVerticesPerCell);
+// Split \a buffer at line boundaries and parse the pieces concurrently.
+std::vector<ParsedChunk> parseBuffer(const std::string& buffer)
+{
+  const char* begin = buffer.data();
+  const char* end = begin + buffer.size();
+  std::size_t numberOfChunks =
+    std::min<std::size_t>(smtk::common::numberOfThreads(), 1 + buffer.size() / s_bytesPerTask);
 
-      // skip the cell index.
-      ++first;
+  std::vector<const char*> bounds(1, begin);
+  for (std::size_t i = 1; i < numberOfChunks; ++i)
+  {
+    const char* bound = std::max(bounds.back(), begin + i * (buffer.size() / numberOfChunks));
+    bound = static_cast<const char*>(std::memchr(bound, '\n', end - bound));
+    bounds.push_back(bound ? bound + 1 : end);
+  }
+  bounds.push_back(end);
+
+  std::vector<ParsedChunk> chunks(numberOfChunks);
+  smtk::common::forEachChunk(
+    numberOfChunks, 1, [&bounds, &chunks](std::size_t i, std::size_t, std::size_t) {
+      parseChunk(bounds[i], bounds[i + 1], chunks[i]);
+    });
+  return chunks;
+}
 
-      // access the x, y and z coordiantes
-      for (std::size_t i = 0; i < nVerticesPerCell; i++)
+bool readPoints(
+  const std::vector<ParsedChunk>& chunks,
+  const smtk::mesh::BufferedCellAllocatorPtr& bcAllocator)
+{
+  std::size_t nPts = 0;
+  std::size_t counter = 0;
+  bool fromComment = false;
+  for (const auto& chunk : chunks)
+  {
+    if (!chunk.pointError.empty())
+    {
+      std::cout << "ERROR: " << chunk.pointError << std::endl;
+      return false;
+    }
+    if (chunk.hasNodeCount && !fromComment)
+    {
+      fromComment = true;
+      nPts = chunk.nodeCount;
+    }
+    counter += chunk.pointIds.size();
+  }
+  if (!fromComment)
+  {
+    for (const auto& chunk : chunks)
+    {
+      nPts = std::max(nPts, chunk.maxPointId);
+    }
+    if (counter != nPts)
+    {
+      smtkErrorMacro(smtk::io::Logger::instance(), "Unexpected number of points.");
+    }
+  }
+
+  bcAllocator->reserveNumberOfCoordinates(nPts);
+
+  for (const auto& chunk : chunks)
+  {
+    for (std::size_t i = 0; i < chunk.pointIds.size(); ++i)
+    {
+      // ensure that the index falls within the precomputed range of points
+      if (chunk.pointIds[i] >= nPts)
       {
-        // access the point index and shift it from 1-based to 0-based indexing
-        connectivity[i] = std::stol(*(++first)) - 1;
+        std::cout << "ERROR: point index " << chunk.pointIds[i] + 1 << " exceeds " << nPts << "."
+                  << std::endl;
+        return false;
       }
+      // set the coordinates
+      double xyz[3] = { chunk.coordinates[3 * i],
+                        chunk.coordinates[3 * i + 1],
+                        chunk.coordinates[3 * i + 2] };
+      bcAllocator->setCoordinate(chunk.pointIds[i], xyz);
+    }
+  }
+
+  return true;
+}
+bool readCells(
+  const std::vector<ParsedChunk>& chunks,
+  const smtk::mesh::BufferedCellAllocatorPtr& bcAllocator,
+  smtk::mesh::ResourcePtr& meshResource)
+{
+  std::vector<long long int> connectivity;
+  smtk::mesh::HandleRange cellsWithMaterials = bcAllocator->cells();
+  int currentMaterialId = -1;
+
+  for (const auto& chunk : chunks)
+  {
+    std::size_t offset = 0;
+    for (std::size_t c = 0; c < chunk.cellTypes.size(); ++c)
+    {
+      smtk::mesh::CellType type = chunk.cellTypes[c];
+      std::size_t nVerticesPerCell = smtk::mesh::verticesPerCell(type);
+      connectivity.assign(
+        chunk.connectivity.begin() + offset,
+        chunk.connectivity.begin() + offset + nVerticesPerCell);
+      offset += nVerticesPerCell;
 
       // access the cell's material id
-      materialId = std::stoi(*(++first));
+      int materialId = chunk.materialIds[c];
 
       // if it differs from the current material being parsed...
       if (materialId != currentMaterialId)
@@ -723,6 +998,18 @@ bool readCells(
       // add the cell
       bcAllocator->addCell(type, connectivity.data());
     }
+
+    if (!chunk.cellError.empty())
+    {
+      std::cout << "ERROR: " << chunk.cellError << std::endl;
+      return false;
+    }
+
+    // Element cards after an "END" card are ignored.
+    if (chunk.foundEnd)
+    {
+      break;
+    }
   }
 
   // flush the allocator
@@ -754,7 +1041,7 @@ bool readCells(
   return true;
 }
 
-bool read_dm(std::istream& stream, smtk::mesh::ResourcePtr& meshResource)
+bool read_dm(const std::string& buffer, smtk::mesh::ResourcePtr& meshResource)
 {
   bool success = false;
 
@@ -766,13 +1053,17 @@ bool read_dm(std::istream& stream, smtk::mesh::ResourcePtr& meshResource)
   smtk::mesh::BufferedCellAllocatorPtr bcAllocator =
     meshResource->interface()->bufferedCellAllocator();
 
-  success = readPoints(stream, bcAllocator);
+  // Parse the whole file concurrently; the mesh is then populated serially
+  // in file order.
+  std::vector<ParsedChunk> chunks = parseBuffer(buffer);
+
+  success = readPoints(chunks, bcAllocator);
   if (!success)
   {
     return success;
   }
 
-  success = readCells(stream, bcAllocator, meshResource);
+  success = readCells(chunks, bcAllocator, meshResource);
 
   return success;
 }
@@ -809,8 +1100,12 @@ bool MeshIOXMS::importMesh(
   {
     return false;
   }
-  std::ifstream ifs(filePath.c_str(), std::ifstream::in);
-  bool success = read_dm(ifs, meshResource);
+  std::string buffer;
+  if (!readFile(filePath, buffer))
+  {
+    return false;
+  }
+  bool success = read_dm(buffer, meshResource);
   meshResource->interface()->setModifiedState(false);
   return success;
 }
@@ -26,6 +26,13 @@ inline PySharedPtrClass< smtk::io::Logger > pybind11_init_smtk_io_Logger(py::mod
     .def("deepcopy", (smtk::io::Logger & (smtk::io::Logger::*)(::smtk::io::Logger const &)) &smtk::io::Logger::operator=)
     .def_static("instance", &smtk::io::Logger::instance, pybind11::return_value_policy::reference)
     .def("numberOfRecords", &smtk::io::Logger::numberOfRecords)
+    .def("firstRecordIndex", &smtk::io::Logger::firstRecordIndex)
+    .def("isEnabled", &smtk::io::Logger::isEnabled, py::arg("s"))
+    .def("setMinimumSeverity", &smtk::io::Logger::setMinimumSeverity, py::arg("s"))
+    .def("minimumSeverity", &smtk::io::Logger::minimumSeverity)
+    .def("setCapacity", &smtk::io::Logger::setCapacity, py::arg("maxRecords"))
+    .def("capacity", &smtk::io::Logger::capacity)
+    .def("setSpillToFile", &smtk::io::Logger::setSpillToFile, py::arg("filename"), py::arg("maxBytes") = 0, py::arg("maxFiles") = 1)
     .def("hasErrors", &smtk::io::Logger::hasErrors)
     .def("clearErrors", &smtk::io::Logger::clearErrors)
     .def("addRecord", &smtk::io::Logger::addRecord, py::arg("s"), py::arg("m"), py::arg("fname") = "", py::arg("line") = 0)
@@ -0,0 +1,179 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+// .NAME loggerCapacityTest.cxx -
+// .SECTION Description
+// Test severity filtering and bounded record storage in smtk::io::Logger.
+// .SECTION See Also
+
+#include "smtk/io/Logger.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+//SMTK_SCRATCH_DIR is defined by cmake
+std::string write_root = SMTK_SCRATCH_DIR;
+
+int evaluations = 0;
+
+std::string expensive()
+{
+  ++evaluations;
+  return "expensive";
+}
+
+std::size_t countLines(const std::string& filename)
+{
+  std::ifstream file(filename.c_str());
+  std::size_t lines = 0;
+  std::string line;
+  while (std::getline(file, line))
+  {
+    ++lines;
+  }
+  return lines;
+}
+} // namespace
+
+#define test(condition, message)                                                                   \
+  do                                                                                               \
+  {                                                                                                \
+    if (!(condition))                                                                              \
+    {                                                                                              \
+      std::cerr << message << "\n";                                                                \
+      return 1;                                                                                    \
+    }                                                                                              \
+  } while (0)
+
+int main()
+{
+  // Records below the minimum severity are neither formatted nor kept.
+  {
+    smtk::io::Logger logger;
+    logger.setMinimumSeverity(smtk::io::Logger::Warning);
+    smtkDebugMacro(logger, "debug " << expensive());
+    smtkInfoMacro(logger, "info " << expensive());
+    logger.addRecord(smtk::io::Logger::Info, "info");
+    smtkWarningMacro(logger, "warning " << expensive());
+    test(evaluations == 1, "Filtered messages should not be formatted.");
+    test(logger.numberOfRecords() == 1, "Expected 1 record, got " << logger.numberOfRecords());
+
+    // Errors are never filtered.
+    logger.setMinimumSeverity(smtk::io::Logger::Fatal);
+    test(
+      logger.minimumSeverity() == smtk::io::Logger::Error, "Errors should not be filtered.");
+    smtkErrorMacro(logger, "error");
+    test(logger.hasErrors(), "Logger should have errors.");
+  }
+
+  // Records beyond the capacity are discarded, but indices are stable.
+  {
+    smtk::io::Logger logger;
+    logger.setCapacity(4);
+    for (int ii = 0; ii < 10; ++ii)
+    {
+      smtkInfoMacro(logger, "record " << ii);
+    }
+    test(logger.numberOfRecords() == 10, "Expected 10 records, got " << logger.numberOfRecords());
+    test(
+      logger.firstRecordIndex() == 6,
+      "Expected first record 6, got " << logger.firstRecordIndex());
+    test(logger.records().size() == 4, "Expected 4 records held.");
+    test(logger.record(7).message == "record 7", "Unexpected record 7.");
+    test(logger.record(2).message.empty(), "Discarded records should be empty.");
+    auto range = logger.records(4, 8);
+    test(range.size() == 2 && range[0].message == "record 6", "Range should be clamped.");
+    std::string text = logger.convertToString();
+    test(text.find("record 5") == std::string::npos, "Discarded records should not be printed.");
+    test(text.find("record 9") != std::string::npos, "Missing record 9.");
+
+    // Copies hold the same records at the same indices.
+    smtk::io::Logger copy(logger);
+    test(copy.numberOfRecords() == 10, "Copy should have 10 records.");
+    test(copy.record(9).message == "record 9", "Copy has unexpected record 9.");
+
+    logger.reset();
+    test(logger.numberOfRecords() == 0 && logger.firstRecordIndex() == 0, "Reset failed.");
+  }
+
+  // Discarded records spill to a rotating file.
+  {
+    const std::string filename = write_root + "/loggerCapacityTest.log";
+    for (const auto& name : { filename, filename + ".1", filename + ".2", filename + ".3" })
+    {
+      std::remove(name.c_str());
+    }
+
+    {
+      smtk::io::Logger logger;
+      logger.setCapacity(10);
+      test(logger.setSpillToFile(filename, 1000, 2), "Could not open spill file.");
+      for (int ii = 0; ii < 200; ++ii)
+      {
+        smtkInfoMacro(logger, "spilled record " << ii);
+      }
+      test(logger.records().size() == 10, "Expected 10 records held.");
+    }
+
+    std::ifstream rotated((filename + ".2").c_str());
+    test(rotated.good(), "Spill file was not rotated.");
+    std::ifstream extra((filename + ".3").c_str());
+    test(!extra.good(), "Too many spill files were kept.");
+    std::ifstream current(filename.c_str());
+    std::stringstream contents;
+    contents << current.rdbuf();
+    test(
+      contents.str().find("spilled record 189") != std::string::npos,
+      "Spill file is missing the last discarded record.");
+    test(countLines(filename) < 1000 / 20, "Spill file exceeds its size limit.");
+
+    for (const auto& name : { filename, filename + ".1", filename + ".2" })
+    {
+      std::remove(name.c_str());
+    }
+  }
+
+  // Threads may log concurrently to a bounded logger that spills to a file.
+  {
+    const std::string filename = write_root + "/loggerCapacityTestThreads.log";
+    std::remove(filename.c_str());
+    smtk::io::Logger logger;
+    logger.setCapacity(100);
+    test(logger.setSpillToFile(filename), "Could not open spill file.");
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 4; ++ii)
+    {
+      threads.emplace_back([&logger, ii]() {
+        for (int jj = 0; jj < 1000; ++jj)
+        {
+          smtkInfoMacro(logger, "thread " << ii << " record " << jj);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    test(logger.numberOfRecords() == 4000, "Expected 4000 records.");
+    test(logger.records().size() == 100, "Expected 100 records held.");
+    logger.setSpillToFile(std::string());
+    test(countLines(filename) == 3900, "Expected 3900 spilled records.");
+    std::remove(filename.c_str());
+  }
+
+  return 0;
+}
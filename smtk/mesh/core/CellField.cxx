@@ -106,6 +106,15 @@ smtk::mesh::CellSet CellField::cells() const
   return m_meshset.cells();
 }
 
+smtk::mesh::InterfacePtr CellField::interface() const
+{
+  if (m_meshset.resource() == nullptr)
+  {
+    return smtk::mesh::InterfacePtr();
+  }
+  return m_meshset.resource()->interface();
+}
+
 bool CellField::get(const smtk::mesh::HandleRange& cellIds, void* values) const
 {
   const smtk::mesh::InterfacePtr& iface = m_meshset.resource()->interface();
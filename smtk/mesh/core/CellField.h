@@ -15,6 +15,7 @@
 #include "smtk/PublicPointerDefs.h"
 
 #include "smtk/mesh/core/FieldTypes.h"
+#include "smtk/mesh/core/FieldView.h"
 #include "smtk/mesh/core/Handle.h"
 #include "smtk/mesh/core/MeshSet.h"
 
@@ -147,7 +148,37 @@ public:
     return set(cellIds, values.data());
   }
 
+  //Return a read-only view of the field's values that avoids copying them
+  //when the backend exposes its storage. The view is invalid if <T> does not
+  //match the field type.
+  template<typename T>
+  smtk::mesh::FieldView<const T, smtk::mesh::CellFieldTag> view() const
+  {
+    if (type() != FieldTypeFor<T>::type)
+    {
+      return smtk::mesh::FieldView<const T, smtk::mesh::CellFieldTag>();
+    }
+    return smtk::mesh::FieldView<const T, smtk::mesh::CellFieldTag>(
+      this->interface(), this->cells().range(), smtk::mesh::CellFieldTag(m_name), dimension());
+  }
+
+  //Return a writable view of the field's values that modifies them in place
+  //when the backend exposes its storage. The view is invalid if <T> does not
+  //match the field type.
+  template<typename T>
+  smtk::mesh::FieldView<T, smtk::mesh::CellFieldTag> mutableView()
+  {
+    if (type() != FieldTypeFor<T>::type)
+    {
+      return smtk::mesh::FieldView<T, smtk::mesh::CellFieldTag>();
+    }
+    return smtk::mesh::FieldView<T, smtk::mesh::CellFieldTag>(
+      this->interface(), this->cells().range(), smtk::mesh::CellFieldTag(m_name), dimension());
+  }
+
 private:
+  smtk::mesh::InterfacePtr interface() const;
+
   std::string m_name;
   smtk::mesh::MeshSet m_meshset;
 };
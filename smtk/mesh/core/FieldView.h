@@ -0,0 +1,322 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_core_FieldView_h
+#define smtk_mesh_core_FieldView_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/core/Handle.h"
+#include "smtk/mesh/core/Interface.h"
+#include "smtk/mesh/core/QueryTypes.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+
+//Access to one component of each tuple in a span of field values: element i
+//is the component of the i-th tuple, <stride> values after element i - 1.
+template<typename T>
+class FieldComponent
+{
+public:
+  FieldComponent(T* data, std::size_t size, std::size_t stride)
+    : m_data(data)
+    , m_size(size)
+    , m_stride(stride)
+  {
+  }
+
+  std::size_t size() const { return m_size; }
+  std::size_t stride() const { return m_stride; }
+
+  T& operator[](std::size_t i) const { return m_data[i * m_stride]; }
+
+private:
+  T* m_data;
+  std::size_t m_size;
+  std::size_t m_stride;
+};
+
+//A run of consecutive tuples of a field's values. <first> is the index of the
+//run's first tuple within the field and <size> is its number of tuples; each
+//tuple holds <dimension> interleaved components.
+template<typename T>
+class FieldSpan
+{
+public:
+  FieldSpan(T* data, std::size_t first, std::size_t size, std::size_t dimension)
+    : m_data(data)
+    , m_first(first)
+    , m_size(size)
+    , m_dimension(dimension)
+  {
+  }
+
+  T* data() const { return m_data; }
+  std::size_t first() const { return m_first; }
+  std::size_t size() const { return m_size; }
+  std::size_t dimension() const { return m_dimension; }
+
+  //Return the components of the i-th tuple of the span
+  T* operator[](std::size_t i) const { return m_data + i * m_dimension; }
+
+  //Return strided access to one component of every tuple in the span
+  FieldComponent<T> component(std::size_t c) const
+  {
+    return FieldComponent<T>(m_data + c, m_size, m_dimension);
+  }
+
+private:
+  T* m_data;
+  std::size_t m_first;
+  std::size_t m_size;
+  std::size_t m_dimension;
+};
+
+//A typed view of the values of a cell field or point field that avoids copying
+//them. When the mesh backend exposes its storage (see
+//Interface::fieldStorage()), the view's spans point directly into it and
+//reads and writes happen in place. Otherwise, visit() iterates over the field
+//in chunks that are copied into (and, for writable views, back out of) a
+//buffer, and get()/set() transfer values directly between the caller's memory
+//and the backend.
+//
+//Views are obtained from CellField::view() and PointField::view() (read-only,
+//T is const) or CellField::mutableView() and PointField::mutableView(). A view
+//becomes invalid if its field, its mesh set or the mesh set's entities are
+//modified by other means.
+template<typename T, typename FieldTag>
+class FieldView
+{
+public:
+  typedef typename std::remove_const<T>::type ValueType;
+
+  //Default constructor generates an invalid FieldView
+  FieldView()
+    : m_tag(std::string())
+  {
+  }
+
+  //Construct a view of the field <tag> with <dimension> components per
+  //entity, for the <entities> (cells or points) of a mesh set.
+  FieldView(
+    const smtk::mesh::InterfacePtr& iface,
+    const smtk::mesh::HandleRange& entities,
+    const FieldTag& tag,
+    std::size_t dimension)
+    : m_interface(iface)
+    , m_entities(entities)
+    , m_tag(tag)
+    , m_size(entities.size())
+    , m_dimension(dimension)
+  {
+    if (!m_interface || m_dimension == 0)
+    {
+      m_interface.reset();
+      return;
+    }
+
+    //collect the backend's storage for every interval of entities. If any part
+    //of the field is not exposed, fall back to copying chunks.
+    std::size_t first = 0;
+    for (const auto& interval : m_entities)
+    {
+      smtk::mesh::Handle lower = interval.lower();
+      while (lower <= interval.upper())
+      {
+        const std::size_t remaining = static_cast<std::size_t>(interval.upper() - lower) + 1;
+        void* data = nullptr;
+        std::size_t count = 0;
+        if (
+          !m_interface->fieldStorage(
+            smtk::mesh::HandleInterval(lower, interval.upper()), m_tag, data, count) ||
+          data == nullptr || count == 0)
+        {
+          m_spans.clear();
+          return;
+        }
+        count = std::min(count, remaining);
+        m_spans.emplace_back(static_cast<T*>(data), first, count, m_dimension);
+        first += count;
+        lower += count;
+      }
+    }
+  }
+
+  bool isValid() const { return m_interface != nullptr && m_dimension > 0; }
+
+  //Return the number of tuples (entities) in the view
+  std::size_t size() const { return m_size; }
+
+  //Return the number of components in each tuple
+  std::size_t dimension() const { return m_dimension; }
+
+  //Return true if the spans of the view point directly into the backend's
+  //storage
+  bool isDirect() const { return !m_spans.empty(); }
+
+  //Return true if all values lie in a single span of the backend's storage
+  bool isContiguous() const { return m_spans.size() == 1; }
+
+  //Return the values of a contiguous view, or nullptr otherwise
+  T* data() const { return this->isContiguous() ? m_spans.front().data() : nullptr; }
+
+  //Return the spans of the backend's storage (empty if the view is not direct)
+  const std::vector<FieldSpan<T>>& spans() const { return m_spans; }
+
+  //Call <visitor> with each span of the field's values in the order of the
+  //entities' handles and return a success flag. Direct views visit their
+  //spans; other views visit chunks of up to <chunkSize> tuples held in a
+  //buffer, writing modified chunks back to the backend for writable views.
+  template<typename Visitor>
+  bool visit(Visitor&& visitor, std::size_t chunkSize = 65536) const
+  {
+    if (!this->isValid())
+    {
+      return false;
+    }
+    if (this->isDirect())
+    {
+      for (const auto& span : m_spans)
+      {
+        visitor(span);
+      }
+      this->markModified();
+      return true;
+    }
+
+    chunkSize = std::max<std::size_t>(1, chunkSize);
+    std::vector<ValueType> buffer(std::min(chunkSize, m_size) * m_dimension);
+    for (std::size_t first = 0; first < m_size; first += chunkSize)
+    {
+      const std::size_t count = std::min(chunkSize, m_size - first);
+      const smtk::mesh::HandleRange entities = this->subrange(first, count);
+      if (!m_interface->getField(entities, m_tag, buffer.data()))
+      {
+        return false;
+      }
+      visitor(FieldSpan<T>(buffer.data(), first, count, m_dimension));
+      if (!std::is_const<T>::value && !m_interface->setField(entities, m_tag, buffer.data()))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //Copy the <count> tuples starting at tuple <first> into <values>, which must
+  //hold count * dimension() values.
+  bool get(std::size_t first, std::size_t count, ValueType* values) const
+  {
+    if (!this->isValid() || first + count > m_size)
+    {
+      return false;
+    }
+    if (!this->isDirect())
+    {
+      return count == 0 || m_interface->getField(this->subrange(first, count), m_tag, values);
+    }
+    this->forSpans(first, count, [&values, this](T* data, std::size_t n) {
+      values = std::copy(data, data + n * m_dimension, values);
+    });
+    return true;
+  }
+
+  //Write the <count> tuples starting at tuple <first> from <values>, which must
+  //hold count * dimension() values. Only available for writable views.
+  bool set(std::size_t first, std::size_t count, const ValueType* values) const
+  {
+    static_assert(!std::is_const<T>::value, "Cannot write through a read-only field view.");
+    if (!this->isValid() || first + count > m_size)
+    {
+      return false;
+    }
+    if (!this->isDirect())
+    {
+      return count == 0 || m_interface->setField(this->subrange(first, count), m_tag, values);
+    }
+    this->forSpans(first, count, [&values, this](T* data, std::size_t n) {
+      std::copy(values, values + n * m_dimension, data);
+      values += n * m_dimension;
+    });
+    this->markModified();
+    return true;
+  }
+
+private:
+  //Call functor(data, n) for each part of the spans covering <count> tuples
+  //from tuple <first>
+  template<typename Functor>
+  void forSpans(std::size_t first, std::size_t count, const Functor& functor) const
+  {
+    auto span = std::upper_bound(
+      m_spans.begin(), m_spans.end(), first, [](std::size_t value, const FieldSpan<T>& s) {
+        return value < s.first();
+      });
+    for (--span; count > 0; ++span)
+    {
+      const std::size_t offset = first - span->first();
+      const std::size_t n = std::min(count, span->size() - offset);
+      functor(span->data() + offset * m_dimension, n);
+      first += n;
+      count -= n;
+    }
+  }
+
+  //Return the <count> entities starting at the <first>-th entity of the view
+  smtk::mesh::HandleRange subrange(std::size_t first, std::size_t count) const
+  {
+    smtk::mesh::HandleRange result;
+    for (auto interval = m_entities.begin(); interval != m_entities.end() && count > 0;
+         ++interval)
+    {
+      const std::size_t length = static_cast<std::size_t>(interval->upper() - interval->lower()) + 1;
+      if (first >= length)
+      {
+        first -= length;
+        continue;
+      }
+      const std::size_t n = std::min(count, length - first);
+      result.insert(smtk::mesh::HandleInterval(
+        interval->lower() + first, interval->lower() + first + n - 1));
+      first = 0;
+      count -= n;
+    }
+    return result;
+  }
+
+  void markModified() const
+  {
+    if (!std::is_const<T>::value)
+    {
+      m_interface->setModifiedState(true);
+    }
+  }
+
+  smtk::mesh::InterfacePtr m_interface;
+  smtk::mesh::HandleRange m_entities;
+  FieldTag m_tag;
+  std::size_t m_size{ 0 };
+  std::size_t m_dimension{ 0 };
+  std::vector<FieldSpan<T>> m_spans;
+};
+
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -68,6 +68,29 @@ public:
     const smtk::mesh::HandleRange& cellsToUpdate,
     int numVertsPerCell,
     const smtk::mesh::Handle* connectivityArray) = 0;
+
+  // Replace the connectivity of existing cells that each have numVertsPerCell
+  // vertices. The connectivity array holds the new vertices of each cell in
+  // the order of cellsToUpdate. Backends that cannot modify the connectivity
+  // of existing cells return false.
+  virtual bool setConnectivity(
+    const smtk::mesh::HandleRange& /*cellsToUpdate*/,
+    int /*numVertsPerCell*/,
+    const smtk::mesh::Handle* /*connectivityArray*/)
+  {
+    return false;
+  }
+
+  // Replace each point of pointsToReplace with the corresponding entry of
+  // replacementPoints wherever it is still used (by the connectivity of a cell
+  // or as a vertex cell of a mesh set), then delete it. Backends that cannot
+  // delete points return false.
+  virtual bool replacePoints(
+    const smtk::mesh::HandleRange& /*pointsToReplace*/,
+    const smtk::mesh::Handle* /*replacementPoints*/)
+  {
+    return false;
+  }
 };
 
 // BufferedCellAllocator allows for the allocation of meshes by
@@ -501,6 +524,20 @@ public:
   virtual std::set<smtk::mesh::CellFieldTag> computeCellFieldTags(
     const smtk::mesh::Handle& handle) const = 0;
 
+  //Expose the storage of a cell field's values for the leading cells of
+  //<cells>: on success, <data> points to the values of the first <count>
+  //cells, which may be read and written in place. Backends that do not store
+  //field values contiguously return false, and callers should use
+  //getField()/setField() instead.
+  virtual bool fieldStorage(
+    const smtk::mesh::HandleInterval& /*cells*/,
+    const smtk::mesh::CellFieldTag& /*cfTag*/,
+    void*& /*data*/,
+    std::size_t& /*count*/) const
+  {
+    return false;
+  }
+
   virtual bool deleteCellField(
     const smtk::mesh::CellFieldTag& dsTag,
     const smtk::mesh::HandleRange& meshsets) = 0;
@@ -547,6 +584,17 @@ public:
   virtual std::set<smtk::mesh::PointFieldTag> computePointFieldTags(
     const smtk::mesh::Handle& handle) const = 0;
 
+  //Expose the storage of a point field's values for the leading points of
+  //<points>. See the CellFieldTag overload.
+  virtual bool fieldStorage(
+    const smtk::mesh::HandleInterval& /*points*/,
+    const smtk::mesh::PointFieldTag& /*pfTag*/,
+    void*& /*data*/,
+    std::size_t& /*count*/) const
+  {
+    return false;
+  }
+
   virtual bool deletePointField(
     const smtk::mesh::PointFieldTag& dsTag,
     const smtk::mesh::HandleRange& meshsets) = 0;
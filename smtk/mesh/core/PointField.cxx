@@ -107,6 +107,15 @@ smtk::mesh::PointSet PointField::points() const
   return m_meshset.points();
 }
 
+smtk::mesh::InterfacePtr PointField::interface() const
+{
+  if (m_meshset.resource() == nullptr)
+  {
+    return smtk::mesh::InterfacePtr();
+  }
+  return m_meshset.resource()->interface();
+}
+
 bool PointField::get(const smtk::mesh::HandleRange& pointIds, void* values) const
 {
   const smtk::mesh::InterfacePtr& iface = m_meshset.resource()->interface();
@@ -14,6 +14,7 @@
 #include "smtk/CoreExports.h"
 #include "smtk/PublicPointerDefs.h"
 
+#include "smtk/mesh/core/FieldView.h"
 #include "smtk/mesh/core/Handle.h"
 #include "smtk/mesh/core/MeshSet.h"
 
@@ -146,7 +147,37 @@ public:
     return set(cellIds, values.data());
   }
 
+  //Return a read-only view of the field's values that avoids copying them
+  //when the backend exposes its storage. The view is invalid if <T> does not
+  //match the field type.
+  template<typename T>
+  smtk::mesh::FieldView<const T, smtk::mesh::PointFieldTag> view() const
+  {
+    if (type() != FieldTypeFor<T>::type)
+    {
+      return smtk::mesh::FieldView<const T, smtk::mesh::PointFieldTag>();
+    }
+    return smtk::mesh::FieldView<const T, smtk::mesh::PointFieldTag>(
+      this->interface(), this->points().range(), smtk::mesh::PointFieldTag(m_name), dimension());
+  }
+
+  //Return a writable view of the field's values that modifies them in place
+  //when the backend exposes its storage. The view is invalid if <T> does not
+  //match the field type.
+  template<typename T>
+  smtk::mesh::FieldView<T, smtk::mesh::PointFieldTag> mutableView()
+  {
+    if (type() != FieldTypeFor<T>::type)
+    {
+      return smtk::mesh::FieldView<T, smtk::mesh::PointFieldTag>();
+    }
+    return smtk::mesh::FieldView<T, smtk::mesh::PointFieldTag>(
+      this->interface(), this->points().range(), smtk::mesh::PointFieldTag(m_name), dimension());
+  }
+
 private:
+  smtk::mesh::InterfacePtr interface() const;
+
   std::string m_name;
   smtk::mesh::MeshSet m_meshset;
 };
@@ -17,6 +17,7 @@
 
 #include "smtk/common/FileLocation.h"
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDContainers.h"
 
 #include "smtk/mesh/core/CellSet.h"
 #include "smtk/mesh/core/Component.h"
@@ -334,7 +335,7 @@ private:
     const ResourcePtr&,
     const smtk::common::UUID&);
   friend std::shared_ptr<Component> Component::create(const MeshSet&);
-  std::map<smtk::common::UUID, Component::Ptr> m_componentMap;
+  smtk::common::UUIDHashMap<Component::Ptr> m_componentMap;
 
   //holds a reference to the specific backend interface
   class InternalImpl;
@@ -10,11 +10,12 @@
 
 #include "smtk/mesh/interpolation/PointCloudFromCSV.h"
 
-#include "smtk/common/CompilerInformation.h"
 #include "smtk/common/Paths.h"
+#include "smtk/common/Parallel.h"
 
-#include "smtk/Regex.h"
-
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <stdexcept>
 #include <vector>
@@ -27,7 +28,46 @@ namespace mesh
 namespace
 {
 bool registered = PointCloudFromCSV::registerClass();
+
+// The number of lines parsed by a single task
+const std::size_t s_linesPerTask = 4096;
+
+// Parse a line of the form (x, y, z, value) or (x, y, value).
+void parseLine(const std::string& line, double* xyz, double& value)
+{
+  // We are looking for (x, y, z, value), but we will also accept
+  // (x, y, value). So, we must have at least 3 components.
+  std::size_t nFields = std::count(line.begin(), line.end(), ',') + 1;
+  if (!line.empty() && line.back() == ',')
+  {
+    --nFields;
+  }
+  if (nFields < 3)
+  {
+    throw std::invalid_argument("File does not contain enough parameters.");
+  }
+
+  double fields[4];
+  const std::size_t nValues = nFields == 4 ? 4 : 3;
+  const char* field = line.c_str();
+  for (std::size_t i = 0; i < nValues; ++i)
+  {
+    char* end = nullptr;
+    fields[i] = std::strtod(field, &end);
+    if (end == field)
+    {
+      throw std::invalid_argument("File contains a value that is not a number.");
+    }
+    field = std::strchr(end, ',');
+    field = field ? field + 1 : end;
+  }
+
+  xyz[0] = fields[0];
+  xyz[1] = fields[1];
+  xyz[2] = nValues == 4 ? fields[2] : 0.;
+  value = fields[nValues - 1];
 }
+} // namespace
 
 bool PointCloudFromCSV::valid(const std::string& fileName) const
 {
@@ -40,35 +80,58 @@ smtk::mesh::PointCloud PointCloudFromCSV::operator()(const std::string& fileName
   std::vector<double> coordinates;
   std::vector<double> values;
 
+  PointCloudFromCSV::readChunks(
+    fileName, [&](std::size_t nPoints, const double* chunkCoordinates, const double* chunkValues) {
+      coordinates.insert(coordinates.end(), chunkCoordinates, chunkCoordinates + 3 * nPoints);
+      values.insert(values.end(), chunkValues, chunkValues + nPoints);
+    });
+
+  return smtk::mesh::PointCloud(std::move(coordinates), std::move(values));
+}
+
+void PointCloudFromCSV::readChunks(
+  const std::string& fileName,
+  const std::function<void(std::size_t, const double*, const double*)>& visit,
+  std::size_t chunkSize)
+{
   std::ifstream infile(fileName.c_str());
   if (!infile.good())
   {
     throw std::invalid_argument("File cannot be read.");
   }
-  std::string line;
-  smtk::regex re(",");
-  while (std::getline(infile, line))
-  {
-    // Passing -1 as the submatch index parameter performs splitting
-    smtk::sregex_token_iterator first{ line.begin(), line.end(), re, -1 }, last;
 
-    // We are looking for (x, y, z, value), but we will also accept
-    // (x, y, value). So, we must have at least 3 components.
-    std::size_t dist = std::distance(first, last);
-    if (dist < 3)
+  chunkSize = std::max<std::size_t>(chunkSize, 1);
+  std::vector<std::string> lines(chunkSize);
+  std::vector<double> coordinates;
+  std::vector<double> values;
+  while (infile.good())
+  {
+    std::size_t nLines = 0;
+    while (nLines < chunkSize && std::getline(infile, lines[nLines]))
+    {
+      ++nLines;
+    }
+    if (nLines == 0)
     {
-      throw std::invalid_argument("File does not contain enough parameters.");
+      break;
     }
 
-    coordinates.push_back(std::stod(*(first++)));
-    coordinates.push_back(std::stod(*(first++)));
-    coordinates.push_back(dist == 4 ? std::stod(*(first++)) : 0.);
-    values.push_back(std::stod(*(first++)));
+    // Parse the chunk's lines in parallel. Each task fills its own part of
+    // the coordinates and values; a malformed line throws from forEachChunk().
+    coordinates.resize(3 * nLines);
+    values.resize(nLines);
+    smtk::common::forEachChunk(
+      nLines, s_linesPerTask, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          parseLine(lines[i], &coordinates[3 * i], values[i]);
+        }
+      });
+
+    visit(nLines, coordinates.data(), values.data());
   }
 
   infile.close();
-
-  return smtk::mesh::PointCloud(std::move(coordinates), std::move(values));
 }
 } // namespace mesh
 } // namespace smtk
@@ -17,6 +17,7 @@
 #include "smtk/common/Generator.h"
 #include "smtk/mesh/interpolation/PointCloud.h"
 
+#include <functional>
 #include <string>
 
 namespace smtk
@@ -33,6 +34,15 @@ public:
   bool valid(const std::string& file) const override;
 
   smtk::mesh::PointCloud operator()(const std::string& file) override;
+
+  /// Read the points of a CSV file <chunkSize> lines at a time, calling
+  /// <visit>(nPoints, coordinates, values) with the interleaved coordinates
+  /// and the values of each chunk. The lines of a chunk are parsed on multiple
+  /// threads, and only one chunk is held in memory at a time.
+  static void readChunks(
+    const std::string& file,
+    const std::function<void(std::size_t, const double*, const double*)>& visit,
+    std::size_t chunkSize = 65536);
 };
 } // namespace mesh
 } // namespace smtk
@@ -0,0 +1,457 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/interpolation/PointCloudIndex.h"
+
+#include "smtk/mesh/interpolation/PointCloud.h"
+
+#include "smtk/common/Parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace
+{
+// The number of points (or grid cells) handled by a single task.
+const std::size_t s_entriesPerTask = 1 << 14;
+
+// The number of points per cell targeted when the cell size is not given
+const double s_pointsPerCell = 8.;
+
+// Coincident points are within this distance, as in InverseDistanceWeighting
+const double s_epsilon = 1.e-10;
+
+// Call functor(task, begin, end) for consecutive chunks of [0, size).
+template<typename Functor>
+void forEachChunk(std::size_t size, const Functor& functor)
+{
+  smtk::common::forEachChunk(size, s_entriesPerTask, functor);
+}
+
+double distance(const std::array<double, 3>& p, double x, double y, double z)
+{
+  return std::sqrt((p[0] - x) * (p[0] - x) + (p[1] - y) * (p[1] - y) + (p[2] - z) * (p[2] - z));
+}
+} // namespace
+
+namespace smtk
+{
+namespace mesh
+{
+
+PointCloudIndex::PointCloudIndex(std::function<bool(double)> prefilter, double resolution)
+  : m_prefilter(std::move(prefilter))
+  , m_resolution(resolution > 0. ? resolution : 0.)
+{
+}
+
+void PointCloudIndex::add(double x, double y, double z, double value)
+{
+  ++m_numberOfInsertedPoints;
+  if (m_resolution == 0.)
+  {
+    m_points.push_back({ x, y, z, value });
+    return;
+  }
+
+  const std::pair<std::int64_t, std::int64_t> square(
+    static_cast<std::int64_t>(std::floor(x / m_resolution)),
+    static_cast<std::int64_t>(std::floor(y / m_resolution)));
+  auto inserted = m_squares.emplace(square, m_points.size());
+  if (inserted.second)
+  {
+    m_points.push_back({ x, y, z, value });
+    m_weights.push_back(1);
+    return;
+  }
+
+  // Update the running averages of the square's point
+  const std::size_t p = inserted.first->second;
+  const double n = static_cast<double>(++m_weights[p]);
+  Point& point = m_points[p];
+  point.x += (x - point.x) / n;
+  point.y += (y - point.y) / n;
+  point.z += (z - point.z) / n;
+  point.value += (value - point.value) / n;
+}
+
+void PointCloudIndex::insert(std::size_t nPoints, const double* coordinates, const double* values)
+{
+  m_levels.clear();
+  m_offsets.clear();
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    if (m_prefilter(values[i]))
+    {
+      this->add(coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2], values[i]);
+    }
+  }
+}
+
+void PointCloudIndex::insert(const PointCloud& pointcloud)
+{
+  m_levels.clear();
+  m_offsets.clear();
+  if (m_resolution == 0.)
+  {
+    m_points.reserve(m_points.size() + pointcloud.size());
+  }
+  for (std::size_t i = 0; i < pointcloud.size(); ++i)
+  {
+    if (!pointcloud.containsIndex(i))
+    {
+      continue;
+    }
+    double value = pointcloud.data()(i);
+    if (m_prefilter(value))
+    {
+      std::array<double, 3> x = pointcloud.coordinates()(i);
+      this->add(x[0], x[1], x[2], value);
+    }
+  }
+  m_points.shrink_to_fit();
+}
+
+void PointCloudIndex::build(double cellSize)
+{
+  m_levels.clear();
+  m_offsets.clear();
+
+  const std::size_t nPoints = m_points.size();
+
+  // Compute the bounds of the points in the x-y plane
+  std::vector<std::array<double, 4>> taskBounds(
+    smtk::common::numberOfChunks(nPoints, s_entriesPerTask),
+    { { std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::lowest(),
+        std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::lowest() } });
+  forEachChunk(nPoints, [this, &taskBounds](std::size_t task, std::size_t begin, std::size_t end) {
+    std::array<double, 4>& b = taskBounds[task];
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      b[0] = std::min(b[0], m_points[i].x);
+      b[1] = std::max(b[1], m_points[i].x);
+      b[2] = std::min(b[2], m_points[i].y);
+      b[3] = std::max(b[3], m_points[i].y);
+    }
+  });
+  std::array<double, 4> bounds = taskBounds[0];
+  for (const auto& b : taskBounds)
+  {
+    bounds[0] = std::min(bounds[0], b[0]);
+    bounds[1] = std::max(bounds[1], b[1]);
+    bounds[2] = std::min(bounds[2], b[2]);
+    bounds[3] = std::max(bounds[3], b[3]);
+  }
+  if (nPoints == 0)
+  {
+    bounds = { { 0., 0., 0., 0. } };
+  }
+
+  // Choose the cell size and the dimensions of the finest grid
+  const double width = bounds[1] - bounds[0];
+  const double height = bounds[3] - bounds[2];
+  if (!(cellSize > 0.))
+  {
+    const double n = static_cast<double>(std::max<std::size_t>(nPoints, 1));
+    if (width * height > 0.)
+    {
+      cellSize = std::sqrt(width * height * s_pointsPerCell / n);
+    }
+    else if (std::max(width, height) > 0.)
+    {
+      cellSize = std::max(width, height) * s_pointsPerCell / n;
+    }
+    else
+    {
+      cellSize = 1.;
+    }
+  }
+  const double maximumCells = static_cast<double>(std::max<std::size_t>(nPoints, 1));
+  while ((std::floor(width / cellSize) + 1.) * (std::floor(height / cellSize) + 1.) > maximumCells)
+  {
+    cellSize *= 2.;
+  }
+
+  m_origin[0] = bounds[0];
+  m_origin[1] = bounds[2];
+  Level finest;
+  finest.cellSize = cellSize;
+  finest.dimensions[0] = static_cast<std::size_t>(std::floor(width / cellSize)) + 1;
+  finest.dimensions[1] = static_cast<std::size_t>(std::floor(height / cellSize)) + 1;
+  const std::size_t nx = finest.dimensions[0];
+  const std::size_t nCells = nx * finest.dimensions[1];
+
+  // Compute the cell of each point
+  std::vector<std::size_t> cellOfPoint(nPoints);
+  forEachChunk(
+    nPoints, [this, &cellOfPoint, &finest](std::size_t, std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const auto ix = std::min(
+          finest.dimensions[0] - 1,
+          static_cast<std::size_t>((m_points[i].x - m_origin[0]) / finest.cellSize));
+        const auto iy = std::min(
+          finest.dimensions[1] - 1,
+          static_cast<std::size_t>((m_points[i].y - m_origin[1]) / finest.cellSize));
+        cellOfPoint[i] = ix + finest.dimensions[0] * iy;
+      }
+    });
+
+  // Sort the points by cell (a counting sort, which keeps the points of each
+  // cell in insertion order)
+  m_offsets.assign(nCells + 1, 0);
+  for (std::size_t cell : cellOfPoint)
+  {
+    ++m_offsets[cell + 1];
+  }
+  for (std::size_t cell = 0; cell < nCells; ++cell)
+  {
+    m_offsets[cell + 1] += m_offsets[cell];
+  }
+  {
+    std::vector<Point> sorted(nPoints);
+    std::vector<std::size_t> next(m_offsets.begin(), m_offsets.end() - 1);
+    // The new location of each point, used to keep merged points' weights and
+    // squares in step with the points
+    std::vector<std::size_t> moved(m_weights.empty() ? 0 : nPoints);
+    for (std::size_t i = 0; i < nPoints; ++i)
+    {
+      const std::size_t location = next[cellOfPoint[i]]++;
+      sorted[location] = m_points[i];
+      if (!moved.empty())
+      {
+        moved[i] = location;
+      }
+    }
+    m_points.swap(sorted);
+    if (!moved.empty())
+    {
+      std::vector<std::size_t> weights(nPoints);
+      for (std::size_t i = 0; i < nPoints; ++i)
+      {
+        weights[moved[i]] = m_weights[i];
+      }
+      m_weights.swap(weights);
+      for (auto& square : m_squares)
+      {
+        square.second = moved[square.second];
+      }
+    }
+  }
+  std::vector<std::size_t>().swap(cellOfPoint);
+
+  // Aggregate the points of each cell of the finest level
+  finest.cells.resize(nCells);
+  forEachChunk(nCells, [this, &finest](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t cell = begin; cell < end; ++cell)
+    {
+      Aggregate aggregate{ 0, 0., 0., 0., 0. };
+      for (std::size_t i = m_offsets[cell]; i < m_offsets[cell + 1]; ++i)
+      {
+        const std::size_t weight = this->weight(i);
+        const double w = static_cast<double>(weight);
+        aggregate.count += weight;
+        aggregate.x += w * m_points[i].x;
+        aggregate.y += w * m_points[i].y;
+        aggregate.z += w * m_points[i].z;
+        aggregate.value += w * m_points[i].value;
+      }
+      finest.cells[cell] = aggregate;
+    }
+  });
+  m_levels.push_back(std::move(finest));
+
+  // Each coarser level's cells aggregate 2x2 cells of the level below, until
+  // a single cell covers all of the points
+  while (m_levels.back().dimensions[0] > 1 || m_levels.back().dimensions[1] > 1)
+  {
+    const Level& fine = m_levels.back();
+    Level coarse;
+    coarse.cellSize = 2. * fine.cellSize;
+    coarse.dimensions[0] = (fine.dimensions[0] + 1) / 2;
+    coarse.dimensions[1] = (fine.dimensions[1] + 1) / 2;
+    coarse.cells.resize(coarse.dimensions[0] * coarse.dimensions[1]);
+    forEachChunk(
+      coarse.cells.size(), [&fine, &coarse](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t cell = begin; cell < end; ++cell)
+        {
+          const std::size_t i = cell % coarse.dimensions[0];
+          const std::size_t j = cell / coarse.dimensions[0];
+          Aggregate aggregate{ 0, 0., 0., 0., 0. };
+          for (std::size_t jj = 2 * j; jj < std::min(2 * j + 2, fine.dimensions[1]); ++jj)
+          {
+            for (std::size_t ii = 2 * i; ii < std::min(2 * i + 2, fine.dimensions[0]); ++ii)
+            {
+              const Aggregate& child = fine.cells[ii + fine.dimensions[0] * jj];
+              aggregate.count += child.count;
+              aggregate.x += child.x;
+              aggregate.y += child.y;
+              aggregate.z += child.z;
+              aggregate.value += child.value;
+            }
+          }
+          coarse.cells[cell] = aggregate;
+        }
+      });
+    m_levels.push_back(std::move(coarse));
+  }
+}
+
+bool PointCloudIndex::cellRange(
+  const Level& level,
+  int axis,
+  double lower,
+  double upper,
+  std::size_t& first,
+  std::size_t& last) const
+{
+  const double begin = (lower - m_origin[axis]) / level.cellSize;
+  const double end = (upper - m_origin[axis]) / level.cellSize;
+  const double size = static_cast<double>(level.dimensions[axis]);
+  if (end < 0. || begin >= size || !(begin <= end))
+  {
+    return false;
+  }
+  first = begin < 0. ? 0 : static_cast<std::size_t>(begin);
+  last = end >= size ? level.dimensions[axis] - 1 : static_cast<std::size_t>(end);
+  return true;
+}
+
+double PointCloudIndex::radialAverage(const std::array<double, 3>& x, double radius) const
+{
+  std::size_t first[2], last[2];
+  if (
+    !this->isBuilt() ||
+    !this->cellRange(m_levels.front(), 0, x[0] - radius, x[0] + radius, first[0], last[0]) ||
+    !this->cellRange(m_levels.front(), 1, x[1] - radius, x[1] + radius, first[1], last[1]))
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const std::size_t nx = m_levels.front().dimensions[0];
+  const double radius2 = radius * radius;
+  double sum = 0.;
+  std::size_t numPointsInRadius = 0;
+  for (std::size_t j = first[1]; j <= last[1]; ++j)
+  {
+    for (std::size_t i = first[0]; i <= last[0]; ++i)
+    {
+      const std::size_t cell = i + nx * j;
+      for (std::size_t p = m_offsets[cell]; p < m_offsets[cell + 1]; ++p)
+      {
+        const Point& point = m_points[p];
+        const double dx = point.x - x[0];
+        const double dy = point.y - x[1];
+        if (dx * dx + dy * dy <= radius2)
+        {
+          const std::size_t weight = this->weight(p);
+          sum += static_cast<double>(weight) * point.value;
+          numPointsInRadius += weight;
+        }
+      }
+    }
+  }
+
+  return numPointsInRadius == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                 : sum / numPointsInRadius;
+}
+
+double PointCloudIndex::inverseDistanceWeighting(
+  const std::array<double, 3>& x,
+  double power,
+  double tolerance) const
+{
+  double num = 0., denom = 0.;
+  auto accumulatePoints = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t p = begin; p < end; ++p)
+    {
+      const Point& point = m_points[p];
+      const double d = distance(x, point.x, point.y, point.z);
+      // If d is zero, then the result is the value associated with the point.
+      if (d < s_epsilon)
+      {
+        num = point.value;
+        denom = 1.;
+        return true;
+      }
+      const double w = static_cast<double>(this->weight(p)) * std::pow(d, -1. * power);
+      num += w * point.value;
+      denom += w;
+    }
+    return false;
+  };
+
+  if (!(tolerance > 0.) || !this->isBuilt())
+  {
+    accumulatePoints(0, m_points.size());
+    return num / denom;
+  }
+
+  // Descend the hierarchy from its coarsest cell, replacing the points of
+  // cells that are small and distant enough by their aggregate.
+  std::vector<std::tuple<std::size_t, std::size_t, std::size_t>> cells;
+  cells.emplace_back(m_levels.size() - 1, 0, 0);
+  while (!cells.empty())
+  {
+    std::size_t level, i, j;
+    std::tie(level, i, j) = cells.back();
+    cells.pop_back();
+
+    const Level& current = m_levels[level];
+    const Aggregate& aggregate = current.cells[i + current.dimensions[0] * j];
+    if (aggregate.count == 0)
+    {
+      continue;
+    }
+
+    // The distance from <x> to the cell in the x-y plane
+    const double lower[2] = { m_origin[0] + i * current.cellSize,
+                              m_origin[1] + j * current.cellSize };
+    const double dx = std::max(0., std::max(lower[0] - x[0], x[0] - lower[0] - current.cellSize));
+    const double dy = std::max(0., std::max(lower[1] - x[1], x[1] - lower[1] - current.cellSize));
+    if (current.cellSize < tolerance * std::sqrt(dx * dx + dy * dy))
+    {
+      const double count = static_cast<double>(aggregate.count);
+      const double d =
+        distance(x, aggregate.x / count, aggregate.y / count, aggregate.z / count);
+      const double w = count * std::pow(d, -1. * power);
+      num += w * aggregate.value / count;
+      denom += w;
+    }
+    else if (level == 0)
+    {
+      const std::size_t cell = i + current.dimensions[0] * j;
+      if (accumulatePoints(m_offsets[cell], m_offsets[cell + 1]))
+      {
+        return num;
+      }
+    }
+    else
+    {
+      const Level& fine = m_levels[level - 1];
+      for (std::size_t jj = 2 * j; jj < std::min(2 * j + 2, fine.dimensions[1]); ++jj)
+      {
+        for (std::size_t ii = 2 * i; ii < std::min(2 * i + 2, fine.dimensions[0]); ++ii)
+        {
+          cells.emplace_back(level - 1, ii, jj);
+        }
+      }
+    }
+  }
+
+  return num / denom;
+}
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,167 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_PointCloudIndex_h
+#define smtk_mesh_PointCloudIndex_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+
+class PointCloud;
+
+/**\brief A multi-resolution grid index of point cloud data.
+
+   Points and their scalar values are streamed into the index in chunks of any
+   size; values rejected by the prefilter are discarded as they arrive, and
+   only the coordinates and value of each point are kept. When a resolution is
+   given, points are also merged as they arrive: all of the points within a
+   square of that size in the x-y plane are kept as a single point at their
+   centroid carrying their average value and weighted by their number, so the
+   memory held grows with the area covered rather than the number of points
+   inserted. Once all of the
+   points have been inserted, build() sorts them into a uniform grid in the x-y
+   plane and aggregates the grid into a hierarchy of coarser levels, each of
+   whose cells covers 2x2 cells of the level below. Both steps run on multiple
+   threads.
+
+   A built index answers radial average and inverse distance weighting
+   queries without visiting every point, and its queries may be called
+   concurrently.
+  */
+class SMTKCORE_EXPORT PointCloudIndex
+{
+public:
+  PointCloudIndex(
+    std::function<bool(double)> prefilter = [](double) { return true; },
+    double resolution = 0.);
+
+  /// Add <nPoints> points with interleaved coordinates and values. Inserting
+  /// points discards the grid of a previous build().
+  void insert(std::size_t nPoints, const double* coordinates, const double* values);
+
+  /// Add the valid points of a point cloud.
+  void insert(const PointCloud& pointcloud);
+
+  /// Sort the points into a grid whose cells have sides of length <cellSize>.
+  /// If <cellSize> is not positive, it is chosen so that there are a few points
+  /// per cell. The cell size is increased if needed to limit the number of
+  /// cells to the number of points.
+  void build(double cellSize = 0.);
+
+  bool isBuilt() const { return !m_levels.empty(); }
+
+  /// The number of indexed points (after merging).
+  std::size_t size() const { return m_points.size(); }
+
+  /// The number of points inserted that passed the prefilter (before merging).
+  std::size_t numberOfInsertedPoints() const { return m_numberOfInsertedPoints; }
+
+  /// The size of the squares within which inserted points are merged (0 when
+  /// points are not merged).
+  double resolution() const { return m_resolution; }
+
+  /// The number of levels of the grid hierarchy (0 before build()).
+  std::size_t numberOfLevels() const { return m_levels.size(); }
+
+  /// The side length of the cells of the finest level.
+  double cellSize() const { return m_levels.empty() ? 0. : m_levels.front().cellSize; }
+
+  /// Return the unweighted average of the values of the points within
+  /// <radius> of <x> when projected onto the x-y plane, or NaN if there are
+  /// none.
+  double radialAverage(const std::array<double, 3>& x, double radius) const;
+
+  /// Return the value at <x> interpolated from all points using Shepard's
+  /// method with weights |x - p|^-power. When <tolerance> is positive, groups
+  /// of points whose extent is less than <tolerance> times their distance from
+  /// <x> are replaced by a single point at their centroid carrying their
+  /// average value; 0 computes the exact sum.
+  double inverseDistanceWeighting(
+    const std::array<double, 3>& x,
+    double power,
+    double tolerance = 0.) const;
+
+private:
+  struct Point
+  {
+    double x, y, z, value;
+  };
+
+  // The number of points and the sums of the coordinates and values of the
+  // points within a grid cell
+  struct Aggregate
+  {
+    std::size_t count;
+    double x, y, z, value;
+  };
+
+  struct Level
+  {
+    double cellSize;
+    std::size_t dimensions[2];
+    std::vector<Aggregate> cells;
+  };
+
+  // Add a point that passed the prefilter, merging it into the point of its
+  // square if points are merged.
+  void add(double x, double y, double z, double value);
+
+  // The number of inserted points that point <p> represents
+  std::size_t weight(std::size_t p) const { return m_weights.empty() ? 1 : m_weights[p]; }
+
+  // Hash the indices of a square of side <m_resolution> in the x-y plane
+  struct SquareHash
+  {
+    std::size_t operator()(const std::pair<std::int64_t, std::int64_t>& square) const
+    {
+      return std::hash<std::int64_t>()(square.first) ^
+        (std::hash<std::int64_t>()(square.second) * 0x9e3779b97f4a7c15ULL);
+    }
+  };
+
+  // Return the range of the cells of <level> overlapping [lower, upper] along
+  // <axis>, or false if there are none.
+  bool cellRange(
+    const Level& level,
+    int axis,
+    double lower,
+    double upper,
+    std::size_t& first,
+    std::size_t& last) const;
+
+  std::function<bool(double)> m_prefilter;
+  double m_resolution;
+  std::size_t m_numberOfInsertedPoints{ 0 };
+  std::vector<Point> m_points;
+  // When points are merged, the number of inserted points each point
+  // represents and the index of the point of each occupied square
+  std::vector<std::size_t> m_weights;
+  std::unordered_map<std::pair<std::int64_t, std::int64_t>, std::size_t, SquareHash> m_squares;
+  // The points of finest cell c are m_points[m_offsets[c], m_offsets[c + 1])
+  std::vector<std::size_t> m_offsets;
+  std::vector<Level> m_levels;
+  double m_origin[2]{ 0., 0. };
+};
+} // namespace mesh
+} // namespace smtk
+
+#endif
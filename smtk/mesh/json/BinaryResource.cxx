@@ -0,0 +1,615 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/json/BinaryResource.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+
+namespace
+{
+const char magic[] = "SMTKMSHB";
+const std::size_t magicLength = sizeof(magic) - 1;
+const std::uint64_t version = 1;
+
+// The subtypes of the binary values that replace JSON values in the records
+enum Subtype : std::uint8_t
+{
+  PackedRange = 1, // an array of increasing [lower, upper] pairs
+  StringReference, // an index into the string table
+  PackedUUID,      // the 16 bytes of a UUID
+  Absent           // a mesh record lacks the key
+};
+
+void appendVarint(std::vector<std::uint8_t>& bytes, std::uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool extractVarint(
+  const std::vector<std::uint8_t>& bytes,
+  std::size_t& position,
+  std::uint64_t& value)
+{
+  value = 0;
+  for (int shift = 0; shift < 64 && position < bytes.size(); shift += 7)
+  {
+    const std::uint8_t byte = bytes[position++];
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool readVarint(std::istream& stream, std::uint64_t& value)
+{
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+  {
+    const int byte = stream.get();
+    if (byte == std::char_traits<char>::eof())
+    {
+      return false;
+    }
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Both handle ranges and their JSON form are a sequence of intervals whose
+// lower bounds follow the upper bounds of their predecessors.
+template<typename Intervals>
+std::vector<std::uint8_t> packIntervals(std::size_t size, const Intervals& intervals)
+{
+  std::vector<std::uint8_t> bytes;
+  appendVarint(bytes, size);
+  std::uint64_t next = 0;
+  intervals([&](std::uint64_t lower, std::uint64_t upper) {
+    appendVarint(bytes, lower - next);
+    appendVarint(bytes, upper - lower);
+    next = upper + 1;
+  });
+  return bytes;
+}
+
+template<typename Insert>
+bool unpackIntervals(const std::vector<std::uint8_t>& bytes, const Insert& insert)
+{
+  std::size_t position = 0;
+  std::uint64_t size;
+  if (!extractVarint(bytes, position, size))
+  {
+    return false;
+  }
+  std::uint64_t next = 0;
+  for (std::uint64_t i = 0; i < size; ++i)
+  {
+    std::uint64_t gap, length;
+    if (!extractVarint(bytes, position, gap) || !extractVarint(bytes, position, length))
+    {
+      return false;
+    }
+    insert(next + gap, next + gap + length);
+    next += gap + length + 1;
+  }
+  return position == bytes.size();
+}
+
+// Return true if <j> is a nonempty array of [lower, upper] pairs of unsigned
+// integers, each of which lies above its predecessor.
+bool isRange(const nlohmann::json& j)
+{
+  if (!j.is_array() || j.empty())
+  {
+    return false;
+  }
+  bool first = true;
+  std::uint64_t previous = 0;
+  for (const auto& interval : j)
+  {
+    if (
+      !interval.is_array() || interval.size() != 2 || !interval[0].is_number_unsigned() ||
+      !interval[1].is_number_unsigned())
+    {
+      return false;
+    }
+    const std::uint64_t lower = interval[0].get<std::uint64_t>();
+    const std::uint64_t upper = interval[1].get<std::uint64_t>();
+    if (upper < lower || (!first && lower <= previous))
+    {
+      return false;
+    }
+    previous = upper;
+    first = false;
+  }
+  return true;
+}
+
+int hexValue(char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+// Pack <s> if it is a UUID in the lowercase, hyphenated form written by
+// smtk::common::UUID::toString().
+bool packUUID(const std::string& s, std::vector<std::uint8_t>& bytes)
+{
+  if (s.size() != 36)
+  {
+    return false;
+  }
+  bytes.clear();
+  for (std::size_t i = 0; i < 36;)
+  {
+    if (i == 8 || i == 13 || i == 18 || i == 23)
+    {
+      if (s[i++] != '-')
+      {
+        return false;
+      }
+      continue;
+    }
+    const int high = hexValue(s[i]);
+    const int low = hexValue(s[i + 1]);
+    if (high < 0 || low < 0)
+    {
+      return false;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(16 * high + low));
+    i += 2;
+  }
+  return true;
+}
+
+std::string unpackUUID(const std::vector<std::uint8_t>& bytes)
+{
+  const char* digits = "0123456789abcdef";
+  std::string s;
+  for (std::size_t i = 0; i < bytes.size(); ++i)
+  {
+    if (i == 4 || i == 6 || i == 8 || i == 10)
+    {
+      s.push_back('-');
+    }
+    s.push_back(digits[bytes[i] >> 4]);
+    s.push_back(digits[bytes[i] & 0xf]);
+  }
+  return s;
+}
+
+void countStrings(const nlohmann::json& j, std::map<std::string, std::size_t>& counts)
+{
+  if (j.is_string())
+  {
+    ++counts[j.get_ref<const std::string&>()];
+  }
+  else if (j.is_structured() && !isRange(j))
+  {
+    for (const auto& value : j)
+    {
+      countStrings(value, counts);
+    }
+  }
+}
+
+class Encoder
+{
+public:
+  void addStrings(const nlohmann::json& j)
+  {
+    // Strings are interned in the order in which they are first encountered
+    std::map<std::string, std::size_t> counts;
+    countStrings(j, counts);
+    this->intern(j, counts);
+  }
+
+  nlohmann::json encode(const nlohmann::json& j) const
+  {
+    if (j.is_string())
+    {
+      const std::string& s = j.get_ref<const std::string&>();
+      auto found = m_indices.find(s);
+      if (found != m_indices.end())
+      {
+        std::vector<std::uint8_t> bytes;
+        appendVarint(bytes, found->second);
+        return nlohmann::json::binary(std::move(bytes), StringReference);
+      }
+      std::vector<std::uint8_t> bytes;
+      if (packUUID(s, bytes))
+      {
+        return nlohmann::json::binary(std::move(bytes), PackedUUID);
+      }
+      return j;
+    }
+    if (isRange(j))
+    {
+      return nlohmann::json::binary(
+        packIntervals(
+          j.size(),
+          [&j](const std::function<void(std::uint64_t, std::uint64_t)>& visit) {
+            for (const auto& interval : j)
+            {
+              visit(interval[0].get<std::uint64_t>(), interval[1].get<std::uint64_t>());
+            }
+          }),
+        PackedRange);
+    }
+    if (j.is_array())
+    {
+      nlohmann::json encoded = nlohmann::json::array();
+      for (const auto& value : j)
+      {
+        encoded.push_back(this->encode(value));
+      }
+      return encoded;
+    }
+    if (j.is_object())
+    {
+      nlohmann::json encoded = nlohmann::json::object();
+      for (auto it = j.begin(); it != j.end(); ++it)
+      {
+        encoded[it.key()] = this->encode(it.value());
+      }
+      return encoded;
+    }
+    return j;
+  }
+
+  const std::vector<std::string>& strings() const { return m_strings; }
+
+private:
+  void intern(const nlohmann::json& j, const std::map<std::string, std::size_t>& counts)
+  {
+    if (j.is_string())
+    {
+      const std::string& s = j.get_ref<const std::string&>();
+      if (counts.at(s) > 1 && m_indices.find(s) == m_indices.end())
+      {
+        m_indices[s] = m_strings.size();
+        m_strings.push_back(s);
+      }
+    }
+    else if (j.is_structured() && !isRange(j))
+    {
+      for (const auto& value : j)
+      {
+        this->intern(value, counts);
+      }
+    }
+  }
+
+  std::vector<std::string> m_strings;
+  std::map<std::string, std::size_t> m_indices;
+};
+
+bool decode(const nlohmann::json& j, const std::vector<std::string>& strings, nlohmann::json& out)
+{
+  if (j.is_binary())
+  {
+    const auto& bytes = j.get_binary();
+    if (!bytes.has_subtype())
+    {
+      out = j;
+      return true;
+    }
+    switch (bytes.subtype())
+    {
+      case PackedRange:
+        out = nlohmann::json::array();
+        return unpackIntervals(bytes, [&out](std::uint64_t lower, std::uint64_t upper) {
+          out.push_back({ lower, upper });
+        });
+      case StringReference:
+      {
+        std::size_t position = 0;
+        std::uint64_t index;
+        if (!extractVarint(bytes, position, index) || index >= strings.size())
+        {
+          return false;
+        }
+        out = strings[index];
+        return true;
+      }
+      case PackedUUID:
+        if (bytes.size() != 16)
+        {
+          return false;
+        }
+        out = unpackUUID(bytes);
+        return true;
+      default:
+        out = j;
+        return true;
+    }
+  }
+  if (j.is_array())
+  {
+    out = nlohmann::json::array();
+    for (const auto& value : j)
+    {
+      nlohmann::json decoded;
+      if (!decode(value, strings, decoded))
+      {
+        return false;
+      }
+      out.push_back(std::move(decoded));
+    }
+    return true;
+  }
+  if (j.is_object())
+  {
+    out = nlohmann::json::object();
+    for (auto it = j.begin(); it != j.end(); ++it)
+    {
+      if (!decode(it.value(), strings, out[it.key()]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  out = j;
+  return true;
+}
+
+void writeRecord(const nlohmann::json& record, std::ostream& stream)
+{
+  std::vector<std::uint8_t> bytes = nlohmann::json::to_msgpack(record);
+  std::vector<std::uint8_t> length;
+  appendVarint(length, bytes.size());
+  stream.write(reinterpret_cast<const char*>(length.data()), length.size());
+  stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+} // namespace
+
+namespace smtk
+{
+namespace mesh
+{
+namespace json
+{
+std::vector<std::uint8_t> packHandleRange(const smtk::mesh::HandleRange& range)
+{
+  return packIntervals(
+    boost::icl::interval_count(range),
+    [&range](const std::function<void(std::uint64_t, std::uint64_t)>& visit) {
+      for (const auto& interval : range)
+      {
+        visit(interval.lower(), interval.upper());
+      }
+    });
+}
+
+bool unpackHandleRange(const std::vector<std::uint8_t>& bytes, smtk::mesh::HandleRange& range)
+{
+  return unpackIntervals(bytes, [&range](std::uint64_t lower, std::uint64_t upper) {
+    range.insert(
+      range.end(),
+      smtk::mesh::HandleInterval(
+        static_cast<smtk::mesh::Handle>(lower), static_cast<smtk::mesh::Handle>(upper)));
+  });
+}
+
+BinaryResourceReader::BinaryResourceReader(std::istream& stream)
+  : m_stream(stream)
+{
+  char buffer[magicLength];
+  if (!m_stream.read(buffer, magicLength) || std::memcmp(buffer, magic, magicLength) != 0)
+  {
+    return;
+  }
+
+  nlohmann::json preamble;
+  if (
+    !this->readRecord(preamble) || !preamble.is_object() ||
+    preamble.value("version", std::uint64_t(0)) != version)
+  {
+    return;
+  }
+  m_strings = preamble.value("strings", std::vector<std::string>());
+  m_fields = preamble.value("fields", std::vector<std::string>());
+  m_hasMeshes = preamble.contains("meshes");
+  m_numberOfMeshes = preamble.value("meshes", std::size_t(0));
+
+  nlohmann::json header;
+  m_valid = this->readRecord(header) && decode(header, m_strings, m_header);
+}
+
+bool BinaryResourceReader::next(nlohmann::json& mesh)
+{
+  nlohmann::json record;
+  if (
+    !m_valid || m_numberOfMeshesRead == m_numberOfMeshes || !this->readRecord(record) ||
+    !record.is_array() || record.size() != m_fields.size())
+  {
+    return false;
+  }
+  ++m_numberOfMeshesRead;
+
+  mesh = nlohmann::json::object();
+  for (std::size_t i = 0; i < m_fields.size(); ++i)
+  {
+    if (record[i].is_binary() && record[i].get_binary().subtype() == Absent)
+    {
+      continue;
+    }
+    if (!decode(record[i], m_strings, mesh[m_fields[i]]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool BinaryResourceReader::readRecord(nlohmann::json& record)
+{
+  std::uint64_t length;
+  if (!readVarint(m_stream, length))
+  {
+    return false;
+  }
+  // The length comes from the stream and cannot be trusted, so the record is
+  // read in bounded chunks rather than allocated up front; a corrupt length
+  // fails once the stream runs out instead of exhausting memory.
+  const std::size_t chunkSize = 1 << 20;
+  std::vector<std::uint8_t> bytes;
+  while (bytes.size() < length)
+  {
+    const std::size_t offset = bytes.size();
+    const std::size_t size =
+      static_cast<std::size_t>(std::min<std::uint64_t>(chunkSize, length - offset));
+    bytes.resize(offset + size);
+    if (!m_stream.read(reinterpret_cast<char*>(bytes.data() + offset), size))
+    {
+      return false;
+    }
+  }
+  try
+  {
+    record = nlohmann::json::from_msgpack(bytes);
+  }
+  catch (nlohmann::json::exception&)
+  {
+    return false;
+  }
+  return true;
+}
+
+bool isBinaryResource(std::istream& stream)
+{
+  const std::streampos start = stream.tellg();
+  char buffer[magicLength];
+  const bool isBinary =
+    static_cast<bool>(stream.read(buffer, magicLength)) &&
+    std::memcmp(buffer, magic, magicLength) == 0;
+  stream.clear();
+  stream.seekg(start);
+  return isBinary;
+}
+
+bool writeBinaryResource(const nlohmann::json& j, std::ostream& stream)
+{
+  if (!j.is_object())
+  {
+    return false;
+  }
+
+  Encoder encoder;
+  encoder.addStrings(j);
+
+  // The keys of the mesh records, in the order in which they are first
+  // encountered
+  const auto meshes = j.find("meshes");
+  const bool hasMeshes = meshes != j.end() && meshes->is_array();
+  std::vector<std::string> fields;
+  if (hasMeshes)
+  {
+    std::map<std::string, std::size_t> indices;
+    for (const auto& mesh : *meshes)
+    {
+      if (!mesh.is_object())
+      {
+        return false;
+      }
+      for (auto it = mesh.begin(); it != mesh.end(); ++it)
+      {
+        if (indices.emplace(it.key(), fields.size()).second)
+        {
+          fields.push_back(it.key());
+        }
+      }
+    }
+  }
+
+  nlohmann::json preamble = { { "version", version },
+                              { "strings", encoder.strings() },
+                              { "fields", fields } };
+  nlohmann::json header = j;
+  if (hasMeshes)
+  {
+    preamble["meshes"] = meshes->size();
+    header.erase("meshes");
+  }
+
+  stream.write(magic, magicLength);
+  writeRecord(preamble, stream);
+  writeRecord(encoder.encode(header), stream);
+
+  if (hasMeshes)
+  {
+    for (const auto& mesh : *meshes)
+    {
+      nlohmann::json record = nlohmann::json::array();
+      for (const auto& field : fields)
+      {
+        const auto value = mesh.find(field);
+        record.push_back(
+          value == mesh.end() ? nlohmann::json::binary(std::vector<std::uint8_t>(), Absent)
+                              : encoder.encode(*value));
+      }
+      writeRecord(record, stream);
+    }
+  }
+
+  return stream.good();
+}
+
+bool readBinaryResource(std::istream& stream, nlohmann::json& j)
+{
+  BinaryResourceReader reader(stream);
+  if (!reader.isValid())
+  {
+    return false;
+  }
+
+  j = reader.header();
+  if (reader.hasMeshes())
+  {
+    nlohmann::json meshes = nlohmann::json::array();
+    nlohmann::json mesh;
+    while (reader.next(mesh))
+    {
+      meshes.push_back(std::move(mesh));
+    }
+    if (meshes.size() != reader.numberOfMeshes())
+    {
+      return false;
+    }
+    j["meshes"] = std::move(meshes);
+  }
+  return true;
+}
+} // namespace json
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,110 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_mesh_json_BinaryResource_h
+#define smtk_mesh_json_BinaryResource_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/mesh/core/Handle.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace json
+{
+/// Pack a handle range into a sequence of variable-length integers: the
+/// number of intervals, followed by the gap preceding each interval and its
+/// length.
+SMTKCORE_EXPORT std::vector<std::uint8_t> packHandleRange(const smtk::mesh::HandleRange&);
+
+/// Unpack a handle range packed by packHandleRange(). Return false if the
+/// data is malformed.
+SMTKCORE_EXPORT bool unpackHandleRange(const std::vector<std::uint8_t>&, smtk::mesh::HandleRange&);
+
+/**\brief A binary alternative to the text JSON description of a mesh resource.
+
+   A mesh resource's metadata (the JSON produced by smtk::mesh::to_json) is
+   written as a magic string followed by a sequence of length-prefixed
+   MessagePack records:
+
+   1. a preamble holding the format version, a table of the strings that
+      occur more than once in the metadata, the keys of the mesh records and
+      the number of meshes;
+   2. the resource's description without its meshes;
+   3. one record per mesh, holding the values of its keys in the order listed
+      by the preamble.
+
+   Within the records, handle ranges are packed with packHandleRange(),
+   repeated strings are replaced by their index into the string table and
+   UUIDs are stored as 16 bytes. The conversion is lossless: reading a binary
+   resource yields the JSON that was written.
+
+   Records may be read one at a time using BinaryResourceReader, so that the
+   meshes of a large resource need not all be held in memory at once.
+  */
+class SMTKCORE_EXPORT BinaryResourceReader
+{
+public:
+  BinaryResourceReader(std::istream& stream);
+
+  /// Return true if the stream holds a binary resource whose preamble and
+  /// header were read successfully.
+  bool isValid() const { return m_valid; }
+
+  /// The resource's description, without its meshes.
+  const nlohmann::json& header() const { return m_header; }
+
+  /// Return true if the resource's description has an array of meshes.
+  bool hasMeshes() const { return m_hasMeshes; }
+
+  /// The number of mesh records in the stream.
+  std::size_t numberOfMeshes() const { return m_numberOfMeshes; }
+
+  /// Read the next mesh record into <mesh>. Return false when there are no
+  /// more records or the record is malformed.
+  bool next(nlohmann::json& mesh);
+
+private:
+  bool readRecord(nlohmann::json& record);
+
+  std::istream& m_stream;
+  bool m_valid{ false };
+  bool m_hasMeshes{ false };
+  std::size_t m_numberOfMeshes{ 0 };
+  std::size_t m_numberOfMeshesRead{ 0 };
+  std::vector<std::string> m_strings;
+  std::vector<std::string> m_fields;
+  nlohmann::json m_header;
+};
+
+/// Return true if <stream> begins with the binary resource magic string. The
+/// stream's position is left unchanged.
+SMTKCORE_EXPORT bool isBinaryResource(std::istream& stream);
+
+/// Write the JSON description of a mesh resource to <stream> in the binary
+/// format.
+SMTKCORE_EXPORT bool writeBinaryResource(const nlohmann::json& j, std::ostream& stream);
+
+/// Read a binary resource from <stream> into a JSON description of a mesh
+/// resource.
+SMTKCORE_EXPORT bool readBinaryResource(std::istream& stream, nlohmann::json& j);
+} // namespace json
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -11,6 +11,7 @@
 //=============================================================================
 #include "smtk/mesh/moab/Allocator.h"
 #include "smtk/mesh/moab/CellTypeToType.h"
+#include "smtk/mesh/moab/HandleRangeToRange.h"
 
 #include "smtk/common/CompilerInformation.h"
 
@@ -19,6 +20,10 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 #include "moab/ReadUtilIface.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace smtk
 {
 namespace mesh
@@ -27,6 +32,7 @@ namespace moab
 {
 
 Allocator::Allocator(::moab::Interface* interface)
+  : m_iface(interface)
 {
   if (interface)
   {
@@ -38,6 +44,7 @@ Allocator::~Allocator()
 {
   //don't de-allocate the Interface that created us, really manages this
   //memory
+  m_iface = nullptr;
   m_rface = nullptr;
 }
 
@@ -117,6 +124,168 @@ bool Allocator::connectivityModified(
     firstCellToUpdate, numberOfCellsToUpdate, numVertsPerCell, connectivityArray);
   return err == ::moab::MB_SUCCESS;
 }
+
+bool Allocator::setConnectivity(
+  const smtk::mesh::HandleRange& cellsToUpdate,
+  int numVertsPerCell,
+  const smtk::mesh::Handle* connectivityArray)
+{
+  if (m_iface == nullptr)
+  {
+    return false;
+  }
+
+  //set_connectivity also moves the cells' vertex adjacencies from their old
+  //vertices to the new ones
+  ::moab::EntityHandle* connectivity = const_cast<::moab::EntityHandle*>(connectivityArray);
+  for (auto cell = smtk::mesh::rangeElementsBegin(cellsToUpdate);
+       cell != smtk::mesh::rangeElementsEnd(cellsToUpdate);
+       ++cell, connectivity += numVertsPerCell)
+  {
+    if (m_iface->set_connectivity(*cell, connectivity, numVertsPerCell) != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Allocator::replacePoints(
+  const smtk::mesh::HandleRange& pointsToReplace,
+  const smtk::mesh::Handle* replacementPoints)
+{
+  if (m_iface == nullptr)
+  {
+    return false;
+  }
+  if (pointsToReplace.empty())
+  {
+    return true;
+  }
+
+  std::unordered_map<::moab::EntityHandle, ::moab::EntityHandle> replacements;
+  replacements.reserve(pointsToReplace.size());
+  std::size_t index = 0;
+  for (auto point = smtk::mesh::rangeElementsBegin(pointsToReplace);
+       point != smtk::mesh::rangeElementsEnd(pointsToReplace);
+       ++point, ++index)
+  {
+    replacements[*point] = replacementPoints[index];
+  }
+  const ::moab::Range deadPoints = smtkToMOABRange(pointsToReplace);
+
+  //gather everything that refers to a replaced point before modifying
+  //anything, so that a failed query leaves the resource untouched
+  ::moab::ErrorCode err;
+  ::moab::Range cells;
+  for (int dim = 1; dim <= 3; ++dim)
+  {
+    err = m_iface->get_adjacencies(deadPoints, dim, false, cells, ::moab::Interface::UNION);
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+  }
+
+  //meshsets that explicitly hold a replaced point. Sets that track their
+  //contents report themselves as adjacent to the points; the other meshsets
+  //of the resource are only searched when they hold points at all, since
+  //most meshsets hold only cells.
+  ::moab::Range meshsets;
+  err = m_iface->get_adjacencies(deadPoints, 4, false, meshsets, ::moab::Interface::UNION);
+  if (err != ::moab::MB_SUCCESS)
+  {
+    return false;
+  }
+  ::moab::Range resourceMeshsets;
+  err = m_iface->get_entities_by_type(
+    m_iface->get_root_set(), ::moab::MBENTITYSET, resourceMeshsets);
+  if (err != ::moab::MB_SUCCESS)
+  {
+    return false;
+  }
+  for (auto meshset = resourceMeshsets.begin(); meshset != resourceMeshsets.end(); ++meshset)
+  {
+    int numberOfPoints = 0;
+    err = m_iface->get_number_entities_by_dimension(*meshset, 0, numberOfPoints, false);
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+    if (numberOfPoints > 0)
+    {
+      meshsets.insert(*meshset);
+    }
+  }
+  std::vector<std::pair<::moab::EntityHandle, ::moab::Range>> setsToUpdate;
+  for (auto meshset = meshsets.begin(); meshset != meshsets.end(); ++meshset)
+  {
+    ::moab::Range points;
+    err = m_iface->get_entities_by_dimension(*meshset, 0, points, false);
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+    ::moab::Range pointsToRemove = ::moab::intersect(deadPoints, points);
+    if (!pointsToRemove.empty())
+    {
+      setsToUpdate.emplace_back(*meshset, pointsToRemove);
+    }
+  }
+
+  //update the connectivity of any cell that still uses a replaced point
+  std::vector<::moab::EntityHandle> connectivity;
+  for (auto cell = cells.begin(); cell != cells.end(); ++cell)
+  {
+    const ::moab::EntityHandle handle = *cell;
+    connectivity.clear();
+    err = m_iface->get_connectivity(&handle, 1, connectivity);
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+    for (auto& point : connectivity)
+    {
+      auto replacement = replacements.find(point);
+      if (replacement != replacements.end())
+      {
+        point = replacement->second;
+      }
+    }
+    err = m_iface->set_connectivity(
+      handle, connectivity.data(), static_cast<int>(connectivity.size()));
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+  }
+
+  //each of those meshsets holds the replacements instead
+  std::vector<::moab::EntityHandle> pointsToAdd;
+  for (const auto& setToUpdate : setsToUpdate)
+  {
+    const ::moab::Range& pointsToRemove = setToUpdate.second;
+    pointsToAdd.clear();
+    for (auto point = pointsToRemove.begin(); point != pointsToRemove.end(); ++point)
+    {
+      pointsToAdd.push_back(replacements[*point]);
+    }
+    err = m_iface->add_entities(
+      setToUpdate.first, pointsToAdd.data(), static_cast<int>(pointsToAdd.size()));
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+    err = m_iface->remove_entities(setToUpdate.first, pointsToRemove);
+    if (err != ::moab::MB_SUCCESS)
+    {
+      return false;
+    }
+  }
+
+  err = m_iface->delete_entities(deadPoints);
+  return err == ::moab::MB_SUCCESS;
+}
 } // namespace moab
 } // namespace mesh
 } // namespace smtk
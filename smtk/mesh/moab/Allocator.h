@@ -56,6 +56,15 @@ public:
     int numVertsPerCell,
     const smtk::mesh::Handle* connectivityArray) override;
 
+  bool setConnectivity(
+    const smtk::mesh::HandleRange& cellsToUpdate,
+    int numVertsPerCell,
+    const smtk::mesh::Handle* connectivityArray) override;
+
+  bool replacePoints(
+    const smtk::mesh::HandleRange& pointsToReplace,
+    const smtk::mesh::Handle* replacementPoints) override;
+
 protected:
   bool connectivityModified(
     smtk::mesh::Handle firstCellToUpdate,
@@ -65,6 +74,7 @@ protected:
 
 private:
   //holds a reference to the real moab interface
+  ::moab::Interface* m_iface = nullptr;
   ::moab::ReadUtilIface* m_rface = nullptr;
 };
 } // namespace moab
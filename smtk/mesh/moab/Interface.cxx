@@ -1554,6 +1554,53 @@ std::set<smtk::mesh::CellFieldTag> Interface::computeCellFieldTags(
   return cellFieldTags;
 }
 
+bool Interface::fieldStorage(
+  const smtk::mesh::HandleInterval& entities,
+  const std::string& tagName,
+  void*& data,
+  std::size_t& count) const
+{
+  ::moab::Tag moab_tag;
+  ::moab::ErrorCode rval = m_iface->tag_get_handle(tagName.c_str(), moab_tag);
+  if (rval != ::moab::MB_SUCCESS)
+  {
+    return false;
+  }
+
+  // Dense tag values are stored in arrays that parallel MOAB's entity
+  // sequences, so tag_iterate exposes the values of the leading run of
+  // entities that share a sequence. Sparse tags are not stored this way.
+  ::moab::TagType tag_type;
+  rval = m_iface->tag_get_type(moab_tag, tag_type);
+  if (rval != ::moab::MB_SUCCESS || tag_type != ::moab::MB_TAG_DENSE)
+  {
+    return false;
+  }
+
+  ::moab::Range range(entities.lower(), entities.upper());
+  int numberOfValues = 0;
+  void* values = nullptr;
+  rval = m_iface->tag_iterate(
+    moab_tag, range.begin(), range.end(), numberOfValues, values, false);
+  if (rval != ::moab::MB_SUCCESS || values == nullptr || numberOfValues <= 0)
+  {
+    return false;
+  }
+
+  data = values;
+  count = static_cast<std::size_t>(numberOfValues);
+  return true;
+}
+
+bool Interface::fieldStorage(
+  const smtk::mesh::HandleInterval& cells,
+  const smtk::mesh::CellFieldTag& cfTag,
+  void*& data,
+  std::size_t& count) const
+{
+  return this->fieldStorage(cells, cfTag.name() + std::string("_"), data, count);
+}
+
 bool Interface::deleteCellField(
   const smtk::mesh::CellFieldTag& cfTag,
   const smtk::mesh::HandleRange& meshsets)
@@ -1920,6 +1967,15 @@ std::set<smtk::mesh::PointFieldTag> Interface::computePointFieldTags(
   return pointFieldTags;
 }
 
+bool Interface::fieldStorage(
+  const smtk::mesh::HandleInterval& points,
+  const smtk::mesh::PointFieldTag& pfTag,
+  void*& data,
+  std::size_t& count) const
+{
+  return this->fieldStorage(points, pfTag.name() + std::string("_"), data, count);
+}
+
 bool Interface::deletePointField(
   const smtk::mesh::PointFieldTag& pfTag,
   const smtk::mesh::HandleRange& meshsets)
@@ -305,6 +305,12 @@ public:
   std::set<smtk::mesh::CellFieldTag> computeCellFieldTags(
     const smtk::mesh::Handle& handle) const override;
 
+  bool fieldStorage(
+    const smtk::mesh::HandleInterval& cells,
+    const smtk::mesh::CellFieldTag& cfTag,
+    void*& data,
+    std::size_t& count) const override;
+
   bool deleteCellField(
     const smtk::mesh::CellFieldTag& cfTag,
     const smtk::mesh::HandleRange& meshsets) override;
@@ -350,6 +356,12 @@ public:
   std::set<smtk::mesh::PointFieldTag> computePointFieldTags(
     const smtk::mesh::Handle& handle) const override;
 
+  bool fieldStorage(
+    const smtk::mesh::HandleInterval& points,
+    const smtk::mesh::PointFieldTag& pfTag,
+    void*& data,
+    std::size_t& count) const override;
+
   bool deletePointField(
     const smtk::mesh::PointFieldTag& pfTag,
     const smtk::mesh::HandleRange& meshsets) override;
@@ -382,6 +394,12 @@ public:
   void setModifiedState(bool state) override { m_modified = state; }
 
 private:
+  bool fieldStorage(
+    const smtk::mesh::HandleInterval& entities,
+    const std::string& tagName,
+    void*& data,
+    std::size_t& count) const;
+
   void callPointForEach(
     const HandleRange& points,
     std::vector<double>& coords,
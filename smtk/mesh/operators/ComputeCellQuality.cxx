@@ -0,0 +1,144 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/operators/ComputeCellQuality.h"
+
+#include "smtk/mesh/core/Component.h"
+#include "smtk/mesh/core/MeshSet.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/VoidItem.h"
+
+#include "smtk/mesh/operators/ComputeCellQuality_xml.h"
+
+#include <sstream>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+
+namespace
+{
+void printStatistics(
+  std::ostream& os,
+  const std::string& name,
+  const smtk::mesh::utility::CellQualityStatistics& statistics)
+{
+  os << "  " << name << ":\n";
+  if (statistics.numberOfCells == statistics.numberOfUndefinedCells)
+  {
+    os << "    undefined for all " << statistics.numberOfCells << " cells\n";
+    return;
+  }
+  os << "    minimum:   " << statistics.minimum << "\n"
+     << "    maximum:   " << statistics.maximum << "\n"
+     << "    mean:      " << statistics.mean << "\n"
+     << "    std. dev.: " << statistics.standardDeviation << "\n";
+  if (statistics.numberOfUndefinedCells > 0)
+  {
+    os << "    undefined: " << statistics.numberOfUndefinedCells << " cells\n";
+  }
+
+  const std::size_t numberOfBins = statistics.histogram.size();
+  const double width = (statistics.maximum - statistics.minimum) / numberOfBins;
+  for (std::size_t bin = 0; bin < numberOfBins; ++bin)
+  {
+    os << "    [" << statistics.minimum + bin * width << ", "
+       << (bin + 1 == numberOfBins ? statistics.maximum : statistics.minimum + (bin + 1) * width)
+       << (bin + 1 == numberOfBins ? "]: " : "): ") << statistics.histogram[bin] << "\n";
+  }
+}
+} // namespace
+
+smtk::mesh::ComputeCellQuality::Result ComputeCellQuality::operateInternal()
+{
+  // Access the requested metrics
+  smtk::attribute::StringItem::Ptr metricItem = this->parameters()->findString("metric");
+  std::vector<smtk::mesh::utility::CellQualityMetric> metrics;
+  for (std::size_t i = 0; i < metricItem->numberOfValues(); ++i)
+  {
+    smtk::mesh::utility::CellQualityMetric metric =
+      smtk::mesh::utility::cellQualityMetricFromName(metricItem->value(i));
+    if (metric == smtk::mesh::utility::CellQualityMetric::CellQualityMetric_MAX)
+    {
+      smtkErrorMacro(
+        this->log(), "Unknown cell quality metric \"" << metricItem->value(i) << "\".");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+    metrics.push_back(metric);
+  }
+
+  const std::size_t numberOfBins =
+    static_cast<std::size_t>(this->parameters()->findInt("bins")->value());
+  const bool createFields = this->parameters()->findVoid("create fields")->isEnabled();
+
+  Result result = this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
+
+  smtk::attribute::ReferenceItem::Ptr meshItem = this->parameters()->associations();
+  for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
+  {
+    smtk::mesh::Component::Ptr meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
+    smtk::mesh::MeshSet meshset = meshComponent->mesh();
+
+    // Gather the cells once and compute each metric from the gathered arrays
+    smtk::mesh::utility::CellQuality quality(meshset.cells());
+
+    std::ostringstream summary;
+    summary << "Cell quality of mesh component <" << meshComponent->id() << ">\n"
+            << "  name:    " << meshset.name() << "\n"
+            << "  # cells: " << quality.numberOfCells() << "\n";
+    for (const auto& metric : metrics)
+    {
+      std::vector<double> values = quality.compute(metric);
+      const std::string name = smtk::mesh::utility::cellQualityMetricName(metric);
+      printStatistics(
+        summary, name, smtk::mesh::utility::CellQuality::summarize(values, numberOfBins));
+
+      if (createFields && !meshset.is_empty())
+      {
+        // Replace the field of a previous computation
+        smtk::mesh::CellField previous = meshset.cellField(name);
+        if (previous.isValid())
+        {
+          meshset.removeCellField(previous);
+        }
+        if (!meshset
+               .createCellField(name, 1, smtk::mesh::FieldType::Double, values.data())
+               .isValid())
+        {
+          smtkWarningMacro(this->log(), "Could not create cell field \"" << name << "\".");
+        }
+      }
+    }
+    smtkInfoMacro(this->log(), summary.str());
+
+    if (createFields)
+    {
+      result->findComponent("modified")->appendValue(meshComponent);
+    }
+  }
+
+  return result;
+}
+
+const char* ComputeCellQuality::xmlDescription() const
+{
+  return ComputeCellQuality_xml;
+}
+
+} //namespace mesh
+} // namespace smtk
@@ -0,0 +1,42 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_mesh_ComputeCellQuality_h
+#define smtk_mesh_ComputeCellQuality_h
+
+#include "smtk/operation/XMLOperation.h"
+
+namespace smtk
+{
+namespace mesh
+{
+
+/**\brief Compute quality metrics of the cells of meshes.
+
+   For each associated mesh, the requested metrics are computed in parallel
+   and their statistics and histograms are logged. Optionally, each metric is
+   also stored as a cell field on the mesh.
+  */
+class SMTKCORE_EXPORT ComputeCellQuality : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(smtk::mesh::ComputeCellQuality);
+  smtkCreateMacro(ComputeCellQuality);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+  smtkSuperclassMacro(smtk::operation::XMLOperation);
+
+protected:
+  Result operateInternal() override;
+  const char* xmlDescription() const override;
+};
+
+} //namespace mesh
+} // namespace smtk
+
+#endif // smtk_mesh_ComputeCellQuality_h
@@ -28,7 +28,9 @@
 
 #include "smtk/mesh/interpolation/InverseDistanceWeighting.h"
 #include "smtk/mesh/interpolation/PointCloud.h"
+#include "smtk/mesh/interpolation/PointCloudFromCSV.h"
 #include "smtk/mesh/interpolation/PointCloudGenerator.h"
+#include "smtk/mesh/interpolation/PointCloudIndex.h"
 #include "smtk/mesh/interpolation/RadialAverage.h"
 #include "smtk/mesh/interpolation/StructuredGrid.h"
 #include "smtk/mesh/interpolation/StructuredGridGenerator.h"
@@ -42,7 +44,9 @@
 
 #include "smtk/operation/MarkGeometry.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <sstream>
@@ -51,70 +55,31 @@
 
 namespace
 {
+// Structured grids are interpolated directly; other data sets are converted
+// into point clouds and indexed.
 template<typename InputType>
-std::function<double(std::array<double, 3>)> radialAverageFrom(
-  const InputType& input,
-  double radius,
-  const std::function<bool(double)>& prefilter,
-  const smtk::mesh::InterfacePtr& interface)
+smtk::mesh::StructuredGrid structuredGridFrom(const InputType& input)
 {
-  std::function<double(std::array<double, 3>)> radialAverage;
-  {
-    // Let's start by trying to make a structured grid, since they can be a
-    // subset of point clouds.
-    smtk::mesh::StructuredGridGenerator sgg;
-    smtk::mesh::StructuredGrid structuredgrid = sgg(input);
-    if (structuredgrid.size() > 0)
-    {
-      radialAverage = smtk::mesh::RadialAverage(structuredgrid, radius, prefilter);
-    }
-  }
-
-  if (!radialAverage)
-  {
-    // Next, we try to make a point cloud from our data.
-    smtk::mesh::PointCloudGenerator pcg;
-    smtk::mesh::PointCloud pointcloud = pcg(input);
-    if (pointcloud.size() > 0)
-    {
-      radialAverage = smtk::mesh::RadialAverage(
-        smtk::mesh::Resource::create(interface), pointcloud, radius, prefilter);
-    }
-  }
-
-  return radialAverage;
+  smtk::mesh::StructuredGridGenerator sgg;
+  return sgg(input);
 }
 
 template<typename InputType>
-std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
-  const InputType& input,
-  double power,
-  const std::function<bool(double)>& prefilter)
+bool indexPointCloudFrom(const InputType& input, smtk::mesh::PointCloudIndex& index)
 {
-  std::function<double(std::array<double, 3>)> idw;
+  smtk::mesh::PointCloudGenerator pcg;
+  smtk::mesh::PointCloud pointcloud = pcg(input);
+  if (pointcloud.size() == 0)
   {
-    // Let's start by trying to make a structured grid, since they can be a
-    // subset of point clouds.
-    smtk::mesh::StructuredGridGenerator sgg;
-    smtk::mesh::StructuredGrid structuredgrid = sgg(input);
-    if (structuredgrid.size() > 0)
-    {
-      idw = smtk::mesh::InverseDistanceWeighting(structuredgrid, power, prefilter);
-    }
-  }
-
-  if (!idw)
-  {
-    // Next, we try to make a point cloud from our data.
-    smtk::mesh::PointCloudGenerator pcg;
-    smtk::mesh::PointCloud pointcloud = pcg(input);
-    if (pointcloud.size() > 0)
-    {
-      idw = smtk::mesh::InverseDistanceWeighting(pointcloud, power, prefilter);
-    }
+    return false;
   }
+  index.insert(pointcloud);
+  return true;
+}
 
-  return idw;
+double elapsedSince(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 }
 } // namespace
 
@@ -189,11 +154,16 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     }
   }
 
-  // Construct a function that takes an input point and returns a value
-  // according to the average of the locus of points in the external data that,
-  // when projected onto the x-y plane, are within a radius of the input
-  std::function<double(std::array<double, 3>)> interpolation;
-
+  // Gather the input data. Structured grids are interpolated directly; all
+  // other data are streamed into a grid index of their points.
+  const auto indexStart = std::chrono::steady_clock::now();
+  smtk::mesh::StructuredGrid structuredgrid;
+  auto mergeDistanceItem = this->parameters()->findDouble("merge distance");
+  // Explicitly listed points are never filtered by the input thresholds.
+  const bool explicitPoints = inputDataItem->value() == "points";
+  smtk::mesh::PointCloudIndex index(
+    explicitPoints ? [](double /*unused*/) { return true; } : prefilter,
+    mergeDistanceItem && mergeDistanceItem->isEnabled() ? mergeDistanceItem->value() : 0.);
   if (inputDataItem->value() == "auxiliary geometry")
   {
     // Access the external data to use in determining elevation values
@@ -202,20 +172,8 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     // Get the auxiliary geometry
     smtk::model::AuxiliaryGeometry auxGeo = auxGeoItem->valueAs<smtk::model::Entity>();
 
-    if (interpolationSchemeItem->value() == "radial average")
-    {
-      // Compute the radial average function
-      interpolation = radialAverageFrom<smtk::model::AuxiliaryGeometry>(
-        auxGeo, radiusItem->value(), prefilter, resource->interface());
-    }
-    else if (interpolationSchemeItem->value() == "inverse distance weighting")
-    {
-      // Compute the inverse distance weighting function
-      interpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
-        auxGeo, powerItem->value(), prefilter);
-    }
-
-    if (!interpolation)
+    structuredgrid = structuredGridFrom<smtk::model::AuxiliaryGeometry>(auxGeo);
+    if (structuredgrid.size() == 0 && !indexPointCloudFrom(auxGeo, index))
     {
       smtkErrorMacro(this->log(), "Could not convert auxiliary geometry.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -226,20 +184,30 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     // Get the file name
     std::string fileName = this->parameters()->findFile("ptsfile")->value();
 
-    if (interpolationSchemeItem->value() == "radial average")
+    bool read = false;
+    if (smtk::mesh::PointCloudFromCSV().valid(fileName))
     {
-      // Compute the radial average function
-      interpolation = radialAverageFrom<std::string>(
-        fileName, radiusItem->value(), prefilter, resource->interface());
+      // Stream the file's points into the index in chunks
+      try
+      {
+        smtk::mesh::PointCloudFromCSV::readChunks(
+          fileName, [&index](std::size_t nPoints, const double* coordinates, const double* values) {
+            index.insert(nPoints, coordinates, values);
+          });
+        read = index.size() > 0;
+      }
+      catch (const std::exception& e)
+      {
+        smtkErrorMacro(this->log(), e.what());
+      }
     }
-    else if (interpolationSchemeItem->value() == "inverse distance weighting")
+    else
     {
-      // Compute the inverse distance weighting function
-      interpolation =
-        inverseDistanceWeightingFrom<std::string>(fileName, powerItem->value(), prefilter);
+      structuredgrid = structuredGridFrom<std::string>(fileName);
+      read = structuredgrid.size() > 0 || indexPointCloudFrom(fileName, index);
     }
 
-    if (!interpolation)
+    if (!read)
     {
       smtkErrorMacro(this->log(), "Could not read file.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -267,28 +235,77 @@ ElevateMesh::Result ElevateMesh::operateInternal()
       sourceValues.push_back(pointItem->value(3));
     }
 
-    smtk::mesh::PointCloud pointcloud(std::move(sourceCoordinates), std::move(sourceValues));
+    index.insert(sourceValues.size(), sourceCoordinates.data(), sourceValues.data());
+    if (index.size() == 0)
+    {
+      smtkErrorMacro(this->log(), "Could not read points.");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+  }
+  else
+  {
+    smtkErrorMacro(this->log(), "Unrecognized input type.");
+    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+  }
 
-    if (interpolationSchemeItem->value() == "radial average")
+  const bool radialAverage = interpolationSchemeItem->value() == "radial average";
+  if (structuredgrid.size() == 0)
+  {
+    // A radial average visits the grid cells that overlap its circle, so the
+    // cells are sized to the radius; other schemes let the index choose.
+    index.build(radialAverage ? radiusItem->value() : 0.);
+    const double seconds = elapsedSince(indexStart);
+    smtkInfoMacro(
+      this->log(),
+      "Indexed " << index.numberOfInsertedPoints() << " points in " << seconds << " s ("
+                 << index.numberOfInsertedPoints() / std::max(seconds, 1.e-9)
+                 << " points/s) as " << index.size() << " points using "
+                 << index.numberOfLevels() << " grid levels.");
+  }
+
+  // Gathering the input data may take a while; stop before touching any mesh
+  // if the operation has been canceled in the meantime.
+  if (!this->reportProgress(0., "Gathered elevation data."))
+  {
+    return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+  }
+
+  // Construct a function that takes an input point and returns a value
+  // interpolated from the input data. It must be safe to call concurrently.
+  std::function<double(std::array<double, 3>)> interpolation;
+  if (radialAverage)
+  {
+    const double radius = radiusItem->value();
+    if (structuredgrid.size() > 0)
     {
-      interpolation = smtk::mesh::RadialAverage(
-        smtk::mesh::Resource::create(resource->interface()), pointcloud, radiusItem->value());
+      interpolation = smtk::mesh::RadialAverage(structuredgrid, radius, prefilter);
     }
-    else if (interpolationSchemeItem->value() == "inverse distance weighting")
+    else
     {
-      // Compute the inverse distance weighting function
-      interpolation = smtk::mesh::InverseDistanceWeighting(pointcloud, powerItem->value());
+      interpolation = [&index, radius](std::array<double, 3> x) {
+        return index.radialAverage(x, radius);
+      };
     }
-
-    if (!interpolation)
+  }
+  else if (interpolationSchemeItem->value() == "inverse distance weighting")
+  {
+    const double power = powerItem->value();
+    const double tolerance = this->parameters()->findDouble("tolerance")->value();
+    if (structuredgrid.size() > 0)
     {
-      smtkErrorMacro(this->log(), "Could not read points.");
-      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+      interpolation = smtk::mesh::InverseDistanceWeighting(structuredgrid, power, prefilter);
+    }
+    else
+    {
+      interpolation = [&index, power, tolerance](std::array<double, 3> x) {
+        return index.inverseDistanceWeighting(x, power, tolerance);
+      };
     }
   }
-  else
+
+  if (!interpolation)
   {
-    smtkErrorMacro(this->log(), "Unrecognized input type.");
+    smtkErrorMacro(this->log(), "Unrecognized interpolation scheme.");
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
@@ -373,12 +390,33 @@ ElevateMesh::Result ElevateMesh::operateInternal()
   smtk::operation::MarkGeometry markGeometry(resource);
 
   // apply the interpolator to the meshes and populate the result attributes
-  for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
+  const std::size_t nMeshes = meshItem->numberOfValues();
+  for (std::size_t i = 0; i < nMeshes; i++)
   {
     auto meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
     auto mesh = meshComponent->mesh();
 
-    smtk::mesh::utility::applyWarp(fn, mesh, true);
+    // Report progress and throughput after each chunk of points. A canceled
+    // warp leaves the remaining points in place; their prior coordinates are
+    // still stored, so the partially elevated mesh can be undone.
+    const std::size_t nPoints = mesh.points().size();
+    const auto elevateStart = std::chrono::steady_clock::now();
+    std::function<bool(std::size_t)> progress = [&](std::size_t nElevated) {
+      std::ostringstream message;
+      message << "Elevated " << nElevated << " of " << nPoints << " points ("
+              << nElevated / std::max(elapsedSince(elevateStart), 1.e-9) << " points/s).";
+      return this->reportProgress(
+        (i + static_cast<double>(nElevated) / std::max<std::size_t>(nPoints, 1)) / nMeshes,
+        message.str());
+    };
+
+    smtk::mesh::utility::applyWarpInParallel(fn, mesh, true, progress);
+
+    const double seconds = elapsedSince(elevateStart);
+    smtkInfoMacro(
+      this->log(),
+      "Elevated " << nPoints << " points in " << seconds << " s ("
+                  << nPoints / std::max(seconds, 1.e-9) << " points/s).");
 
     modified->appendValue(meshComponent);
     markGeometry.markModified(meshComponent);
@@ -391,6 +429,14 @@ ElevateMesh::Result ElevateMesh::operateInternal()
       modified->appendValue(model.component());
       smtk::operation::MarkGeometry().markModified(model.component());
     }
+
+    // Meshes that have not been visited are left untouched.
+    if (this->cancelRequested())
+    {
+      result->findInt("outcome")->setValue(
+        static_cast<int>(smtk::operation::Operation::Outcome::CANCELED));
+      break;
+    }
   }
 
   return result;
@@ -75,8 +75,22 @@ Export::Result Export::operateInternal()
 
   std::vector<std::string> generatedFiles;
 
-  for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
+  const std::size_t nResources = meshItem->numberOfValues();
+  for (std::size_t i = 0; i < nResources; i++)
   {
+    // A partial export is of no use, so a canceled export removes the files
+    // it has already written.
+    if (!this->reportProgress(
+          static_cast<double>(i) / nResources,
+          "Exported " + std::to_string(i) + " of " + std::to_string(nResources) + " meshes."))
+    {
+      for (auto&& file : generatedFiles)
+      {
+        cleanup(file);
+      }
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
+
     smtk::mesh::ResourcePtr resource = meshItem->valueAs<smtk::mesh::Resource>(i);
     bool fileExportSuccess = false;
 
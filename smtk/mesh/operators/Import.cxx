@@ -22,12 +22,17 @@
 #include "smtk/attribute/VoidItem.h"
 
 #include "smtk/io/ImportMesh.h"
+#include "smtk/io/Logger.h"
 
 #include "smtk/mesh/core/Component.h"
 #include "smtk/mesh/core/Resource.h"
 
 #include "smtk/mesh/operators/Import_xml.h"
 
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
 namespace
 {
 class AddMeshToResult : public smtk::mesh::MeshForEach
@@ -64,6 +69,7 @@ Import::Result Import::operateInternal()
   std::string label = labelItem->value();
 
   auto resource = smtk::mesh::Resource::create();
+  const auto importStart = std::chrono::steady_clock::now();
   bool success = smtk::io::importMesh(filePath, resource, label);
 
   if (!success)
@@ -71,6 +77,22 @@ Import::Result Import::operateInternal()
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
+  // The file is read in a single call, so cancellation is honored once it
+  // has been read (before the new resource is reported).
+  {
+    const std::size_t nCells = resource->cells().size();
+    const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - importStart).count();
+    std::ostringstream message;
+    message << "Imported " << nCells << " cells in " << seconds << " s ("
+            << nCells / std::max(seconds, 1.e-9) << " cells/s).";
+    smtkInfoMacro(this->log(), message.str());
+    if (!this->reportProgress(1., message.str()))
+    {
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
+  }
+
   auto result = this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
 
   AddMeshToResult addMeshToResult(result);
@@ -381,8 +381,20 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   };
 
   // apply the interpolator to the meshes and populate the result attributes
-  for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
+  const std::size_t nMeshes = meshItem->numberOfValues();
+  for (std::size_t i = 0; i < nMeshes; i++)
   {
+    // Meshes are interpolated whole, so a canceled operation stops between
+    // meshes and reports the ones it has completed.
+    if (!this->reportProgress(
+          static_cast<double>(i) / nMeshes,
+          "Interpolated " + std::to_string(i) + " of " + std::to_string(nMeshes) + " meshes."))
+    {
+      result->findInt("outcome")->setValue(
+        static_cast<int>(smtk::operation::Operation::Outcome::CANCELED));
+      break;
+    }
+
     smtk::mesh::Component::Ptr meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
     smtk::mesh::MeshSet mesh = meshComponent->mesh();
 
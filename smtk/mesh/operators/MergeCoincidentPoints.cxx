@@ -13,6 +13,8 @@
 #include "smtk/mesh/core/MeshSet.h"
 #include "smtk/mesh/core/Resource.h"
 
+#include "smtk/mesh/utility/MergeCoincidentPoints.h"
+
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/ComponentItem.h"
 #include "smtk/attribute/DoubleItem.h"
@@ -36,8 +38,16 @@ smtk::mesh::MergeCoincidentPoints::Result MergeCoincidentPoints::operateInternal
   smtk::mesh::Component::Ptr meshComponent = meshItem->valueAs<smtk::mesh::Component>();
   smtk::mesh::MeshSet meshset = meshComponent->mesh();
 
-  // Set the name of the meshset
-  bool success = meshset.mergeCoincidentContactPoints(tolerance);
+  // Merge the points using the requested algorithm
+  bool success = false;
+  if (this->parameters()->findString("algorithm")->value() == "backend")
+  {
+    success = meshset.mergeCoincidentContactPoints(tolerance);
+  }
+  else
+  {
+    success = smtk::mesh::utility::mergeCoincidentPoints(meshset, tolerance);
+  }
 
   if (!success)
   {
@@ -24,6 +24,7 @@
 
 #include "smtk/io/ReadMesh.h"
 
+#include "smtk/mesh/json/BinaryResource.h"
 #include "smtk/mesh/json/jsonResource.h"
 
 #include "smtk/mesh/core/Resource.h"
@@ -36,6 +37,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 SMTK_THIRDPARTY_POST_INCLUDE
 
 #include <fstream>
+#include <set>
 
 namespace smtk
 {
@@ -49,15 +51,18 @@ ReadResource::Result ReadResource::operateInternal()
   std::ifstream file;
 
   smtk::common::Archive archive(filename);
-  if (!archive.contents().empty())
+  std::set<std::string> contents = archive.contents();
+  if (!contents.empty())
   {
-    std::string smtkFilename = "index.json";
+    // Archives hold either a binary or a text index
+    std::string smtkFilename =
+      contents.find("index.smtkb") != contents.end() ? "index.smtkb" : "index.json";
 
-    archive.get(smtkFilename, file);
+    file.open(archive.location(smtkFilename), std::ios::binary);
   }
   else
   {
-    file.open(filename);
+    file.open(filename, std::ios::binary);
   }
 
   if (!file.good())
@@ -68,11 +73,38 @@ ReadResource::Result ReadResource::operateInternal()
   }
 
   nlohmann::json j;
+  bool parsed = true;
   try
   {
-    j = nlohmann::json::parse(file);
+    if (smtk::mesh::json::isBinaryResource(file))
+    {
+      // Only the resource's header is kept. The meshes themselves are read
+      // from the mesh file below, so their records are read (and checked) one
+      // at a time and discarded rather than gathered into one description.
+      smtk::mesh::json::BinaryResourceReader reader(file);
+      parsed = reader.isValid();
+      if (parsed)
+      {
+        j = reader.header();
+        nlohmann::json mesh;
+        std::size_t numberOfMeshes = 0;
+        while (reader.next(mesh))
+        {
+          ++numberOfMeshes;
+        }
+        parsed = numberOfMeshes == reader.numberOfMeshes();
+      }
+    }
+    else
+    {
+      j = nlohmann::json::parse(file);
+    }
   }
   catch (...)
+  {
+    parsed = false;
+  }
+  if (!parsed)
   {
     smtkErrorMacro(log(), "Cannot parse file \"" << filename << "\".");
     file.close();
@@ -83,7 +115,7 @@ ReadResource::Result ReadResource::operateInternal()
   std::string meshFilename = j.at("Mesh URL");
 
   smtk::common::FileLocation meshFileLocation;
-  if (!archive.contents().empty())
+  if (!contents.empty())
   {
     meshFileLocation = archive.location(meshFilename);
   }
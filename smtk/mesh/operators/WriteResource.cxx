@@ -14,6 +14,7 @@
 #include "smtk/attribute/FileItem.h"
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/VoidItem.h"
 
 #include "smtk/common/Archive.h"
@@ -25,6 +26,7 @@
 
 #include "smtk/mesh/operators/Write.h"
 
+#include "smtk/mesh/json/BinaryResource.h"
 #include "smtk/mesh/json/jsonResource.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
@@ -39,6 +41,29 @@ SMTK_THIRDPARTY_POST_INCLUDE
 
 using namespace smtk::model;
 
+namespace
+{
+bool writeIndex(const nlohmann::json& j, const std::string& path, bool binary)
+{
+  std::ofstream file(path, binary ? std::ios::out | std::ios::binary : std::ios::out);
+  if (!file.good())
+  {
+    return false;
+  }
+  bool written = true;
+  if (binary)
+  {
+    written = smtk::mesh::json::writeBinaryResource(j, file);
+  }
+  else
+  {
+    file << j.dump(2);
+  }
+  file.close();
+  return written && !file.fail();
+}
+} // namespace
+
 namespace smtk
 {
 namespace mesh
@@ -74,11 +99,14 @@ WriteResource::Result WriteResource::operateInternal()
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
+  auto format = this->parameters()->findString("format");
+  const bool binary = format && format->value() == "binary";
+
   // Check if the mesh files are to be archived into a single file
   auto archive = this->parameters()->findVoid("archive");
   if (archive && archive->isEnabled())
   {
-    boost::filesystem::path smtkFilename("index.json");
+    boost::filesystem::path smtkFilename(binary ? "index.smtkb" : "index.json");
     boost::filesystem::path meshFilename("mesh.h5m");
 
     boost::filesystem::path temp =
@@ -94,15 +122,11 @@ WriteResource::Result WriteResource::operateInternal()
     j["Mesh URL"] = meshFilename.string();
 
     // Write the smtk index
+    if (!writeIndex(j, tmpsmtkPath.string(), binary))
     {
-      std::ofstream file(tmpsmtkPath.string());
-      if (!file.good())
-      {
-        smtkErrorMacro(log(), "Unable to open \"" << tmpsmtkPath.string() << "\" for writing.");
-        return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-      }
-      file << j.dump(2);
-      file.close();
+      smtkErrorMacro(log(), "Unable to write \"" << tmpsmtkPath.string() << "\".");
+      ::boost::filesystem::remove_all(temp);
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
 
     // Write the mesh file
@@ -131,6 +155,8 @@ WriteResource::Result WriteResource::operateInternal()
     // Populate an archive with the smtk index and mesh file
     {
       smtk::common::Archive archive(resource->location());
+      auto compress = this->parameters()->findVoid("compress");
+      archive.setCompressed(compress && compress->isEnabled());
       archive.insert(tmpsmtkPath.string(), smtkFilename.string());
       archive.insert(tmpMeshPath.string(), meshFilename.string());
       if (!archive.archive())
@@ -155,15 +181,10 @@ WriteResource::Result WriteResource::operateInternal()
 
     j["Mesh URL"] = meshFilename;
 
+    if (!writeIndex(j, resource->location(), binary))
     {
-      std::ofstream file(resource->location());
-      if (!file.good())
-      {
-        smtkErrorMacro(log(), "Unable to open \"" << resource->location() << "\" for writing.");
-        return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-      }
-      file << j.dump(2);
-      file.close();
+      smtkErrorMacro(log(), "Unable to write \"" << resource->location() << "\".");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
 
     // Create a write operator
@@ -16,6 +16,7 @@
 
 #include "smtk/mesh/core/Resource.h"
 
+#include "smtk/mesh/operators/ComputeCellQuality.h"
 #include "smtk/mesh/operators/DeleteMesh.h"
 #include "smtk/mesh/operators/ElevateMesh.h"
 #include "smtk/mesh/operators/Export.h"
@@ -52,6 +53,7 @@ namespace mesh
 namespace
 {
 typedef std::tuple<
+  ComputeCellQuality,
   DeleteMesh,
   ElevateMesh,
   Export,
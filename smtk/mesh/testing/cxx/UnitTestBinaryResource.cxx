@@ -0,0 +1,194 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/UUIDGenerator.h"
+#include "smtk/common/json/jsonUUID.h"
+
+#include "smtk/mesh/json/BinaryResource.h"
+#include "smtk/mesh/json/jsonHandleRange.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+smtk::mesh::HandleRange makeRange(smtk::mesh::Handle first, std::size_t nIntervals)
+{
+  smtk::mesh::HandleRange range;
+  smtk::mesh::Handle lower = first;
+  for (std::size_t i = 0; i < nIntervals; ++i)
+  {
+    range.insert(smtk::mesh::HandleInterval(lower, lower + i % 7));
+    lower += i % 7 + 2 + i % 3;
+  }
+  return range;
+}
+
+// Mimic the description of a mesh resource written by smtk::mesh::to_json
+nlohmann::json makeResource(std::size_t nMeshes)
+{
+  smtk::common::UUIDGenerator& generator = smtk::common::UUIDGenerator::instance();
+  const smtk::common::UUID model = generator.random();
+
+  nlohmann::json j;
+  j["id"] = generator.random();
+  j["name"] = "resource";
+  j["properties"] = { { "string", { { "name", { "resource" } } } } };
+  j["Mesh URL"] = "mesh.h5m";
+  j["info"] = { { "cell_types", "000000011" },
+                { "meshIds", makeRange(1, 3) },
+                { "id", generator.random() },
+                { "modelEntityIds", nlohmann::json::array() },
+                { "domains", std::vector<int>() },
+                { "boundary_conditions", nullptr } };
+
+  nlohmann::json meshes = nlohmann::json::array();
+  for (std::size_t i = 0; i < nMeshes; ++i)
+  {
+    nlohmann::json mesh;
+    mesh["cell_types"] = i % 2 == 0 ? "000000011" : "000001000";
+    mesh["cells"] = makeRange(1000 * i + 1, 20);
+    mesh["points"] = makeRange(1000 * i + 500, 5);
+    mesh["id"] = generator.random();
+    mesh["modelEntityIds"] = { model };
+    mesh["domains"] = { static_cast<int>(i % 3) };
+    if (i % 4 == 0)
+    {
+      mesh["boundary_conditions"] = { { { "type", "dirichlet" }, { "value", 2 } } };
+    }
+    else
+    {
+      mesh["boundary_conditions"] = nullptr;
+    }
+    if (i == 1)
+    {
+      // A key that only one mesh has
+      mesh["note"] = "unique";
+    }
+    meshes.push_back(mesh);
+  }
+  j["meshes"] = meshes;
+  return j;
+}
+
+void verify_packed_ranges()
+{
+  for (std::size_t nIntervals : { 0, 1, 1000 })
+  {
+    const smtk::mesh::HandleRange range = makeRange(7, nIntervals);
+    const std::vector<std::uint8_t> bytes = smtk::mesh::json::packHandleRange(range);
+    smtk::mesh::HandleRange unpacked;
+    test(smtk::mesh::json::unpackHandleRange(bytes, unpacked), "Failed to unpack range");
+    test(unpacked == range, "Unpacked range differs from the packed range");
+  }
+
+  // Large handles
+  smtk::mesh::HandleRange range;
+  range.insert(smtk::mesh::HandleInterval(0, 0));
+  range.insert(smtk::mesh::HandleInterval(1ULL << 40, (1ULL << 40) + 100));
+  smtk::mesh::HandleRange unpacked;
+  test(
+    smtk::mesh::json::unpackHandleRange(smtk::mesh::json::packHandleRange(range), unpacked) &&
+      unpacked == range,
+    "Failed to round-trip large handles");
+
+  // Truncated data
+  std::vector<std::uint8_t> bytes = smtk::mesh::json::packHandleRange(makeRange(7, 10));
+  bytes.pop_back();
+  unpacked.clear();
+  test(!smtk::mesh::json::unpackHandleRange(bytes, unpacked), "Truncated range was unpacked");
+}
+
+void verify_round_trip()
+{
+  const nlohmann::json j = makeResource(100);
+
+  std::stringstream stream;
+  test(smtk::mesh::json::writeBinaryResource(j, stream), "Failed to write binary resource");
+  const std::string binary = stream.str();
+  const std::string text = j.dump();
+  smtkTest(
+    binary.size() * 3 < text.size(),
+    "Binary resource (" << binary.size() << " bytes) is not much smaller than text ("
+                        << text.size() << " bytes)");
+
+  test(smtk::mesh::json::isBinaryResource(stream), "Binary resource not detected");
+  nlohmann::json read;
+  test(smtk::mesh::json::readBinaryResource(stream, read), "Failed to read binary resource");
+  test(read == j, "Binary resource differs from the written resource");
+
+  std::stringstream textStream(text);
+  test(!smtk::mesh::json::isBinaryResource(textStream), "Text resource detected as binary");
+  test(textStream.tellg() == 0, "Detection should not move the stream");
+
+  // A resource without meshes
+  nlohmann::json empty = makeResource(0);
+  empty["meshes"] = nullptr;
+  std::stringstream emptyStream;
+  smtk::mesh::json::writeBinaryResource(empty, emptyStream);
+  test(
+    smtk::mesh::json::readBinaryResource(emptyStream, read) && read == empty,
+    "Failed to round-trip a resource without meshes");
+}
+
+void verify_incremental_read()
+{
+  const nlohmann::json j = makeResource(10);
+  std::stringstream stream;
+  smtk::mesh::json::writeBinaryResource(j, stream);
+
+  smtk::mesh::json::BinaryResourceReader reader(stream);
+  test(reader.isValid() && reader.hasMeshes(), "Failed to read binary resource header");
+  test(reader.numberOfMeshes() == 10, "Wrong number of meshes");
+  test(reader.header().find("meshes") == reader.header().end(), "Header holds the meshes");
+  test(reader.header()["info"] == j["info"], "Wrong header");
+
+  nlohmann::json mesh;
+  std::size_t i = 0;
+  while (reader.next(mesh))
+  {
+    test(mesh == j["meshes"][i], "Wrong mesh record");
+    smtk::mesh::HandleRange cells = mesh["cells"].get<smtk::mesh::HandleRange>();
+    test(cells == makeRange(1000 * i + 1, 20), "Wrong cells");
+    ++i;
+  }
+  test(i == 10, "Wrong number of mesh records");
+
+  // A truncated stream
+  std::string truncated = stream.str();
+  truncated.resize(truncated.size() - 10);
+  std::stringstream truncatedStream(truncated);
+  nlohmann::json read;
+  test(
+    !smtk::mesh::json::readBinaryResource(truncatedStream, read),
+    "Truncated binary resource was read");
+
+  // A record whose length exceeds the data that follows it
+  std::string corrupt = stream.str().substr(0, 8);
+  corrupt += std::string(9, '\xff') + '\x01';
+  corrupt += "short";
+  std::stringstream corruptStream(corrupt);
+  smtk::mesh::json::BinaryResourceReader corruptReader(corruptStream);
+  test(!corruptReader.isValid(), "Binary resource with a corrupt record length was read");
+}
+} // namespace
+
+int UnitTestBinaryResource(int /*unused*/, char** const /*unused*/)
+{
+  verify_packed_ranges();
+  verify_round_trip();
+  verify_incremental_read();
+
+  return 0;
+}
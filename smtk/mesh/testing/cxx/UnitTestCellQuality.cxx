@@ -0,0 +1,227 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using smtk::mesh::utility::CellQuality;
+using smtk::mesh::utility::CellQualityMetric;
+
+bool near(double a, double b, double tolerance = 1.e-10)
+{
+  return std::abs(a - b) <= tolerance;
+}
+
+// Build a CellQuality for cells that each have their own points
+class Cells
+{
+public:
+  void add(smtk::mesh::CellType cellType, const std::vector<double>& xyz)
+  {
+    const std::size_t first = m_coordinates.size() / 3;
+    m_coordinates.insert(m_coordinates.end(), xyz.begin(), xyz.end());
+    for (std::size_t i = 0; i < xyz.size() / 3; ++i)
+    {
+      m_connectivity.push_back(first + i);
+    }
+    m_cellTypes.push_back(cellType);
+    m_offsets.push_back(m_connectivity.size());
+  }
+
+  CellQuality quality() const
+  {
+    return CellQuality(m_cellTypes, m_offsets, m_connectivity, m_coordinates);
+  }
+
+private:
+  std::vector<smtk::mesh::CellType> m_cellTypes;
+  std::vector<std::size_t> m_offsets{ 0 };
+  std::vector<std::size_t> m_connectivity;
+  std::vector<double> m_coordinates;
+};
+
+const double pi = std::acos(-1.);
+const double h = std::sqrt(3.) / 2.;
+
+void verify_ideal_cells()
+{
+  Cells cells;
+  cells.add(smtk::mesh::Triangle, { 0, 0, 0, 1, 0, 0, .5, h, 0 });
+  cells.add(smtk::mesh::Quad, { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 });
+  cells.add(
+    smtk::mesh::Tetrahedron,
+    { 0, 0, 0, 1, 0, 0, .5, h, 0, .5, h / 3., std::sqrt(2. / 3.) });
+  cells.add(
+    smtk::mesh::Pyramid,
+    { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, .5, .5, std::sqrt(.5) });
+  cells.add(smtk::mesh::Wedge, { 0, 0, 0, 1, 0, 0, .5, h, 0, 0, 0, 1, 1, 0, 1, .5, h, 1 });
+  cells.add(
+    smtk::mesh::Hexahedron,
+    { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1 });
+  // a regular hexagon
+  std::vector<double> hexagon;
+  for (int i = 0; i < 6; ++i)
+  {
+    hexagon.push_back(std::cos(i * pi / 3.));
+    hexagon.push_back(std::sin(i * pi / 3.));
+    hexagon.push_back(0.);
+  }
+  cells.add(smtk::mesh::Polygon, hexagon);
+
+  CellQuality quality = cells.quality();
+  test(quality.numberOfCells() == 7, "Wrong number of cells");
+
+  std::vector<double> jacobian = quality.compute(CellQualityMetric::ScaledJacobian);
+  std::vector<double> skew = quality.compute(CellQualityMetric::Skew);
+  std::vector<double> size = quality.compute(CellQualityMetric::Size);
+  std::vector<double> aspect = quality.compute(CellQualityMetric::AspectRatio);
+  for (std::size_t i = 0; i < quality.numberOfCells(); ++i)
+  {
+    smtkTest(near(jacobian[i], 1.), "Cell " << i << " has scaled jacobian " << jacobian[i]);
+    smtkTest(near(skew[i], 0.), "Cell " << i << " has skew " << skew[i]);
+    smtkTest(near(aspect[i], 1.), "Cell " << i << " has aspect ratio " << aspect[i]);
+  }
+
+  const double expectedSize[7] = {
+    h / 2., 1., std::sqrt(2.) / 12., std::sqrt(.5) / 3., h / 2., 1., 3. * std::sqrt(3.) / 2.
+  };
+  for (std::size_t i = 0; i < 7; ++i)
+  {
+    smtkTest(near(size[i], expectedSize[i]), "Cell " << i << " has size " << size[i]);
+  }
+
+  std::vector<double> minimumAngle = quality.compute(CellQualityMetric::MinimumAngle);
+  std::vector<double> maximumAngle = quality.compute(CellQualityMetric::MaximumAngle);
+  test(near(minimumAngle[0], 60.) && near(maximumAngle[0], 60.), "Wrong triangle angles");
+  test(near(minimumAngle[1], 90.) && near(maximumAngle[1], 90.), "Wrong quad angles");
+  test(near(minimumAngle[2], 60.) && near(maximumAngle[2], 60.), "Wrong tetrahedron angles");
+  test(near(minimumAngle[5], 90.) && near(maximumAngle[5], 90.), "Wrong hexahedron angles");
+  test(near(minimumAngle[6], 120.) && near(maximumAngle[6], 120.), "Wrong hexagon angles");
+}
+
+void verify_distorted_cells()
+{
+  Cells cells;
+  // a right isoceles triangle
+  cells.add(smtk::mesh::Triangle, { 0, 0, 0, 1, 0, 0, 0, 1, 0 });
+  // an inverted (clockwise) tetrahedron
+  cells.add(
+    smtk::mesh::Tetrahedron,
+    { 0, 0, 0, .5, h, 0, 1, 0, 0, .5, h / 3., std::sqrt(2. / 3.) });
+  // a 2 x 1 rectangle
+  cells.add(smtk::mesh::Quad, { 0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 1, 0 });
+  // a degenerate triangle
+  cells.add(smtk::mesh::Triangle, { 0, 0, 0, 1, 0, 0, 2, 0, 0 });
+  // a line and a vertex
+  cells.add(smtk::mesh::Line, { 0, 0, 0, 3, 4, 0 });
+  cells.add(smtk::mesh::Vertex, { 1, 1, 1 });
+
+  CellQuality quality = cells.quality();
+  std::vector<double> jacobian = quality.compute(CellQualityMetric::ScaledJacobian);
+  std::vector<double> skew = quality.compute(CellQualityMetric::Skew);
+  std::vector<double> size = quality.compute(CellQualityMetric::Size);
+  std::vector<double> aspect = quality.compute(CellQualityMetric::AspectRatio);
+  std::vector<double> minimumAngle = quality.compute(CellQualityMetric::MinimumAngle);
+
+  // The right triangle's smallest corner Jacobian is sin(45) / sin(60)
+  smtkTest(
+    near(jacobian[0], std::sin(pi / 4.) / std::sin(pi / 3.)),
+    "Right triangle has scaled jacobian " << jacobian[0]);
+  smtkTest(near(skew[0], 0.25), "Right triangle has skew " << skew[0]);
+  smtkTest(near(minimumAngle[0], 45.), "Right triangle has minimum angle " << minimumAngle[0]);
+  smtkTest(aspect[0] > 1., "Right triangle has aspect ratio " << aspect[0]);
+
+  smtkTest(near(jacobian[1], -1.), "Inverted tetrahedron has scaled jacobian " << jacobian[1]);
+  smtkTest(
+    near(size[1], -std::sqrt(2.) / 12.), "Inverted tetrahedron has volume " << size[1]);
+
+  smtkTest(near(aspect[2], 2.), "Rectangle has aspect ratio " << aspect[2]);
+  smtkTest(near(skew[2], 0.), "Rectangle has skew " << skew[2]);
+
+  test(std::isinf(aspect[3]), "Degenerate triangle should have an infinite aspect ratio");
+  test(near(jacobian[3], 0.), "Degenerate triangle should have a zero scaled jacobian");
+
+  test(near(size[4], 5.), "Wrong line length");
+  test(std::isnan(skew[4]) && std::isnan(minimumAngle[4]), "Line angles are undefined");
+  test(near(size[5], 0.) && std::isnan(jacobian[5]), "Wrong vertex metrics");
+}
+
+void verify_statistics()
+{
+  // Enough values to be summarized by several tasks, with a few undefined.
+  std::vector<double> values;
+  for (std::size_t i = 0; i < 100000; ++i)
+  {
+    values.push_back(static_cast<double>(i % 100));
+  }
+  values.push_back(std::numeric_limits<double>::quiet_NaN());
+  values.push_back(std::numeric_limits<double>::infinity());
+
+  smtk::mesh::utility::CellQualityStatistics statistics = CellQuality::summarize(values, 4);
+  test(statistics.numberOfCells == 100002, "Wrong number of cells");
+  test(statistics.numberOfUndefinedCells == 2, "Wrong number of undefined cells");
+  test(statistics.minimum == 0. && statistics.maximum == 99., "Wrong range");
+  smtkTest(near(statistics.mean, 49.5, 1.e-8), "Wrong mean " << statistics.mean);
+  smtkTest(
+    near(statistics.standardDeviation, std::sqrt((100. * 100. - 1.) / 12.), 1.e-8),
+    "Wrong standard deviation " << statistics.standardDeviation);
+  test(statistics.histogram.size() == 4, "Wrong number of bins");
+  // The bins are [0, 24.75), [24.75, 49.5), [49.5, 74.25) and [74.25, 99].
+  const std::size_t expected[4] = { 25000, 25000, 25000, 25000 };
+  for (std::size_t bin = 0; bin < 4; ++bin)
+  {
+    smtkTest(
+      statistics.histogram[bin] == expected[bin],
+      "Bin " << bin << " has " << statistics.histogram[bin] << " values");
+  }
+}
+
+void verify_many_cells()
+{
+  // Enough cells to be computed by several tasks: a strip of unit cubes.
+  Cells cells;
+  for (int i = 0; i < 50000; ++i)
+  {
+    const double x = static_cast<double>(i);
+    cells.add(
+      smtk::mesh::Hexahedron,
+      { x, 0, 0, x + 1, 0, 0, x + 1, 1, 0, x, 1, 0,
+        x, 0, 1, x + 1, 0, 1, x + 1, 1, 1, x, 1, 1 });
+  }
+  CellQuality quality = cells.quality();
+  smtk::mesh::utility::CellQualityStatistics statistics =
+    CellQuality::summarize(quality.compute(CellQualityMetric::Size));
+  test(statistics.numberOfCells == 50000 && statistics.numberOfUndefinedCells == 0);
+  test(near(statistics.minimum, 1.) && near(statistics.maximum, 1.), "Wrong volumes");
+  test(statistics.histogram[0] == 50000, "All cells should be in the first bin");
+}
+} // namespace
+
+int UnitTestCellQuality(int /*unused*/, char** const /*unused*/)
+{
+  verify_ideal_cells();
+  verify_distorted_cells();
+  verify_statistics();
+  verify_many_cells();
+
+  test(
+    smtk::mesh::utility::cellQualityMetricFromName("scaled jacobian") ==
+    CellQualityMetric::ScaledJacobian);
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/utility/MergeCoincidentPoints.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// A brute-force reference: transitively merge every pair of points within
+// tolerance into the lowest index of its group.
+std::vector<std::size_t> bruteForceMap(const std::vector<double>& xyz, double tolerance)
+{
+  const std::size_t numberOfPoints = xyz.size() / 3;
+  std::vector<std::size_t> map(numberOfPoints);
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    map[i] = i;
+  }
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (std::size_t i = 0; i < numberOfPoints; ++i)
+    {
+      for (std::size_t j = 0; j < i; ++j)
+      {
+        double d2 = 0.;
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+          d2 += (xyz[3 * i + k] - xyz[3 * j + k]) * (xyz[3 * i + k] - xyz[3 * j + k]);
+        }
+        if (d2 <= tolerance * tolerance && map[i] != map[j])
+        {
+          std::size_t low = std::min(map[i], map[j]);
+          std::size_t high = std::max(map[i], map[j]);
+          for (auto& entry : map)
+          {
+            if (entry == high)
+            {
+              entry = low;
+            }
+          }
+          changed = true;
+        }
+      }
+    }
+  }
+  return map;
+}
+
+void verify_exact_duplicates()
+{
+  // Two copies of a unit square's corners with tolerance zero.
+  std::vector<double> xyz = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+                              0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 };
+  std::vector<std::size_t> map = smtk::mesh::utility::coincidentPointMap(xyz, 0.);
+  std::vector<std::size_t> expected = { 0, 1, 2, 3, 0, 1, 2, 3 };
+  smtkTest(map == expected, "Exact duplicates were not merged.");
+
+  // Points offset by less than the tolerance, including across bin borders.
+  xyz = { 0., 0., 0., 1.e-7, 0., 0., 5., 5., 5., 5., 5. - 9.e-7, 5., -1., 2., 3. };
+  map = smtk::mesh::utility::coincidentPointMap(xyz, 1.e-6);
+  expected = { 0, 0, 2, 2, 4 };
+  smtkTest(map == expected, "Nearby points were not merged.");
+}
+
+void verify_against_brute_force()
+{
+  // Many points snapped to a coarse lattice and jittered, so that groups of
+  // points (some chained) fall within tolerance of one another. Enough points
+  // are used to exercise the concurrent sort and search.
+  std::mt19937 generator(12345);
+  std::uniform_int_distribution<int> lattice(0, 40);
+  std::uniform_real_distribution<double> jitter(-0.02, 0.02);
+  const std::size_t numberOfPoints = 3000;
+  std::vector<double> xyz(3 * numberOfPoints);
+  for (auto& coordinate : xyz)
+  {
+    coordinate = 0.1 * lattice(generator) + jitter(generator);
+  }
+
+  const double tolerance = 0.03;
+  std::vector<std::size_t> map = smtk::mesh::utility::coincidentPointMap(xyz, tolerance);
+  std::vector<std::size_t> expected = bruteForceMap(xyz, tolerance);
+  smtkTest(map.size() == numberOfPoints, "Wrong number of map entries.");
+  std::size_t merged = 0;
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    smtkTest(
+      map[i] == expected[i], "Point " << i << " maps to " << map[i] << ", not " << expected[i]);
+    merged += map[i] != i ? 1 : 0;
+  }
+  smtkTest(merged > 0, "The test data should contain coincident points.");
+}
+
+void verify_many_points()
+{
+  // Enough points to be sorted and searched by several tasks: a lattice of
+  // distinct points followed by a shuffled, slightly offset copy of it.
+  const std::size_t side = 40;
+  const std::size_t numberOfLatticePoints = side * side * side;
+  std::vector<std::size_t> copyOf(numberOfLatticePoints);
+  for (std::size_t i = 0; i < numberOfLatticePoints; ++i)
+  {
+    copyOf[i] = i;
+  }
+  std::shuffle(copyOf.begin(), copyOf.end(), std::mt19937(54321));
+
+  std::vector<double> xyz;
+  xyz.reserve(6 * numberOfLatticePoints);
+  for (std::size_t i = 0; i < numberOfLatticePoints; ++i)
+  {
+    xyz.push_back(static_cast<double>(i % side));
+    xyz.push_back(static_cast<double>((i / side) % side));
+    xyz.push_back(static_cast<double>(i / (side * side)));
+  }
+  for (std::size_t i = 0; i < numberOfLatticePoints; ++i)
+  {
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      xyz.push_back(xyz[3 * copyOf[i] + k] + 1.e-4);
+    }
+  }
+
+  std::vector<std::size_t> map = smtk::mesh::utility::coincidentPointMap(xyz, 1.e-3);
+  for (std::size_t i = 0; i < numberOfLatticePoints; ++i)
+  {
+    smtkTest(map[i] == i, "Lattice point " << i << " should not be merged.");
+    smtkTest(
+      map[numberOfLatticePoints + i] == copyOf[i],
+      "Copied point " << i << " should be merged into " << copyOf[i] << ".");
+  }
+}
+} // namespace
+
+int UnitTestCoincidentPointMap(int /*unused*/, char** const /*unused*/)
+{
+  verify_exact_duplicates();
+  verify_against_brute_force();
+  verify_many_points();
+
+  return 0;
+}
@@ -11,6 +11,7 @@
 #include "smtk/common/UUID.h"
 #include "smtk/io/ExportMesh.h"
 #include "smtk/io/ImportMesh.h"
+#include "smtk/io/mesh/MeshIOXMS.h"
 #include "smtk/mesh/core/Resource.h"
 
 #include "smtk/mesh/testing/cxx/helpers.h"
@@ -18,6 +19,10 @@
 //force to use filesystem version 3
 #define BOOST_FILESYSTEM_VERSION 3
 #include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 using namespace boost::filesystem;
 
 namespace
@@ -108,6 +113,136 @@ void verify_read_write_valid_resource()
     test(mr->points().size() == 662, "resource should have 662 points");
   }
 }
+
+// Verify that every card matches the formatting of the original
+// std::ostream-based writer exactly.
+void verify_write_format()
+{
+  std::string file_path(data_root);
+  file_path += "/mesh/3d/twoassm_out.h5m";
+
+  smtk::mesh::ResourcePtr mr = smtk::mesh::Resource::create();
+  smtk::io::importMesh(file_path, mr);
+  mr->meshes(smtk::mesh::Dims3).extractShell();
+
+  std::ostringstream written;
+  smtk::io::mesh::MeshIOXMS xms;
+  test(xms.exportMesh(written, mr, smtk::mesh::Dims2), "failed to write a 2dm stream");
+
+  std::istringstream lines(written.str());
+  std::string line;
+  std::size_t numberOfCells = 0;
+  std::size_t numberOfPoints = 0;
+  while (std::getline(lines, line))
+  {
+    std::istringstream fields(line);
+    std::string card;
+    fields >> card;
+    std::ostringstream expected;
+    if (card == "ND")
+    {
+      std::size_t id;
+      double xyz[3];
+      fields >> id >> xyz[0] >> xyz[1] >> xyz[2];
+      expected << "ND \t " << std::setw(8) << id << " " << std::fixed << std::setw(12) << xyz[0]
+               << " " << std::setw(12) << xyz[1] << " " << std::setw(12) << xyz[2];
+      ++numberOfPoints;
+    }
+    else if (card == "E3T" || card == "E4Q")
+    {
+      int id;
+      fields >> id;
+      expected << card << " \t " << id << " ";
+      long long value;
+      while (fields >> value)
+      {
+        expected << std::setw(8) << value << " ";
+      }
+      // The region id is not followed by a space.
+      std::string text = expected.str();
+      expected.str(text.substr(0, text.size() - 1));
+      ++numberOfCells;
+    }
+    else
+    {
+      continue;
+    }
+    test(line == expected.str(), "card \"" + line + "\" is not formatted as expected");
+  }
+  test(numberOfCells == 660, "expected 660 cells");
+  test(numberOfPoints == 662, "expected 662 points");
+}
+
+
+// Write a triangulated strip of \a width quads as a 2dm file large enough to
+// be parsed in several chunks. Element cards from \a firstTruncated onward
+// list only their first point; when \a endAt is non-negative, an "END" card
+// precedes element \a endAt.
+std::string write_strip(std::size_t width, std::size_t firstTruncated, long long endAt = -1)
+{
+  std::string write_path(write_root);
+  write_path += "/" + smtk::common::UUID::random().toString() + ".2dm";
+  std::ofstream file(write_path.c_str());
+  file << "MESH2D\n";
+  for (std::size_t i = 0; i <= width; ++i)
+  {
+    file << "ND " << 2 * i + 1 << " " << i << ".0 0.0 0.0\n";
+    file << "ND " << 2 * i + 2 << " " << i << ".0 1.0 0.0\n";
+  }
+  for (std::size_t cell = 0; cell < 2 * width; ++cell)
+  {
+    if (static_cast<long long>(cell) == endAt)
+    {
+      file << "END\n";
+    }
+    std::size_t i = cell / 2;
+    std::size_t a = 2 * i + 1;
+    file << "E3T " << cell + 1 << " " << (cell % 2 == 0 ? a : a + 1);
+    if (cell < firstTruncated)
+    {
+      file << " " << a + 2 << " " << (cell % 2 == 0 ? a + 1 : a + 3) << " 1";
+    }
+    file << "\n";
+  }
+  return write_path;
+}
+
+// Verify that files parsed in several chunks (on several threads) are read
+// completely, and that malformed element cards anywhere in a chunk fail the
+// read instead of corrupting the cells of the chunk.
+void verify_read_chunked()
+{
+  const std::size_t width = 40000;
+  smtk::io::mesh::MeshIOXMS xms;
+
+  {
+    std::string path = write_strip(width, 2 * width);
+    smtk::mesh::ResourcePtr mr = smtk::mesh::Resource::create();
+    bool result = xms.importMesh(path, mr, std::string());
+    cleanup(path);
+    test(result, "failed to read a valid 2dm file");
+    test(mr->cells().size() == 2 * width, "unexpected number of cells read");
+    test(mr->points().size() == 2 * (width + 1), "unexpected number of points read");
+  }
+
+  {
+    std::string path = write_strip(width, width / 2);
+    smtk::mesh::ResourcePtr mr = smtk::mesh::Resource::create();
+    bool result = xms.importMesh(path, mr, std::string());
+    cleanup(path);
+    test(!result, "malformed element cards should fail the read");
+  }
+
+  {
+    std::string path = write_strip(width, width, static_cast<long long>(width));
+    smtk::mesh::ResourcePtr mr = smtk::mesh::Resource::create();
+    bool result = xms.importMesh(path, mr, std::string());
+    cleanup(path);
+    test(result, "malformed element cards after END should be ignored");
+    test(mr->cells().size() == width, "cells after END should be ignored");
+  }
+}
+
 } // namespace
 
 int UnitTestExportMesh2DM(int /*unused*/, char** const /*unused*/)
@@ -115,6 +250,8 @@ int UnitTestExportMesh2DM(int /*unused*/, char** const /*unused*/)
   verify_write_empty_resource();
   verify_write_null_resource();
   verify_read_write_valid_resource();
+  verify_write_format();
+  verify_read_chunked();
 
   return 0;
 }
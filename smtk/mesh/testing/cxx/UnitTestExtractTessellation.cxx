@@ -463,6 +463,50 @@ void verify_extract_volume_meshes_by_global_points_to_vtk(const smtk::mesh::Reso
   smtk::mesh::for_each(cells, vc);
   test(vc.cells(mr) == cells);
 }
+void verify_parallel_matches_serial(const smtk::mesh::ResourcePtr& mr)
+{
+  smtk::mesh::CellSet cells = mr->cells();
+
+  std::int64_t connectivityLength = -1;
+  std::int64_t numberOfCells = -1;
+  std::int64_t numberOfPoints = -1;
+
+  smtk::mesh::utility::PreAllocatedTessellation::determineAllocationLengths(
+    cells, connectivityLength, numberOfCells, numberOfPoints);
+
+  for (bool useVTK : { true, false })
+  {
+    std::vector<std::int64_t> conn[2];
+    std::vector<std::int64_t> locations[2];
+    std::vector<unsigned char> types[2];
+    std::vector<float> fpoints[2];
+    for (int parallel = 0; parallel < 2; ++parallel)
+    {
+      conn[parallel].resize(connectivityLength + (useVTK ? numberOfCells : 0));
+      locations[parallel].resize(numberOfCells);
+      types[parallel].resize(numberOfCells);
+      fpoints[parallel].resize(numberOfPoints * 3);
+
+      smtk::mesh::utility::PreAllocatedTessellation tess(
+        conn[parallel].data(),
+        locations[parallel].data(),
+        types[parallel].data(),
+        fpoints[parallel].data());
+      tess.disableVTKStyleConnectivity(!useVTK);
+      tess.disableVTKCellTypes(!useVTK);
+      test(tess.useParallelExtraction(), "Parallel extraction should be enabled by default");
+      tess.disableParallelExtraction(parallel == 0);
+      test(tess.useParallelExtraction() == (parallel == 1));
+
+      smtk::mesh::utility::extractTessellation(cells, tess);
+    }
+
+    test(conn[0] == conn[1], "Parallel and serial connectivity differ");
+    test(locations[0] == locations[1], "Parallel and serial cell locations differ");
+    test(types[0] == types[1], "Parallel and serial cell types differ");
+    test(fpoints[0] == fpoints[1], "Parallel and serial points differ");
+  }
+}
 } // namespace
 
 int UnitTestExtractTessellation(int /*unused*/, char** const /*unused*/)
@@ -482,5 +526,7 @@ int UnitTestExtractTessellation(int /*unused*/, char** const /*unused*/)
 
   verify_extract_volume_meshes_by_global_points_to_vtk(mr);
 
+  verify_parallel_matches_serial(mr);
+
   return 0;
 }
@@ -10,11 +10,18 @@
 
 #include "smtk/common/UUID.h"
 
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/StringItem.h"
+
 #include "smtk/io/ModelToMesh.h"
 #include "smtk/io/WriteMesh.h"
 
 #include "smtk/io/ImportMesh.h"
+#include "smtk/mesh/core/Component.h"
 #include "smtk/mesh/core/Resource.h"
+#include "smtk/mesh/operators/MergeCoincidentPoints.h"
+#include "smtk/mesh/utility/MergeCoincidentPoints.h"
 
 #include "smtk/model/EntityIterator.h"
 #include "smtk/model/Resource.h"
@@ -124,6 +131,40 @@ void verify_simple_merge()
   test(vert_cells.size() == 7);
 }
 
+void verify_spatial_hash_merge()
+{
+  smtk::model::ResourcePtr modelResource = smtk::model::Resource::create();
+
+  create_simple_mesh_model(modelResource);
+
+  smtk::io::ModelToMesh convert;
+  convert.setIsMerging(false);
+  smtk::mesh::ResourcePtr mr = convert(modelResource);
+  test(mr->isValid(), "resouce should be valid");
+
+  smtk::mesh::PointSet points = mr->points();
+  test(points.size() == 88, "Should be exactly 88 points in the original mesh");
+  std::size_t numberOfCells = mr->cells(smtk::mesh::Dims2).size();
+
+  //merging with the backend independent spatial hash should find the same
+  //points as the backend's merge
+  test(
+    smtk::mesh::utility::mergeCoincidentPoints(mr->meshes()),
+    "Merging with a spatial hash should succeed");
+
+  points = mr->points();
+  test(points.size() == 32, "After merging of identical points we should have 32");
+
+  //the merge rewrites connectivity without adding or removing cells
+  test(mr->cells(smtk::mesh::Dims2).size() == numberOfCells, "Merging should not remove faces");
+  smtk::mesh::CellSet vert_cells = mr->cells(smtk::mesh::Dims0);
+  test(vert_cells.size() == 7);
+
+  //merging again should change nothing
+  test(smtk::mesh::utility::mergeCoincidentPoints(mr->meshes()));
+  test(mr->points().size() == 32, "Merging twice should not change the points");
+}
+
 void verify_complex_merge()
 {
   smtk::model::ResourcePtr modelResource = smtk::model::Resource::create();
@@ -175,6 +216,41 @@ void verify_complex_merge()
   test(p[2] == 0.0);
 }
 
+void verify_operation_merge()
+{
+  smtk::model::ResourcePtr modelResource = smtk::model::Resource::create();
+
+  create_simple_mesh_model(modelResource);
+
+  smtk::io::ModelToMesh convert;
+  convert.setIsMerging(false);
+  smtk::mesh::ResourcePtr mr = convert(modelResource);
+  test(mr->isValid(), "resource should be valid");
+
+  //add mesh points that duplicate existing vertex cells
+  make_MeshPoint(mr, 0.0, 2.0, 0.0);
+  make_MeshPoint(mr, 1.0, 0.0, 0.0);
+  make_MeshPoint(mr, 3.0, 0.0, 0.0);
+  make_MeshPoint(mr, 0.0, 2.0, 0.0);
+  test(mr->cells(smtk::mesh::Dims0).size() == 11, "Should have 11 vertex cells before merge");
+
+  //the operation's default algorithm should also merge cells that become
+  //duplicates
+  smtk::operation::Operation::Ptr mergeOp = smtk::mesh::MergeCoincidentPoints::create();
+  test(
+    mergeOp->parameters()->findString("algorithm")->value() == "backend",
+    "The backend should merge coincident points by default");
+  mergeOp->parameters()->associate(smtk::mesh::Component::create(mr->meshes()));
+  smtk::operation::Operation::Result result = mergeOp->operate();
+  test(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Merge coincident points operation failed");
+
+  test(mr->points().size() == 32, "After merging of identical points we should have 32");
+  test(mr->cells(smtk::mesh::Dims0).size() == 9, "Should have 9 vertex cells after merge");
+}
+
 void verify_write_valid_meshResource_hdf5_after_merge()
 {
   smtk::model::ResourcePtr modelResource = smtk::model::Resource::create();
@@ -256,7 +332,9 @@ void verify_write_valid_meshResource_hdf5_after_merge()
 int UnitTestMergeContactPoints(int /*unused*/, char** const /*unused*/)
 {
   verify_simple_merge();
+  verify_spatial_hash_merge();
   verify_complex_merge();
+  verify_operation_merge();
   verify_write_valid_meshResource_hdf5_after_merge();
   return 0;
 }
@@ -0,0 +1,312 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/interpolation/PointCloud.h"
+#include "smtk/mesh/interpolation/PointCloudFromCSV.h"
+#include "smtk/mesh/interpolation/PointCloudIndex.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string write_root = SMTK_SCRATCH_DIR;
+
+// A deterministic sequence of values in [0, 1)
+class Random
+{
+public:
+  double operator()()
+  {
+    m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<double>(m_state >> 11) / static_cast<double>(1ULL << 53);
+  }
+
+private:
+  unsigned long long m_state{ 1 };
+};
+
+// Enough points to be indexed by several tasks. Some values are negative so
+// that they can be rejected by a prefilter.
+const std::size_t nPoints = 100000;
+
+void makePoints(std::vector<double>& coordinates, std::vector<double>& values)
+{
+  Random random;
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    const double x = 10. * random();
+    const double y = 5. * random();
+    coordinates.push_back(x);
+    coordinates.push_back(y);
+    coordinates.push_back(0.);
+    values.push_back(std::sin(x) + std::cos(y) + .1 * (random() - .5));
+  }
+}
+
+bool isValid(double value)
+{
+  return value > -1.5;
+}
+
+double bruteForceRadialAverage(
+  const std::vector<double>& coordinates,
+  const std::vector<double>& values,
+  const std::array<double, 3>& x,
+  double radius)
+{
+  double sum = 0.;
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    const double dx = coordinates[3 * i] - x[0];
+    const double dy = coordinates[3 * i + 1] - x[1];
+    if (isValid(values[i]) && dx * dx + dy * dy <= radius * radius)
+    {
+      sum += values[i];
+      ++count;
+    }
+  }
+  return count == 0 ? std::nan("") : sum / count;
+}
+
+double bruteForceInverseDistanceWeighting(
+  const std::vector<double>& coordinates,
+  const std::vector<double>& values,
+  const std::array<double, 3>& x,
+  double power)
+{
+  double num = 0., denom = 0.;
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    if (!isValid(values[i]))
+    {
+      continue;
+    }
+    const double dx = coordinates[3 * i] - x[0];
+    const double dy = coordinates[3 * i + 1] - x[1];
+    const double dz = coordinates[3 * i + 2] - x[2];
+    const double w = std::pow(std::sqrt(dx * dx + dy * dy + dz * dz), -power);
+    num += w * values[i];
+    denom += w;
+  }
+  return num / denom;
+}
+
+std::vector<std::array<double, 3>> queryPoints()
+{
+  // Points within, on the boundary of and outside of the data's extent
+  std::vector<std::array<double, 3>> queries;
+  Random random;
+  for (int i = 0; i < 20; ++i)
+  {
+    queries.push_back({ { 12. * random() - 1., 7. * random() - 1., random() } });
+  }
+  queries.push_back({ { 0., 0., 0. } });
+  queries.push_back({ { 10., 5., 0. } });
+  queries.push_back({ { 100., 100., 0. } });
+  return queries;
+}
+
+void verify_radial_average(
+  const std::vector<double>& coordinates,
+  const std::vector<double>& values)
+{
+  const double radius = .1;
+  for (double cellSize : { radius, 0., .013 })
+  {
+    smtk::mesh::PointCloudIndex index(isValid);
+    index.insert(nPoints, coordinates.data(), values.data());
+    index.build(cellSize);
+    test(index.isBuilt() && index.numberOfLevels() > 1, "Index was not built");
+
+    for (const auto& x : queryPoints())
+    {
+      const double expected = bruteForceRadialAverage(coordinates, values, x, radius);
+      const double actual = index.radialAverage(x, radius);
+      smtkTest(
+        (std::isnan(expected) && std::isnan(actual)) || std::abs(expected - actual) < 1.e-12,
+        "Radial average at (" << x[0] << ", " << x[1] << ") is " << actual << ", not "
+                              << expected);
+    }
+  }
+}
+
+void verify_inverse_distance_weighting(
+  const std::vector<double>& coordinates,
+  const std::vector<double>& values)
+{
+  // Insert the points in chunks, as they would be streamed from a file
+  smtk::mesh::PointCloudIndex index(isValid);
+  for (std::size_t first = 0; first < nPoints; first += 30000)
+  {
+    const std::size_t count = std::min<std::size_t>(30000, nPoints - first);
+    index.insert(count, coordinates.data() + 3 * first, values.data() + first);
+  }
+  index.build();
+
+  for (const auto& x : queryPoints())
+  {
+    const double expected = bruteForceInverseDistanceWeighting(coordinates, values, x, 2.);
+    const double exact = index.inverseDistanceWeighting(x, 2., 0.);
+    smtkTest(
+      std::abs(expected - exact) < 1.e-9 * std::abs(expected) + 1.e-12,
+      "Exact inverse distance weighting is " << exact << ", not " << expected);
+
+    // The values span about 4 units
+    const double approximate = index.inverseDistanceWeighting(x, 2., .5);
+    smtkTest(
+      std::abs(expected - approximate) < 2.e-2,
+      "Approximate inverse distance weighting is " << approximate << ", not " << expected);
+  }
+
+  // A query at a source point returns its value
+  const std::array<double, 3> source = { { coordinates[0], coordinates[1], coordinates[2] } };
+  test(
+    !isValid(values[0]) || index.inverseDistanceWeighting(source, 2., .5) == values[0],
+    "A query at a source point should return its value");
+}
+
+void verify_prefilter_and_point_cloud(
+  const std::vector<double>& coordinates,
+  const std::vector<double>& values)
+{
+  std::size_t nValid = 0;
+  for (double value : values)
+  {
+    nValid += isValid(value) ? 1 : 0;
+  }
+  test(nValid < nPoints, "The prefilter should reject some points");
+
+  smtk::mesh::PointCloudIndex index(isValid);
+  index.insert(smtk::mesh::PointCloud(nPoints, coordinates.data(), values.data()));
+  test(index.size() == nValid, "Wrong number of indexed points");
+
+  smtk::mesh::PointCloudIndex empty;
+  empty.build();
+  test(std::isnan(empty.radialAverage({ { 0., 0., 0. } }, 1.)), "An empty index has no values");
+}
+
+void verify_merging(const std::vector<double>& coordinates, const std::vector<double>& values)
+{
+  std::size_t nValid = 0;
+  double sum = 0.;
+  for (double value : values)
+  {
+    nValid += isValid(value) ? 1 : 0;
+    sum += isValid(value) ? value : 0.;
+  }
+
+  // Points are merged into squares of side .05, of which there are at most
+  // 200 x 100 over the data's extent
+  smtk::mesh::PointCloudIndex merged(isValid, .05);
+  merged.insert(nPoints, coordinates.data(), values.data());
+  merged.build();
+  test(merged.numberOfInsertedPoints() == nValid, "Wrong number of inserted points");
+  test(merged.size() <= 201 * 101 && merged.size() < nValid, "Points were not merged");
+
+  // Merged points are weighted by the number of points they represent
+  const double average = merged.radialAverage({ { 5., 2.5, 0. } }, 100.);
+  smtkTest(
+    std::abs(average - sum / nValid) < 1.e-9,
+    "Radial average of all points is " << average << ", not " << sum / nValid);
+  for (const auto& x : queryPoints())
+  {
+    const double expected = bruteForceInverseDistanceWeighting(coordinates, values, x, 2.);
+    const double actual = merged.inverseDistanceWeighting(x, 2., 0.);
+    smtkTest(
+      std::abs(expected - actual) < 5.e-2,
+      "Merged inverse distance weighting is " << actual << ", not " << expected);
+  }
+
+  // Points inserted after a build are merged into the same squares
+  smtk::mesh::PointCloudIndex rebuilt(isValid, .05);
+  rebuilt.insert(nPoints / 2, coordinates.data(), values.data());
+  rebuilt.build();
+  rebuilt.insert(
+    nPoints - nPoints / 2, coordinates.data() + 3 * (nPoints / 2), values.data() + nPoints / 2);
+  rebuilt.build();
+  test(rebuilt.size() == merged.size(), "Rebuilding changed the merged points");
+  for (const auto& x : queryPoints())
+  {
+    const double expected = merged.inverseDistanceWeighting(x, 2., 0.);
+    const double actual = rebuilt.inverseDistanceWeighting(x, 2., 0.);
+    smtkTest(
+      std::abs(expected - actual) < 1.e-9 * std::abs(expected),
+      "Rebuilt inverse distance weighting is " << actual << ", not " << expected);
+  }
+}
+
+void verify_csv_chunks()
+{
+  const std::string fileName = write_root + "/pointCloudIndex.csv";
+  {
+    std::ofstream file(fileName.c_str());
+    for (int i = 0; i < 10000; ++i)
+    {
+      if (i % 2 == 0)
+      {
+        file << i << "," << 2 * i << "," << 3 * i << "," << 4 * i << "\n";
+      }
+      else
+      {
+        file << i << ", " << 2 * i << ", " << 4 * i << "\n";
+      }
+    }
+  }
+
+  std::size_t nRead = 0;
+  std::size_t nChunks = 0;
+  smtk::mesh::PointCloudFromCSV::readChunks(
+    fileName,
+    [&](std::size_t n, const double* coordinates, const double* values) {
+      for (std::size_t i = 0; i < n; ++i, ++nRead)
+      {
+        const double expected[4] = { static_cast<double>(nRead),
+                                     2. * nRead,
+                                     nRead % 2 == 0 ? 3. * nRead : 0.,
+                                     4. * nRead };
+        test(
+          coordinates[3 * i] == expected[0] && coordinates[3 * i + 1] == expected[1] &&
+            coordinates[3 * i + 2] == expected[2] && values[i] == expected[3],
+          "Wrong point read from file");
+      }
+      ++nChunks;
+    },
+    3000);
+  test(nRead == 10000 && nChunks == 4, "Wrong number of points or chunks read from file");
+
+  smtk::mesh::PointCloud pointcloud = smtk::mesh::PointCloudFromCSV()(fileName);
+  test(pointcloud.size() == 10000, "Wrong number of points in point cloud");
+
+  std::remove(fileName.c_str());
+}
+} // namespace
+
+int UnitTestPointCloudIndex(int /*unused*/, char** const /*unused*/)
+{
+  std::vector<double> coordinates;
+  std::vector<double> values;
+  makePoints(coordinates, values);
+
+  verify_radial_average(coordinates, values);
+  verify_inverse_distance_weighting(coordinates, values);
+  verify_prefilter_and_point_cloud(coordinates, values);
+  verify_merging(coordinates, values);
+  verify_csv_chunks();
+
+  return 0;
+}
@@ -21,6 +21,7 @@
 #include <boost/filesystem.hpp>
 using namespace boost::filesystem;
 
+#include <algorithm>
 #include <cmath>
 
 namespace
@@ -354,6 +355,75 @@ void verify_pointfield_persistency()
     }
   }
 }
+
+void verify_pointfield_views()
+{
+  smtk::mesh::ResourcePtr mr = load_mesh();
+  smtk::mesh::MeshSet mesh = mr->meshes(smtk::mesh::Dims2);
+
+  const std::size_t numberOfPoints = mesh.points().size();
+  std::vector<double> fieldValues(numberOfPoints * 3);
+  for (std::size_t i = 0; i < fieldValues.size(); i++)
+  {
+    fieldValues[i] = static_cast<double>(i);
+  }
+  smtk::mesh::PointField pointfield =
+    mesh.createPointField("view data", 3, smtk::mesh::FieldType::Double, fieldValues.data());
+
+  //a view with the wrong value type is invalid
+  test(!pointfield.view<int>().isValid(), "int view of a double field should be invalid");
+
+  {
+    auto view = pointfield.view<double>();
+    test(view.isValid(), "view should be valid");
+    test(view.size() == numberOfPoints && view.dimension() == 3, "view has the wrong shape");
+
+    //visit the values and compare them to the field's values
+    std::size_t visited = 0;
+    test(view.visit([&](const smtk::mesh::FieldSpan<const double>& span) {
+      for (std::size_t i = 0; i < span.size(); ++i)
+      {
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+          test(span[i][c] == fieldValues[3 * (span.first() + i) + c]);
+          test(span.component(c)[i] == span[i][c]);
+        }
+      }
+      visited += span.size();
+    }));
+    test(visited == numberOfPoints, "visit should cover every point");
+
+    //read a range of tuples that starts part way into the field
+    const std::size_t first = numberOfPoints / 3;
+    std::vector<double> values((numberOfPoints - first) * 3);
+    test(view.get(first, numberOfPoints - first, values.data()));
+    test(std::equal(values.begin(), values.end(), fieldValues.begin() + 3 * first));
+    test(!view.get(first, numberOfPoints, values.data()), "get past the end should fail");
+  }
+
+  {
+    //negate the first component in place, then overwrite the last tuple
+    auto view = pointfield.mutableView<double>();
+    test(view.visit([](const smtk::mesh::FieldSpan<double>& span) {
+      auto x = span.component(0);
+      for (std::size_t i = 0; i < x.size(); ++i)
+      {
+        x[i] = -x[i];
+      }
+    }));
+    const double last[3] = { 1., 2., 3. };
+    test(view.set(numberOfPoints - 1, 1, last));
+  }
+
+  for (std::size_t i = 0; i < numberOfPoints; i++)
+  {
+    fieldValues[3 * i] = -fieldValues[3 * i];
+  }
+  fieldValues[3 * numberOfPoints - 3] = 1.;
+  fieldValues[3 * numberOfPoints - 2] = 2.;
+  fieldValues[3 * numberOfPoints - 1] = 3.;
+  test(pointfield.get<double>() == fieldValues, "modifications through the view were lost");
+}
 } // namespace
 
 int UnitTestPointField(int /*unused*/, char** const /*unused*/)
@@ -362,6 +432,7 @@ int UnitTestPointField(int /*unused*/, char** const /*unused*/)
   verify_duplicate_pointfields();
   verify_incremental_data_assignment();
   verify_pointfield_persistency();
+  verify_pointfield_views();
 
   return 0;
 }
@@ -13,6 +13,8 @@
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/ReferenceItem.h"
 #include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/VoidItem.h"
 
 #include "smtk/common/Paths.h"
 
@@ -22,6 +24,15 @@
 
 #include "smtk/mesh/operators/ReadResource.h"
 #include "smtk/mesh/operators/WriteResource.h"
+#include "smtk/mesh/resource/Registrar.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Registrar.h"
+#include "smtk/operation/operators/ReadResource.h"
+
+#include "smtk/plugin/Registry.h"
+
+#include "smtk/resource/Manager.h"
 
 #include "smtk/mesh/testing/cxx/helpers.h"
 
@@ -108,5 +119,56 @@ int UnitTestReadWriteMeshResource(int /*unused*/, char** const /*unused*/)
   test(mr1->numberOfMeshes() == mr->numberOfMeshes());
   test(mr1->types() == mr->types());
 
+  // Binary metadata, whether written to a plain file or to an archive, is
+  // detected by the generic "read resource" operation.
+  auto resourceManager = smtk::resource::Manager::create();
+  auto operationManager = smtk::operation::Manager::create();
+  auto operationRegistry =
+    smtk::plugin::addToManagers<smtk::operation::Registrar>(operationManager);
+  auto meshRegistry =
+    smtk::plugin::addToManagers<smtk::mesh::Registrar>(resourceManager, operationManager);
+  operationManager->registerResourceManager(resourceManager);
+  for (bool archived : { false, true })
+  {
+    std::string binary_path(write_root);
+    binary_path += "/" + smtk::common::UUID::random().toString() + ".smtk";
+    mr->setLocation(binary_path);
+
+    writeOp = smtk::mesh::WriteResource::create();
+    test(
+      writeOp->parameters()->associate(mr),
+      "failed to associate mesh resource to write resource operation");
+    writeOp->parameters()->findString("format")->setValue("binary");
+    writeOp->parameters()->findVoid("archive")->setIsEnabled(archived);
+    result = writeOp->operate();
+    test(
+      result->findInt("outcome")->value() ==
+        static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+      "write resource operation failed to write binary metadata");
+
+    auto genericReadOp = operationManager->create<smtk::operation::ReadResource>();
+    test(genericReadOp != nullptr, "failed to create generic read resource operation");
+    genericReadOp->parameters()->findFile("filename")->setValue(binary_path);
+    result = genericReadOp->operate();
+
+    cleanup(binary_path);
+    cleanup(
+      smtk::common::Paths::directory(binary_path) + "/" +
+      smtk::common::Paths::stem(binary_path) + ".h5m");
+
+    test(
+      result->findInt("outcome")->value() ==
+        static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+      "generic read resource operation failed to read binary metadata");
+    smtk::mesh::ResourcePtr mr2 =
+      std::dynamic_pointer_cast<smtk::mesh::Resource>(result->findResource("resource")->value());
+    test(mr2 != nullptr, "generic read resource operation did not create a mesh resource");
+    test(mr2->isValid(), "resource should be valid");
+    test(mr2->id() == mr->id(), "binary metadata lost the resource's id");
+    test(mr2->numberOfMeshes() == mr->numberOfMeshes());
+    test(mr2->types() == mr->types());
+    resourceManager->remove(mr2);
+  }
+
   return 0;
 }
@@ -0,0 +1,131 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace smtk::mesh::utility;
+
+namespace
+{
+
+class Timer
+{
+public:
+  void mark() { m_start = std::chrono::steady_clock::now(); }
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+protected:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+// Split each cube of an n x n x n grid of points into 6 tetrahedra around
+// its main diagonal. The points are jittered so that the cells' quality
+// varies.
+CellQuality tetrahedralGrid(std::size_t n)
+{
+  std::vector<double> coordinates;
+  coordinates.reserve(3 * n * n * n);
+  std::srand(1);
+  for (std::size_t k = 0; k < n; ++k)
+  {
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const double jitter[3] = { .2 * std::rand() / RAND_MAX,
+                                   .2 * std::rand() / RAND_MAX,
+                                   .2 * std::rand() / RAND_MAX };
+        coordinates.push_back(static_cast<double>(i) + jitter[0]);
+        coordinates.push_back(static_cast<double>(j) + jitter[1]);
+        coordinates.push_back(static_cast<double>(k) + jitter[2]);
+      }
+    }
+  }
+
+  // The tetrahedra of a cube with corners numbered i + 2j + 4k
+  const std::size_t tets[6][4] = { { 0, 1, 3, 7 }, { 0, 3, 2, 7 }, { 0, 2, 6, 7 },
+                                   { 0, 6, 4, 7 }, { 0, 4, 5, 7 }, { 0, 5, 1, 7 } };
+
+  const std::size_t cubes = (n - 1) * (n - 1) * (n - 1);
+  std::vector<smtk::mesh::CellType> cellTypes(6 * cubes, smtk::mesh::Tetrahedron);
+  std::vector<std::size_t> offsets;
+  std::vector<std::size_t> connectivity;
+  offsets.reserve(6 * cubes + 1);
+  connectivity.reserve(24 * cubes);
+  offsets.push_back(0);
+  for (std::size_t k = 0; k + 1 < n; ++k)
+  {
+    for (std::size_t j = 0; j + 1 < n; ++j)
+    {
+      for (std::size_t i = 0; i + 1 < n; ++i)
+      {
+        std::size_t corners[8];
+        for (std::size_t c = 0; c < 8; ++c)
+        {
+          corners[c] = (i + (c & 1)) + n * ((j + ((c >> 1) & 1)) + n * (k + ((c >> 2) & 1)));
+        }
+        for (const auto& tet : tets)
+        {
+          for (std::size_t c : tet)
+          {
+            connectivity.push_back(corners[c]);
+          }
+          offsets.push_back(connectivity.size());
+        }
+      }
+    }
+  }
+
+  return CellQuality(
+    std::move(cellTypes), std::move(offsets), std::move(connectivity), std::move(coordinates));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  // 6 * 80^3, or about 3 million, tetrahedra by default
+  std::size_t n = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 81;
+  if (n < 2)
+  {
+    n = 2;
+  }
+
+  Timer timer;
+  timer.mark();
+  CellQuality quality = tetrahedralGrid(n);
+  std::cout << "Generated " << quality.numberOfCells() << " tetrahedra in " << timer.elapsed()
+            << " seconds\n";
+
+  for (int i = 0; i < static_cast<int>(CellQualityMetric::CellQualityMetric_MAX); ++i)
+  {
+    CellQualityMetric metric = static_cast<CellQualityMetric>(i);
+    timer.mark();
+    std::vector<double> values = quality.compute(metric);
+    const double computeTime = timer.elapsed();
+    timer.mark();
+    CellQualityStatistics statistics = CellQuality::summarize(values);
+    const double summarizeTime = timer.elapsed();
+
+    std::cout << "  " << cellQualityMetricName(metric) << ": " << computeTime << " seconds ("
+              << (values.size() / computeTime) << " cells/sec), summarized in " << summarizeTime
+              << " seconds; range [" << statistics.minimum << ", " << statistics.maximum
+              << "], mean " << statistics.mean << "\n";
+  }
+
+  return 0;
+}
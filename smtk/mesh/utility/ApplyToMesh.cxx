@@ -17,6 +17,8 @@
 #include "smtk/mesh/core/PointField.h"
 #include "smtk/mesh/core/PointSet.h"
 
+#include "smtk/common/Parallel.h"
+
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -64,6 +66,7 @@ class StoreAndWarpPoints : public smtk::mesh::PointForEach
 {
   const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
   std::vector<double> m_data;
+  std::size_t m_counter{ 0 };
 
 public:
   StoreAndWarpPoints(
@@ -79,6 +82,8 @@ public:
     std::vector<double>& xyz,
     bool& coordinatesModified) override
   {
+    // The points are visited in chunks; <m_counter> tracks the position of the
+    // chunk's first point within the stored coordinates.
     std::size_t offset = 0;
     std::array<double, 3> x, f_x;
     for (auto i = smtk::mesh::rangeElementsBegin(pointIds);
@@ -87,34 +92,104 @@ public:
     {
       std::copy(xyz.data() + offset, xyz.data() + offset + 3, x.data());
 
-      std::copy(std::begin(x), std::end(x), m_data.data() + offset);
+      std::copy(std::begin(x), std::end(x), m_data.data() + 3 * m_counter + offset);
 
       f_x = m_mapping(x);
       std::copy(std::begin(f_x), std::end(f_x), xyz.data() + offset);
     }
+    m_counter += pointIds.size();
     coordinatesModified = true; //mark we are going to modify the points
   }
 
   const std::vector<double>& data() const { return m_data; }
 };
 
-class UndoWarpPoints : public smtk::mesh::PointForEach
+// The number of points warped by a single task of ParallelWarpPoints
+const std::size_t s_pointsPerTask = 1 << 12;
+
+// Warp each chunk of points concurrently, optionally storing their
+// prior coordinates and reporting the number of points warped so far. Once
+// the progress function returns false, the remaining chunks are left as they
+// are (but their prior coordinates are still stored).
+class ParallelWarpPoints : public smtk::mesh::PointForEach
 {
+  const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
+  const std::function<bool(std::size_t)>& m_progress;
   std::vector<double> m_data;
+  std::size_t m_counter{ 0 };
+  bool m_stopped{ false };
 
 public:
-  UndoWarpPoints() = default;
+  ParallelWarpPoints(
+    const std::function<std::array<double, 3>(std::array<double, 3>)>& mapping,
+    const std::function<bool(std::size_t)>& progress,
+    std::size_t nPriorPoints)
+    : m_mapping(mapping)
+    , m_progress(progress)
+    , m_data(3 * nPriorPoints)
+  {
+  }
 
   void forPoints(
-    const smtk::mesh::HandleRange& /*pointIds*/,
+    const smtk::mesh::HandleRange& pointIds,
     std::vector<double>& xyz,
     bool& coordinatesModified) override
   {
-    xyz = m_data;
-    coordinatesModified = true;
+    const std::size_t nPoints = pointIds.size();
+    if (!m_data.empty())
+    {
+      std::copy(xyz.data(), xyz.data() + 3 * nPoints, m_data.data() + 3 * m_counter);
+    }
+    m_counter += nPoints;
+    if (m_stopped)
+    {
+      coordinatesModified = false;
+      return;
+    }
+
+    smtk::common::forEachChunk(
+      nPoints, s_pointsPerTask, [this, &xyz](std::size_t, std::size_t begin, std::size_t end) {
+        std::array<double, 3> x, f_x;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          std::copy(xyz.data() + 3 * i, xyz.data() + 3 * i + 3, x.data());
+          f_x = m_mapping(x);
+          std::copy(std::begin(f_x), std::end(f_x), xyz.data() + 3 * i);
+        }
+      });
+
+    coordinatesModified = true; //mark we are going to modify the points
+    if (m_progress && !m_progress(m_counter))
+    {
+      m_stopped = true;
+    }
   }
 
-  std::vector<double>& data() { return m_data; }
+  const std::vector<double>& data() const { return m_data; }
+};
+
+class UndoWarpPoints : public smtk::mesh::PointForEach
+{
+  const smtk::mesh::FieldView<const double, smtk::mesh::PointFieldTag>& m_prior;
+  std::size_t m_counter{ 0 };
+
+public:
+  UndoWarpPoints(const smtk::mesh::FieldView<const double, smtk::mesh::PointFieldTag>& prior)
+    : m_prior(prior)
+  {
+  }
+
+  void forPoints(
+    const smtk::mesh::HandleRange& pointIds,
+    std::vector<double>& xyz,
+    bool& coordinatesModified) override
+  {
+    // The points are visited in chunks, in the same order as the field's
+    // values, so each chunk reads only its own prior coordinates.
+    m_prior.get(m_counter, pointIds.size(), xyz.data());
+    m_counter += pointIds.size();
+    coordinatesModified = true;
+  }
 };
 } // namespace
 
@@ -138,6 +213,23 @@ bool applyWarp(
   }
 }
 
+bool applyWarpInParallel(
+  const std::function<std::array<double, 3>(std::array<double, 3>)>& f,
+  smtk::mesh::MeshSet& ms,
+  bool storePriorCoordinates,
+  const std::function<bool(std::size_t)>& progress)
+{
+  smtk::mesh::PointSet points = ms.points();
+  ParallelWarpPoints warp(f, progress, storePriorCoordinates ? points.size() : 0);
+  smtk::mesh::for_each(points, warp);
+  if (storePriorCoordinates)
+  {
+    return ms.createPointField("_prior", 3, smtk::mesh::FieldType::Double, warp.data().data())
+      .isValid();
+  }
+  return true;
+}
+
 bool undoWarp(smtk::mesh::MeshSet& ms)
 {
   smtk::mesh::PointField pointfield = ms.pointField("_prior");
@@ -146,10 +238,15 @@ bool undoWarp(smtk::mesh::MeshSet& ms)
     return false;
   }
 
-  UndoWarpPoints undoWarp;
-  undoWarp.data().resize(pointfield.size() * pointfield.dimension());
-  pointfield.get(undoWarp.data().data());
-  smtk::mesh::for_each(ms.points(), undoWarp);
+  {
+    const auto prior = pointfield.view<double>();
+    if (!prior.isValid() || prior.dimension() != 3)
+    {
+      return false;
+    }
+    UndoWarpPoints undoWarp(prior);
+    smtk::mesh::for_each(ms.points(), undoWarp);
+  }
   return ms.removePointField(pointfield);
 }
 
@@ -32,6 +32,19 @@ bool applyWarp(
   smtk::mesh::MeshSet& ms,
   bool storePriorCoordinates = false);
 
+// deform each point in a meshset according to an R^3->R^3 mapping that is safe
+// to call concurrently. Each chunk of points visited by smtk::mesh::for_each is
+// mapped on multiple threads, and <progress> (if set) is then called with the
+// number of points deformed so far. If <progress> returns false, the points
+// that remain are left undeformed (their prior coordinates are still stored,
+// so undoWarp restores the whole meshset).
+SMTKCORE_EXPORT
+bool applyWarpInParallel(
+  const std::function<std::array<double, 3>(std::array<double, 3>)>&,
+  smtk::mesh::MeshSet& ms,
+  bool storePriorCoordinates = false,
+  const std::function<bool(std::size_t)>& progress = nullptr);
+
 // if prior coordinates were stored during applyWarp, undoWarp resets the
 // coordinates to their original values.
 SMTKCORE_EXPORT
@@ -0,0 +1,726 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include "smtk/mesh/core/FieldTypes.h"
+#include "smtk/mesh/core/Handle.h"
+#include "smtk/mesh/core/PointConnectivity.h"
+#include "smtk/mesh/core/PointSet.h"
+
+#include "smtk/common/Parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace utility
+{
+
+namespace
+{
+
+// The number of cells (or values) handled by a single task.
+const std::size_t s_entriesPerTask = 1 << 14;
+
+const double s_pi = 3.14159265358979323846;
+const double s_nan = std::numeric_limits<double>::quiet_NaN();
+
+// Call functor(task, begin, end) for consecutive chunks of [0, size).
+template<typename Functor>
+std::size_t forEachChunk(std::size_t size, const Functor& functor)
+{
+  return smtk::common::forEachChunk(size, s_entriesPerTask, functor);
+}
+
+struct Vector
+{
+  double x;
+  double y;
+  double z;
+};
+
+Vector operator-(const Vector& a, const Vector& b)
+{
+  return Vector{ a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+Vector operator+(const Vector& a, const Vector& b)
+{
+  return Vector{ a.x + b.x, a.y + b.y, a.z + b.z };
+}
+
+Vector operator*(double s, const Vector& a)
+{
+  return Vector{ s * a.x, s * a.y, s * a.z };
+}
+
+double dot(const Vector& a, const Vector& b)
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+Vector cross(const Vector& a, const Vector& b)
+{
+  return Vector{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+double norm(const Vector& a)
+{
+  return std::sqrt(dot(a, a));
+}
+
+double determinant(const Vector& a, const Vector& b, const Vector& c)
+{
+  return dot(a, cross(b, c));
+}
+
+// The faces (ordered so that their normals point outward) and the corners (a
+// point followed by its neighbours, ordered so that the corner's Jacobian is
+// positive) of a cell type. 2-dimensional cells are their own single face.
+struct Shape
+{
+  int dimension;
+  int numberOfPoints;
+  int numberOfFaces;
+  int faceSizes[6];
+  int faces[6][4];
+  int numberOfCorners;
+  int corners[8][4];
+  // Scales a corner's Jacobian so that the ideal cell's scaled Jacobian is 1
+  double jacobianScale;
+};
+
+const double s_sqrt2 = 1.41421356237309504880;
+const double s_2OverSqrt3 = 1.15470053837925152902;
+
+const Shape s_triangle = { 2, 3, 1, { 3 }, { { 0, 1, 2 } }, 3,
+                           { { 0, 1, 2 }, { 1, 2, 0 }, { 2, 0, 1 } }, s_2OverSqrt3 };
+const Shape s_quad = { 2, 4, 1, { 4 }, { { 0, 1, 2, 3 } }, 4,
+                       { { 0, 1, 3 }, { 1, 2, 0 }, { 2, 3, 1 }, { 3, 0, 2 } }, 1. };
+const Shape s_tetrahedron = { 3, 4, 4, { 3, 3, 3, 3 },
+                              { { 0, 1, 3 }, { 1, 2, 3 }, { 2, 0, 3 }, { 0, 2, 1 } }, 4,
+                              { { 0, 1, 2, 3 }, { 1, 2, 0, 3 }, { 2, 0, 1, 3 }, { 3, 0, 2, 1 } },
+                              s_sqrt2 };
+const Shape s_pyramid = { 3, 5, 5, { 3, 3, 3, 3, 4 },
+                          { { 0, 1, 4 }, { 1, 2, 4 }, { 2, 3, 4 }, { 3, 0, 4 }, { 0, 3, 2, 1 } }, 4,
+                          { { 0, 1, 3, 4 }, { 1, 2, 0, 4 }, { 2, 3, 1, 4 }, { 3, 0, 2, 4 } },
+                          s_sqrt2 };
+const Shape s_wedge = { 3, 6, 5, { 4, 4, 4, 3, 3 },
+                        { { 0, 1, 4, 3 },
+                          { 1, 2, 5, 4 },
+                          { 2, 0, 3, 5 },
+                          { 0, 2, 1 },
+                          { 3, 4, 5 } },
+                        6,
+                        { { 0, 1, 2, 3 },
+                          { 1, 2, 0, 4 },
+                          { 2, 0, 1, 5 },
+                          { 3, 5, 4, 0 },
+                          { 4, 3, 5, 1 },
+                          { 5, 4, 3, 2 } },
+                        s_2OverSqrt3 };
+const Shape s_hexahedron = { 3, 8, 6, { 4, 4, 4, 4, 4, 4 },
+                             { { 0, 1, 5, 4 },
+                               { 1, 2, 6, 5 },
+                               { 2, 3, 7, 6 },
+                               { 3, 0, 4, 7 },
+                               { 0, 3, 2, 1 },
+                               { 4, 5, 6, 7 } },
+                             8,
+                             { { 0, 1, 3, 4 },
+                               { 1, 2, 0, 5 },
+                               { 2, 3, 1, 6 },
+                               { 3, 0, 2, 7 },
+                               { 4, 7, 5, 0 },
+                               { 5, 4, 6, 1 },
+                               { 6, 5, 7, 2 },
+                               { 7, 6, 4, 3 } },
+                             1. };
+
+const Shape* shape(smtk::mesh::CellType cellType)
+{
+  switch (cellType)
+  {
+    case smtk::mesh::Triangle:
+      return &s_triangle;
+    case smtk::mesh::Quad:
+      return &s_quad;
+    case smtk::mesh::Tetrahedron:
+      return &s_tetrahedron;
+    case smtk::mesh::Pyramid:
+      return &s_pyramid;
+    case smtk::mesh::Wedge:
+      return &s_wedge;
+    case smtk::mesh::Hexahedron:
+      return &s_hexahedron;
+    default:
+      return nullptr;
+  }
+}
+
+// The points of a single cell, with the indices of its faces and corners.
+// Polygons describe their single face and corners here rather than in a
+// static Shape.
+class Cell
+{
+public:
+  Cell(const Shape* shape, std::vector<Vector>& points)
+    : m_shape(shape)
+    , m_points(points)
+  {
+    const int n = static_cast<int>(m_points.size());
+    if (!m_shape)
+    {
+      m_polygon.resize(n);
+      for (int i = 0; i < n; ++i)
+      {
+        m_polygon[i] = i;
+      }
+    }
+  }
+
+  int dimension() const { return m_shape ? m_shape->dimension : 2; }
+  int numberOfFaces() const { return m_shape ? m_shape->numberOfFaces : 1; }
+  int faceSize(int f) const
+  {
+    return m_shape ? m_shape->faceSizes[f] : static_cast<int>(m_points.size());
+  }
+  const Vector& facePoint(int f, int i) const
+  {
+    return m_points[m_shape ? m_shape->faces[f][i] : m_polygon[i]];
+  }
+
+  int numberOfCorners() const
+  {
+    return m_shape ? m_shape->numberOfCorners : static_cast<int>(m_points.size());
+  }
+  // Return the k-th point of corner c (k = 0 is the corner's point)
+  const Vector& cornerPoint(int c, int k) const
+  {
+    if (m_shape)
+    {
+      return m_points[m_shape->corners[c][k]];
+    }
+    const int n = static_cast<int>(m_points.size());
+    return m_points[k == 0 ? c : (k == 1 ? (c + 1) % n : (c + n - 1) % n)];
+  }
+
+  double jacobianScale() const
+  {
+    if (m_shape)
+    {
+      return m_shape->jacobianScale;
+    }
+    // The sine of the interior angle of the regular polygon
+    const double n = static_cast<double>(m_points.size());
+    return 1. / std::sin((n - 2.) * s_pi / n);
+  }
+
+  const std::vector<Vector>& points() const { return m_points; }
+
+private:
+  const Shape* m_shape;
+  std::vector<Vector>& m_points;
+  std::vector<int> m_polygon;
+};
+
+// The (unnormalized) normal of a face, using Newell's method; its length is
+// twice the face's area.
+Vector faceNormal(const Cell& cell, int f)
+{
+  Vector normal{ 0., 0., 0. };
+  const int n = cell.faceSize(f);
+  for (int i = 0; i < n; ++i)
+  {
+    normal = normal + cross(cell.facePoint(f, i), cell.facePoint(f, (i + 1) % n));
+  }
+  return normal;
+}
+
+double size(const Cell& cell)
+{
+  const std::vector<Vector>& points = cell.points();
+  if (cell.dimension() == 2)
+  {
+    return 0.5 * norm(faceNormal(cell, 0));
+  }
+
+  // Sum the signed volumes of the tetrahedra formed by the centroid and a fan
+  // triangulation of each face.
+  Vector centroid{ 0., 0., 0. };
+  for (const Vector& point : points)
+  {
+    centroid = centroid + point;
+  }
+  centroid = (1. / static_cast<double>(points.size())) * centroid;
+  double volume = 0.;
+  for (int f = 0; f < cell.numberOfFaces(); ++f)
+  {
+    const Vector a = cell.facePoint(f, 0) - centroid;
+    for (int i = 1; i + 1 < cell.faceSize(f); ++i)
+    {
+      volume +=
+        determinant(a, cell.facePoint(f, i) - centroid, cell.facePoint(f, i + 1) - centroid);
+    }
+  }
+  return volume / 6.;
+}
+
+double aspectRatio(const Cell& cell, smtk::mesh::CellType cellType)
+{
+  const std::vector<Vector>& p = cell.points();
+  if (cellType == smtk::mesh::Triangle)
+  {
+    // R / (2 r) = abc / (8 (s - a)(s - b)(s - c))
+    const double a = norm(p[1] - p[0]);
+    const double b = norm(p[2] - p[1]);
+    const double c = norm(p[0] - p[2]);
+    const double s = 0.5 * (a + b + c);
+    const double denominator = 8. * (s - a) * (s - b) * (s - c);
+    return denominator > 0. ? a * b * c / denominator : std::numeric_limits<double>::infinity();
+  }
+  if (cellType == smtk::mesh::Tetrahedron)
+  {
+    // R / (3 r), where R = |N| / (12 V) and r = 3 V / A
+    const Vector a = p[1] - p[0];
+    const Vector b = p[2] - p[0];
+    const Vector c = p[3] - p[0];
+    const double sixVolume = determinant(a, b, c);
+    const Vector n =
+      dot(a, a) * cross(b, c) + dot(b, b) * cross(c, a) + dot(c, c) * cross(a, b);
+    double area = 0.;
+    for (int f = 0; f < cell.numberOfFaces(); ++f)
+    {
+      area += 0.5 * norm(faceNormal(cell, f));
+    }
+    return sixVolume != 0. ? norm(n) * area / (3. * sixVolume * sixVolume)
+                           : std::numeric_limits<double>::infinity();
+  }
+
+  // The ratio of the longest to the shortest edge
+  double shortest = std::numeric_limits<double>::max();
+  double longest = 0.;
+  for (int f = 0; f < cell.numberOfFaces(); ++f)
+  {
+    const int n = cell.faceSize(f);
+    for (int i = 0; i < n; ++i)
+    {
+      const double length = norm(cell.facePoint(f, (i + 1) % n) - cell.facePoint(f, i));
+      shortest = std::min(shortest, length);
+      longest = std::max(longest, length);
+    }
+  }
+  return shortest > 0. ? longest / shortest : std::numeric_limits<double>::infinity();
+}
+
+double scaledJacobian(const Cell& cell)
+{
+  double minimum = std::numeric_limits<double>::max();
+  if (cell.dimension() == 2)
+  {
+    // Corner Jacobians are measured relative to the face's normal
+    const Vector normal = faceNormal(cell, 0);
+    const double normalLength = norm(normal);
+    if (normalLength == 0.)
+    {
+      return 0.;
+    }
+    const Vector unitNormal = (1. / normalLength) * normal;
+    for (int c = 0; c < cell.numberOfCorners(); ++c)
+    {
+      const Vector e1 = cell.cornerPoint(c, 1) - cell.cornerPoint(c, 0);
+      const Vector e2 = cell.cornerPoint(c, 2) - cell.cornerPoint(c, 0);
+      const double lengths = norm(e1) * norm(e2);
+      minimum = std::min(minimum, lengths > 0. ? dot(cross(e1, e2), unitNormal) / lengths : 0.);
+    }
+  }
+  else
+  {
+    for (int c = 0; c < cell.numberOfCorners(); ++c)
+    {
+      const Vector e1 = cell.cornerPoint(c, 1) - cell.cornerPoint(c, 0);
+      const Vector e2 = cell.cornerPoint(c, 2) - cell.cornerPoint(c, 0);
+      const Vector e3 = cell.cornerPoint(c, 3) - cell.cornerPoint(c, 0);
+      const double lengths = norm(e1) * norm(e2) * norm(e3);
+      minimum = std::min(minimum, lengths > 0. ? determinant(e1, e2, e3) / lengths : 0.);
+    }
+  }
+  return std::max(-1., std::min(1., minimum * cell.jacobianScale()));
+}
+
+// Compute the smallest and largest corner angles (in degrees) of the cell's
+// faces, and the cell's equiangle skew.
+void angles(const Cell& cell, double& minimumAngle, double& maximumAngle, double& skew)
+{
+  minimumAngle = 180.;
+  maximumAngle = 0.;
+  skew = 0.;
+  for (int f = 0; f < cell.numberOfFaces(); ++f)
+  {
+    const int n = cell.faceSize(f);
+    double faceMinimum = 180.;
+    double faceMaximum = 0.;
+    for (int i = 0; i < n; ++i)
+    {
+      const Vector& corner = cell.facePoint(f, i);
+      const Vector e1 = cell.facePoint(f, (i + 1) % n) - corner;
+      const Vector e2 = cell.facePoint(f, (i + n - 1) % n) - corner;
+      const double lengths = norm(e1) * norm(e2);
+      const double cosine = lengths > 0. ? std::max(-1., std::min(1., dot(e1, e2) / lengths)) : 1.;
+      const double angle = std::acos(cosine) * 180. / s_pi;
+      faceMinimum = std::min(faceMinimum, angle);
+      faceMaximum = std::max(faceMaximum, angle);
+    }
+    const double ideal = 180. * (n - 2) / n;
+    skew = std::max(
+      skew, std::max((faceMaximum - ideal) / (180. - ideal), (ideal - faceMinimum) / ideal));
+    minimumAngle = std::min(minimumAngle, faceMinimum);
+    maximumAngle = std::max(maximumAngle, faceMaximum);
+  }
+}
+
+double metricValue(CellQualityMetric metric, smtk::mesh::CellType cellType, const Cell& cell)
+{
+  switch (metric)
+  {
+    case CellQualityMetric::AspectRatio:
+      return aspectRatio(cell, cellType);
+    case CellQualityMetric::ScaledJacobian:
+      return scaledJacobian(cell);
+    case CellQualityMetric::Size:
+      return size(cell);
+    case CellQualityMetric::Skew:
+    case CellQualityMetric::MinimumAngle:
+    case CellQualityMetric::MaximumAngle:
+    {
+      double minimumAngle, maximumAngle, skew;
+      angles(cell, minimumAngle, maximumAngle, skew);
+      return metric == CellQualityMetric::Skew
+        ? skew
+        : (metric == CellQualityMetric::MinimumAngle ? minimumAngle : maximumAngle);
+    }
+    default:
+      return s_nan;
+  }
+}
+
+// Compute a metric for the run of cells [begin, end), all of type <cellType>
+void computeRun(
+  CellQualityMetric metric,
+  smtk::mesh::CellType cellType,
+  std::size_t begin,
+  std::size_t end,
+  const std::vector<std::size_t>& offsets,
+  const std::vector<std::size_t>& connectivity,
+  const std::vector<double>& coordinates,
+  double* values)
+{
+  const Shape* cellShape = shape(cellType);
+  std::vector<Vector> points;
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    const std::size_t numberOfPoints = offsets[i + 1] - offsets[i];
+    points.resize(numberOfPoints);
+    for (std::size_t j = 0; j < numberOfPoints; ++j)
+    {
+      const double* xyz = &coordinates[3 * connectivity[offsets[i] + j]];
+      points[j] = Vector{ xyz[0], xyz[1], xyz[2] };
+    }
+
+    if (cellType == smtk::mesh::Vertex)
+    {
+      values[i] = metric == CellQualityMetric::Size ? 0. : s_nan;
+    }
+    else if (cellType == smtk::mesh::Line)
+    {
+      values[i] = metric == CellQualityMetric::Size
+        ? norm(points[numberOfPoints - 1] - points[0])
+        : ((metric == CellQualityMetric::AspectRatio ||
+            metric == CellQualityMetric::ScaledJacobian)
+             ? 1.
+             : s_nan);
+    }
+    else if (
+      (cellShape && static_cast<int>(numberOfPoints) < cellShape->numberOfPoints) ||
+      (!cellShape && (cellType != smtk::mesh::Polygon || numberOfPoints < 3)))
+    {
+      values[i] = s_nan;
+    }
+    else
+    {
+      // Higher-order points follow the corner points, and are ignored.
+      if (cellShape)
+      {
+        points.resize(static_cast<std::size_t>(cellShape->numberOfPoints));
+      }
+      values[i] = metricValue(metric, cellType, Cell(cellShape, points));
+    }
+  }
+}
+
+// Partial statistics of a chunk of values, combined using the pairwise update
+// of Chan et al. for the mean and the sum of squared deviations.
+struct Accumulator
+{
+  std::size_t count{ 0 };
+  std::size_t undefined{ 0 };
+  double minimum{ std::numeric_limits<double>::max() };
+  double maximum{ std::numeric_limits<double>::lowest() };
+  double mean{ 0. };
+  double m2{ 0. };
+
+  void add(double value)
+  {
+    if (!std::isfinite(value))
+    {
+      ++undefined;
+      return;
+    }
+    ++count;
+    minimum = std::min(minimum, value);
+    maximum = std::max(maximum, value);
+    const double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+  }
+
+  void combine(const Accumulator& other)
+  {
+    undefined += other.undefined;
+    if (other.count == 0)
+    {
+      return;
+    }
+    const double n = static_cast<double>(count + other.count);
+    const double delta = other.mean - mean;
+    mean += delta * static_cast<double>(other.count) / n;
+    m2 += other.m2 +
+      delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / n;
+    count += other.count;
+    minimum = std::min(minimum, other.minimum);
+    maximum = std::max(maximum, other.maximum);
+  }
+};
+} // namespace
+
+std::string cellQualityMetricName(CellQualityMetric metric)
+{
+  switch (metric)
+  {
+    case CellQualityMetric::AspectRatio:
+      return "aspect ratio";
+    case CellQualityMetric::ScaledJacobian:
+      return "scaled jacobian";
+    case CellQualityMetric::Skew:
+      return "skew";
+    case CellQualityMetric::MinimumAngle:
+      return "minimum angle";
+    case CellQualityMetric::MaximumAngle:
+      return "maximum angle";
+    case CellQualityMetric::Size:
+      return "size";
+    default:
+      return std::string();
+  }
+}
+
+CellQualityMetric cellQualityMetricFromName(const std::string& name)
+{
+  for (int i = 0; i < static_cast<int>(CellQualityMetric::CellQualityMetric_MAX); ++i)
+  {
+    if (cellQualityMetricName(static_cast<CellQualityMetric>(i)) == name)
+    {
+      return static_cast<CellQualityMetric>(i);
+    }
+  }
+  return CellQualityMetric::CellQualityMetric_MAX;
+}
+
+CellQuality::CellQuality(const smtk::mesh::CellSet& cells)
+{
+  smtk::mesh::PointSet points = cells.points();
+  m_coordinates.resize(3 * points.size());
+  if (points.is_empty() || !points.get(m_coordinates.data()))
+  {
+    m_coordinates.clear();
+    return;
+  }
+  const std::vector<smtk::mesh::Handle> pointHandles(
+    smtk::mesh::rangeElementsBegin(points.range()), smtk::mesh::rangeElementsEnd(points.range()));
+
+  std::vector<smtk::mesh::Handle> connectivity;
+  m_cellTypes.reserve(cells.size());
+  m_offsets.reserve(cells.size() + 1);
+  m_offsets.push_back(0);
+  {
+    smtk::mesh::PointConnectivity pointConnectivity = cells.pointConnectivity();
+    connectivity.reserve(pointConnectivity.size());
+    smtk::mesh::CellType cellType;
+    int numPts;
+    const smtk::mesh::Handle* pts;
+    for (pointConnectivity.initCellTraversal();
+         pointConnectivity.fetchNextCell(cellType, numPts, pts);)
+    {
+      m_cellTypes.push_back(cellType);
+      connectivity.insert(connectivity.end(), pts, pts + numPts);
+      m_offsets.push_back(connectivity.size());
+    }
+  }
+
+  // Convert the point handles to indices into the coordinates concurrently.
+  m_connectivity.resize(connectivity.size());
+  forEachChunk(connectivity.size(), [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      m_connectivity[i] = static_cast<std::size_t>(
+        std::lower_bound(pointHandles.begin(), pointHandles.end(), connectivity[i]) -
+        pointHandles.begin());
+    }
+  });
+}
+
+CellQuality::CellQuality(
+  std::vector<smtk::mesh::CellType> cellTypes,
+  std::vector<std::size_t> offsets,
+  std::vector<std::size_t> connectivity,
+  std::vector<double> coordinates)
+  : m_cellTypes(std::move(cellTypes))
+  , m_offsets(std::move(offsets))
+  , m_connectivity(std::move(connectivity))
+  , m_coordinates(std::move(coordinates))
+{
+}
+
+std::vector<double> CellQuality::compute(CellQualityMetric metric) const
+{
+  std::vector<double> values(this->numberOfCells(), s_nan);
+  if (m_offsets.size() != this->numberOfCells() + 1)
+  {
+    return values;
+  }
+
+  forEachChunk(this->numberOfCells(), [&](std::size_t, std::size_t begin, std::size_t end) {
+    // Each chunk is processed in runs of cells of the same type.
+    std::size_t runBegin = begin;
+    while (runBegin < end)
+    {
+      const smtk::mesh::CellType cellType = m_cellTypes[runBegin];
+      std::size_t runEnd = runBegin + 1;
+      while (runEnd < end && m_cellTypes[runEnd] == cellType)
+      {
+        ++runEnd;
+      }
+      computeRun(
+        metric,
+        cellType,
+        runBegin,
+        runEnd,
+        m_offsets,
+        m_connectivity,
+        m_coordinates,
+        values.data());
+      runBegin = runEnd;
+    }
+  });
+  return values;
+}
+
+CellQualityStatistics CellQuality::summarize(
+  const std::vector<double>& values,
+  std::size_t numberOfBins)
+{
+  std::vector<Accumulator> accumulators(
+    smtk::common::numberOfChunks(values.size(), s_entriesPerTask));
+  forEachChunk(values.size(), [&](std::size_t task, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      accumulators[task].add(values[i]);
+    }
+  });
+  Accumulator total;
+  for (const Accumulator& accumulator : accumulators)
+  {
+    total.combine(accumulator);
+  }
+
+  CellQualityStatistics statistics;
+  statistics.numberOfCells = values.size();
+  statistics.numberOfUndefinedCells = total.undefined;
+  statistics.histogram.assign(numberOfBins, 0);
+  if (total.count == 0)
+  {
+    return statistics;
+  }
+  statistics.minimum = total.minimum;
+  statistics.maximum = total.maximum;
+  statistics.mean = total.mean;
+  statistics.standardDeviation = std::sqrt(total.m2 / static_cast<double>(total.count));
+  if (numberOfBins == 0)
+  {
+    return statistics;
+  }
+
+  // Bin the values in a second pass, with a histogram per task.
+  const double width = (total.maximum - total.minimum) / static_cast<double>(numberOfBins);
+  std::vector<std::vector<std::size_t>> histograms(
+    accumulators.size(), std::vector<std::size_t>(numberOfBins, 0));
+  forEachChunk(values.size(), [&](std::size_t task, std::size_t begin, std::size_t end) {
+    std::vector<std::size_t>& histogram = histograms[task];
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      if (std::isfinite(values[i]))
+      {
+        const std::size_t bin =
+          width > 0. ? static_cast<std::size_t>((values[i] - total.minimum) / width) : 0;
+        ++histogram[std::min(bin, numberOfBins - 1)];
+      }
+    }
+  });
+  for (const auto& histogram : histograms)
+  {
+    for (std::size_t bin = 0; bin < numberOfBins; ++bin)
+    {
+      statistics.histogram[bin] += histogram[bin];
+    }
+  }
+  return statistics;
+}
+
+smtk::mesh::CellField createCellQualityField(
+  const smtk::mesh::MeshSet& ms,
+  CellQualityMetric metric,
+  const std::string& name)
+{
+  const std::string fieldName = name.empty() ? cellQualityMetricName(metric) : name;
+  if (fieldName.empty() || ms.is_empty())
+  {
+    return smtk::mesh::CellField();
+  }
+
+  CellQuality quality(ms.cells());
+  std::vector<double> values = quality.compute(metric);
+  if (values.size() != ms.cells().size())
+  {
+    return smtk::mesh::CellField();
+  }
+
+  smtk::mesh::MeshSet meshset = ms;
+  return meshset.createCellField(fieldName, 1, smtk::mesh::FieldType::Double, values.data());
+}
+} // namespace utility
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,123 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_utility_CellQuality_h
+#define smtk_mesh_utility_CellQuality_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/CellTypes.h"
+#include "smtk/mesh/core/MeshSet.h"
+
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace utility
+{
+
+// Element-quality metrics. Each metric is computed per cell; cells for which a
+// metric is not defined (e.g. angles of a vertex or line) are assigned NaN.
+enum class CellQualityMetric
+{
+  // Triangles and tetrahedra: circumradius over (dimension times) inradius.
+  // Other cells: longest over shortest edge. 1 is ideal.
+  AspectRatio = 0,
+  // Minimum over the corners of the corner Jacobian determinant divided by
+  // the lengths of the corner's edges, normalized so that 1 is ideal. Negative
+  // values indicate inverted cells.
+  ScaledJacobian,
+  // Equiangle skew: the largest deviation of a face's angles from those of
+  // the equiangular face, from 0 (ideal) to 1 (degenerate).
+  Skew,
+  // The smallest and largest angles (in degrees) between edges meeting at a
+  // corner of the cell (or of one of its faces, for 3-dimensional cells).
+  MinimumAngle,
+  MaximumAngle,
+  // Length, area or signed volume, according to the cell's dimension.
+  Size,
+  CellQualityMetric_MAX
+};
+
+// Return a name for a metric (e.g. "aspect ratio"), or an empty string.
+SMTKCORE_EXPORT std::string cellQualityMetricName(CellQualityMetric metric);
+
+// Return the metric with the given name, or CellQualityMetric_MAX.
+SMTKCORE_EXPORT CellQualityMetric cellQualityMetricFromName(const std::string& name);
+
+// Summary statistics of the values of a metric. Non-finite values (undefined
+// metrics, or the infinite aspect ratio of a degenerate cell) are counted but
+// otherwise ignored; the histogram's bins evenly divide [minimum, maximum].
+struct SMTKCORE_EXPORT CellQualityStatistics
+{
+  std::size_t numberOfCells{ 0 };
+  std::size_t numberOfUndefinedCells{ 0 };
+  double minimum{ 0. };
+  double maximum{ 0. };
+  double mean{ 0. };
+  double standardDeviation{ 0. };
+  std::vector<std::size_t> histogram;
+};
+
+// Computes quality metrics for a collection of cells. The cells' connectivity
+// and coordinates are gathered once into contiguous arrays, after which any
+// number of metrics are computed on multiple threads. Each task processes its
+// cells in runs of a single cell type.
+class SMTKCORE_EXPORT CellQuality
+{
+public:
+  // Gather the cells of a cell set (in the order of its handles)
+  explicit CellQuality(const smtk::mesh::CellSet& cells);
+
+  // Use cells described by their types, the offsets of each cell's points
+  // into <connectivity> (numberOfCells + 1 entries), point indices into
+  // <coordinates> and interleaved point coordinates.
+  CellQuality(
+    std::vector<smtk::mesh::CellType> cellTypes,
+    std::vector<std::size_t> offsets,
+    std::vector<std::size_t> connectivity,
+    std::vector<double> coordinates);
+
+  std::size_t numberOfCells() const { return m_cellTypes.size(); }
+
+  // Compute a metric for each cell
+  std::vector<double> compute(CellQualityMetric metric) const;
+
+  // Summarize the values of a metric, using <numberOfBins> histogram bins
+  static CellQualityStatistics summarize(
+    const std::vector<double>& values,
+    std::size_t numberOfBins = 10);
+
+private:
+  std::vector<smtk::mesh::CellType> m_cellTypes;
+  std::vector<std::size_t> m_offsets;
+  std::vector<std::size_t> m_connectivity;
+  std::vector<double> m_coordinates;
+};
+
+// Compute a metric for the cells of a mesh set and store it as a cell field
+// named <name> (or the metric's name, if empty). Returns the new field, which
+// is invalid on failure.
+SMTKCORE_EXPORT
+smtk::mesh::CellField createCellQualityField(
+  const smtk::mesh::MeshSet& ms,
+  CellQualityMetric metric,
+  const std::string& name = std::string());
+} // namespace utility
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -20,8 +20,12 @@
 #include "smtk/model/Loop.h"
 #include "smtk/model/Vertex.h"
 
+#include "smtk/common/Parallel.h"
+
+#include <algorithm>
 #include <cmath>
 #include <deque>
+#include <numeric>
 #include <utility>
 
 namespace smtk
@@ -103,6 +107,70 @@ inline std::size_t smtkToVTKConn(std::int64_t& conn, std::size_t index, int numP
   return index + 1;
 }
 
+//The number of cells (or points) handled by a single task when extracting
+//in parallel.
+const std::size_t s_entriesPerTask = 1 << 14;
+
+inline std::size_t numberOfChunks(std::size_t size)
+{
+  return smtk::common::numberOfChunks(size, s_entriesPerTask);
+}
+
+//Call functor(chunk, begin, end) for each of the numberOfChunks(size)
+//consecutive chunks of [0, size).
+template<typename Functor>
+void forEachChunk(std::size_t size, const Functor& functor)
+{
+  smtk::common::forEachChunk(size, s_entriesPerTask, functor);
+}
+
+//A cell as reported by a connectivity traversal
+struct CellRecord
+{
+  const smtk::mesh::Handle* points;
+  int numPts;
+  smtk::mesh::CellType type;
+};
+
+//Maps point ids to their index in a PointSet by searching the PointSet's
+//intervals, which unlike a hash map can be shared by many threads. Ids that
+//are not in the PointSet map to 0, matching the serial extraction.
+class PointIndex
+{
+public:
+  PointIndex(const smtk::mesh::PointSet& ps)
+  {
+    std::int64_t offset = 0;
+    for (const auto& interval : ps.range())
+    {
+      m_lower.push_back(interval.lower());
+      m_upper.push_back(interval.upper());
+      m_offset.push_back(offset);
+      offset += static_cast<std::int64_t>(interval.upper() - interval.lower()) + 1;
+    }
+  }
+
+  std::int64_t operator()(smtk::mesh::Handle id) const
+  {
+    auto next = std::upper_bound(m_lower.begin(), m_lower.end(), id);
+    if (next == m_lower.begin())
+    {
+      return 0;
+    }
+    const std::size_t interval = static_cast<std::size_t>(next - m_lower.begin()) - 1;
+    if (id > m_upper[interval])
+    {
+      return 0;
+    }
+    return m_offset[interval] + static_cast<std::int64_t>(id - m_lower[interval]);
+  }
+
+private:
+  std::vector<smtk::mesh::Handle> m_lower;
+  std::vector<smtk::mesh::Handle> m_upper;
+  std::vector<std::int64_t> m_offset;
+};
+
 } //namespace detail
 
 void PreAllocatedTessellation::determineAllocationLengths(
@@ -171,6 +239,7 @@ PreAllocatedTessellation::PreAllocatedTessellation(std::int64_t* connectivity)
   , m_fpoints(nullptr)
   , m_useVTKConnectivity(true)
   , m_useVTKCellTypes(true)
+  , m_useParallelExtraction(true)
 {
 }
 
@@ -182,6 +251,7 @@ PreAllocatedTessellation::PreAllocatedTessellation(std::int64_t* connectivity, f
   , m_fpoints(points)
   , m_useVTKConnectivity(true)
   , m_useVTKCellTypes(true)
+  , m_useParallelExtraction(true)
 {
 }
 
@@ -193,6 +263,7 @@ PreAllocatedTessellation::PreAllocatedTessellation(std::int64_t* connectivity, d
   , m_fpoints(nullptr)
   , m_useVTKConnectivity(true)
   , m_useVTKCellTypes(true)
+  , m_useParallelExtraction(true)
 {
 }
 
@@ -207,6 +278,7 @@ PreAllocatedTessellation::PreAllocatedTessellation(
   , m_fpoints(nullptr)
   , m_useVTKConnectivity(true)
   , m_useVTKCellTypes(true)
+  , m_useParallelExtraction(true)
 {
 }
 
@@ -222,6 +294,7 @@ PreAllocatedTessellation::PreAllocatedTessellation(
   , m_fpoints(points)
   , m_useVTKConnectivity(true)
   , m_useVTKCellTypes(true)
+  , m_useParallelExtraction(true)
 {
 }
 
@@ -237,6 +310,7 @@ PreAllocatedTessellation::PreAllocatedTessellation(
   , m_fpoints(nullptr)
   , m_useVTKConnectivity(true)
   , m_useVTKCellTypes(true)
+  , m_useParallelExtraction(true)
 {
 }
 
@@ -358,6 +432,95 @@ void extractTessellationInternal(
     addCellLen = detail::smtkToVTKConn;
   }
 
+  //determine the function pointer to use for the cell type conversion
+  unsigned char (*convertCellTypeFunction)(smtk::mesh::CellType t, int numPts) =
+    detail::smtkToSMTKCell;
+  if (tess.m_useVTKCellTypes)
+  {
+    convertCellTypeFunction = detail::smtkToVTKCell;
+  }
+
+  int numPts = 0;
+  const smtk::mesh::Handle* pointIds;
+  smtk::mesh::CellType ctype;
+
+  if (tess.m_useParallelExtraction)
+  {
+    //record the cells in traversal order. The point ids they reference remain
+    //valid for as long as the connectivity does
+    std::vector<detail::CellRecord> cells;
+    for (pc.initCellTraversal(); pc.fetchNextCell(ctype, numPts, pointIds);)
+    {
+      cells.push_back(detail::CellRecord{ pointIds, numPts, ctype });
+    }
+
+    //compute the length of each chunk's connectivity, and with an inclusive
+    //prefix sum the offset at which each chunk's connectivity starts
+    const std::size_t cellLength = tess.m_useVTKConnectivity ? 1 : 0;
+    std::vector<std::size_t> chunkOffsets(detail::numberOfChunks(cells.size()) + 1, 0);
+    detail::forEachChunk(
+      cells.size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        std::size_t length = 0;
+        for (std::size_t index = begin; index < end; ++index)
+        {
+          length += cellLength + static_cast<std::size_t>(cells[index].numPts);
+        }
+        chunkOffsets[chunk + 1] = length;
+      });
+    std::partial_sum(chunkOffsets.begin(), chunkOffsets.end(), chunkOffsets.begin());
+
+    //fill each chunk of the output arrays concurrently
+    const detail::PointIndex pointIndex(ps);
+    detail::forEachChunk(
+      cells.size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        std::size_t conn_index = chunkOffsets[chunk];
+        for (std::size_t index = begin; index < end; ++index)
+        {
+          const detail::CellRecord& cell = cells[index];
+          if (fetch_cellLocations)
+          {
+            tess.m_cellLocations[index] = conn_index;
+            tess.m_cellTypes[index] = convertCellTypeFunction(cell.type, cell.numPts);
+          }
+
+          conn_index = addCellLen(*(tess.m_connectivity + conn_index), conn_index, cell.numPts);
+
+          std::int64_t* connectivity = tess.m_connectivity + conn_index;
+          for (int i = 0; i < cell.numPts; ++i)
+          {
+            connectivity[i] = pointIndex(cell.points[i]);
+          }
+          conn_index += cell.numPts;
+        }
+      });
+
+    //gather the coordinates in bulk. Floats are converted from the doubles
+    //held by the backend in a tight loop per chunk
+    if (fetch_dPoints)
+    {
+      ps.get(tess.m_dpoints);
+    }
+    else if (fetch_fPoints)
+    {
+      const std::size_t numberOfCoordinates = 3 * ps.size();
+      std::vector<double> coordinates(numberOfCoordinates);
+      if (ps.get(coordinates.data()))
+      {
+        const double* source = coordinates.data();
+        float* destination = tess.m_fpoints;
+        detail::forEachChunk(
+          numberOfCoordinates,
+          [source, destination](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+              destination[i] = static_cast<float>(source[i]);
+            }
+          });
+      }
+    }
+    return;
+  }
+
   //construct a map to better search for point ids
   std::unordered_map<std::int64_t, std::size_t> pointMap;
   auto it = smtk::mesh::rangeElementsBegin(ps.range());
@@ -367,20 +530,9 @@ void extractTessellationInternal(
     pointMap[*it] = counter;
   }
 
-  int numPts = 0;
-  const smtk::mesh::Handle* pointIds;
   std::size_t conn_index = 0;
-  smtk::mesh::CellType ctype;
   if (fetch_cellLocations)
   {
-    //determine the function pointer to use for the cell type conversion
-    unsigned char (*convertCellTypeFunction)(smtk::mesh::CellType t, int numPts) =
-      detail::smtkToSMTKCell;
-    if (tess.m_useVTKCellTypes)
-    {
-      convertCellTypeFunction = detail::smtkToVTKCell;
-    }
-
     //Issue we haven't handled the VTK syst
     std::size_t index = 0;
     for (pc.initCellTraversal(); pc.fetchNextCell(ctype, numPts, pointIds);
@@ -102,6 +102,13 @@ public:
   //If this is disabled we use the smtk/mesh cell enum values.
   void disableVTKCellTypes(bool disable) { m_useVTKCellTypes = !disable; }
 
+  //determine if the tessellation is extracted on multiple threads. When
+  //enabled, cells are split into chunks whose offsets into the output arrays
+  //are computed with a prefix sum, and the chunks are filled concurrently.
+  //The output is identical to the serial extraction. The default behavior of
+  //the class is to extract in parallel.
+  void disableParallelExtraction(bool disable) { m_useParallelExtraction = !disable; }
+
   bool hasConnectivity() const { return m_connectivity != nullptr; }
   bool hasCellLocations() const { return m_cellLocations != nullptr; }
   bool hasCellTypes() const { return m_cellTypes != nullptr; }
@@ -111,6 +118,7 @@ public:
 
   bool useVTKConnectivity() const { return m_useVTKConnectivity; }
   bool useVTKCellTypes() const { return m_useVTKCellTypes; }
+  bool useParallelExtraction() const { return m_useParallelExtraction; }
 
 private:
   template<class PointConnectivity>
@@ -127,6 +135,7 @@ private:
 
   bool m_useVTKConnectivity;
   bool m_useVTKCellTypes;
+  bool m_useParallelExtraction;
 };
 
 class SMTKCORE_EXPORT Tessellation
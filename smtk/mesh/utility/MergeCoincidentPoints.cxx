@@ -0,0 +1,397 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/utility/MergeCoincidentPoints.h"
+
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/Interface.h"
+#include "smtk/mesh/core/PointConnectivity.h"
+#include "smtk/mesh/core/PointSet.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/common/Parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace
+{
+
+// The number of points (or connectivity entries) handled by a single task.
+const std::size_t s_entriesPerTask = 1 << 15;
+
+// The number of bits of each bin coordinate packed into a Morton key.
+const int s_bitsPerAxis = 21;
+const std::int64_t s_binsPerAxis = (std::int64_t(1) << s_bitsPerAxis) - 1;
+
+// Call functor(task, begin, end) for consecutive chunks of [0, size).
+template<typename Functor>
+std::size_t forEachChunk(std::size_t size, const Functor& functor)
+{
+  return smtk::common::forEachChunk(size, s_entriesPerTask, functor);
+}
+
+// Interleave the low 21 bits of <value> with two zero bits between each.
+std::uint64_t spreadBits(std::uint64_t value)
+{
+  value &= 0x1fffff;
+  value = (value | value << 32) & 0x1f00000000ffffULL;
+  value = (value | value << 16) & 0x1f0000ff0000ffULL;
+  value = (value | value << 8) & 0x100f00f00f00f00fULL;
+  value = (value | value << 4) & 0x10c30c30c30c30c3ULL;
+  value = (value | value << 2) & 0x1249249249249249ULL;
+  return value;
+}
+
+std::uint64_t mortonKey(std::int64_t i, std::int64_t j, std::int64_t k)
+{
+  return spreadBits(static_cast<std::uint64_t>(i)) |
+    (spreadBits(static_cast<std::uint64_t>(j)) << 1) |
+    (spreadBits(static_cast<std::uint64_t>(k)) << 2);
+}
+
+// Bins points into a regular grid whose bins are no smaller than the
+// tolerance, so that all points within tolerance of a point lie in the 27
+// bins surrounding it.
+class Binning
+{
+public:
+  Binning(const std::vector<double>& xyz, double tolerance)
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      m_origin[axis] = std::numeric_limits<double>::max();
+    }
+    double upper[3] = { std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::lowest() };
+    for (std::size_t i = 0; i < xyz.size(); i += 3)
+    {
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        m_origin[axis] = std::min(m_origin[axis], xyz[i + axis]);
+        upper[axis] = std::max(upper[axis], xyz[i + axis]);
+      }
+    }
+
+    // Widen the bins if needed so that each bin coordinate fits in a key.
+    double span = 0.;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      span = std::max(span, upper[axis] - m_origin[axis]);
+    }
+    m_binSize = std::max(tolerance, span / static_cast<double>(s_binsPerAxis - 1));
+    if (!(m_binSize > 0.))
+    {
+      m_binSize = 1.;
+    }
+  }
+
+  void bin(const double* point, std::int64_t* ijk) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      std::int64_t index =
+        static_cast<std::int64_t>(std::floor((point[axis] - m_origin[axis]) / m_binSize));
+      ijk[axis] = std::max<std::int64_t>(0, std::min(index, s_binsPerAxis - 1));
+    }
+  }
+
+  std::uint64_t key(const double* point) const
+  {
+    std::int64_t ijk[3];
+    this->bin(point, ijk);
+    return mortonKey(ijk[0], ijk[1], ijk[2]);
+  }
+
+private:
+  double m_origin[3];
+  double m_binSize;
+};
+
+std::size_t findRepresentative(std::vector<std::size_t>& parent, std::size_t i)
+{
+  while (parent[i] != i)
+  {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+} // namespace
+
+namespace smtk
+{
+namespace mesh
+{
+namespace utility
+{
+
+std::vector<std::size_t> coincidentPointMap(const std::vector<double>& xyz, double tolerance)
+{
+  const std::size_t numberOfPoints = xyz.size() / 3;
+  std::vector<std::size_t> map(numberOfPoints);
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    map[i] = i;
+  }
+  if (numberOfPoints < 2 || !(tolerance >= 0.))
+  {
+    return map;
+  }
+
+  // I. Compute the Morton key of each point's bin.
+  const Binning binning(xyz, tolerance);
+  std::vector<std::uint64_t> keys(numberOfPoints);
+  forEachChunk(numberOfPoints, [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      keys[i] = binning.key(&xyz[3 * i]);
+    }
+  });
+
+  // II. Order the points by (key, index): sort chunks concurrently, then merge.
+  std::vector<std::size_t> order(map);
+  auto byKey = [&keys](std::size_t a, std::size_t b) {
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+  };
+  forEachChunk(numberOfPoints, [&](std::size_t, std::size_t begin, std::size_t end) {
+    std::sort(order.begin() + begin, order.begin() + end, byKey);
+  });
+  for (std::size_t width = s_entriesPerTask; width < numberOfPoints; width *= 2)
+  {
+    for (std::size_t begin = 0; begin + width < numberOfPoints; begin += 2 * width)
+    {
+      std::inplace_merge(
+        order.begin() + begin,
+        order.begin() + begin + width,
+        order.begin() + std::min(numberOfPoints, begin + 2 * width),
+        byKey);
+    }
+  }
+  std::vector<std::uint64_t> sortedKeys(numberOfPoints);
+  forEachChunk(numberOfPoints, [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t rank = begin; rank < end; ++rank)
+    {
+      sortedKeys[rank] = keys[order[rank]];
+    }
+  });
+
+  // III. Concurrently search the bins neighboring each point for points with
+  //      a lower index that lie within tolerance.
+  const double tolerance2 = tolerance * tolerance;
+  std::vector<std::vector<std::pair<std::size_t, std::size_t>>> pairs(
+    smtk::common::numberOfChunks(numberOfPoints, s_entriesPerTask));
+  forEachChunk(numberOfPoints, [&](std::size_t task, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const double* point = &xyz[3 * i];
+      std::int64_t ijk[3];
+      binning.bin(point, ijk);
+      for (std::int64_t k = std::max<std::int64_t>(0, ijk[2] - 1);
+           k <= std::min(s_binsPerAxis - 1, ijk[2] + 1);
+           ++k)
+      {
+        for (std::int64_t j = std::max<std::int64_t>(0, ijk[1] - 1);
+             j <= std::min(s_binsPerAxis - 1, ijk[1] + 1);
+             ++j)
+        {
+          for (std::int64_t ii = std::max<std::int64_t>(0, ijk[0] - 1);
+               ii <= std::min(s_binsPerAxis - 1, ijk[0] + 1);
+               ++ii)
+          {
+            auto range =
+              std::equal_range(sortedKeys.begin(), sortedKeys.end(), mortonKey(ii, j, k));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+              const std::size_t other = order[it - sortedKeys.begin()];
+              if (other >= i)
+              {
+                // Points within a bin are ordered by index.
+                break;
+              }
+              const double* candidate = &xyz[3 * other];
+              const double dx = point[0] - candidate[0];
+              const double dy = point[1] - candidate[1];
+              const double dz = point[2] - candidate[2];
+              if (dx * dx + dy * dy + dz * dz <= tolerance2)
+              {
+                pairs[task].emplace_back(other, i);
+              }
+            }
+          }
+        }
+      }
+    }
+  });
+
+  // IV. Join the coincident pairs, keeping the lowest index of each group as
+  //     its representative.
+  for (const auto& taskPairs : pairs)
+  {
+    for (const auto& pair : taskPairs)
+    {
+      std::size_t a = findRepresentative(map, pair.first);
+      std::size_t b = findRepresentative(map, pair.second);
+      if (a < b)
+      {
+        map[b] = a;
+      }
+      else if (b < a)
+      {
+        map[a] = b;
+      }
+    }
+  }
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    map[i] = map[map[i]];
+  }
+  return map;
+}
+
+bool mergeCoincidentPoints(const smtk::mesh::MeshSet& ms, double tolerance)
+{
+  const smtk::mesh::ResourcePtr& resource = ms.resource();
+  if (!resource)
+  {
+    return false;
+  }
+
+  smtk::mesh::PointSet points = ms.points();
+  if (points.is_empty())
+  {
+    return true;
+  }
+  std::vector<double> xyz(3 * points.size());
+  if (!points.get(xyz.data()))
+  {
+    return false;
+  }
+  const std::vector<std::size_t> map = coincidentPointMap(xyz, tolerance);
+  std::size_t numberOfMergedPoints = 0;
+  for (std::size_t i = 0; i < map.size(); ++i)
+  {
+    numberOfMergedPoints += map[i] != i ? 1 : 0;
+  }
+  if (numberOfMergedPoints == 0)
+  {
+    return true;
+  }
+  const std::vector<smtk::mesh::Handle> pointHandles(
+    smtk::mesh::rangeElementsBegin(points.range()), smtk::mesh::rangeElementsEnd(points.range()));
+
+  // Vertex cells are their own points; they are replaced along with the
+  // merged points below. Gather the connectivity of all other cells (in the
+  // order of the cell range)...
+  smtk::mesh::CellTypes cellTypes;
+  cellTypes.set();
+  cellTypes.reset(smtk::mesh::Vertex);
+  smtk::mesh::CellSet cells = ms.cells(cellTypes);
+  std::vector<int> cellSizes;
+  std::vector<smtk::mesh::Handle> connectivity;
+  cellSizes.reserve(cells.size());
+  {
+    smtk::mesh::PointConnectivity pointConnectivity = cells.pointConnectivity();
+    connectivity.reserve(pointConnectivity.size());
+    int numPts;
+    const smtk::mesh::Handle* pts;
+    for (pointConnectivity.initCellTraversal(); pointConnectivity.fetchNextCell(numPts, pts);)
+    {
+      cellSizes.push_back(numPts);
+      connectivity.insert(connectivity.end(), pts, pts + numPts);
+    }
+  }
+
+  // ... remap it concurrently...
+  std::vector<char> changed(connectivity.size(), 0);
+  forEachChunk(connectivity.size(), [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const std::size_t index = static_cast<std::size_t>(
+        std::lower_bound(pointHandles.begin(), pointHandles.end(), connectivity[i]) -
+        pointHandles.begin());
+      if (index < pointHandles.size() && map[index] != index)
+      {
+        connectivity[i] = pointHandles[map[index]];
+        changed[i] = 1;
+      }
+    }
+  });
+
+  // ... and write the modified cells back in runs of cells with the same
+  // number of points.
+  smtk::mesh::AllocatorPtr allocator = resource->interface()->allocator();
+  if (!allocator)
+  {
+    return false;
+  }
+
+  bool success = true;
+  smtk::mesh::HandleRange run;
+  std::vector<smtk::mesh::Handle> runConnectivity;
+  int runSize = 0;
+  auto flush = [&]() {
+    if (!run.empty())
+    {
+      success &= allocator->setConnectivity(run, runSize, runConnectivity.data());
+      run.clear();
+      runConnectivity.clear();
+    }
+  };
+
+  std::size_t offset = 0;
+  auto cell = smtk::mesh::rangeElementsBegin(cells.range());
+  for (std::size_t c = 0; c < cellSizes.size() && success; ++c, ++cell)
+  {
+    const int numPts = cellSizes[c];
+    const auto first = changed.begin() + offset;
+    if (std::find(first, first + numPts, 1) != first + numPts)
+    {
+      if (numPts != runSize)
+      {
+        flush();
+        runSize = numPts;
+      }
+      run.insert(*cell);
+      runConnectivity.insert(
+        runConnectivity.end(),
+        connectivity.begin() + offset,
+        connectivity.begin() + offset + numPts);
+    }
+    offset += static_cast<std::size_t>(numPts);
+  }
+  flush();
+  if (!success)
+  {
+    return false;
+  }
+
+  // Finally, replace the merged points wherever else they are used and
+  // remove them.
+  smtk::mesh::HandleRange mergedPoints;
+  std::vector<smtk::mesh::Handle> replacementPoints;
+  replacementPoints.reserve(numberOfMergedPoints);
+  for (std::size_t i = 0; i < map.size(); ++i)
+  {
+    if (map[i] != i)
+    {
+      mergedPoints.insert(pointHandles[i]);
+      replacementPoints.push_back(pointHandles[map[i]]);
+    }
+  }
+  return allocator->replacePoints(mergedPoints, replacementPoints.data());
+}
+} // namespace utility
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,49 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_utility_MergeCoincidentPoints_h
+#define smtk_mesh_utility_MergeCoincidentPoints_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/core/MeshSet.h"
+
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace utility
+{
+
+// Given interleaved (x, y, z) coordinates, compute for each point the index
+// of the point it is merged into. Points closer than <tolerance> to one
+// another (transitively) are merged into the point of the group with the
+// lowest index, so the returned table satisfies map[i] <= i. Points are
+// binned into a Morton-ordered spatial hash that is built and searched on
+// multiple threads.
+SMTKCORE_EXPORT
+std::vector<std::size_t> coincidentPointMap(const std::vector<double>& xyz, double tolerance);
+
+// Merge the points used by the cells of a mesh set that are closer than
+// <tolerance> to one another. Cell connectivity is rewritten in bulk through
+// the interface's Allocator, so any backend that supports
+// Allocator::setConnectivity() and Allocator::replacePoints() may be used.
+// Unlike the backend's own merge, cells that become duplicates are kept.
+// Will cause any existing PointConnectivity and PointSet's to become invalid.
+SMTKCORE_EXPORT
+bool mergeCoincidentPoints(const smtk::mesh::MeshSet& ms, double tolerance = 1.0e-6);
+} // namespace utility
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -123,6 +123,17 @@ std::shared_future<Operation::Result> Launchers::operator()(
   }
 }
 
+std::shared_future<Operation::Result> Launchers::operator()(
+  const Operation::Ptr& op,
+  const Launchers::LauncherMap::key_type& k_type,
+  const Operation::ProgressHandler& handler)
+{
+  assert(op != nullptr);
+
+  op->setProgressHandler(handler);
+  return this->operator()(op, k_type);
+}
+
 std::shared_future<Operation::Result> Launchers::operator()(const Operation::Ptr& op)
 {
   return this->operator()(op, default_key);
@@ -28,6 +28,10 @@ typedef std::function<std::shared_future<Operation::Result>(const Operation::Ptr
 /// A functor for executing operations and returning futures of the result.
 /// Multiple launch types are supported and can be accessed using the
 /// LauncherMap's key.
+///
+/// Launched operations may be stopped by calling Operation::cancel(); an
+/// operation that is canceled while waiting to run returns a CANCELED result
+/// without executing.
 class SMTKCORE_EXPORT Launchers
 {
 public:
@@ -62,6 +66,14 @@ public:
     const Operation::Ptr&,
     const Launchers::LauncherMap::key_type&);
 
+  /// Launch an operation using the launch method associated to the input key,
+  /// passing its progress reports to \a handler (which replaces any handler
+  /// previously set on the operation).
+  std::shared_future<Operation::Result> operator()(
+    const Operation::Ptr&,
+    const Launchers::LauncherMap::key_type&,
+    const Operation::ProgressHandler& handler);
+
 protected:
   LauncherMap m_launchers;
 };
@@ -19,6 +19,7 @@
 #include "smtk/io/Logger.h"
 
 #include <sstream>
+#include <vector>
 
 namespace smtk
 {
@@ -215,6 +216,7 @@ bool Manager::registerResourceManager(smtk::resource::ManagerPtr& resourceManage
       result->filterItems(resourceItems, filter);
 
       // For each resource item found...
+      std::vector<smtk::resource::ResourcePtr> resources;
       for (auto& resourceItem : resourceItems)
       {
         if (resourceItem->name() == "resourcesToExpunge")
@@ -231,10 +233,14 @@ bool Manager::registerResourceManager(smtk::resource::ManagerPtr& resourceManage
             continue;
           }
 
-          // ...add the resource to the manager.
-          rsrcManager->add(resourceItem->value(i));
+          // ...collect the resource so all of them are added to the manager together.
+          resources.push_back(resourceItem->value(i));
         }
       }
+      if (!resources.empty())
+      {
+        rsrcManager->add(resources);
+      }
       return 0;
     },
     smtk::operation::Observers::lowestPriority(),
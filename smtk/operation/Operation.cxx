@@ -21,6 +21,9 @@
 #include "smtk/attribute/ResourceItem.h"
 #include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/VoidItem.h"
+
+#include "smtk/common/Tracing.h"
+
 #include "smtk/io/AttributeReader.h"
 #include "smtk/io/Logger.h"
 #include "smtk/project/Manager.h"
@@ -31,6 +34,7 @@
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -86,6 +90,23 @@ Operation::~Operation()
   }
 }
 
+Operation& Operation::operator=(const Operation& other)
+{
+  if (&other != this)
+  {
+    m_debugLevel = other.m_debugLevel;
+    this->setProgressHandler(other.progressHandler());
+    m_manager = other.m_manager;
+    m_managers = other.m_managers;
+    m_specification = other.m_specification;
+    m_parameters = other.m_parameters;
+    m_resultDefinition = other.m_resultDefinition;
+    m_results = other.m_results;
+    m_lightweightResults = other.m_lightweightResults;
+  }
+  return *this;
+}
+
 Operation::Specification Operation::specification()
 {
   // Lazily create the specification.
@@ -130,6 +151,17 @@ ResourceAccessMap Operation::identifyLocksRequired()
 
 Operation::Result Operation::operate()
 {
+  // When tracing, each phase of the operation is recorded as a span whose
+  // detail is the operation's type name.
+  const char* traceName = smtk::common::Tracing::enabled()
+    ? smtk::common::Tracing::intern(this->typeName())
+    : nullptr;
+  smtk::common::ScopedSpan operateSpan("operate", "operation", traceName);
+
+  // Cancellation requests apply to a single invocation; discard any request
+  // that arrived while the operation was not running.
+  m_cancelRequested = false;
+
   // Gather all requested resources and their lock types.
   auto resourcesAndLockTypes = this->identifyLocksRequired();
 
@@ -138,37 +170,39 @@ Operation::Result Operation::operate()
   static std::mutex mutex;
 
   // Lock the resources.
-  mutex.lock();
-  for (auto& resourceAndLockType : resourcesAndLockTypes)
   {
-    auto resource = resourceAndLockType.first.lock();
-    auto& lockType = resourceAndLockType.second;
-
-// Leave this for debugging, but do not include it in every debug build
-// as it can be quite noisy.
-#if 0
-    // Given the puzzling result of deadlock that can arise if one Operation
-    // calls another Operation using its public API and passes it a Resource
-    // with a Write LockType, we print to the terminal which resources we are
-    // locking. If you are working on an Operation and are trying to debug a
-    // deadlock, consider calling operations using the following syntax:
-    // $
-    // $ op->operate(Key());
-    // $
-    // This will avoid the inner Operation's resource locking and execute it
-    // directly. Be sure to verify the operation's validity prior to execution
-    // (via the ableToOperate() method).
-    std::cout << "Operation \"" << this->typeName() << "\" is locking resource " << resource->name()
-              << " (" << resource->typeName() << ") with lock type \""
-              << (lockType == smtk::resource::LockType::Read
-                     ? "Read"
-                     : (lockType == smtk::resource::LockType::Write ? "Write" : "DoNotLock"))
-              << "\"\n";
-#endif
-
-    resource->lock({}).lock(lockType);
-  }
-  mutex.unlock();
+    smtk::common::ScopedSpan lockSpan("lock resources", "operation", traceName);
+    mutex.lock();
+    for (auto& resourceAndLockType : resourcesAndLockTypes)
+    {
+      auto resource = resourceAndLockType.first.lock();
+      auto& lockType = resourceAndLockType.second;
+
+      // Deadlock can arise if one Operation calls another Operation using its
+      // public API and passes it a Resource with a Write LockType. Tracing
+      // records which resources are locked (and for how long each lock took
+      // to acquire). If you are working on an Operation and are trying to
+      // debug a deadlock, consider calling operations using the following
+      // syntax:
+      // $
+      // $ op->operate(Key());
+      // $
+      // This will avoid the inner Operation's resource locking and execute it
+      // directly. Be sure to verify the operation's validity prior to
+      // execution (via the ableToOperate() method).
+      smtk::common::ScopedSpan resourceSpan(
+        "lock resource",
+        "operation",
+        traceName ? smtk::common::Tracing::intern(
+                      resource->name() + " (" + resource->typeName() + "): " +
+                      (lockType == smtk::resource::LockType::Read
+                         ? "Read"
+                         : (lockType == smtk::resource::LockType::Write ? "Write" : "DoNotLock")))
+                  : nullptr);
+      resource->lock({}).lock(lockType);
+    }
+    mutex.unlock();
+  }
 
   // Remember where the log was so we only serialize messages for this
   // operation:
@@ -186,15 +220,35 @@ Operation::Result Operation::operate()
   Outcome outcome;
 
   // First, we check that the operation is able to operate.
-  if (!this->ableToOperate())
+  bool able;
+  {
+    smtk::common::ScopedSpan span("ableToOperate", "operation", traceName);
+    able = this->ableToOperate();
+  }
+
+  // Then, we check if any observers wish to cancel this operation.
+  bool canceledByObserver = false;
+  if (able && manager)
+  {
+    smtk::common::ScopedSpan span("WILL_OPERATE observers", "operation", traceName);
+    canceledByObserver = manager->observers()(*this, EventType::WILL_OPERATE, nullptr) != 0;
+  }
+
+  if (!able)
   {
     outcome = Outcome::UNABLE_TO_OPERATE;
     result = this->createResult(outcome);
     // If the operation cannot operate, there is no need to call any observers.
     observePostOperation = false;
   }
-  // Then, we check if any observers wish to cancel this operation.
-  else if (manager && manager->observers()(*this, EventType::WILL_OPERATE, nullptr))
+  else if (canceledByObserver)
+  {
+    outcome = Outcome::CANCELED;
+    result = this->createResult(outcome);
+  }
+  // An operation canceled before it began (e.g., while queued by a launcher)
+  // is not executed.
+  else if (m_cancelRequested)
   {
     outcome = Outcome::CANCELED;
     result = this->createResult(outcome);
@@ -208,33 +262,55 @@ Operation::Result Operation::operate()
     m_debugLevel = ((debugItem && debugItem->isEnabled()) ? debugItem->value() : 0);
 
     // Perform the derived operation.
-    result = this->operateInternal();
+    {
+      smtk::common::ScopedSpan span("operateInternal", "operation", traceName);
+      result = this->operateInternal();
+    }
     // Post-process the result if the operation was successful.
     outcome = static_cast<Outcome>(result->findInt("outcome")->value());
     if (outcome == Outcome::SUCCEEDED)
     {
+      smtk::common::ScopedSpan span("postProcessResult", "operation", traceName);
       this->postProcessResult(result);
     }
 
     // By default, all executed operations are assumed to modify any input
     // resource accessed with a Write LockType and any resources referenced in
-    // the result.
-    if (outcome == Outcome::SUCCEEDED || outcome == Outcome::FAILED)
+    // the result. This includes operations that were canceled while running,
+    // since their results hold the work completed before they stopped.
+    if (
+      outcome == Outcome::SUCCEEDED || outcome == Outcome::FAILED || outcome == Outcome::CANCELED)
     {
+      smtk::common::ScopedSpan span("markModifiedResources", "operation", traceName);
       this->markModifiedResources(result);
     }
   }
 
-  // Add a summary of the operation to the result.
-  this->generateSummary(result);
+  // Add a summary of the operation to the result. Lightweight results of
+  // successful operations defer this until completeResult() is called.
+  const bool summarize = !m_lightweightResults || outcome != Outcome::SUCCEEDED;
+  if (summarize)
+  {
+    this->generateSummary(result);
+  }
 
-  // Now grab all log messages and serialize them into the result attribute.
+  // Now grab this operation's log messages and serialize them into the result
+  // attribute (or, for lightweight results, remember which messages they are).
   {
+    smtk::common::ScopedSpan span("serialize log", "operation", traceName);
     std::size_t logEnd = this->log().numberOfRecords();
-    if (logEnd > logStart)
+    if (m_lightweightResults)
+    {
+      for (auto it = m_deferredLogs.begin(); it != m_deferredLogs.end();)
+      {
+        it = it->first.expired() ? m_deferredLogs.erase(it) : std::next(it);
+      }
+      m_deferredLogs[result] = DeferredLog{ logStart, logEnd, !summarize };
+    }
+    else if (logEnd > logStart)
     {
       // Serialize relevant log records to a json-formatted string.
-      auto records = this->log().records();
+      auto records = this->log().records(logStart, logEnd);
       nlohmann::json j = records;
       result->findString("log")->appendValue(j.dump());
     }
@@ -243,11 +319,16 @@ Operation::Result Operation::operate()
   // Execute post-operation observation
   if (observePostOperation)
   {
+    smtk::common::ScopedSpan span("DID_OPERATE observers", "operation", traceName);
     manager->observers()(*this, EventType::DID_OPERATE, result);
   }
 
   // Un-manage any resources marked for removal before releasing locks.
-  bool removed = this->unmanageResources(result);
+  bool removed;
+  {
+    smtk::common::ScopedSpan span("unmanageResources", "operation", traceName);
+    removed = this->unmanageResources(result);
+  }
   if (!removed)
   {
     smtkErrorMacro(this->log(), "Failed to remove resources marked for removal.");
@@ -285,23 +366,60 @@ Operation::Outcome Operation::safeOperate(Handler handler)
     {
       handler(*this, result);
     }
-    if (m_specification)
-    {
-      m_specification->removeAttribute(result);
-    }
+    this->releaseResult(result);
   }
   return outcome;
 }
 
 bool Operation::releaseResult(Result& result)
 {
-  if (!m_specification)
+  if (!m_specification || !result)
   {
     return false;
   }
+  m_deferredLogs.erase(result);
+
+  // Lightweight results are reset (dropping any references they hold) and
+  // pooled for reuse rather than removed.
+  if (m_lightweightResults && result->definition() == m_resultDefinition)
+  {
+    for (std::size_t ii = 0; ii < result->numberOfItems(); ++ii)
+    {
+      result->item(static_cast<int>(ii))->reset();
+    }
+    m_resultPool.push_back(result);
+    return true;
+  }
   return m_specification->removeAttribute(result);
 }
 
+void Operation::completeResult(const Result& result)
+{
+  auto deferred = result ? m_deferredLogs.find(result) : m_deferredLogs.end();
+  if (deferred == m_deferredLogs.end())
+  {
+    return;
+  }
+  DeferredLog range = deferred->second;
+  m_deferredLogs.erase(deferred);
+
+  std::vector<smtk::io::Logger::Record> records = this->log().records(range.begin, range.end);
+  if (range.summarize)
+  {
+    std::size_t summaryStart = this->log().numberOfRecords();
+    Result summarized = result;
+    this->generateSummary(summarized);
+    auto summary = this->log().records(summaryStart, this->log().numberOfRecords());
+    records.insert(records.end(), summary.begin(), summary.end());
+  }
+
+  if (!records.empty())
+  {
+    nlohmann::json j = records;
+    result->findString("log")->appendValue(j.dump());
+  }
+}
+
 smtk::io::Logger& Operation::log() const
 {
   return smtk::io::Logger::instance();
@@ -362,7 +480,13 @@ Operation::Result Operation::createResult(Outcome outcome)
   // Now that we have our result definition, we create our result attribute.
   Result result;
 
-  if (m_resultDefinition)
+  if (!m_resultPool.empty())
+  {
+    // Reuse a released lightweight result; its items were reset on release.
+    result = m_resultPool.back();
+    m_resultPool.pop_back();
+  }
+  else if (m_resultDefinition)
   {
     // Create a new instance of the result.
     {
@@ -533,6 +657,30 @@ bool Operation::unmanageResources(Operation::Result& result)
   return ret;
 }
 
+void Operation::setProgressHandler(const ProgressHandler& handler)
+{
+  std::lock_guard<std::mutex> guard(m_progressHandlerMutex);
+  m_progressHandler = handler;
+}
+
+Operation::ProgressHandler Operation::progressHandler() const
+{
+  std::lock_guard<std::mutex> guard(m_progressHandlerMutex);
+  return m_progressHandler;
+}
+
+bool Operation::reportProgress(double fraction, const std::string& message)
+{
+  // Call a copy of the handler so that it may be replaced (or the report may
+  // replace it) without holding the lock while it runs.
+  ProgressHandler handler = this->progressHandler();
+  if (handler)
+  {
+    handler(*this, std::min(std::max(fraction, 0.), 1.), message);
+  }
+  return !m_cancelRequested;
+}
+
 void Operation::generateSummary(Operation::Result& result)
 {
   std::stringstream s;
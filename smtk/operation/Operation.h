@@ -15,8 +15,11 @@
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/SharedFromThis.h"
 
+#include <atomic>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <utility>
@@ -95,6 +98,16 @@ public:
 
   virtual ~Operation();
 
+  /// Copy another operation's configuration.
+  ///
+  /// The debug level, progress handler, managers, specification, result
+  /// definition and lightweight-results setting are copied. The parameters are
+  /// shared rather than duplicated, so changes made through either operation
+  /// affect both, and the copy also removes the other operation's results from
+  /// the specification when it is destroyed. Any pending cancellation request,
+  /// deferred result logs and recycled results are not copied.
+  Operation& operator=(const Operation& other);
+
   // Index is a compile-time intrinsic of the derived operation; as such, it
   // cannot be set. It is virtual so that derived operations can assign their
   // own index (as is necessary for python operations that would otherwise all
@@ -161,8 +174,32 @@ public:
   /// resource; anyone holding the shared pointer to the result will keep the
   /// attribute in memory but will experience inconsistent behavior since its items
   /// are removed as part of releasing it from control by the attribute::Resource.
+  ///
+  /// When the operation produces lightweight results, the released result is
+  /// instead reset and kept so that a later call to createResult() can reuse it.
+  /// A released result must not be used after it has been released.
   virtual bool releaseResult(Result& result);
 
+  /// Set or get whether the operation produces lightweight results.
+  ///
+  /// Operations run many times in a loop spend a noticeable fraction of their
+  /// time summarizing their results and serializing log records to JSON, even
+  /// when nobody reads them. A lightweight result of a successful operation
+  /// instead remembers which log records the operation produced; its summary is
+  /// generated and its "log" item is populated only when completeResult() is
+  /// called. Unsuccessful results are summarized immediately (so that failures
+  /// are always logged) but their log serialization is deferred as well.
+  /// Released lightweight results are recycled rather than destroyed.
+  void setLightweightResults(bool lightweight) { m_lightweightResults = lightweight; }
+  bool lightweightResults() const { return m_lightweightResults; }
+
+  /// Generate the summary and serialize the log records deferred for a
+  /// lightweight \a result. This does nothing for results that are already
+  /// complete. It must be called before \a result is released and before the
+  /// operation's logger is reset. Records the logger has since discarded (see
+  /// io::Logger::setCapacity()) are omitted.
+  void completeResult(const Result& result);
+
   /// Retrieve the operation's logger. By default, we use the singleton logger.
   /// Derived classes can reimplement this method if an alternative logging
   /// system is needed.
@@ -197,6 +234,35 @@ public:
   /// Is this type of operation safe to launch in a thread?
   virtual bool threadSafe() const { return true; }
 
+  /// A progress handler is passed the operation, the fraction of its work that
+  /// is complete (in [0, 1]) and a message describing the current step.
+  ///
+  /// The handler is invoked on the thread running the operation, so handlers
+  /// that update a user interface must forward the report to the interface's
+  /// own thread.
+  typedef std::function<void(const Operation&, double, const std::string&)> ProgressHandler;
+
+  /// Set or get the handler that receives progress reports while the operation
+  /// runs. The handler may be replaced from any thread; reports already under
+  /// way complete with the handler they started with.
+  void setProgressHandler(const ProgressHandler& handler);
+  ProgressHandler progressHandler() const;
+
+  /// Request that the operation stop as soon as possible.
+  ///
+  /// This may be called from any thread while operate() is running. If the
+  /// request arrives before operateInternal() is called, the operation is not
+  /// executed; otherwise it stops at its next safe point (see reportProgress())
+  /// and returns a CANCELED result holding whatever it completed before
+  /// stopping. Each call to operate() begins by clearing the request, so a
+  /// request made while the operation is not running never affects a later
+  /// invocation.
+  void cancel() { m_cancelRequested = true; }
+
+  /// Return true if cancellation has been requested since operate() was last
+  /// called.
+  bool cancelRequested() const { return m_cancelRequested; }
+
   /// retrieve the resource manager, if available.
   smtk::resource::ManagerPtr resourceManager();
 
@@ -225,6 +291,14 @@ protected:
   // Remove resources from the resource manager.
   virtual bool unmanageResources(Result&);
 
+  /// Report that \a fraction of the operation's work is complete and return
+  /// whether the operation should continue.
+  ///
+  /// Long-running operations should call this at safe points (where the
+  /// resources they modify are consistent) and, when it returns false, stop
+  /// and return a CANCELED result describing the work done so far.
+  bool reportProgress(double fraction, const std::string& message = std::string());
+
   // Append an output summary string to the output result. Derived classes can
   // reimplement this method to send custom summary strings to the logger.
   virtual void generateSummary(Result&);
@@ -234,6 +308,9 @@ protected:
   Specification createBaseSpecification() const;
 
   int m_debugLevel{ 0 };
+  ProgressHandler m_progressHandler;
+  mutable std::mutex m_progressHandlerMutex;
+  std::atomic<bool> m_cancelRequested{ false };
   std::weak_ptr<Manager> m_manager;
   std::shared_ptr<smtk::common::Managers> m_managers;
 
@@ -264,6 +341,22 @@ private:
   Parameters m_parameters;
   Definition m_resultDefinition;
   std::vector<std::weak_ptr<smtk::attribute::Attribute>> m_results;
+
+  // The range of log records [begin, end) produced while computing a
+  // lightweight result that has not yet been completed. Results are held
+  // weakly (and compared by owner) so that a result destroyed without being
+  // completed or released cannot pass its range on to a new result at the
+  // same address; such entries are pruned when new results are deferred.
+  struct DeferredLog
+  {
+    std::size_t begin;
+    std::size_t end;
+    bool summarize;
+  };
+  using DeferredResult = std::weak_ptr<const smtk::attribute::Attribute>;
+  bool m_lightweightResults{ false };
+  std::map<DeferredResult, DeferredLog, std::owner_less<DeferredResult>> m_deferredLogs;
+  std::vector<Result> m_resultPool;
 };
 
 /**\brief Return the outcome of an operation given its \a result object.
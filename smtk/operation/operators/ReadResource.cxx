@@ -11,14 +11,19 @@
 
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DoubleItem.h"
 #include "smtk/attribute/FileItem.h"
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/VoidItem.h"
 
 #include "smtk/common/Archive.h"
+#include "smtk/common/Parallel.h"
 
 #include "smtk/io/Logger.h"
 
+#include "smtk/mesh/json/BinaryResource.h"
+
 #include "smtk/resource/Manager.h"
 #include "smtk/resource/Metadata.h"
 
@@ -28,10 +33,103 @@
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
 using json = nlohmann::json;
 
+namespace
+{
+// Determine the type of resource stored in \a filename.
+bool readResourceType(const std::string& filename, std::string& type, smtk::io::Logger& log)
+{
+  smtk::common::Archive archive(filename);
+
+  std::ifstream file;
+  std::set<std::string> contents = archive.contents();
+  if (!contents.empty())
+  {
+    // Archives hold either a binary mesh index or a text index.
+    std::string smtkFilename =
+      contents.find("index.smtkb") != contents.end() ? "index.smtkb" : "index.json";
+    file.open(archive.location(smtkFilename), std::ios::in | std::ios::binary);
+  }
+  else
+  {
+    file.open(filename, std::ios::in | std::ios::binary);
+  }
+
+  if (!file.good())
+  {
+    smtkErrorMacro(log, "Could not open file \"" << filename << "\" for reading.");
+    return false;
+  }
+
+  bool fileTypeKnown = false;
+
+  // Binary mesh resources hold their type in the header that precedes their
+  // meshes, so only the header is read.
+  if (smtk::mesh::json::isBinaryResource(file))
+  {
+    smtk::mesh::json::BinaryResourceReader reader(file);
+    try
+    {
+      type = reader.header().at("type").get<std::string>();
+      fileTypeKnown = reader.isValid();
+    }
+    catch (std::exception&)
+    {
+    }
+    if (!fileTypeKnown)
+    {
+      smtkErrorMacro(log, "Could not determine resource type for file \"" << filename << "\".");
+    }
+    return fileTypeKnown;
+  }
+
+  json j;
+
+  try
+  {
+    j = json::parse(file);
+    type = j.at("type").get<std::string>();
+    fileTypeKnown = true;
+  }
+  catch (std::exception&)
+  {
+  }
+
+  if (!fileTypeKnown)
+  {
+    try
+    {
+      for (json::iterator it = j.begin(); it != j.end(); ++it)
+      {
+        auto jtype = it->find("type");
+        if (jtype != it->end() && jtype.value() == "session")
+        {
+          type = it->find("name").value().get<std::string>();
+          fileTypeKnown = true;
+        }
+      }
+    }
+    catch (std::exception&)
+    {
+    }
+  }
+
+  if (!fileTypeKnown)
+  {
+    smtkErrorMacro(log, "Could not determine resource type for file \"" << filename << "\".");
+  }
+  return fileTypeKnown;
+}
+} // anonymous namespace
+
 namespace smtk
 {
 namespace operation
@@ -67,78 +165,19 @@ ReadResource::Result ReadResource::operateInternal()
 
   auto fileItem = this->parameters()->findFile("filename");
 
-  std::string type;
-
   smtk::operation::ReaderGroup readerGroup(manager);
 
-  Result result = this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
-
-  auto hints = result->findReference("hints");
+  // I. Identify the type of each file and prepare a reader for it.
+  //    This is done serially since it queries the operation manager.
+  std::vector<std::string> filenames;
+  std::vector<smtk::operation::Operation::Ptr> readOperations;
   for (auto fileIt = fileItem->begin(); fileIt != fileItem->end(); ++fileIt)
   {
     std::string filename = *fileIt;
-
-    smtk::common::Archive archive(filename);
-
-    // Scope so file is only open for a short time:
+    std::string type;
+    if (!readResourceType(filename, type, this->log()))
     {
-      std::ifstream file;
-      if (!archive.contents().empty())
-      {
-        std::string smtkFilename = "index.json";
-        archive.get(smtkFilename, file);
-      }
-      else
-      {
-        file.open(filename, std::ios::in);
-      }
-
-      {
-        if (!file.good())
-        {
-          smtkErrorMacro(this->log(), "Could not open file \"" << filename << "\" for reading.");
-          return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-        }
-
-        bool fileTypeKnown = false;
-        json j;
-
-        try
-        {
-          j = json::parse(file);
-          type = j.at("type").get<std::string>();
-          fileTypeKnown = true;
-        }
-        catch (std::exception&)
-        {
-        }
-
-        if (!fileTypeKnown)
-        {
-          try
-          {
-            for (json::iterator it = j.begin(); it != j.end(); ++it)
-            {
-              auto jtype = it->find("type");
-              if (jtype != it->end() && jtype.value() == "session")
-              {
-                type = it->find("name").value().get<std::string>();
-                fileTypeKnown = true;
-              }
-            }
-          }
-          catch (std::exception&)
-          {
-          }
-        }
-
-        if (!fileTypeKnown)
-        {
-          smtkErrorMacro(
-            this->log(), "Could not determine resource type for file \"" << filename << "\".");
-          return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-        }
-      }
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
 
     smtk::operation::Operation::Ptr readOperation = readerGroup.readerForResource(type);
@@ -159,12 +198,51 @@ ReadResource::Result ReadResource::operateInternal()
       readerGroup.fileItemNameForOperation(readOperation->index()));
     readerFileItem->setValue(filename);
 
-    // Run the local read internally using Key (do not fire observers) and
-    // copy the output resources into our result.
-    smtk::operation::Operation::Result readOperationResult = readOperation->operate(Key{});
+    filenames.push_back(filename);
+    readOperations.push_back(readOperation);
+  }
+
+  // II. Run the local reads internally using Key (do not fire observers).
+  //     Resources are independent files, so when there is more than one
+  //     they are read concurrently.
+  std::vector<smtk::operation::Operation::Result> readResults(readOperations.size());
+  std::vector<double> timings(readOperations.size(), 0.0);
+  auto readOne = [&readOperations, &readResults, &timings](std::size_t ii) {
+    auto start = std::chrono::steady_clock::now();
+    readResults[ii] = readOperations[ii]->operate(Key{});
+    timings[ii] =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  auto parallelItem = this->parameters()->findVoid("parallel");
+  bool parallel = readOperations.size() > 1 && parallelItem && parallelItem->isEnabled();
+  if (parallel)
+  {
+    smtk::common::forEachChunk(
+      readOperations.size(), 1, [&readOne](std::size_t ii, std::size_t, std::size_t) {
+        readOne(ii);
+      });
+  }
+  else
+  {
+    for (std::size_t ii = 0; ii < readOperations.size(); ++ii)
+    {
+      readOne(ii);
+    }
+  }
+
+  // III. Copy the output resources (in the order requested) into our result.
+  Result result = this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
+  smtk::attribute::ResourceItem::Ptr created = result->findResource("resource");
+  auto hints = result->findReference("hints");
+  auto timingItem = result->findDouble("timings");
+  std::vector<smtk::resource::ResourcePtr> resources;
+  for (std::size_t ii = 0; ii < readOperations.size(); ++ii)
+  {
+    const auto& readOperationResult = readResults[ii];
     if (
+      !readOperationResult ||
       readOperationResult->findInt("outcome")->value() !=
-      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
+        static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
     {
       // An error message should already enter the logger from the local
       // operation.
@@ -174,13 +252,16 @@ ReadResource::Result ReadResource::operateInternal()
     smtk::resource::ResourcePtr resource = readOperationResult->findResource("resource")->value();
     if (resource == nullptr)
     {
-      smtkErrorMacro(
-        this->log(), "Error reading file \"" << filename << "\" (type = " << type << ").");
+      smtkErrorMacro(this->log(), "Error reading file \"" << filenames[ii] << "\".");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
 
-    smtk::attribute::ResourceItem::Ptr created = result->findResource("resource");
     created->appendValue(resource);
+    resources.push_back(resource);
+    if (timingItem)
+    {
+      timingItem->appendValue(timings[ii]);
+    }
 
     // Reference hints from the internal reader's results to our results:
     if (auto readHints = readOperationResult->findReference("hints"))
@@ -192,6 +273,31 @@ ReadResource::Result ReadResource::operateInternal()
     }
   }
 
+  // IV. Now that all of the resources are present, resolve links between them
+  //     so surrogates need not be fetched from the resource manager later.
+  //     Resources are indexed by id so each surrogate is visited only once.
+  if (resources.size() > 1)
+  {
+    std::unordered_map<smtk::common::UUID, smtk::resource::ResourcePtr> resourcesById;
+    for (const auto& resource : resources)
+    {
+      resourcesById[resource->id()] = resource;
+    }
+    for (const auto& lhs : resources)
+    {
+      for (const auto& link : lhs->links().data())
+      {
+        auto rhs = resourcesById.find(link.right);
+        if (
+          rhs != resourcesById.end() && rhs->second != lhs &&
+          link.typeName() == rhs->second->typeName())
+        {
+          link.resolve(rhs->second);
+        }
+      }
+    }
+  }
+
   return result;
 }
 
@@ -44,6 +44,11 @@ inline PySharedPtrClass< smtk::operation::Operation, smtk::operation::PyOperatio
     .def("createResult", &smtk::operation::Operation::createResult, py::arg("arg0"))
     .def("manager", &smtk::operation::Operation::manager)
     .def("managers", &smtk::operation::Operation::managers)
+    .def("cancel", &smtk::operation::Operation::cancel)
+    .def("cancelRequested", &smtk::operation::Operation::cancelRequested)
+    .def("lightweightResults", &smtk::operation::Operation::lightweightResults)
+    .def("setLightweightResults", &smtk::operation::Operation::setLightweightResults, py::arg("lightweight"))
+    .def("completeResult", &smtk::operation::Operation::completeResult, py::arg("result"))
     .def("restoreTrace", (bool (smtk::operation::Operation::*)(::std::string const &)) &smtk::operation::Operation::restoreTrace)
     ;
   py::enum_<smtk::operation::Operation::Outcome>(instance, "Outcome")
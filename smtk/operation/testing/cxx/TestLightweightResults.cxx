@@ -0,0 +1,186 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/operation/Operation.h"
+#include "smtk/operation/XMLOperation.h"
+
+#include "nlohmann/json.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+// An operation that logs a message and counts how many times it has run.
+class CountOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(CountOperation);
+  smtkCreateMacro(CountOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  CountOperation() = default;
+  ~CountOperation() override = default;
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+
+  int m_executions{ 0 };
+};
+
+CountOperation::Result CountOperation::operateInternal()
+{
+  ++m_executions;
+  smtkInfoMacro(this->log(), "execution " << m_executions);
+  auto result = this->createResult(Outcome::SUCCEEDED);
+  result->findInt("count")->setValue(m_executions);
+  return result;
+}
+
+const char countOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeSystem Version=\"2\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"CountOperation\" Label=\"Count Operation\" BaseType=\"operation\">"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(CountOperation)\" BaseType=\"result\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"count\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeSystem>";
+
+const char* CountOperation::xmlDescription() const
+{
+  return countOperationXML;
+}
+
+// Return the messages serialized into a result's log.
+std::vector<std::string> messagesOf(const smtk::operation::Operation::Result& result)
+{
+  std::vector<std::string> messages;
+  auto log = result->findString("log");
+  for (std::size_t ii = 0; ii < log->numberOfValues(); ++ii)
+  {
+    nlohmann::json j = nlohmann::json::parse(log->value(ii));
+    for (const auto& record : j)
+    {
+      messages.push_back(record["message"].get<std::string>());
+    }
+  }
+  return messages;
+}
+} // namespace
+
+int TestLightweightResults(int /*unused*/, char** const /*unused*/)
+{
+  auto operation = CountOperation::create();
+  smtkTest(!!operation, "Could not create operation.");
+
+  // Complete results hold only the log records produced by their operation.
+  smtkInfoMacro(smtk::io::Logger::instance(), "unrelated");
+  auto result = operation->operate();
+  auto messages = messagesOf(result);
+  smtkTest(messages.size() == 2, "Expected 2 log messages, got " << messages.size());
+  smtkTest(messages[0] == "execution 1", "Unexpected message \"" << messages[0] << "\".");
+  smtkTest(
+    messages[1] == "CountOperation: operation succeeded",
+    "Unexpected summary \"" << messages[1] << "\".");
+  operation->completeResult(result);
+  smtkTest(messagesOf(result).size() == 2, "Completing a complete result should do nothing.");
+  operation->releaseResult(result);
+
+  // Lightweight results defer their summary and log until completed.
+  operation->setLightweightResults(true);
+  std::size_t numberOfRecords = smtk::io::Logger::instance().numberOfRecords();
+  result = operation->operate();
+  smtkTest(
+    result->findString("log")->numberOfValues() == 0, "Lightweight result should have no log.");
+  smtkTest(
+    smtk::io::Logger::instance().numberOfRecords() == numberOfRecords + 1,
+    "Lightweight result should not be summarized.");
+  operation->completeResult(result);
+  messages = messagesOf(result);
+  smtkTest(messages.size() == 2, "Expected 2 log messages, got " << messages.size());
+  smtkTest(messages[0] == "execution 2", "Unexpected message \"" << messages[0] << "\".");
+  smtkTest(
+    messages[1] == "CountOperation: operation succeeded",
+    "Unexpected summary \"" << messages[1] << "\".");
+  operation->completeResult(result);
+  smtkTest(messagesOf(result).size() == 2, "A result should only be completed once.");
+
+  // Released lightweight results are reset and reused.
+  const smtk::attribute::Attribute* recycled = result.get();
+  operation->releaseResult(result);
+  smtkTest(
+    recycled->findString("log")->numberOfValues() == 0 &&
+      recycled->findInt("count")->value() == 0,
+    "Released result should be reset.");
+  result = operation->operate();
+  smtkTest(result.get() == recycled, "Released result should be reused.");
+  smtkTest(result->findInt("count")->value() == 3, "Reused result holds the wrong count.");
+  operation->releaseResult(result);
+
+  // Results released by safeOperate() are recycled too.
+  for (int ii = 0; ii < 10; ++ii)
+  {
+    operation->safeOperate(
+      [recycled](smtk::operation::Operation&, const smtk::operation::Operation::Result& result) {
+        smtkTest(result.get() == recycled, "Expected safeOperate() to reuse its result.");
+      });
+  }
+  smtkTest(operation->m_executions == 13, "Expected 13 executions.");
+
+  // Each outstanding lightweight result keeps its own log records, whatever
+  // order they are completed in.
+  auto first = operation->operate();
+  auto second = operation->operate();
+  operation->completeResult(second);
+  operation->completeResult(first);
+  messages = messagesOf(first);
+  smtkTest(
+    messages.size() == 2 && messages[0] == "execution 14",
+    "Unexpected log for the first outstanding result.");
+  messages = messagesOf(second);
+  smtkTest(
+    messages.size() == 2 && messages[0] == "execution 15",
+    "Unexpected log for the second outstanding result.");
+  operation->releaseResult(first);
+  operation->releaseResult(second);
+
+  return 0;
+}
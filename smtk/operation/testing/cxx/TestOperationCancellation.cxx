@@ -0,0 +1,179 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+
+#include "smtk/operation/Launcher.h"
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Operation.h"
+#include "smtk/operation/XMLOperation.h"
+
+#include <future>
+#include <string>
+#include <vector>
+
+namespace
+{
+// An operation that performs a number of steps, reporting progress after each
+// one and stopping early if it is canceled.
+class StepOperation : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(StepOperation);
+  smtkCreateMacro(StepOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  StepOperation() = default;
+  ~StepOperation() override = default;
+
+  Result operateInternal() override;
+
+  const char* xmlDescription() const override;
+
+  int m_executions{ 0 };
+};
+
+StepOperation::Result StepOperation::operateInternal()
+{
+  ++m_executions;
+  int steps = this->parameters()->findInt("steps")->value();
+  auto result = this->createResult(Outcome::SUCCEEDED);
+  auto completed = result->findInt("completed");
+  for (int ii = 0; ii < steps; ++ii)
+  {
+    completed->setValue(ii + 1);
+    if (!this->reportProgress(
+          static_cast<double>(ii + 1) / steps, "step " + std::to_string(ii + 1)))
+    {
+      result->findInt("outcome")->setValue(static_cast<int>(Outcome::CANCELED));
+      break;
+    }
+  }
+  return result;
+}
+
+const char stepOperationXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeSystem Version=\"2\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <String Name=\"log\" Optional=\"True\" NumberOfRequiredValues=\"0\" Extensible=\"True\">"
+  "        </String>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"StepOperation\" Label=\"Step Operation\" BaseType=\"operation\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"steps\" Optional=\"False\">"
+  "          <DefaultValue>10</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(StepOperation)\" BaseType=\"result\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"completed\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeSystem>";
+
+const char* StepOperation::xmlDescription() const
+{
+  return stepOperationXML;
+}
+
+smtk::operation::Operation::Outcome outcomeOf(const smtk::operation::Operation::Result& result)
+{
+  return smtk::operation::Operation::Outcome(result->findInt("outcome")->value());
+}
+} // namespace
+
+int TestOperationCancellation(int /*unused*/, char** const /*unused*/)
+{
+  auto operationManager = smtk::operation::Manager::create();
+  operationManager->registerOperation<StepOperation>("StepOperation");
+
+  auto operation = operationManager->create<StepOperation>();
+  smtkTest(!!operation, "Could not create operation.");
+
+  // Progress is reported after each step.
+  std::vector<double> fractions;
+  std::string lastMessage;
+  operation->setProgressHandler(
+    [&](const smtk::operation::Operation&, double fraction, const std::string& message) {
+      fractions.push_back(fraction);
+      lastMessage = message;
+    });
+  auto result = operation->operate();
+  smtkTest(
+    outcomeOf(result) == smtk::operation::Operation::Outcome::SUCCEEDED,
+    "Operation should succeed.");
+  smtkTest(fractions.size() == 10, "Expected 10 progress reports, got " << fractions.size());
+  smtkTest(fractions.back() == 1., "Expected the last report to be complete.");
+  smtkTest(lastMessage == "step 10", "Unexpected progress message \"" << lastMessage << "\".");
+
+  // A running operation stops at its next safe point and keeps its partial result.
+  operation->setProgressHandler(
+    [&operation](const smtk::operation::Operation&, double fraction, const std::string&) {
+      if (fraction > 0.25)
+      {
+        operation->cancel();
+      }
+    });
+  result = operation->operate();
+  smtkTest(
+    outcomeOf(result) == smtk::operation::Operation::Outcome::CANCELED,
+    "Operation should be canceled.");
+  smtkTest(
+    result->findInt("completed")->value() == 3,
+    "Expected 3 completed steps, got " << result->findInt("completed")->value());
+
+  // Each invocation begins by discarding requests made while the operation
+  // was not running, including the one made during the previous invocation.
+  operation->setProgressHandler(nullptr);
+  operation->cancel();
+  smtkTest(operation->cancelRequested(), "Cancellation should be pending.");
+  int executions = operation->m_executions;
+  result = operation->operate();
+  smtkTest(
+    outcomeOf(result) == smtk::operation::Operation::Outcome::SUCCEEDED,
+    "A request made before operating should be discarded.");
+  smtkTest(operation->m_executions == executions + 1, "Operation should execute.");
+  smtkTest(
+    result->findInt("completed")->value() == 10,
+    "Expected 10 completed steps, got " << result->findInt("completed")->value());
+
+  // Launchers pass progress to the given handler.
+  std::size_t reports = 0;
+  std::shared_future<smtk::operation::Operation::Result> future = operationManager->launchers()(
+    operation,
+    "default",
+    [&reports](const smtk::operation::Operation&, double, const std::string&) { ++reports; });
+  smtkTest(
+    outcomeOf(future.get()) == smtk::operation::Operation::Outcome::SUCCEEDED,
+    "Launched operation should succeed.");
+  smtkTest(reports == 10, "Expected 10 progress reports from launched operation, got " << reports);
+
+  return 0;
+}
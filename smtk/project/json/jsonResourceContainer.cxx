@@ -10,8 +10,12 @@
 #include "smtk/project/json/jsonResourceContainer.h"
 
 #include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/DoubleItem.h"
 #include "smtk/attribute/FileItem.h"
 #include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/VoidItem.h"
+
+#include "smtk/io/Logger.h"
 
 #include "smtk/resource/Manager.h"
 #include "smtk/resource/json/jsonResource.h"
@@ -24,6 +28,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+
 namespace
 {
 void replaceWindowsSeparators(boost::filesystem::path& path)
@@ -75,11 +81,14 @@ void from_json(const json& j, ResourceContainer& resourceContainer, const Projec
     std::cerr << "Could not find ReadResource Operation\n";
     return;
   }
+  // A project's resources are independent files, so read them concurrently.
+  reader->parameters()->findVoid("parallel")->setIsEnabled(true);
+
   // get the base path of the project
   std::string projectPath = project->location();
   boost::filesystem::path parentPath = boost::filesystem::path(projectPath).parent_path();
-  smtk::resource::ResourcePtr resource;
 
+  std::vector<std::string> locations;
   for (json::const_iterator it = j["resources"].begin(); it != j["resources"].end(); ++it)
   {
     std::string location = it->at("location").get<std::string>();
@@ -89,24 +98,63 @@ void from_json(const json& j, ResourceContainer& resourceContainer, const Projec
       locationPath = boost::filesystem::absolute(locationPath, parentPath);
     }
     replaceWindowsSeparators(locationPath);
+    locations.push_back(locationPath.string());
+  }
+  if (locations.empty())
+  {
+    return;
+  }
 
-    reader->parameters()
-      ->findAs<smtk::attribute::FileItem>("filename")
-      ->setValue(locationPath.string());
+  auto readResources = [&reader](const std::vector<std::string>& filenames) {
+    std::vector<smtk::resource::ResourcePtr> resources;
+    auto filenameItem = reader->parameters()->findAs<smtk::attribute::FileItem>("filename");
+    filenameItem->setValues(filenames.begin(), filenames.end());
     auto result = reader->operate(*smtk::operation::Helper::instance().key());
     if (smtk::operation::outcome(result) == smtk::operation::Operation::Outcome::SUCCEEDED)
     {
-      resource = result->findAs<smtk::attribute::ResourceItem>("resource")->value();
+      auto resourceItem = result->findAs<smtk::attribute::ResourceItem>("resource");
+      auto timingItem = result->findDouble("timings");
+      for (std::size_t ii = 0; ii < resourceItem->numberOfValues(); ++ii)
+      {
+        resources.push_back(resourceItem->value(ii));
+        if (timingItem && ii < timingItem->numberOfValues() && resources.back())
+        {
+          smtkDebugMacro(
+            smtk::io::Logger::instance(),
+            "Read \"" << resources.back()->name() << "\" in " << timingItem->value(ii) << " s.");
+        }
+      }
     }
     else
     {
       std::cerr << "ReadResource Operation did not succeed - outcome was: "
                 << static_cast<int>(smtk::operation::outcome(result)) << std::endl;
     }
-    if (!resource)
+    return resources;
+  };
+
+  // Read all of the project's resources at once (so they may be loaded concurrently
+  // and links between them resolved). If that fails, read them one at a time so
+  // that a single unreadable resource does not prevent the others from loading.
+  std::vector<smtk::resource::ResourcePtr> resources = readResources(locations);
+  if (resources.empty() && locations.size() > 1)
+  {
+    for (const auto& location : locations)
     {
-      continue;
+      auto single = readResources({ location });
+      resources.insert(resources.end(), single.begin(), single.end());
     }
+  }
+
+  // Register the resources with the manager as one batch, so links between
+  // them are resolved and observers are notified once.
+  resources.erase(
+    std::remove(resources.begin(), resources.end(), smtk::resource::ResourcePtr()),
+    resources.end());
+  manager->add(resources);
+
+  for (const auto& resource : resources)
+  {
     resource->setClean(true);
     resourceContainer.add(
       resource, resource->properties().get<std::string>()[ResourceContainer::role_name]);
@@ -15,6 +15,7 @@
 #include "smtk/resource/Manager.h"
 #include "smtk/resource/Resource.h"
 
+#include "smtk/common/UUIDContainers.h"
 #include "smtk/common/UUIDGenerator.h"
 
 namespace
@@ -62,15 +63,54 @@ Links::Key Links::addLinkTo(const ComponentPtr& rhs2, const RoleType& role)
     role);
 }
 
+std::vector<Links::Key> Links::addLinksTo(
+  const std::vector<ComponentPtr>& rhs2s,
+  const RoleType& role)
+{
+  return this->addLinksTo(
+    this->leftHandSideResource(), this->leftHandSideComponentId(), rhs2s, role);
+}
+
 PersistentObjectSet Links::linkedFrom(const RoleType& role) const
 {
-  return this->linkedFrom(this->leftHandSideResource(), this->leftHandSideComponentId(), role);
+  PersistentObjectSet objectSet;
+  this->linkedFrom(
+    this->leftHandSideResource(),
+    this->leftHandSideComponentId(),
+    role,
+    [&objectSet](PersistentObject& object) {
+      objectSet.insert(object.shared_from_this());
+      return smtk::common::Visit::Continue;
+    });
+  return objectSet;
+}
+
+PersistentObjectSet Links::linkedFrom(const ResourcePtr& lhs1, const RoleType& role) const
+{
+  PersistentObjectSet objectSet;
+  this->linkedFrom(
+    lhs1,
+    this->leftHandSideResource(),
+    this->leftHandSideComponentId(),
+    role,
+    [&objectSet](PersistentObject& object) {
+      objectSet.insert(object.shared_from_this());
+      return smtk::common::Visit::Continue;
+    });
+  return objectSet;
+}
+
+smtk::common::Visited Links::linkedFrom(const RoleType& role, const Visitor& visitor) const
+{
+  return this->linkedFrom(
+    this->leftHandSideResource(), this->leftHandSideComponentId(), role, visitor);
 }
 
-PersistentObjectSet Links::linkedFrom(const ResourcePtr& rhs1, const RoleType& role) const
+smtk::common::Visited
+Links::linkedFrom(const ResourcePtr& lhs1, const RoleType& role, const Visitor& visitor) const
 {
   return this->linkedFrom(
-    rhs1, this->leftHandSideResource(), this->leftHandSideComponentId(), role);
+    lhs1, this->leftHandSideResource(), this->leftHandSideComponentId(), role, visitor);
 }
 
 bool Links::removeLink(const Key& key)
@@ -98,11 +138,29 @@ bool Links::removeLinksTo(const ComponentPtr& rhs2, const RoleType& role)
     role);
 }
 
+bool Links::removeLinksTo(const std::vector<ComponentPtr>& rhs2s, const RoleType& role)
+{
+  bool removed = false;
+  for (const auto& rhs2 : rhs2s)
+  {
+    if (rhs2)
+    {
+      removed |= this->removeLinksTo(rhs2, role);
+    }
+  }
+  return removed;
+}
+
 std::pair<PersistentObjectPtr, Links::RoleType> Links::linkedObjectAndRole(const Key& key) const
 {
   return this->linkedObjectAndRole(this->leftHandSideResource(), key);
 }
 
+std::vector<PersistentObjectPtr> Links::linkedObjects(const std::vector<Key>& keys) const
+{
+  return this->linkedObjects(this->leftHandSideResource(), keys);
+}
+
 std::pair<smtk::common::UUID, Links::RoleType> Links::linkedObjectIdAndRole(const Key& key) const
 {
   return this->linkedObjectIdAndRole(this->leftHandSideResource(), key);
@@ -115,7 +173,22 @@ LinkInformation Links::linkedObjectInformation(const Key& key) const
 
 PersistentObjectSet Links::linkedTo(const RoleType& role) const
 {
-  return this->linkedTo(this->leftHandSideResource(), this->leftHandSideComponentId(), role);
+  PersistentObjectSet objectSet;
+  this->linkedTo(
+    this->leftHandSideResource(),
+    this->leftHandSideComponentId(),
+    role,
+    [&objectSet](PersistentObject& object) {
+      objectSet.insert(object.shared_from_this());
+      return smtk::common::Visit::Continue;
+    });
+  return objectSet;
+}
+
+smtk::common::Visited Links::linkedTo(const RoleType& role, const Visitor& visitor) const
+{
+  return this->linkedTo(
+    this->leftHandSideResource(), this->leftHandSideComponentId(), role, visitor);
 }
 
 const smtk::common::UUID& Links::leftHandSideComponentId() const
@@ -155,8 +228,13 @@ bool Links::isLinkedTo(
   // connects this component to the input resource. If it doesn't exist, then
   // there is no link.
   const Component::Links::Data& componentLinkData = *resourceRange.first;
-  auto linkedTo = componentLinkData.linked_to<Component::Links::Data::Left>(lhs2, role);
-  return (linkedTo.find(rhs2) != linkedTo.end());
+  bool found = false;
+  componentLinkData.visit_links<Component::Links::Data::Left>(
+    lhs2, role, [&rhs2, &found](const Component::Links::Data::Link& link) {
+      found = (link.right == rhs2);
+      return found ? smtk::common::Visit::Halt : smtk::common::Visit::Continue;
+    });
+  return found;
 }
 
 Links::Key Links::addLinkTo(
@@ -225,15 +303,77 @@ Links::Key Links::addLinkTo(
   return std::make_pair(resourceLinkId, componentLinkId);
 }
 
-PersistentObjectSet
-Links::linkedTo(const Resource* lhs1, const smtk::common::UUID& lhs2, const RoleType& role) const
+std::vector<Links::Key> Links::addLinksTo(
+  Resource* lhs1,
+  const smtk::common::UUID& lhs2,
+  const std::vector<ComponentPtr>& rhs2s,
+  const RoleType& role)
+{
+  typedef Resource::Links::ResourceLinkData ResourceLinkData;
+  ResourceLinkData& resourceLinkData = lhs1->links().data();
+  auto& resourceLinks = resourceLinkData.get<ResourceLinkData::Right>();
+
+  std::vector<Key> keys(rhs2s.size());
+  smtk::common::UUIDArray componentLinkIds =
+    smtk::common::UUIDGenerator::instance().random(rhs2s.size());
+
+  // Components are usually owned by a small number of resources, so remember
+  // the resource link (and its component link data) for the last resource seen.
+  const Resource* lastResource = nullptr;
+  smtk::common::UUID resourceLinkId;
+  Component::Links::Data* componentLinkData = nullptr;
+  for (std::size_t ii = 0; ii < rhs2s.size(); ++ii)
+  {
+    const auto& rhs2 = rhs2s[ii];
+    auto rhs1 = rhs2 ? rhs2->resource() : ResourcePtr();
+    if (!rhs1)
+    {
+      continue;
+    }
+    if (rhs1.get() != lastResource)
+    {
+      auto resourceRange = resourceLinks.equal_range(rhs1->id());
+      if (resourceRange.first == resourceRange.second)
+      {
+        resourceLinkId = smtk::common::UUIDGenerator::instance().random();
+        while (resourceLinkData.contains(resourceLinkId))
+        {
+          resourceLinkId = smtk::common::UUIDGenerator::instance().random();
+        }
+        resourceLinkData.insert(
+          ResourceLinkData::LinkBase(rhs1), resourceLinkId, lhs1->id(), rhs1->id());
+      }
+      else
+      {
+        assert(std::distance(resourceRange.first, resourceRange.second) == 1);
+        resourceLinkId = resourceRange.first->id;
+      }
+      componentLinkData = &resourceLinkData.value(resourceLinkId);
+      lastResource = rhs1.get();
+    }
+
+    smtk::common::UUID& componentLinkId = componentLinkIds[ii];
+    while (!componentLinkData->insert(componentLinkId, lhs2, rhs2->id(), role).second)
+    {
+      componentLinkId = smtk::common::UUIDGenerator::instance().random();
+    }
+    keys[ii] = std::make_pair(resourceLinkId, componentLinkId);
+  }
+  return keys;
+}
+
+smtk::common::Visited Links::linkedTo(
+  const Resource* lhs1,
+  const smtk::common::UUID& lhs2,
+  const RoleType& role,
+  const Visitor& visitor) const
 {
   // Access the Resource Link data that connects this component's resource to
   // the input resource. If it doesn't exist, then there is no link.
   typedef Resource::Links::ResourceLinkData ResourceLinkData;
   const ResourceLinkData& resourceLinkData = lhs1->links().data();
 
-  PersistentObjectSet objectSet;
+  smtk::common::Visited result = smtk::common::Visited::Empty;
   for (const auto& resourceLink : resourceLinkData)
   {
     // Access the resource associated with this link. If it cannot be resolved,
@@ -245,37 +385,37 @@ Links::linkedTo(const Resource* lhs1, const smtk::common::UUID& lhs2, const Role
       continue;
     }
 
-    const auto& data = resourceLink.get<Component::Links::Data::Left>();
-    auto range = data.equal_range(std::make_tuple(lhs2, role));
-
-    for (auto& link = range.first; link != range.second; ++link)
-    {
-      if (link->right == linkToResource)
-      {
-        objectSet.insert(rhs1);
-      }
-      else
-      {
-        ComponentPtr comp = rhs1->find(link->right);
+    auto visited = resourceLink.visit_links<Component::Links::Data::Left>(
+      lhs2, role, [&rhs1, &visitor, &result](const Component::Links::Data::Link& link) {
+        if (link.right == linkToResource)
+        {
+          result = smtk::common::Visited::All;
+          return visitor(*rhs1);
+        }
+        ComponentPtr comp = rhs1->find(link.right);
         if (comp)
         {
-          objectSet.insert(comp);
+          result = smtk::common::Visited::All;
+          return visitor(*comp);
         }
-      }
+        return smtk::common::Visit::Continue;
+      });
+    if (visited == smtk::common::Visited::Some)
+    {
+      return visited;
     }
   }
 
-  return objectSet;
+  return result;
 }
 
-PersistentObjectSet Links::linkedFrom(
+smtk::common::Visited Links::linkedFrom(
   const ResourcePtr& lhs1,
   const Resource* rhs1,
   const smtk::common::UUID& rhs2,
-  const RoleType& role) const
+  const RoleType& role,
+  const Visitor& visitor) const
 {
-  PersistentObjectSet objectSet;
-
   // Access the Resource Link data that connects this component's resource to
   // the input resource. If it doesn't exist, then there is no link.
   typedef Resource::Links::ResourceLinkData ResourceLinkData;
@@ -289,7 +429,7 @@ PersistentObjectSet Links::linkedFrom(
   // If the range of resources is empty, then there is no link.
   if (resourceRange.first == resourceRange.second)
   {
-    return objectSet;
+    return smtk::common::Visited::Empty;
   }
 
   // There should be only one link connecting two resources. If there is more
@@ -301,49 +441,55 @@ PersistentObjectSet Links::linkedFrom(
   // there is no link.
   const Component::Links::Data& componentLinkData = *resourceRange.first;
 
-  const auto& data = componentLinkData.get<Component::Links::Data::Right>();
-  auto range = data.equal_range(std::make_tuple(rhs2, role));
-
-  for (auto& link = range.first; link != range.second; ++link)
-  {
-    if (link->left == linkToResource)
-    {
-      objectSet.insert(lhs1);
-    }
-    else
-    {
-      ComponentPtr comp = lhs1->find(link->left);
+  smtk::common::Visited result = smtk::common::Visited::Empty;
+  auto visited = componentLinkData.visit_links<Component::Links::Data::Right>(
+    rhs2, role, [&lhs1, &visitor, &result](const Component::Links::Data::Link& link) {
+      if (link.left == linkToResource)
+      {
+        result = smtk::common::Visited::All;
+        return visitor(*lhs1);
+      }
+      ComponentPtr comp = lhs1->find(link.left);
       if (comp)
       {
-        objectSet.insert(comp);
+        result = smtk::common::Visited::All;
+        return visitor(*comp);
       }
-    }
-  }
-
-  return objectSet;
+      return smtk::common::Visit::Continue;
+    });
+  return visited == smtk::common::Visited::Some ? visited : result;
 }
 
-PersistentObjectSet
-Links::linkedFrom(const Resource* rhs1, const smtk::common::UUID& rhs2, const RoleType& role) const
+smtk::common::Visited Links::linkedFrom(
+  const Resource* rhs1,
+  const smtk::common::UUID& rhs2,
+  const RoleType& role,
+  const Visitor& visitor) const
 {
-  PersistentObjectSet objectSet;
-
   // Access the manager managing this resource. If none exists, there's not much
   // we can do.
   smtk::resource::Manager::Ptr manager = rhs1->manager();
   if (manager == nullptr)
   {
-    return objectSet;
+    return smtk::common::Visited::Empty;
   }
 
-  manager->visit([this, &rhs1, &rhs2, &role, &objectSet](Resource& lhs1) {
-    PersistentObjectSet objectSetForResource =
-      this->linkedFrom(lhs1.shared_from_this(), rhs1, rhs2, role);
-    objectSet.insert(objectSetForResource.begin(), objectSetForResource.end());
+  smtk::common::Visited result = smtk::common::Visited::Empty;
+  manager->visit([this, &rhs1, &rhs2, &role, &visitor, &result](Resource& lhs1) {
+    auto visited = this->linkedFrom(lhs1.shared_from_this(), rhs1, rhs2, role, visitor);
+    if (visited == smtk::common::Visited::Some)
+    {
+      result = visited;
+      return common::Processing::STOP;
+    }
+    if (visited == smtk::common::Visited::All)
+    {
+      result = visited;
+    }
     return common::Processing::CONTINUE;
   });
 
-  return objectSet;
+  return result;
 }
 
 bool Links::removeLink(Resource* lhs1, const Links::Key& key)
@@ -437,6 +583,62 @@ std::pair<PersistentObjectPtr, Links::RoleType> Links::linkedObjectAndRole(
   }
 }
 
+std::vector<PersistentObjectPtr> Links::linkedObjects(
+  const Resource* lhs1,
+  const std::vector<Links::Key>& keys) const
+{
+  typedef Resource::Links::ResourceLinkData ResourceLinkData;
+  const ResourceLinkData& resourceLinkData = lhs1->links().data();
+  std::vector<PersistentObjectPtr> objects(keys.size());
+
+  // Group the keys by their resource link so that each linked resource is
+  // fetched (and its component index consulted) in a single pass.
+  smtk::common::UUIDHashMap<std::vector<std::size_t>> groups;
+  for (std::size_t ii = 0; ii < keys.size(); ++ii)
+  {
+    if (resourceLinkData.contains(keys[ii].first))
+    {
+      groups[keys[ii].first].push_back(ii);
+    }
+  }
+
+  for (const auto& group : groups)
+  {
+    const auto& resourceLink = resourceLinkData.value(group.first);
+
+    // Refresh the link using the manager, if one is available (see
+    // linkedObjectAndRole() above).
+    if (lhs1->manager() != nullptr)
+    {
+      resourceLink.fetch(lhs1->manager());
+    }
+
+    auto resource = resourceLink.resource();
+    if (resource == nullptr)
+    {
+      continue;
+    }
+
+    for (const auto& index : group.second)
+    {
+      if (!resourceLink.contains(keys[index].second))
+      {
+        continue;
+      }
+      const auto& componentLink = resourceLink.at(keys[index].second);
+      if (componentLink.right == linkToResource)
+      {
+        objects[index] = resource;
+      }
+      else
+      {
+        objects[index] = resource->find(componentLink.right);
+      }
+    }
+  }
+  return objects;
+}
+
 std::pair<smtk::common::UUID, Links::RoleType> Links::linkedObjectIdAndRole(
   const Resource* lhs1,
   const Links::Key& key) const
@@ -14,6 +14,10 @@
 #include "smtk/CoreExports.h"
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/common/UUID.h"
+#include "smtk/common/Visit.h"
+
+#include <functional>
+#include <vector>
 
 namespace smtk
 {
@@ -34,6 +38,11 @@ public:
   typedef std::pair<smtk::common::UUID, smtk::common::UUID> Key;
   typedef int RoleType;
 
+  /// A functor invoked on linked objects by the visitor variants of
+  /// linkedTo() and linkedFrom(). Return smtk::common::Visit::Halt to
+  /// stop visiting objects.
+  using Visitor = std::function<smtk::common::Visit(PersistentObject&)>;
+
   /// Given a resource or component and a role, check if a link of this role type
   /// exists between us and the input object.
   bool isLinkedTo(const ResourcePtr&, const RoleType&) const;
@@ -46,9 +55,21 @@ public:
   Key addLinkTo(const ResourcePtr&, const RoleType&);
   Key addLinkTo(const ComponentPtr&, const RoleType&);
 
+  /// Construct a link of the given role type from us to each of the input
+  /// components. This is much faster than calling addLinkTo() for each
+  /// component since the resource-level link for each resource is found once.
+  /// The returned keys are in the same order as the input components (null
+  /// keys are returned for null components).
+  std::vector<Key> addLinksTo(const std::vector<ComponentPtr>&, const RoleType&);
+
   /// Given a role, return a set of objects to which this object links.
   PersistentObjectSet linkedTo(const RoleType&) const;
 
+  /// Given a role, invoke \a visitor on each object to which this object links.
+  /// Unlike the method above, no set of objects is constructed. Note that an
+  /// object will be visited once per link to it.
+  smtk::common::Visited linkedTo(const RoleType&, const Visitor& visitor) const;
+
   /// Given a role and a resource corresponding to the rhs of a link, return a
   /// set of objects from the rhs that link to this object using this role type.
   PersistentObjectSet linkedFrom(const ResourcePtr&, const RoleType&) const;
@@ -60,6 +81,14 @@ public:
   /// with this link object is not managed, this method returns an empty set.
   PersistentObjectSet linkedFrom(const RoleType&) const;
 
+  ///@{
+  /// Visitor variants of the linkedFrom() methods above. No set of objects is
+  /// constructed; an object will be visited once per link it holds to this object.
+  smtk::common::Visited linkedFrom(const ResourcePtr&, const RoleType&, const Visitor& visitor)
+    const;
+  smtk::common::Visited linkedFrom(const RoleType&, const Visitor& visitor) const;
+  ///@}
+
   /// Given a Link key, remove the associated link. Return true if successful.
   bool removeLink(const Key&);
 
@@ -68,11 +97,20 @@ public:
   bool removeLinksTo(const ResourcePtr&, const RoleType&);
   bool removeLinksTo(const ComponentPtr&, const RoleType&);
 
+  /// Remove all links of the given role type from this object to each of the
+  /// input components. Return true if any link was removed.
+  bool removeLinksTo(const std::vector<ComponentPtr>&, const RoleType&);
+
   /// Given a Link key, return the object and role to which this object is
   /// linked, or return nullptr if no link exists with this link id.
   std::pair<PersistentObjectPtr, RoleType> linkedObjectAndRole(const Key&) const;
   PersistentObjectPtr linkedObject(const Key& key) const { return linkedObjectAndRole(key).first; }
 
+  /// Given many Link keys, return the object to which each key links (or
+  /// nullptr for keys that do not resolve). Keys are grouped by the resource
+  /// they link to so that each linked resource is fetched only once.
+  std::vector<PersistentObjectPtr> linkedObjects(const std::vector<Key>& keys) const;
+
   /// Given a Link key, return the id and role to which this object is linked,
   /// or return a null id if no link exists with this link id. This method is
   /// similar to linkedObjectAndRole() but does not require the link to
@@ -106,17 +144,30 @@ private:
     const smtk::common::UUID& rhs2,
     const RoleType& role);
 
-  PersistentObjectSet
-  linkedTo(const Resource* lhs1, const smtk::common::UUID& lhs2, const RoleType& role) const;
+  std::vector<Key> addLinksTo(
+    Resource* lhs1,
+    const smtk::common::UUID& lhs2,
+    const std::vector<ComponentPtr>& rhs2s,
+    const RoleType& role);
+
+  smtk::common::Visited linkedTo(
+    const Resource* lhs1,
+    const smtk::common::UUID& lhs2,
+    const RoleType& role,
+    const Visitor& visitor) const;
 
-  PersistentObjectSet linkedFrom(
+  smtk::common::Visited linkedFrom(
     const ResourcePtr& lhs1,
     const Resource* rhs1,
     const smtk::common::UUID& rhs2,
-    const RoleType& role) const;
+    const RoleType& role,
+    const Visitor& visitor) const;
 
-  PersistentObjectSet
-  linkedFrom(const Resource* rhs1, const smtk::common::UUID& rhs2, const RoleType& role) const;
+  smtk::common::Visited linkedFrom(
+    const Resource* rhs1,
+    const smtk::common::UUID& rhs2,
+    const RoleType& role,
+    const Visitor& visitor) const;
 
   bool removeLink(Resource* lhs1, const Key& key);
 
@@ -130,6 +181,8 @@ private:
   std::pair<PersistentObjectPtr, Links::RoleType> linkedObjectAndRole(const Resource*, const Key&)
     const;
 
+  std::vector<PersistentObjectPtr> linkedObjects(const Resource*, const std::vector<Key>&) const;
+
   std::pair<smtk::common::UUID, Links::RoleType> linkedObjectIdAndRole(const Resource*, const Key&)
     const;
 
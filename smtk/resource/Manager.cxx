@@ -89,13 +89,21 @@ bool Manager::registered(const Resource::Index& index) const
 
 void Manager::clear()
 {
-  ScopedLockGuard guard(m_lock, LockType::Write);
-  for (auto resourceIt = m_resources.begin(); resourceIt != m_resources.end();)
+  std::vector<ResourcePtr> removed;
   {
-    Resource::Ptr resource = *resourceIt;
-    resourceIt = m_resources.erase(resourceIt);
+    ScopedLockGuard guard(m_lock, LockType::Write);
+    for (auto resourceIt = m_resources.begin(); resourceIt != m_resources.end();)
+    {
+      Resource::Ptr resource = *resourceIt;
+      resourceIt = m_resources.erase(resourceIt);
 
-    m_observers(*resource, smtk::resource::EventType::REMOVED);
+      m_observers(*resource, smtk::resource::EventType::REMOVED);
+      removed.push_back(resource);
+    }
+  }
+  if (!removed.empty())
+  {
+    m_batchObservers(removed, smtk::resource::EventType::REMOVED);
   }
 }
 
@@ -492,10 +500,75 @@ bool Manager::add(const Resource::Index& index, const smtk::resource::ResourcePt
 
   // Tell observers we just added a resource:
   m_observers(*resource, smtk::resource::EventType::ADDED);
+  m_batchObservers(std::vector<ResourcePtr>{ resource }, smtk::resource::EventType::ADDED);
 
   return true;
 }
 
+bool Manager::add(const std::vector<smtk::resource::ResourcePtr>& resources)
+{
+  bool allAdded = true;
+  std::vector<smtk::resource::ResourcePtr> added;
+  {
+    ScopedLockGuard guard(m_lock, LockType::Write);
+    typedef Container::index<IdTag>::type ResourcesById;
+    ResourcesById& resourcesById = m_resources.get<IdTag>();
+    for (const auto& resource : resources)
+    {
+      if (!resource)
+      {
+        allAdded = false;
+        continue;
+      }
+
+      // If the manager cannot manage a resource of this type, do not add
+      if (m_metadata.get<IndexTag>().find(resource->index()) == m_metadata.get<IndexTag>().end())
+      {
+        smtkErrorMacro(
+          smtk::io::Logger::instance(),
+          "Resource manager " << this << " is refusing to add resource " << resource
+                              << " of type \"" << resource->typeName() << "\" "
+                              << "as that type has not been registered.");
+        allAdded = false;
+        continue;
+      }
+
+      // If the manager already contains this resource, there is nothing to do
+      if (resourcesById.find(resource->id()) != resourcesById.end())
+      {
+        continue;
+      }
+
+      resource->m_manager = this->shared_from_this();
+      m_resources.insert(resource);
+      added.push_back(resource);
+    }
+
+    // Resolve resource surrogate links between the new resources and all
+    // managed resources (including each other) once every one is present.
+    for (const auto& resource : added)
+    {
+      for (const auto& rsrc : m_resources)
+      {
+        resource->links().resolve(rsrc);
+        rsrc->links().resolve(resource);
+      }
+    }
+  }
+
+  // Tell observers we just added the resources:
+  for (const auto& resource : added)
+  {
+    m_observers(*resource, smtk::resource::EventType::ADDED);
+  }
+  if (!added.empty())
+  {
+    m_batchObservers(added, smtk::resource::EventType::ADDED);
+  }
+
+  return allAdded;
+}
+
 bool Manager::remove(const smtk::resource::ResourcePtr& resource)
 {
   bool didRemove = false;
@@ -523,6 +596,7 @@ bool Manager::remove(const smtk::resource::ResourcePtr& resource)
   {
     // Tell observers we have removed it *after* unlocking the manager.
     m_observers(*resource, smtk::resource::EventType::REMOVED);
+    m_batchObservers(std::vector<ResourcePtr>{ resource }, smtk::resource::EventType::REMOVED);
   }
 
   return didRemove;
@@ -31,6 +31,7 @@
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 namespace smtk
 {
@@ -205,6 +206,13 @@ public:
   /// Returns true if the resource was added or already is part of this manager.
   bool add(const ResourcePtr&);
 
+  /// Add several resources at once. The manager is locked once while links
+  /// between the new and managed resources are resolved, and batch observers
+  /// are notified once of all the newly added resources (observers of
+  /// individual resources are still told about each one). Returns true if
+  /// every resource was added or already is part of this manager.
+  bool add(const std::vector<ResourcePtr>&);
+
   /// Removes a resource from a given Manager. This doesn't explicitly release
   /// the memory of the resource, it only stops the tracking of the resource
   /// by the manager.
@@ -286,6 +294,11 @@ public:
   Observers& observers() { return m_observers; }
   const Observers& observers() const { return m_observers; }
 
+  /// Return the observers told once about each group of resources added to
+  /// or removed from this manager.
+  BatchObservers& batchObservers() { return m_batchObservers; }
+  const BatchObservers& batchObservers() const { return m_batchObservers; }
+
   /// Return the metadata observers associated with this manager.
   Metadata::Observers& metadataObservers() { return m_metadataObservers; }
   const Metadata::Observers& metadataObservers() const { return m_metadataObservers; }
@@ -338,6 +351,9 @@ private:
   /// A container for all resource observers.
   Observers m_observers;
 
+  /// A container for all resource batch observers.
+  BatchObservers m_batchObservers;
+
   /// A container for all resource metadata observers.
   Metadata::Observers m_metadataObservers;
 
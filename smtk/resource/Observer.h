@@ -13,6 +13,8 @@
 #include "smtk/common/Observers.h"
 #include "smtk/resource/Resource.h"
 
+#include <vector>
+
 namespace smtk
 {
 namespace resource
@@ -29,6 +31,12 @@ enum class EventType
 typedef std::function<void(const Resource&, EventType)> Observer;
 
 typedef smtk::common::Observers<Observer> Observers;
+
+/// Batch observers are told once about each group of resources that a manager
+/// adds or removes together (e.g., all of the resources read by one operation).
+typedef std::function<void(const std::vector<ResourcePtr>&, EventType)> BatchObserver;
+
+typedef smtk::common::Observers<BatchObserver> BatchObservers;
 } // namespace resource
 } // namespace smtk
 
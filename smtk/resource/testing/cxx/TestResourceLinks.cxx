@@ -291,6 +291,56 @@ int TestResourceLinks(int /*unused*/, char** const /*unused*/)
   TestLink<ComponentA, ResourceB>(componentA, resourceB);
   TestLink<ComponentA, ComponentB>(componentA, componentB);
 
+  // Test bulk link creation/removal and visitor-based queries.
+  {
+    smtk::resource::Links::RoleType role3 = 3;
+    std::vector<smtk::resource::ComponentPtr> targets;
+    for (int ii = 0; ii < 10; ++ii)
+    {
+      targets.push_back(resourceB->newComponent());
+    }
+    auto keys = componentA->links().addLinksTo(targets, role3);
+    smtkTest(keys.size() == targets.size(), "Expected one key per linked component.");
+    for (std::size_t ii = 0; ii < targets.size(); ++ii)
+    {
+      smtkTest(
+        componentA->links().isLinkedTo(targets[ii], role3),
+        "Component A should be linked to target " << ii << ".");
+      smtkTest(
+        componentA->links().linkedObject(keys[ii]) == targets[ii],
+        "Key " << ii << " should refer to its target.");
+    }
+
+    std::size_t numberVisited = 0;
+    auto visited =
+      componentA->links().linkedTo(role3, [&numberVisited](smtk::resource::PersistentObject&) {
+        ++numberVisited;
+        return smtk::common::Visit::Continue;
+      });
+    smtkTest(
+      visited == smtk::common::Visited::All && numberVisited == targets.size(),
+      "Expected to visit all " << targets.size() << " targets, visited " << numberVisited << ".");
+    visited = componentA->links().linkedTo(
+      role3, [](smtk::resource::PersistentObject&) { return smtk::common::Visit::Halt; });
+    smtkTest(visited == smtk::common::Visited::Some, "Visitation should halt early.");
+
+    smtk::resource::PersistentObject* linkedFrom = nullptr;
+    visited = targets[4]->links().linkedFrom(
+      role3, [&linkedFrom](smtk::resource::PersistentObject& obj) {
+        linkedFrom = &obj;
+        return smtk::common::Visit::Continue;
+      });
+    smtkTest(
+      visited == smtk::common::Visited::All && linkedFrom == componentA.get(),
+      "Target should be linked from component A.");
+
+    smtkTest(
+      componentA->links().removeLinksTo(targets, role3), "Could not remove links to targets.");
+    smtkTest(
+      componentA->links().linkedTo(role3).empty(),
+      "Component A should no longer have role-3 links.");
+  }
+
   // Test the ability to remove all links between resources
   {
     smtk::resource::Links::RoleType role1 = 1;
@@ -194,6 +194,34 @@ int TestResourceManager(int /*unused*/, char** const /*unused*/)
   auto count = resourcesByIndex.size();
   smtkTest(count == 2, "Fetched " << count << " instead of 2 resources by type-index failed.");
 
+  // Resources added together are reported to batch observers once.
+  {
+    int numBatches = 0;
+    std::size_t batchSize = 0;
+    auto batchHandle = resourceManager->batchObservers().insert(
+      [&numBatches, &batchSize](
+        const std::vector<smtk::resource::ResourcePtr>& resources,
+        smtk::resource::EventType event) {
+        if (event == smtk::resource::EventType::ADDED)
+        {
+          ++numBatches;
+          batchSize = resources.size();
+        }
+      });
+    auto resourceA3 = resourceManager->create<ResourceA>();
+    auto resourceB2 = resourceManager->create<ResourceB>();
+    smtkTest(
+      resourceManager->add({ resourceA3, resourceB2, resourceA1 }),
+      "Resources A3 and B2 not added to manager.");
+    smtkTest(resourceManager->size() == 5, "Resource manager should be managing five resources.");
+    smtkTest(
+      numBatches == 1 && batchSize == 2,
+      "Expected one batch of 2 new resources, got " << numBatches << " of " << batchSize << ".");
+    resourceManager->remove(resourceA3);
+    resourceManager->remove(resourceB2);
+    resourceManager->batchObservers().erase(batchHandle);
+  }
+
   std::vector<std::thread> ts;
   for (int i = 1; i < 100; ++i)
   {
@@ -16,7 +16,13 @@
 #include "smtk/mesh/core/MeshSet.h"
 #include "smtk/mesh/core/Resource.h"
 
+#include "smtk/common/Parallel.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <numeric>
+#include <unordered_map>
 
 namespace smtk
 {
@@ -29,6 +35,104 @@ namespace
 {
 typedef std::vector<std::pair<smtk::mesh::MeshSet, Topology::Element*>> ElementShells;
 
+// The minimum number of bounding cells handled by a single task when grouping
+// cells by the shells that contain them.
+const std::size_t s_cellsPerTask = 1 << 15;
+
+// A map from a sorted list of shell indices to the cells that are contained by
+// exactly those shells.
+typedef std::map<std::vector<std::size_t>, smtk::mesh::HandleRange> CellGroups;
+
+// Group the cells of a collection of shells by the shells that contain them.
+// The span of cell handles is divided among tasks, each of which builds a
+// hashed map from its cells to the shells that contain them.
+CellGroups groupCellsByShells(const std::vector<smtk::mesh::HandleRange>& shells)
+{
+  smtk::mesh::Handle lower = std::numeric_limits<smtk::mesh::Handle>::max();
+  smtk::mesh::Handle upper = 0;
+  std::size_t numberOfCells = 0;
+  for (const auto& shell : shells)
+  {
+    if (!shell.empty())
+    {
+      lower = std::min(lower, shell.begin()->lower());
+      upper = std::max(upper, shell.rbegin()->upper());
+      numberOfCells += shell.size();
+    }
+  }
+  if (numberOfCells == 0)
+  {
+    return CellGroups();
+  }
+
+  const std::size_t span = static_cast<std::size_t>(upper - lower) + 1;
+  const std::size_t numberOfTasks = std::min(
+    span,
+    std::max<std::size_t>(
+      1,
+      std::min<std::size_t>(smtk::common::numberOfThreads(), numberOfCells / s_cellsPerTask)));
+  const std::size_t handlesPerTask = (span + numberOfTasks - 1) / numberOfTasks;
+
+  std::vector<CellGroups> taskGroups(numberOfTasks);
+  auto groupTask = [&](std::size_t task) {
+    const smtk::mesh::Handle first = lower + task * handlesPerTask;
+    const smtk::mesh::Handle last = lower +
+      static_cast<smtk::mesh::Handle>(
+        std::min<std::size_t>(upper - lower, (task + 1) * handlesPerTask - 1));
+    const smtk::mesh::HandleInterval bounds(first, last);
+
+    // Shells are visited in order, so each cell's list of owners is sorted.
+    std::unordered_map<smtk::mesh::Handle, std::vector<std::size_t>> owners;
+    for (std::size_t i = 0; i < shells.size(); ++i)
+    {
+      const smtk::mesh::HandleRange cells = shells[i] & bounds;
+      for (auto cell = smtk::mesh::rangeElementsBegin(cells);
+           cell != smtk::mesh::rangeElementsEnd(cells);
+           ++cell)
+      {
+        owners[*cell].push_back(i);
+      }
+    }
+
+    CellGroups& groups = taskGroups[task];
+    for (const auto& entry : owners)
+    {
+      groups[entry.second].insert(smtk::mesh::HandleInterval(entry.first, entry.first));
+    }
+  };
+
+  smtk::common::forEachChunk(
+    numberOfTasks, 1, [&groupTask](std::size_t task, std::size_t, std::size_t) {
+      groupTask(task);
+    });
+
+  // Each task covers a disjoint span of handles, so the groups are combined by
+  // union.
+  CellGroups groups = std::move(taskGroups[0]);
+  for (std::size_t task = 1; task < numberOfTasks; ++task)
+  {
+    for (auto& group : taskGroups[task])
+    {
+      groups[group.first] += group.second;
+    }
+  }
+  return groups;
+}
+
+// Return the id of the model entity associated with a mesh, assigning it a new
+// one if it has none.
+smtk::common::UUID elementId(Topology* topology, smtk::mesh::MeshSet& mesh)
+{
+  smtk::common::UUIDArray ids = mesh.modelEntityIds();
+  if (!ids.empty())
+  {
+    return ids[0];
+  }
+  smtk::common::UUID id = topology->m_resource->modelResource()->unusedUUID();
+  mesh.setModelEntityId(id);
+  return id;
+}
+
 class AddFreeElements : public smtk::mesh::MeshForEach
 {
 public:
@@ -39,7 +143,13 @@ public:
   }
 
   void setElementShells(ElementShells* shells) { m_shells = shells; }
-  void setDimension(int dimension) { m_dimension = dimension; }
+  void setDimension(int dimension)
+  {
+    m_dimension = dimension;
+    m_boundaries.clear();
+    m_boundariesByHandle.clear();
+    m_boundariesCollected = false;
+  }
 
   void forMesh(smtk::mesh::MeshSet& singleMesh) override
   {
@@ -49,18 +159,7 @@ public:
     // First, check if the mesh has an associated element already. If it does,
     // use this value (facilitating persistency across multiple calls to the
     // construction of Topologies).
-    smtk::common::UUIDArray ids = singleMesh.modelEntityIds();
-    smtk::common::UUID id;
-    if (ids.empty())
-    {
-      id = (m_topology->m_resource->modelResource()->unusedUUID());
-      // Assign the unique id to the mesh
-      singleMesh.setModelEntityId(id);
-    }
-    else
-    {
-      id = ids[0];
-    }
+    smtk::common::UUID id = elementId(m_topology, singleMesh);
 
     // add the unique id as a child of the model
     m_root->m_children.insert(id);
@@ -82,31 +181,39 @@ public:
         // The shell is a new meshset containing all of the cells that comprise
         // the shell. It does not account for the existing meshsets that may
         // comprise the shell (which is what we need). So, we partition the
-        // shell using the existing meshests of the appropriate dimension.
-        smtk::mesh::CellSet shellCells = shell.cells();
-        smtk::mesh::MeshSet cellsOfDimension = smtk::mesh::set_difference(
-          m_topology->m_resource->meshes(smtk::mesh::DimensionType(m_dimension - 1)), shell);
-        for (std::size_t i = 0; i < cellsOfDimension.size(); i++)
+        // shell using the existing meshests of the appropriate dimension that
+        // it entirely contains.
+        this->collectBoundaries();
+        const smtk::mesh::HandleRange shellRange = shell.cells().range();
+        smtk::mesh::HandleRange shellCells = shellRange;
+        std::set<std::size_t> contained;
+        for (const auto& interval : shellRange)
         {
-          smtk::mesh::CellSet intersect =
-            smtk::mesh::set_intersect(cellsOfDimension.subset(i).cells(), shell.cells());
-
-          // If the intersection is nonzero and the mesh subset is entirely
-          // contained by the shell, we add the subset as a child entity and we
-          // remove its contents from the list of shell cells.
-          if (
-            !intersect.is_empty() && intersect.size() == cellsOfDimension.subset(i).cells().size())
+          // Only the meshsets whose first cell lies in the shell can be
+          // contained by it.
+          auto begin = m_boundariesByHandle.lower_bound(interval.lower());
+          auto end = m_boundariesByHandle.upper_bound(interval.upper());
+          for (auto it = begin; it != end; ++it)
           {
-            m_shells->push_back(std::make_pair(cellsOfDimension.subset(i), element));
-            shellCells = smtk::mesh::set_difference(shellCells, intersect);
+            const auto& boundary = m_boundaries[it->second];
+            if (
+              contained.find(it->second) == contained.end() &&
+              smtk::mesh::rangeContains(shellRange, boundary.second))
+            {
+              contained.insert(it->second);
+              m_shells->push_back(std::make_pair(boundary.first, element));
+              shellCells -= boundary.second;
+            }
           }
         }
         // After all predescribed entities have been removed from the shell,
         // whatever remains is also an entity.
-        if (!shellCells.is_empty())
+        if (!shellCells.empty())
         {
-          m_shells->push_back(
-            std::make_pair(m_topology->m_resource->createMesh(shellCells), element));
+          m_shells->push_back(std::make_pair(
+            m_topology->m_resource->createMesh(
+              smtk::mesh::CellSet(m_topology->m_resource, shellCells)),
+            element));
         }
         m_topology->m_resource->removeMeshes(shell);
       }
@@ -114,10 +221,37 @@ public:
   }
 
 protected:
+  // Index the existing meshsets of one dimension lower than the free elements
+  // by their first cell, so each shell is partitioned without intersecting it
+  // with every meshset.
+  void collectBoundaries()
+  {
+    if (m_boundariesCollected)
+    {
+      return;
+    }
+    m_boundariesCollected = true;
+    smtk::mesh::MeshSet meshes =
+      m_topology->m_resource->meshes(smtk::mesh::DimensionType(m_dimension - 1));
+    for (std::size_t i = 0; i < meshes.size(); ++i)
+    {
+      smtk::mesh::MeshSet mesh = meshes.subset(i);
+      smtk::mesh::HandleRange cells = mesh.cells().range();
+      if (!cells.empty())
+      {
+        m_boundariesByHandle.insert(std::make_pair(cells.begin()->lower(), m_boundaries.size()));
+        m_boundaries.emplace_back(mesh, cells);
+      }
+    }
+  }
+
   Topology* m_topology;
   Topology::Element* m_root;
   ElementShells* m_shells{ nullptr };
   int m_dimension{ -1 };
+  std::vector<std::pair<smtk::mesh::MeshSet, smtk::mesh::HandleRange>> m_boundaries;
+  std::multimap<smtk::mesh::Handle, std::size_t> m_boundariesByHandle;
+  bool m_boundariesCollected{ false };
 };
 
 struct AddBoundElements
@@ -130,95 +264,84 @@ struct AddBoundElements
   void setElementShells(ElementShells* shells) { m_shells = shells; }
   void setDimension(int dimension) { m_dimension = dimension; }
 
-  void operator()(ElementShells::iterator start, ElementShells::iterator end)
+  void operator()(ElementShells& shells)
   {
-    std::vector<ElementShells::iterator> activeShells;
+    std::vector<smtk::mesh::HandleRange> ranges;
+    ranges.reserve(shells.size());
+    for (auto& shell : shells)
+    {
+      ranges.push_back(shell.first.cells().range());
+    }
 
-    ElementShells::iterator seed = start;
+    // Each group of cells that are contained by the same shells is an
+    // element whose parents are the elements that own those shells.
+    CellGroups groups = groupCellsByShells(ranges);
 
-    while (seed != end)
+    std::vector<bool> reused(shells.size(), false);
+    // The new children of each shell's element, added in bulk once all of the
+    // groups have been visited.
+    std::vector<smtk::common::UUIDArray> children(shells.size());
+    for (const auto& group : groups)
     {
-      activeShells.push_back(seed++);
+      const std::vector<std::size_t>& owners = group.first;
 
-      while (!activeShells.empty())
+      // A shell that is not shared with any other is used as is, preserving
+      // the model entity that may already be associated with it.
+      smtk::mesh::MeshSet m;
+      if (owners.size() == 1 && smtk::mesh::rangesEqual(ranges[owners[0]], group.second))
       {
-        smtk::mesh::MeshSet m = activeShells.back()->first;
-        for (ElementShells::iterator j = seed; j != end; ++j)
-        {
-          smtk::mesh::CellSet cs = smtk::mesh::set_intersect(m.cells(), j->first.cells());
-          if (!cs.is_empty())
-          {
-            m = m_topology->m_resource->createMesh(cs);
-            activeShells.push_back(j);
-          }
-          if (m_dimension == 2 && activeShells.size() == 2)
-          {
-            break;
-          }
-        }
+        m = shells[owners[0]].first;
+        reused[owners[0]] = true;
+      }
+      else
+      {
+        m = m_topology->m_resource->createMesh(
+          smtk::mesh::CellSet(m_topology->m_resource, group.second));
+      }
 
-        if (!m.is_empty())
-        {
-          // We have an intersection, so we must now process it. We start by
-          // creating a new id for it.
-          smtk::common::UUIDArray ids = m.modelEntityIds();
-          smtk::common::UUID id;
-          if (ids.empty())
-          {
-            id = (m_topology->m_resource->modelResource()->unusedUUID());
-            // Assign the unique id to the mesh
-            m.setModelEntityId(id);
-          }
-          else
-          {
-            id = ids[0];
-          }
+      smtk::common::UUID id = elementId(m_topology, m);
 
-          // Next, we remove the intersection from the contributing mesh sets
-          // and add the new id as a child of these sets. We also record the
-          // sets' ids as parents of the new set.
-          smtk::common::UUIDArray parents;
-          for (auto&& shell : activeShells)
-          {
-            if (activeShells.size() > 1)
-            {
-              smtk::mesh::MeshSet tmp = m_topology->m_resource->createMesh(
-                smtk::mesh::set_difference(shell->first.cells(), m.cells()));
-              m_topology->m_resource->removeMeshes(shell->first);
-              shell->first = tmp;
-            }
-            shell->second->m_children.insert(id);
-            parents.push_back(shell->second->m_id);
-          }
+      // Record the new id as a child of the shells' elements and their ids
+      // as parents of the new element.
+      smtk::common::UUIDArray parents;
+      for (std::size_t owner : owners)
+      {
+        children[owner].push_back(id);
+        parents.push_back(shells[owner].second->m_id);
+      }
 
-          // finally, we insert it as an element into the topology. If
-          // necessary, we store its shell for the bound element calculation of
-          // lower dimension
-          Topology::Element* element =
-            &m_topology->m_elements
-               .insert(std::make_pair(id, Topology::Element(m, id, m_dimension)))
-               .first->second;
-          element->m_parents.insert(parents.begin(), parents.end());
-          if (m_shells)
-          {
-            m_shells->push_back(std::make_pair(m.extractShell(), element));
-          }
-        }
-        if (activeShells.size() == 1)
-        {
-          activeShells.pop_back();
-        }
-        else
-        {
-          activeShells.erase(std::next(activeShells.begin()), activeShells.end());
-        }
+      // finally, we insert it as an element into the topology. If
+      // necessary, we store its shell for the bound element calculation of
+      // lower dimension
+      Topology::Element* element =
+        &m_topology->m_elements
+           .insert(std::make_pair(id, Topology::Element(m, id, m_dimension)))
+           .first->second;
+      element->m_parents.insert(parents.begin(), parents.end());
+      if (m_shells)
+      {
+        m_shells->push_back(std::make_pair(m.extractShell(), element));
+      }
+    }
+
+    for (std::size_t i = 0; i < shells.size(); ++i)
+    {
+      shells[i].second->m_children.insert(children[i].begin(), children[i].end());
+    }
+
+    // The shells that have been partitioned into elements are no longer needed.
+    for (std::size_t i = 0; i < shells.size(); ++i)
+    {
+      if (!reused[i])
+      {
+        m_topology->m_resource->removeMeshes(shells[i].first);
       }
     }
   }
 
   Topology* m_topology;
-  ElementShells* m_shells;
-  int m_dimension;
+  ElementShells* m_shells{ nullptr };
+  int m_dimension{ -1 };
 };
 } // namespace
 
@@ -290,7 +413,7 @@ Topology::Topology(
 
       addBoundElements.setElementShells(elementShells[dimension]);
       addBoundElements.setDimension(dimension);
-      addBoundElements(elementShells[dimension + 1]->begin(), elementShells[dimension + 1]->end());
+      addBoundElements(*elementShells[dimension + 1]);
     }
   }
   else
@@ -306,6 +429,74 @@ Topology::Topology(
     }
   }
 }
+
+std::set<smtk::common::UUID> Topology::sharedBoundaries(
+  const std::set<smtk::common::UUID>& ids) const
+{
+  std::set<smtk::common::UUID> shared;
+  for (const auto& id : ids)
+  {
+    auto elementIt = m_elements.find(id);
+    if (elementIt == m_elements.end())
+    {
+      continue;
+    }
+    for (const auto& childId : elementIt->second.m_children)
+    {
+      auto childIt = m_elements.find(childId);
+      if (childIt == m_elements.end() || childIt->second.m_parents.size() < 2)
+      {
+        continue;
+      }
+      const smtk::common::UUIDFlatSet& parents = childIt->second.m_parents;
+      if (std::includes(ids.begin(), ids.end(), parents.begin(), parents.end()))
+      {
+        shared.insert(childId);
+      }
+    }
+  }
+  return shared;
+}
+
+std::vector<Topology::Element> Topology::removeElement(const smtk::common::UUID& id)
+{
+  std::vector<Element> removed;
+  auto elementIt = m_elements.find(id);
+  if (elementIt == m_elements.end())
+  {
+    return removed;
+  }
+
+  const smtk::common::UUIDFlatSet parents = elementIt->second.m_parents;
+  const smtk::common::UUIDFlatSet children = elementIt->second.m_children;
+  removed.push_back(elementIt->second);
+  m_elements.erase(elementIt);
+
+  for (const auto& parentId : parents)
+  {
+    auto parentIt = m_elements.find(parentId);
+    if (parentIt != m_elements.end())
+    {
+      parentIt->second.m_children.erase(id);
+    }
+  }
+
+  for (const auto& childId : children)
+  {
+    auto childIt = m_elements.find(childId);
+    if (childIt == m_elements.end())
+    {
+      continue;
+    }
+    childIt->second.m_parents.erase(id);
+    if (childIt->second.m_parents.empty())
+    {
+      std::vector<Element> removedChildren = this->removeElement(childId);
+      removed.insert(removed.end(), removedChildren.begin(), removedChildren.end());
+    }
+  }
+  return removed;
+}
 } // namespace mesh
 } // namespace session
 } // namespace smtk
@@ -16,8 +16,11 @@
 #include "smtk/mesh/core/Resource.h"
 
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDContainers.h"
 #include "smtk/common/UUIDGenerator.h"
 
+#include <map>
+#include <set>
 #include <vector>
 
 namespace smtk
@@ -33,6 +36,11 @@ namespace mesh
    construct hierarchical relationships between mesh sets. This struct provides
    the description of these relationships, as well as a means of automatically
    constructing the hierarchy by extracting mesh shells.
+
+   The cells that bound elements of one dimension are partitioned into
+   elements of the next lower dimension in a single pass: a hashed map from
+   each bounding cell to the elements whose shells contain it is built in
+   parallel, and cells with the same set of owners form one element.
   */
 struct SMTKMESHSESSION_EXPORT Topology
 {
@@ -53,10 +61,23 @@ struct SMTKMESHSESSION_EXPORT Topology
     smtk::mesh::MeshSet m_mesh;
     int m_dimension;
     smtk::common::UUID m_id;
-    std::set<smtk::common::UUID> m_parents;
-    std::set<smtk::common::UUID> m_children;
+    // Elements gain and lose relations rarely (only when the topology is
+    // built or elements are merged) but are traversed often, so relations are
+    // held in sorted arrays.
+    smtk::common::UUIDFlatSet m_parents;
+    smtk::common::UUIDFlatSet m_children;
   };
 
+  /// Return the ids of the elements that bound two or more of the elements
+  /// \a ids and no others. When the elements \a ids are merged, these
+  /// boundaries lie in the interior of the merged element.
+  std::set<smtk::common::UUID> sharedBoundaries(const std::set<smtk::common::UUID>& ids) const;
+
+  /// Remove the element \a id and, recursively, those of its children that
+  /// are left without a parent. The removed elements are returned as they
+  /// were when they were removed.
+  std::vector<Element> removeElement(const smtk::common::UUID& id);
+
   smtk::mesh::ResourcePtr m_resource;
   smtk::common::UUID m_modelId;
   std::map<smtk::common::UUID, Element> m_elements;
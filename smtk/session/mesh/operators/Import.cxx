@@ -39,6 +39,10 @@
 
 #include "smtk/session/mesh/operators/Import_xml.h"
 
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
 using namespace smtk::model;
 using namespace smtk::common;
 
@@ -133,10 +137,30 @@ Import::Result Import::operateInternal()
 
   // Get the mesh resource from the file
   smtk::mesh::MeshSet preexistingMeshes = meshResource->meshes();
+  const auto importStart = std::chrono::steady_clock::now();
   smtk::io::importMesh(filePath, meshResource, label);
   smtk::mesh::MeshSet allMeshes = meshResource->meshes();
   smtk::mesh::MeshSet newMeshes = smtk::mesh::set_difference(allMeshes, preexistingMeshes);
 
+  // The file is read in a single call, so cancellation is honored once it has
+  // been read. A canceled import leaves an existing resource as it was.
+  {
+    const std::size_t nCells = newMeshes.cells().size();
+    const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - importStart).count();
+    std::ostringstream message;
+    message << "Read " << nCells << " cells in " << seconds << " s ("
+            << nCells / std::max(seconds, 1.e-9) << " cells/s).";
+    if (!this->reportProgress(0.5, message.str()))
+    {
+      if (!newResource)
+      {
+        meshResource->removeMeshes(newMeshes);
+      }
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
+  }
+
   // Name the mesh according to the stem of the file
   std::string name = smtk::common::Paths::stem(filePath);
   if (!name.empty() && newResource)
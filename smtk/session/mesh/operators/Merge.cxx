@@ -15,6 +15,7 @@
 
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/VoidItem.h"
 
 #include "smtk/common/CompilerInformation.h"
 
@@ -115,6 +116,22 @@ Merge::Result Merge::operateInternal()
   // Create a new id for the merged entity.
   smtk::common::UUID id = resource->unusedUUID();
 
+  // Boundaries that are shared only by the entities being merged will lie in
+  // the interior of the merged entity. If requested, they are found before the
+  // topology is modified so that they can be removed from it in place.
+  std::set<smtk::common::UUID> interior;
+  smtk::attribute::VoidItem::Ptr removeInteriorItem =
+    this->parameters()->findVoid("remove interior boundaries");
+  if (removeInteriorItem && removeInteriorItem->isEnabled())
+  {
+    std::set<smtk::common::UUID> mergedIds;
+    for (auto it = associations->begin(); it != associations->end(); ++it)
+    {
+      mergedIds.insert(it->id());
+    }
+    interior = topology->sharedBoundaries(mergedIds);
+  }
+
   smtk::mesh::HandleRange cells;
   std::set<smtk::common::UUID> parents;
   std::set<smtk::common::UUID> children;
@@ -183,7 +200,10 @@ Merge::Result Merge::operateInternal()
       childEntityRef.elideRawRelation(eRef);
       eRef.elideRawRelation(childEntityRef);
 
-      modified->appendValue(childEntityRef.component());
+      if (interior.find(*childId) == interior.end())
+      {
+        modified->appendValue(childEntityRef.component());
+      }
     }
 
     // Construct a name for the resulting entity.
@@ -244,6 +264,48 @@ Merge::Result Merge::operateInternal()
   element->m_parents.insert(parents.begin(), parents.end());
   element->m_children.insert(children.begin(), children.end());
 
+  // Remove any interior boundaries, along with any of their own boundaries
+  // that are left without a parent.
+  std::vector<Topology::Element> removed;
+  for (const auto& interiorId : interior)
+  {
+    std::vector<Topology::Element> removedElements = topology->removeElement(interiorId);
+    removed.insert(removed.end(), removedElements.begin(), removedElements.end());
+  }
+  std::set<smtk::common::UUID> removedIds;
+  for (const auto& removedElement : removed)
+  {
+    removedIds.insert(removedElement.m_id);
+  }
+  std::set<smtk::common::UUID> modifiedIds;
+  for (const auto& removedElement : removed)
+  {
+    smtk::model::EntityRef removedRef(resource, removedElement.m_id);
+    std::set<smtk::common::UUID> related(
+      removedElement.m_parents.begin(), removedElement.m_parents.end());
+    related.insert(removedElement.m_children.begin(), removedElement.m_children.end());
+    for (const auto& relatedId : related)
+    {
+      smtk::model::EntityRef relatedRef(resource, relatedId);
+      relatedRef.elideRawRelation(removedRef);
+      removedRef.elideRawRelation(relatedRef);
+
+      if (
+        relatedId != id && removedIds.find(relatedId) == removedIds.end() &&
+        modifiedIds.insert(relatedId).second)
+      {
+        modified->appendValue(relatedRef.component());
+      }
+    }
+
+    if (removedRef.component())
+    {
+      expunged->appendValue(removedRef.component());
+      resource->erase(removedRef);
+    }
+    meshResource->removeMeshes(removedElement.m_mesh);
+  }
+
   // Declare the model as "dangling" so it will be transcribed.
   resource->session()->declareDanglingEntity(entityRef);
 
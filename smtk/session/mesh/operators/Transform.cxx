@@ -99,7 +99,9 @@ Transform::Result Transform::operateInternal()
   // Construct a MarkGeometry instance.
   smtk::operation::MarkGeometry markGeometry(resource);
 
-  // Access the model resource's associated topology.
+  // Access the model resource's associated topology. A transform does not
+  // change the connectivity of the mesh, so the topology is kept as is and only
+  // the geometry of its elements is marked as modified.
   smtk::session::mesh::Topology* topology = resource->session()->topology(resource);
 
   std::function<void(const smtk::common::UUID&)> mark;
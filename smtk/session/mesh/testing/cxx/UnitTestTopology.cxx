@@ -9,7 +9,10 @@
 //=========================================================================
 
 #include "smtk/session/mesh/Resource.h"
+#include "smtk/session/mesh/Session.h"
+#include "smtk/session/mesh/Topology.h"
 #include "smtk/session/mesh/operators/Import.h"
+#include "smtk/session/mesh/operators/Merge.h"
 
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/ComponentItem.h"
@@ -195,6 +198,7 @@ int UnitTestTopology(int argc, char* argv[])
   // Register import operator to the operation manager
   {
     operationManager->registerOperation<smtk::session::mesh::Import>("smtk::session::mesh::Import");
+    operationManager->registerOperation<smtk::session::mesh::Merge>("smtk::session::mesh::Merge");
   }
 
   // Register the resource manager to the operation manager (newly created
@@ -259,6 +263,86 @@ int UnitTestTopology(int argc, char* argv[])
     }
   }
 
+  for (bool removeInterior : { false, true })
+  {
+    // Merging two volumes keeps the faces they share as children of the
+    // merged volume. When requested, those faces (and any edges that bound
+    // only those faces) are removed from the topology in place instead.
+    smtk::model::Entity::Ptr model;
+
+    std::string readFilePath(dataRoot);
+    readFilePath += "/model/3d/exodus/SimpleReactorCore/SimpleReactorCore.exo";
+
+    test(
+      ImportModel(model, operationManager, readFilePath) == 0,
+      "Could not import model " + readFilePath);
+
+    smtk::session::mesh::Resource::Ptr resource =
+      std::static_pointer_cast<smtk::session::mesh::Resource>(model->resource());
+    smtk::session::mesh::Topology* topology = resource->session()->topology(resource);
+    test(topology != nullptr, "Could not access the model's topology");
+
+    std::set<smtk::common::UUID> volumes;
+    for (const auto& entry : topology->m_elements)
+    {
+      if (entry.second.m_dimension == 2 && entry.second.m_parents.size() == 2)
+      {
+        volumes.insert(entry.second.m_parents.begin(), entry.second.m_parents.end());
+        break;
+      }
+    }
+    test(volumes.size() == 2, "There should be a face shared by two volumes");
+
+    std::set<smtk::common::UUID> shared = topology->sharedBoundaries(volumes);
+    test(!shared.empty(), "The volumes should share at least one face");
+
+    std::size_t before[4] = { 0, 0, 0, 0 };
+    ParseModelTopology(model->referenceAs<smtk::model::Model>(), before);
+
+    smtk::operation::Operation::Ptr mergeOp =
+      operationManager->create<smtk::session::mesh::Merge>();
+    for (const auto& id : volumes)
+    {
+      mergeOp->parameters()->associate(resource->find(id));
+    }
+    mergeOp->parameters()->findVoid("remove interior boundaries")->setIsEnabled(removeInterior);
+    smtk::operation::Operation::Result mergeOpResult = mergeOp->operate();
+    test(
+      mergeOpResult->findInt("outcome")->value() ==
+        static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+      "Merge operator failed");
+
+    for (const auto& id : shared)
+    {
+      bool inTopology = topology->m_elements.find(id) != topology->m_elements.end();
+      bool inModel = resource->find(id) != nullptr;
+      if (removeInterior)
+      {
+        test(!inTopology, "Shared faces should be removed from the topology");
+        test(!inModel, "Shared faces should be removed from the model");
+      }
+      else
+      {
+        test(inTopology, "Shared faces should be kept in the topology");
+        test(inModel, "Shared faces should be kept in the model");
+      }
+    }
+
+    std::size_t after[4] = { 0, 0, 0, 0 };
+    ParseModelTopology(model->referenceAs<smtk::model::Model>(), after);
+
+    std::cout << after[3] << " volumes and " << after[2] << " faces after merge" << std::endl;
+    test(after[3] == before[3] - 1, "Merging two volumes should leave one fewer volume");
+    if (removeInterior)
+    {
+      test(after[2] == before[2] - shared.size(), "Shared faces should no longer bound volumes");
+    }
+    else
+    {
+      test(after[2] == before[2], "Shared faces should still bound the merged volume");
+    }
+  }
+
 #ifdef SMTK_ENABLE_VTK_SUPPORT
   {
     smtk::model::Entity::Ptr model;
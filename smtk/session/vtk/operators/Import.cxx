@@ -460,12 +460,26 @@ Import::Result Import::importExodus(const smtk::session::vtk::Resource::Ptr& res
           this->log(), "Error:Associated file " << filenameItem->value(i) << " is not valid!");
         return this->createResult(smtk::operation::Operation::Outcome::FAILED);
       }
+
+      // Files are transcribed only once all of them have been read, so a
+      // canceled import leaves the resource untouched.
+      if (!this->reportProgress(
+            0.5 * (i + 1) / modelsOut.size(),
+            "Read " + std::to_string(i + 1) + " of " + std::to_string(modelsOut.size()) +
+              " files."))
+      {
+        return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+      }
     }
   }
   else
   {
     std::string filename = filenameItem->value();
     modelsOut[0] = importExodusInternal(filename);
+    if (!this->reportProgress(0.5, "Read " + filename + "."))
+    {
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
   }
 
   // Now set model for session and transcribe everything.
@@ -490,6 +504,16 @@ Import::Result Import::importExodus(const smtk::session::vtk::Resource::Ptr& res
       smtk::attribute::ComponentItem::Ptr created = result->findComponent("created");
       created->appendValue(smtkModelOut.component());
     }
+
+    // A canceled import reports the models transcribed so far.
+    if (!this->reportProgress(
+          0.5 + 0.5 * (i + 1) / modelsOut.size(),
+          "Transcribed " + std::to_string(i + 1) + " of " + std::to_string(modelsOut.size()) +
+            " models."))
+    {
+      result->findInt("outcome")->setValue(static_cast<int>(Import::Outcome::CANCELED));
+      break;
+    }
   }
 
   {
@@ -682,6 +706,15 @@ Import::Result Import::importLabelMap(const smtk::session::vtk::Resource::Ptr& r
   bdyFilt->SetNumberOfContours(1);
   for (std::set<double>::iterator it = labelSet.begin(); it != labelSet.end(); ++it, ++i)
   {
+    // Nothing has been added to the resource while labels are contoured, so
+    // a canceled import simply stops.
+    if (!this->reportProgress(
+          static_cast<double>(i) / numLabels,
+          "Contoured " + std::to_string(i) + " of " + std::to_string(numLabels) + " labels."))
+    {
+      return this->createResult(smtk::operation::Operation::Outcome::CANCELED);
+    }
+
     bdyFilt->SetValue(0, *it);
     bdyFilt->Update();
     vtkNew<vtkPolyData> childData;
@@ -245,6 +245,8 @@ bool FillOutAttributes::updateResourceEntry(
   ResourceAttributes& entry)
 {
   bool changesMade = false;
+  // Resolve references in bulk rather than one at a time as each attribute is validated.
+  resource.resolveReferences();
   // I. Remove invalid entries for attributes that are valid or deleted.
   std::set<smtk::common::UUID> expunged;
   std::set<smtk::common::UUID> validated;
@@ -12,6 +12,7 @@
 #include "smtk/view/Badge.h"
 #include "smtk/view/BadgeSet.h"
 #include "smtk/view/PhraseModel.h"
+#include "smtk/view/PhraseTitleIndex.h"
 #include "smtk/view/SubphraseGenerator.h"
 
 #include "smtk/model/Entity.h"
@@ -29,6 +30,22 @@ namespace smtk
 {
 namespace view
 {
+namespace
+{
+// Return the UUID used to order phrases whose titles are identical.
+smtk::common::UUID relatedId(const DescriptivePhrasePtr& phrase)
+{
+  if (const auto* comp = phrase->relatedRawComponent())
+  {
+    return comp->id();
+  }
+  if (const auto* rsrc = phrase->relatedRawResource())
+  {
+    return rsrc->id();
+  }
+  return smtk::common::UUID::null();
+}
+} // namespace
 
 unsigned int DescriptivePhrase::s_nextPhraseId = 0;
 
@@ -128,6 +145,16 @@ DescriptivePhrases DescriptivePhrase::subphrases() const
   return m_subphrases;
 }
 
+int DescriptivePhrase::pendingSubphrases() const
+{
+  if (!m_titleIndex || !m_subphrasesBuilt)
+  {
+    return 0;
+  }
+  int pending = static_cast<int>(m_titleIndex->size()) - static_cast<int>(m_subphrases.size());
+  return pending > 0 ? pending : 0;
+}
+
 int DescriptivePhrase::argFindChild(const DescriptivePhrase* child) const
 {
   int i = 0;
@@ -464,16 +491,31 @@ bool DescriptivePhrase::compareByTypeThenTitle(
     }
   }
 
-  // IV. Sort by title, with care taken when differences are numeric values.
+  // IV. Sort by title, with care taken when differences are numeric values,
+  //     then by UUID so that the order matches PhraseTitleIndex.
   return compareByTitle(a, b);
 }
 
 bool DescriptivePhrase::compareByTitle(const DescriptivePhrasePtr& a, const DescriptivePhrasePtr& b)
 {
-  std::string ta(a->title());
-  std::string tb(b->title());
+  return compareTitles(a->title(), relatedId(a), b->title(), relatedId(b));
+}
 
-  return smtk::common::StringUtil::mixedAlphanumericComparator(ta, tb);
+bool DescriptivePhrase::compareTitles(
+  const std::string& titleA,
+  const smtk::common::UUID& idA,
+  const std::string& titleB,
+  const smtk::common::UUID& idB)
+{
+  if (smtk::common::StringUtil::mixedAlphanumericComparator(titleA, titleB))
+  {
+    return true;
+  }
+  if (smtk::common::StringUtil::mixedAlphanumericComparator(titleB, titleA))
+  {
+    return false;
+  }
+  return idA < idB;
 }
 
 bool DescriptivePhrase::operator==(const DescriptivePhrase& other) const
@@ -505,6 +547,8 @@ void DescriptivePhrase::buildSubphrases()
     SubphraseGeneratorPtr delegate = this->findDelegate();
     if (delegate)
     {
+      // The delegate will provide a fresh index if it pages our children.
+      m_titleIndex.reset();
       DescriptivePhrases next = delegate->subphrases(shared_from_this());
       PhraseModelPtr phraseModel = delegate->model();
       if (phraseModel)
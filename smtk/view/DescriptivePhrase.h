@@ -203,6 +203,23 @@ public:
   /// Return children phrases that further describe the subject of this phrase.
   virtual DescriptivePhrases subphrases() const;
 
+  /**\brief Paged (virtualized) children.
+    *
+    * When a subphrase generator has a positive SubphraseGenerator::pageSize(),
+    * phrases with very many children hold a PhraseTitleIndex of all their
+    * children but only materialize a prefix of them in subphrases().
+    * The PhraseModel pages in more children on request and keeps the index
+    * up to date as objects are created, modified, and expunged.
+    */
+  ///@{
+  /// Return the sorted index of all children (or null when children are not paged).
+  const PhraseTitleIndexPtr& titleIndex() const { return m_titleIndex; }
+  /// Return true when this phrase's children are paged.
+  bool isPaged() const { return !!m_titleIndex; }
+  /// Return the number of children that exist but have not been materialized as phrases.
+  int pendingSubphrases() const;
+  ///@}
+
   /// Return the index of the given phrase in this instance's subphrases (or -1).
   virtual int argFindChild(const DescriptivePhrase* child) const;
 
@@ -313,10 +330,24 @@ public:
   /**\brief Title-based comparison method for DescriptivePhrases
     *
     * This can be used to help sort DescriptivePhrases based solely on their
-    * titles.
+    * titles. Phrases with identical titles are ordered by the UUID of their
+    * related object (see compareTitles()).
     */
   static bool compareByTitle(const DescriptivePhrasePtr& a, const DescriptivePhrasePtr& b);
 
+  /**\brief Compare titles with care taken when differences are numeric values,
+    *        breaking ties with the given UUIDs.
+    *
+    * This is the order used by compareByTitle(), by the final stage of
+    * compareByTypeThenTitle(), and by PhraseTitleIndex, so that sorted
+    * children always agree with the title index of a paged phrase.
+    */
+  static bool compareTitles(
+    const std::string& titleA,
+    const smtk::common::UUID& idA,
+    const std::string& titleB,
+    const smtk::common::UUID& idB);
+
   /** \brief Provide contents-based comparison for phrases.
     *
     * This allows unordered sets and maps to hold phrases.
@@ -375,6 +406,7 @@ protected:
   unsigned int m_phraseId;
   mutable DescriptivePhrases m_subphrases;
   mutable bool m_subphrasesBuilt{ false };
+  PhraseTitleIndexPtr m_titleIndex;
 
 private:
   static unsigned int s_nextPhraseId;
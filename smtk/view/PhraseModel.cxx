@@ -15,6 +15,7 @@
 #include "smtk/view/EmptySubphraseGenerator.h"
 #include "smtk/view/Manager.h"
 #include "smtk/view/PhraseListContent.h"
+#include "smtk/view/PhraseTitleIndex.h"
 #include "smtk/view/SubphraseGenerator.h"
 
 #include "smtk/operation/Manager.h"
@@ -28,7 +29,10 @@
 
 #include "smtk/io/Logger.h"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
+#include <unordered_map>
 #include <thread>
 
 #undef SMTK_DBG_PHRASE
@@ -69,6 +73,25 @@ void notify(PhraseModel::Observer obs, DescriptivePhrasePtr parent)
   std::vector<int> parentIdx;
   return notifyRecursive(obs, parent, parentIdx);
 }
+
+// Return the row of \a phrase in \a children (sorted by \a less) or -1 when a
+// binary search does not find it (e.g., because its sort key has changed).
+template<typename Compare>
+int sortedRowOf(
+  const DescriptivePhrases& children,
+  const DescriptivePhrasePtr& phrase,
+  Compare less)
+{
+  auto range = std::equal_range(children.begin(), children.end(), phrase, less);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (*it == phrase)
+    {
+      return static_cast<int>(it - children.begin());
+    }
+  }
+  return -1;
+}
 } // namespace
 
 PhraseModel::Source::Source(
@@ -150,6 +173,11 @@ SubphraseGeneratorPtr PhraseModel::configureSubphraseGenerator(
         spType = "smtk::view::SubphraseGenerator";
       }
       result = manager->subphraseGeneratorFactory().createFromConfiguration(&subphraseConfig);
+      int pageSize;
+      if (result && subphraseConfig.attributeAsInt("PageSize", pageSize))
+      {
+        result->setPageSize(pageSize);
+      }
     }
   }
   if (!result)
@@ -497,10 +525,19 @@ void PhraseModel::handleExpunged(const smtk::resource::PersistentObjectSet& expu
   {
     return;
   }
-  // Remove phrases that correspond to the set of expunged objects
-  // For each object get all of the phrased that corresponds to it, calculate their indices,
-  //  and add them to the Phrase Delta
-  PhraseDeltas phrasePaths;
+  // Drop expunged components from the indices of paged phrases.
+  // Any phrases that were materialized are removed below with all the others.
+  for (const auto& object : expungedObjects)
+  {
+    auto comp = std::dynamic_pointer_cast<smtk::resource::Component>(object);
+    for (const auto& parent : this->pagedParentsOf(comp))
+    {
+      parent->titleIndex()->erase(comp->id());
+    }
+  }
+  // Group the phrases of expunged objects by their parent phrase so that each
+  // parent is updated once with coalesced removal ranges.
+  ChildChangeMap changes;
   for (const auto& object : expungedObjects)
   {
     auto it = m_objectMap.find(object->id());
@@ -511,67 +548,29 @@ void PhraseModel::handleExpunged(const smtk::resource::PersistentObjectSet& expu
     for (const auto& wdp : it->second)
     {
       auto dp = wdp.lock(); // get the shared pointer from the phrase weak pointer
-      if (dp == nullptr)
+      auto parent = dp ? dp->parent() : nullptr;
+      if (!parent)
       {
-        continue; // the phrase was previously released
+        continue; // the phrase was previously released or is a root
       }
-      std::vector<int> path;
-      dp->index(path);
-      phrasePaths.insert(path);
+      changes[parent].removed.insert(dp);
     }
   }
 
-  std::vector<int> lastPath;
-  int removeRange[2] = { -1, -1 };
-  bool remaining = false;
-  for (auto idx : phrasePaths)
+  for (auto& entry : changes)
   {
-    if (idx.empty())
+    // Skip parents inside subtrees that are being removed anyway.
+    bool doomed = false;
+    for (auto phrase = entry.first; phrase && !doomed; phrase = phrase->parent())
     {
-      continue;
+      auto grandparent = phrase->parent();
+      auto git = grandparent ? changes.find(grandparent) : changes.end();
+      doomed = git != changes.end() && git->second.removed.count(phrase) > 0;
     }
-
-    auto backIdx = idx.back();
-    idx.pop_back();
-    if (removeRange[1] == -1)
-    {
-      removeRange[0] = backIdx;
-      removeRange[1] = removeRange[0];
-      remaining = true;
-      lastPath = idx;
-    }
-    else if (removeRange[0] == backIdx + 1 && lastPath == idx)
+    if (!doomed)
     {
-      removeRange[0] = backIdx;
+      this->applyChildChanges(entry.first, entry.second);
     }
-    else
-    {
-#ifdef SMTK_DBG_PHRASE
-      std::cout << "Remove (";
-      for (const auto& rr : lastPath)
-      {
-        std::cout << " " << rr;
-      }
-      std::cout << " ) " << removeRange[0] << " " << removeRange[1] << "\n";
-#endif
-      this->removeChildren(lastPath, removeRange);
-      removeRange[0] = backIdx;
-      removeRange[1] = removeRange[0];
-      remaining = true;
-      lastPath = idx;
-    }
-  }
-  if (remaining && removeRange[1] != -1)
-  {
-#ifdef SMTK_DBG_PHRASE
-    std::cout << "Remove (";
-    for (const auto& rr : lastPath)
-    {
-      std::cout << " " << rr;
-    }
-    std::cout << " ) " << removeRange[0] << " " << removeRange[1] << "\n";
-#endif
-    this->removeChildren(lastPath, removeRange);
   }
 }
 
@@ -589,6 +588,50 @@ void PhraseModel::handleModified(const smtk::resource::PersistentObjectSet& modi
     return;
   }
 
+  // Reposition modified components in the indices of paged phrases.
+  // Renaming may move a child into, within, or out of the materialized prefix.
+  for (const auto& object : modifiedObjects)
+  {
+    auto comp = std::dynamic_pointer_cast<smtk::resource::Component>(object);
+    for (const auto& parent : this->pagedParentsOf(comp))
+    {
+      auto& children = parent->subphrases();
+      int count = static_cast<int>(children.size());
+      auto moved = parent->titleIndex()->retitle(comp->id(), comp->name());
+      if (moved.first < 0 || moved.first == moved.second)
+      {
+        continue;
+      }
+      std::vector<int> pidx;
+      parent->index(pidx);
+      if (moved.first < count && moved.second < count)
+      {
+        // Destination rows are expressed relative to the list before the move.
+        std::vector<int> moveRange{ moved.first,
+                                    moved.first,
+                                    moved.second > moved.first ? moved.second + 1
+                                                               : moved.second };
+        this->trigger(parent, PhraseModelEvent::ABOUT_TO_MOVE, pidx, pidx, moveRange);
+        auto phrase = children[moved.first];
+        children.erase(children.begin() + moved.first);
+        children.insert(children.begin() + moved.second, phrase);
+        this->trigger(parent, PhraseModelEvent::MOVE_FINISHED, pidx, pidx, moveRange);
+      }
+      else if (moved.first < count)
+      {
+        int removeRange[2] = { moved.first, moved.first };
+        this->removeChildren(pidx, removeRange);
+      }
+      else if (moved.second < count)
+      {
+        this->materializePagedChild(parent, moved.second);
+      }
+    }
+  }
+
+  // Group modified phrases by parent; each parent reports the modified rows
+  // and repositions only those phrases whose sort order changed.
+  ChildChangeMap changes;
   for (const auto& object : modifiedObjects)
   {
     auto it = m_objectMap.find(object->id());
@@ -599,22 +642,31 @@ void PhraseModel::handleModified(const smtk::resource::PersistentObjectSet& modi
     for (const auto& wdp : it->second)
     {
       auto dp = wdp.lock(); // get the shared pointer from the phrase weak pointer
-      if (dp == nullptr)
+      auto parent = dp ? dp->parent() : nullptr;
+      if (!parent)
       {
-        continue; // the phrase was previously released
+        continue; // the phrase was previously released or is a root
+      }
+      if (parent->isPaged())
+      {
+        // Paged phrases were repositioned above; only report the modification.
+        int row = parent->argFindChild(dp.get());
+        if (row >= 0)
+        {
+          std::vector<int> path;
+          parent->index(path);
+          path.push_back(row);
+          this->trigger(dp, PhraseModelEvent::PHRASE_MODIFIED, path, path, std::vector<int>());
+        }
+        continue;
       }
-      std::vector<int> path;
-      dp->index(path);
-
-      this->trigger(dp, PhraseModelEvent::PHRASE_MODIFIED, path, path, std::vector<int>());
-      // Now check whether the modification requires a reorder
-      auto pp = dp->parent();
-      smtk::view::DescriptivePhrases sorted(pp->subphrases().begin(), pp->subphrases().end());
-      std::sort(sorted.begin(), sorted.end(), DescriptivePhrase::compareByTypeThenTitle);
-      std::vector<int> pidx(path.begin(), path.begin() + path.size() - 1);
-      this->updateChildren(pp, sorted, pidx);
+      changes[parent].modified.insert(dp);
     }
   }
+  for (auto& entry : changes)
+  {
+    this->applyChildChanges(entry.first, entry.second);
+  }
 }
 
 void PhraseModel::handleCreated(const smtk::resource::PersistentObjectSet& createdObjects)
@@ -626,35 +678,48 @@ void PhraseModel::handleCreated(const smtk::resource::PersistentObjectSet& creat
     return;
   }
 
+  // Insert created components into the indices of paged phrases, only
+  // materializing phrases that land inside the already-materialized prefix.
+  for (const auto& object : createdObjects)
+  {
+    auto comp = std::dynamic_pointer_cast<smtk::resource::Component>(object);
+    for (const auto& parent : this->pagedParentsOf(comp))
+    {
+      auto parentDelegate = parent->findDelegate();
+      if (!parentDelegate || !parentDelegate->isTopLevelComponent(comp, parent->relatedResource()))
+      {
+        continue;
+      }
+      int count = static_cast<int>(parent->subphrases().size());
+      bool complete = parent->pendingSubphrases() == 0;
+      int position = parent->titleIndex()->insert(comp->id(), comp->name());
+      if (position >= 0 && (position < count || (complete && position == count)))
+      {
+        this->materializePagedChild(parent, position);
+      }
+    }
+  }
+
   smtk::resource::PersistentObjectArray objects(createdObjects.begin(), createdObjects.end());
 
   SubphraseGenerator::PhrasesByPath phrasesToInsert;
   delegate->subphrasesForCreatedObjects(objects, rootPhrase, phrasesToInsert);
 
-  std::vector<int> insertRange{ 0, 0 };
-  for (auto pathIt = phrasesToInsert.begin(); pathIt != phrasesToInsert.end();)
+  // Group new phrases by parent. The generator's paths are only used to
+  // identify the parent; rows are computed by binary search of the siblings.
+  ChildChangeMap changes;
+  for (const auto& entry : phrasesToInsert)
   {
-    SubphraseGenerator::Path path = pathIt->first;
-    auto parent = pathIt->second->parent();
-    SubphraseGenerator::Path idx(
-      path.begin(), path.begin() + path.size() - 1); // Index of parent, not phrase to be inserted.
-    insertRange[0] = path.back();
-    insertRange[1] = insertRange[0];
-
-    DescriptivePhrases batch;
-    batch.push_back(pathIt->second);
-    for (++pathIt; pathIt != phrasesToInsert.end() && pathIt->first == path; ++pathIt)
+    auto parent = entry.second ? entry.second->parent() : nullptr;
+    if (parent && !parent->isPaged()) // paged phrases were updated above
     {
-      batch.push_back(pathIt->second);
-      ++insertRange[1];
+      changes[parent].inserted.push_back(entry.second);
     }
-    this->trigger(parent, PhraseModelEvent::ABOUT_TO_INSERT, idx, idx, insertRange);
-    auto& children = parent->subphrases();
-    children.insert(children.begin() + path.back(), batch.begin(), batch.end());
-    std::sort(
-      children.begin(), children.end(), smtk::view::DescriptivePhrase::compareByTypeThenTitle);
-    this->trigger(parent, PhraseModelEvent::INSERT_FINISHED, idx, idx, insertRange);
-    for (const auto& childPhrase : batch)
+  }
+  for (auto& entry : changes)
+  {
+    this->applyChildChanges(entry.first, entry.second);
+    for (const auto& childPhrase : entry.second.inserted)
     {
       childPhrase->subphrases(); // make sure the children subphrases are built
     }
@@ -663,6 +728,210 @@ void PhraseModel::handleCreated(const smtk::resource::PersistentObjectSet& creat
 
 void PhraseModel::redecorate() {}
 
+void PhraseModel::applyChildChanges(const DescriptivePhrasePtr& parent, ChildChanges& changes)
+{
+  if (!parent || !parent->areSubphrasesBuilt())
+  {
+    // Children will include these changes when they are generated on demand.
+    return;
+  }
+  DescriptivePhrases& children(parent->subphrases());
+  const auto& less = DescriptivePhrase::compareByTypeThenTitle;
+
+  // I. Locate removed and modified children by binary search. The siblings are
+  //    only scanned (once) for phrases the search misses because a sort key changed.
+  std::vector<int> removedRows;
+  std::vector<int> modifiedRows;
+  std::unordered_map<DescriptivePhrasePtr, bool> unresolved;
+  auto locate = [&](const DescriptivePhrasePtr& phrase, bool removed) {
+    int row = sortedRowOf(children, phrase, less);
+    if (row >= 0)
+    {
+      (removed ? removedRows : modifiedRows).push_back(row);
+    }
+    else
+    {
+      unresolved[phrase] = removed;
+    }
+  };
+  for (const auto& phrase : changes.removed)
+  {
+    locate(phrase, true);
+  }
+  for (const auto& phrase : changes.modified)
+  {
+    if (changes.removed.find(phrase) == changes.removed.end())
+    {
+      locate(phrase, false);
+    }
+  }
+  for (int row = 0; row < static_cast<int>(children.size()) && !unresolved.empty(); ++row)
+  {
+    auto it = unresolved.find(children[row]);
+    if (it != unresolved.end())
+    {
+      (it->second ? removedRows : modifiedRows).push_back(row);
+      unresolved.erase(it);
+    }
+  }
+  // Anything still unresolved is not a child of the parent and is ignored.
+  std::sort(removedRows.begin(), removedRows.end());
+  std::sort(modifiedRows.begin(), modifiedRows.end());
+
+  // II. Merge the modified and inserted children into the unchanged children,
+  //     finding the row of each by binary search. Unchanged children are
+  //     still sorted, so a modified child lands wherever its new sort key
+  //     belongs (which is usually where it was).
+  using Extra = std::pair<DescriptivePhrasePtr, bool>;
+  std::vector<Extra> extras;
+  extras.reserve(modifiedRows.size() + changes.inserted.size());
+  for (const auto& row : modifiedRows)
+  {
+    extras.emplace_back(children[row], true);
+  }
+  for (const auto& phrase : changes.inserted)
+  {
+    if (phrase)
+    {
+      extras.emplace_back(phrase, false);
+    }
+  }
+  if (removedRows.empty() && extras.empty())
+  {
+    return;
+  }
+  std::stable_sort(extras.begin(), extras.end(), [&less](const Extra& aa, const Extra& bb) {
+    return less(aa.first, bb.first);
+  });
+
+  std::vector<int> departed;
+  std::set_union(
+    removedRows.begin(),
+    removedRows.end(),
+    modifiedRows.begin(),
+    modifiedRows.end(),
+    std::back_inserter(departed));
+  DescriptivePhrases kept;
+  kept.reserve(children.size() - departed.size());
+  int first = 0;
+  for (const auto& row : departed)
+  {
+    kept.insert(kept.end(), children.begin() + first, children.begin() + row);
+    first = row + 1;
+  }
+  kept.insert(kept.end(), children.begin() + first, children.end());
+
+  PhraseModelDelta delta;
+  delta.removed = std::move(removedRows);
+  DescriptivePhrases updated;
+  updated.reserve(kept.size() + extras.size());
+  auto cursor = kept.begin();
+  for (const auto& extra : extras)
+  {
+    auto next = std::lower_bound(cursor, kept.end(), extra.first, less);
+    updated.insert(updated.end(), cursor, next);
+    cursor = next;
+    (extra.second ? delta.modified : delta.inserted).push_back(static_cast<int>(updated.size()));
+    updated.push_back(extra.first);
+  }
+  updated.insert(updated.end(), cursor, kept.end());
+
+  // III. Report every change to the parent's children with a single pair of events.
+  std::vector<int> pidx;
+  parent->index(pidx);
+  std::vector<int> range = delta.encode();
+  this->trigger(parent, PhraseModelEvent::ABOUT_TO_UPDATE, pidx, pidx, range);
+  children.swap(updated);
+  this->trigger(parent, PhraseModelEvent::UPDATE_FINISHED, pidx, pidx, range);
+}
+
+bool PhraseModel::canFetchMoreSubphrases(const DescriptivePhrasePtr& phrase) const
+{
+  return phrase && phrase->areSubphrasesBuilt() && phrase->pendingSubphrases() > 0;
+}
+
+int PhraseModel::fetchMoreSubphrases(const DescriptivePhrasePtr& phrase, int count)
+{
+  if (!this->canFetchMoreSubphrases(phrase))
+  {
+    return 0;
+  }
+  auto delegate = phrase->findDelegate();
+  if (!delegate)
+  {
+    return 0;
+  }
+  if (count <= 0)
+  {
+    count = delegate->pageSize() > 0 ? delegate->pageSize() : phrase->pendingSubphrases();
+  }
+
+  auto& children = phrase->subphrases();
+  int begin = static_cast<int>(children.size());
+  DescriptivePhrases batch;
+  delegate->pageSubphrases(phrase, begin, begin + count, batch);
+  if (batch.empty())
+  {
+    return 0;
+  }
+
+  std::vector<int> pidx;
+  phrase->index(pidx);
+  std::vector<int> insertRange{ begin, begin + static_cast<int>(batch.size()) - 1 };
+  this->trigger(phrase, PhraseModelEvent::ABOUT_TO_INSERT, pidx, pidx, insertRange);
+  children.insert(children.end(), batch.begin(), batch.end());
+  this->trigger(phrase, PhraseModelEvent::INSERT_FINISHED, pidx, pidx, insertRange);
+  return static_cast<int>(batch.size());
+}
+
+DescriptivePhrases PhraseModel::pagedParentsOf(const smtk::resource::ComponentPtr& comp) const
+{
+  DescriptivePhrases result;
+  auto rsrc = comp ? comp->resource() : smtk::resource::ResourcePtr();
+  if (!rsrc)
+  {
+    return result;
+  }
+  auto it = m_objectMap.find(rsrc->id());
+  if (it == m_objectMap.end())
+  {
+    return result;
+  }
+  for (const auto& weakPhrase : it->second)
+  {
+    auto phrase = weakPhrase.lock();
+    if (
+      phrase && !phrase->relatedComponent() && phrase->areSubphrasesBuilt() && phrase->isPaged())
+    {
+      result.push_back(phrase);
+    }
+  }
+  return result;
+}
+
+bool PhraseModel::materializePagedChild(const DescriptivePhrasePtr& parent, int position)
+{
+  auto delegate = parent ? parent->findDelegate() : nullptr;
+  if (!delegate || position < 0 || position > static_cast<int>(parent->subphrases().size()))
+  {
+    return false;
+  }
+  DescriptivePhrases batch;
+  delegate->pageSubphrases(parent, position, position + 1, batch);
+  if (batch.empty())
+  {
+    return false;
+  }
+  std::vector<int> pidx;
+  parent->index(pidx);
+  std::vector<int> insertRange{ position, position };
+  auto& children = parent->subphrases();
+  this->trigger(parent, PhraseModelEvent::ABOUT_TO_INSERT, pidx, pidx, insertRange);
+  children.insert(children.begin() + position, batch.front());
+  this->trigger(parent, PhraseModelEvent::INSERT_FINISHED, pidx, pidx, insertRange);
+  return true;
+}
+
 void PhraseModel::updateChildren(
   smtk::view::DescriptivePhrasePtr src,
   DescriptivePhrases& next,
@@ -1043,7 +1312,27 @@ void PhraseModel::trigger(
     }
   }
 
+  else if ((event == PhraseModelEvent::ABOUT_TO_UPDATE) && phr && phr->areSubphrasesBuilt())
+  {
+    DescriptivePhrases& children(phr->subphrases());
+    for (const auto& row : PhraseModelDelta::decode(arg).removed)
+    {
+      this->removeFromMap(children[row]);
+    }
+  }
+
   this->observers()(phr, event, src, dst, arg);
+  if (event == PhraseModelEvent::UPDATE_FINISHED && phr && phr->areSubphrasesBuilt())
+  {
+    DescriptivePhrases& children(phr->subphrases());
+    for (const auto& row : PhraseModelDelta::decode(arg).inserted)
+    {
+      if (children[row])
+      {
+        this->insertIntoMap(children[row]);
+      }
+    }
+  }
   // Check to see if phrases we just inserted have pre-existing children. If so, trigger them.
   if (event == PhraseModelEvent::INSERT_FINISHED && phr && phr->areSubphrasesBuilt())
   {
@@ -32,8 +32,10 @@
 
 #include <functional>
 #include <list>
+#include <map>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -184,6 +186,24 @@ public:
     DescriptivePhrases& next,
     const std::vector<int>& idx);
 
+  /**\brief Page in children of phrases whose children are paged.
+    *
+    * When the subphrase generator has a positive page size, the children of
+    * large resources are only partially materialized (see
+    * SubphraseGenerator::setPageSize()). User interfaces call these methods
+    * as users scroll to the end of the materialized children.
+    */
+  ///@{
+  /// Return true when \a phrase has children that have not been materialized yet.
+  virtual bool canFetchMoreSubphrases(const DescriptivePhrasePtr& phrase) const;
+  /**\brief Materialize up to \a count more children of \a phrase.
+    *
+    * If \a count is not positive, the generator's page size is used.
+    * Observers are notified of the insertion. The number of phrases added is returned.
+    */
+  virtual int fetchMoreSubphrases(const DescriptivePhrasePtr& phrase, int count = -1);
+  ///@}
+
   /// Manually specify that all rows should be updated (but to keep the expanded/collapsed state).
   virtual void triggerDataChanged();
 
@@ -272,6 +292,44 @@ protected:
     */
   void removeChildren(const std::vector<int>& parentIdx, int childRange[2]);
 
+  /**\brief Changes to the immediate children of a single parent phrase.
+    *
+    * The base-class handlers for expunged, modified, and created objects
+    * group affected phrases by their parent and pass each group to
+    * applyChildChanges() so that every parent is visited once.
+    */
+  struct ChildChanges
+  {
+    /// Children to remove from the parent.
+    std::unordered_set<DescriptivePhrasePtr> removed;
+    /// Children whose content changed (and which may need to be repositioned).
+    std::unordered_set<DescriptivePhrasePtr> modified;
+    /// New children to insert at their sorted locations.
+    DescriptivePhrases inserted;
+  };
+  using ChildChangeMap = std::map<DescriptivePhrasePtr, ChildChanges>;
+
+  /**\brief Apply \a changes to the children of \a parent, notifying observers.
+    *
+    * Children are assumed to be sorted with DescriptivePhrase::compareByTypeThenTitle.
+    * Removed and modified children are located by binary search (falling back to one
+    * scan of the siblings for phrases whose sort key changed); modified and inserted
+    * children are merged into the unchanged children at rows found by binary search.
+    * All of the changes are reported with a single pair of ABOUT_TO_UPDATE and
+    * UPDATE_FINISHED events whose range is an encoded PhraseModelDelta.
+    */
+  virtual void applyChildChanges(const DescriptivePhrasePtr& parent, ChildChanges& changes);
+
+  /// Return the phrases with paged children whose index may hold \a comp.
+  DescriptivePhrases pagedParentsOf(const smtk::resource::ComponentPtr& comp) const;
+
+  /**\brief Create and insert the phrase at \a position of \a parent's title index.
+    *
+    * The position must not exceed the number of materialized children.
+    * This properly signals observers of the insertion.
+    */
+  bool materializePagedChild(const DescriptivePhrasePtr& parent, int position);
+
   /**\brief Set the Parent of a Descriptive Phrase */
   void setPhraseParent(const DescriptivePhrasePtr& phrase, const DescriptivePhrasePtr& parent)
     const;
@@ -15,6 +15,8 @@
 
 #include "smtk/common/Observers.h"
 
+#include <algorithm>
+#include <initializer_list>
 #include <vector>
 
 namespace smtk
@@ -31,7 +33,60 @@ enum class PhraseModelEvent
   REMOVE_FINISHED, //!< A phrase or range of phrases has been removed from the parent.
   ABOUT_TO_MOVE,   //!< A phrase or range of phrases is being moved from one place to another.
   MOVE_FINISHED,   //!< A phrase or range of phrases has been moved and the update is complete.
-  PHRASE_MODIFIED  //!< The given phrase has had its text, color, or some other property modified.
+  PHRASE_MODIFIED, //!< The given phrase has had its text, color, or some other property modified.
+  ABOUT_TO_UPDATE, //!< Children of the parent are about to change at once (see PhraseModelDelta).
+  UPDATE_FINISHED  //!< Children of the parent have been changed at once (see PhraseModelDelta).
+};
+
+/**\brief The changes to a parent's children reported by a single pair of
+  *        ABOUT_TO_UPDATE and UPDATE_FINISHED events.
+  *
+  * The delta is passed to observers as the events' range (see encode() and decode()).
+  * Removed rows are numbered as the children were before the update (so observers
+  * of ABOUT_TO_UPDATE may inspect them); inserted and modified rows are numbered as
+  * the children are after the update (so observers of UPDATE_FINISHED may inspect them).
+  * All rows are sorted in ascending order.
+  * Every other child keeps its identity but may have been shifted or, when a modified
+  * sibling was reordered, moved; observers that track rows should look children up
+  * by identity once the update has finished.
+  */
+struct PhraseModelDelta
+{
+  std::vector<int> removed;
+  std::vector<int> inserted;
+  std::vector<int> modified;
+
+  /// Flatten the delta into a range: each list is preceded by its length.
+  std::vector<int> encode() const
+  {
+    std::vector<int> range;
+    range.reserve(3 + removed.size() + inserted.size() + modified.size());
+    for (const auto* rows : { &removed, &inserted, &modified })
+    {
+      range.push_back(static_cast<int>(rows->size()));
+      range.insert(range.end(), rows->begin(), rows->end());
+    }
+    return range;
+  }
+
+  /// Recover a delta from the range passed to an observer.
+  static PhraseModelDelta decode(const std::vector<int>& range)
+  {
+    PhraseModelDelta delta;
+    auto it = range.begin();
+    for (auto* rows : { &delta.removed, &delta.inserted, &delta.modified })
+    {
+      if (it == range.end())
+      {
+        break;
+      }
+      auto count = static_cast<std::size_t>(*it++);
+      count = std::min(count, static_cast<std::size_t>(range.end() - it));
+      rows->assign(it, it + count);
+      it += count;
+    }
+    return delta;
+  }
 };
 
 /// Events that alter the phrase model trigger callbacks of this type.
@@ -0,0 +1,110 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/view/PhraseTitleIndex.h"
+
+#include "smtk/view/DescriptivePhrase.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace view
+{
+
+bool PhraseTitleIndex::compare(const Entry& aa, const Entry& bb)
+{
+  // Order entries exactly as DescriptivePhrase::compareByTitle orders phrases.
+  return DescriptivePhrase::compareTitles(aa.title, aa.id, bb.title, bb.id);
+}
+
+void PhraseTitleIndex::assign(std::vector<Entry>&& entries)
+{
+  m_entries = std::move(entries);
+  std::sort(m_entries.begin(), m_entries.end(), &PhraseTitleIndex::compare);
+  m_titles.clear();
+  m_titles.reserve(m_entries.size());
+  for (const auto& entry : m_entries)
+  {
+    m_titles[entry.id] = entry.title;
+  }
+}
+
+void PhraseTitleIndex::clear()
+{
+  m_entries.clear();
+  m_titles.clear();
+}
+
+std::size_t PhraseTitleIndex::lowerBound(const std::string& title, const smtk::common::UUID& id)
+  const
+{
+  Entry key{ title, id };
+  return static_cast<std::size_t>(
+    std::lower_bound(m_entries.begin(), m_entries.end(), key, &PhraseTitleIndex::compare) -
+    m_entries.begin());
+}
+
+int PhraseTitleIndex::find(const smtk::common::UUID& id) const
+{
+  auto it = m_titles.find(id);
+  if (it == m_titles.end())
+  {
+    return -1;
+  }
+  return static_cast<int>(this->lowerBound(it->second, id));
+}
+
+int PhraseTitleIndex::insert(const smtk::common::UUID& id, const std::string& title)
+{
+  if (!m_titles.insert(std::make_pair(id, title)).second)
+  {
+    return -1;
+  }
+  std::size_t position = this->lowerBound(title, id);
+  m_entries.insert(m_entries.begin() + position, Entry{ title, id });
+  return static_cast<int>(position);
+}
+
+int PhraseTitleIndex::erase(const smtk::common::UUID& id)
+{
+  auto it = m_titles.find(id);
+  if (it == m_titles.end())
+  {
+    return -1;
+  }
+  std::size_t position = this->lowerBound(it->second, id);
+  m_entries.erase(m_entries.begin() + position);
+  m_titles.erase(it);
+  return static_cast<int>(position);
+}
+
+std::pair<int, int> PhraseTitleIndex::retitle(
+  const smtk::common::UUID& id,
+  const std::string& title)
+{
+  auto it = m_titles.find(id);
+  if (it == m_titles.end())
+  {
+    return std::make_pair(-1, -1);
+  }
+  std::size_t before = this->lowerBound(it->second, id);
+  if (it->second == title)
+  {
+    return std::make_pair(static_cast<int>(before), static_cast<int>(before));
+  }
+  m_entries.erase(m_entries.begin() + before);
+  it->second = title;
+  std::size_t after = this->lowerBound(title, id);
+  m_entries.insert(m_entries.begin() + after, Entry{ title, id });
+  return std::make_pair(static_cast<int>(before), static_cast<int>(after));
+}
+
+} // namespace view
+} // namespace smtk
@@ -0,0 +1,111 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_view_PhraseTitleIndex_h
+#define smtk_view_PhraseTitleIndex_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/SharedFromThis.h"
+
+#include "smtk/common/UUID.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace view
+{
+
+/**\brief A sorted index of the children of a paged (virtualized) descriptive phrase.
+  *
+  * When a parent phrase has a very large number of children (e.g., a resource
+  * with hundreds of thousands of components), creating a DescriptivePhrase
+  * for each child is expensive in both time and memory.
+  * Instead, the subphrase generator records the title and UUID of each
+  * child in this index (sorted the same way DescriptivePhrase::compareByTitle
+  * orders phrases) and only materializes phrases for the prefix of the index
+  * a user interface has asked to see.
+  *
+  * The index is maintained incrementally as objects are created, renamed,
+  * and expunged; each method reports the position(s) affected so that the
+  * PhraseModel can emit fine-grained insert/remove/move events.
+  */
+class SMTKCORE_EXPORT PhraseTitleIndex : smtkEnableSharedPtr(PhraseTitleIndex)
+{
+public:
+  smtkTypeMacroBase(smtk::view::PhraseTitleIndex);
+  smtkCreateMacro(smtk::view::PhraseTitleIndex);
+  virtual ~PhraseTitleIndex() = default;
+
+  /// An entry in the index: the sort key (title) and the object it describes.
+  struct Entry
+  {
+    std::string title;
+    smtk::common::UUID id;
+  };
+
+  /// Return true if \a aa should be ordered before \a bb.
+  static bool compare(const Entry& aa, const Entry& bb);
+
+  /// The number of entries in the index.
+  std::size_t size() const { return m_entries.size(); }
+  /// Return true when the index holds no entries.
+  bool empty() const { return m_entries.empty(); }
+  /// Return the entry at \a position (which must be in [0, size()[).
+  const Entry& at(std::size_t position) const { return m_entries[position]; }
+  /// Return true if \a id has an entry in the index.
+  bool contains(const smtk::common::UUID& id) const { return m_titles.find(id) != m_titles.end(); }
+
+  /// Replace the contents of the index with \a entries, sorting them once.
+  void assign(std::vector<Entry>&& entries);
+  /// Remove all entries.
+  void clear();
+
+  /// Return the position of \a id in the index or -1 if it is not present.
+  int find(const smtk::common::UUID& id) const;
+
+  /**\brief Insert \a id with the given \a title.
+    *
+    * Returns the position at which the entry was inserted or -1
+    * if \a id was already present.
+    */
+  int insert(const smtk::common::UUID& id, const std::string& title);
+
+  /**\brief Remove \a id from the index.
+    *
+    * Returns the position the entry occupied before removal or -1
+    * if \a id was not present.
+    */
+  int erase(const smtk::common::UUID& id);
+
+  /**\brief Change the title of \a id, repositioning it as needed.
+    *
+    * Returns the position of the entry before the change (in the old ordering)
+    * and after the change (in the new ordering).
+    * Both are -1 if \a id is not present.
+    */
+  std::pair<int, int> retitle(const smtk::common::UUID& id, const std::string& title);
+
+protected:
+  PhraseTitleIndex() = default;
+
+  /// Return the position of the entry (\a title, \a id) or where it would be inserted.
+  std::size_t lowerBound(const std::string& title, const smtk::common::UUID& id) const;
+
+  std::vector<Entry> m_entries;
+  std::unordered_map<smtk::common::UUID, std::string> m_titles;
+};
+
+} // namespace view
+} // namespace smtk
+
+#endif
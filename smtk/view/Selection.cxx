@@ -38,6 +38,12 @@ static Selection* g_instance = nullptr;
 Selection::Selection()
   : m_observers(
       [this](Selection::Observer& fn) { fn(g_selectionManagerSource, this->shared_from_this()); })
+  , m_deltaObservers([this](Selection::DeltaObserver& fn) {
+    // Newly registered observers are told that the entire selection was added.
+    Selection::Delta delta;
+    delta.added = m_selection;
+    fn(g_selectionManagerSource, delta, this->shared_from_this());
+  })
   , m_filter(defaultFilter)
 {
   if (!g_instance)
@@ -144,27 +150,95 @@ bool Selection::resetSelectionBits(const std::string& source, int value)
   int mask = ~value;
   for (auto it = m_selection.begin(); it != m_selection.end(); /* fancy */)
   {
-    auto curr = it;
-    bool shouldErase = (it->second & mask) == 0;
-    modified |= (it->second & value) != 0;
-    it->second = it->second & mask;
-
-    ++it;
+    if ((it->second & value) == 0)
+    {
+      ++it;
+      continue;
+    }
 
-    if (shouldErase)
+    modified = true;
+    this->recordChange(it->first, it->second);
+    if ((it->second & mask) == 0)
     {
-      m_selection.erase(curr);
+      it = m_selection.erase(it);
+    }
+    else
+    {
+      it->second &= mask;
+      ++it;
     }
   }
 
   if (modified)
   {
-    this->observers()(source, shared_from_this());
+    this->notifyObservers(source);
   }
 
   return modified;
 }
 
+bool Selection::notifyObservers(const std::string& source)
+{
+  // Compare each changed object's current value to its value when observers
+  // were last notified; changes that were undone are not reported.
+  Delta delta;
+  for (const auto& prior : m_priorValues)
+  {
+    auto it = m_selection.find(prior.first);
+    const int value = it == m_selection.end() ? 0 : it->second;
+    if (value == prior.second)
+    {
+      continue;
+    }
+    if (prior.second == 0)
+    {
+      delta.added.insert(delta.added.end(), std::make_pair(prior.first, value));
+    }
+    else if (value == 0)
+    {
+      delta.removed.insert(delta.removed.end(), prior);
+    }
+    else
+    {
+      delta.modified.insert(delta.modified.end(), std::make_pair(prior.first, value));
+    }
+  }
+  m_priorValues.clear();
+
+  if (delta.empty())
+  {
+    return false;
+  }
+  auto self = shared_from_this();
+  this->observers()(source, self);
+  this->deltaObservers()(source, delta, self);
+  return true;
+}
+
+bool Selection::setValue(const Object::Ptr& object, int value)
+{
+  auto it = m_selection.find(object);
+  const int priorValue = it == m_selection.end() ? 0 : it->second;
+  if (priorValue == value)
+  {
+    return false;
+  }
+  this->recordChange(object, priorValue);
+  if (value == 0)
+  {
+    m_selection.erase(it);
+  }
+  else if (it == m_selection.end())
+  {
+    m_selection.insert(it, std::make_pair(object, value));
+  }
+  else
+  {
+    it->second = value;
+  }
+  return true;
+}
+
 bool Selection::setDefaultAction(const SelectionAction& action)
 {
   switch (action)
@@ -295,36 +369,18 @@ bool Selection::performAction(
           auto it = m_selection.find(suggestion.first);
           if (it == m_selection.end())
           {
-            if (suggestion.second != 0)
-            {
-              modified = true;
-              m_selection.insert(suggestion);
-            }
+            modified |= this->setValue(suggestion.first, suggestion.second);
           }
           else if (it->second != suggestion.second)
           {
-            modified = true;
             if (suggestion.second == 0)
             {
-              if (bitwise)
-              {
-                it->second = it->second & ~value;
-              }
-              else
-              {
-                m_selection.erase(it);
-              }
+              modified |= this->setValue(suggestion.first, bitwise ? it->second & ~value : 0);
             }
             else
             {
-              if (bitwise)
-              {
-                it->second |= suggestion.second;
-              }
-              else
-              {
-                it->second = suggestion.second;
-              }
+              modified |= this->setValue(
+                suggestion.first, bitwise ? it->second | suggestion.second : suggestion.second);
             }
           }
         }
@@ -345,13 +401,11 @@ bool Selection::performAction(
     case SelectionAction::UNFILTERED_ADD:
       if (it == m_selection.end())
       {
-        modified = true;
-        m_selection[obj] = value;
+        modified |= this->setValue(obj, value);
       }
       else if (it->second != value)
       {
-        modified = true;
-        it->second = (bitwise ? it->second | value : value);
+        modified |= this->setValue(obj, bitwise ? it->second | value : value);
       }
       // Now add all the suggested entries and clear.
       for (const auto& suggestion : suggestions)
@@ -359,22 +413,18 @@ bool Selection::performAction(
         it = m_selection.find(suggestion.first);
         if (it == m_selection.end())
         {
-          if (suggestion.second != 0)
-          {
-            modified = true;
-            m_selection.insert(suggestion);
-          }
+          modified |= this->setValue(suggestion.first, suggestion.second);
         }
         else if (it->second != suggestion.second)
         {
-          modified = true;
           if (suggestion.second == 0 && (!bitwise || (bitwise && !(it->second & ~value))))
           {
-            m_selection.erase(it);
+            modified |= this->setValue(suggestion.first, 0);
           }
           else
           {
-            it->second = (bitwise ? it->second | suggestion.second : suggestion.second);
+            modified |= this->setValue(
+              suggestion.first, bitwise ? it->second | suggestion.second : suggestion.second);
           }
         }
       }
@@ -382,18 +432,12 @@ bool Selection::performAction(
       break;
     case SelectionAction::FILTERED_SUBTRACT:
     case SelectionAction::UNFILTERED_SUBTRACT:
+    {
+      int mask = ~value;
       if (it != m_selection.end())
       {
-        modified = true;
-        int mask = ~value;
-        if (!bitwise || (bitwise && (it->second & mask) == 0))
-        {
-          m_selection.erase(it);
-        }
-        else
-        {
-          it->second &= mask;
-        }
+        modified |= this->setValue(
+          obj, (!bitwise || (bitwise && (it->second & mask) == 0)) ? 0 : it->second & mask);
       }
       // Now deal with suggestions... should we really allow additions
       // during a subtract? Not going to for now, but I guess it is
@@ -403,21 +447,14 @@ bool Selection::performAction(
         it = m_selection.find(suggestion.first);
         if (it != m_selection.end())
         {
-          int mask = ~value;
-          if (!bitwise || (bitwise && (it->second & mask) == 0))
-          {
-            modified = true;
-            m_selection.erase(it);
-          }
-          else if (bitwise)
-          {
-            modified = true;
-            it->second &= mask;
-          }
+          modified |= this->setValue(
+            suggestion.first,
+            (!bitwise || (bitwise && (it->second & mask) == 0)) ? 0 : it->second & mask);
         }
       }
       suggestions.clear();
       break;
+    }
     default:
       break;
   }
@@ -431,11 +468,10 @@ bool Selection::refilter(const std::string& source)
   for (auto it = m_selection.begin(); it != m_selection.end();)
   {
     if (!m_filter(it->first, it->second, suggestions))
-    { // Remove the current item from the selection, being careful not to invalidate the iterator:
-      auto tmp = it;
+    { // Remove the current item from the selection:
       modified = true;
-      ++it;
-      m_selection.erase(tmp);
+      this->recordChange(it->first, it->second);
+      it = m_selection.erase(it);
     }
     else
     { // We still like the current item; keep it.
@@ -445,32 +481,12 @@ bool Selection::refilter(const std::string& source)
   // Now handle suggestions
   for (const auto& suggestion : suggestions)
   {
-    auto it = m_selection.find(suggestion.first);
-    if (it == m_selection.end())
-    {
-      if (suggestion.second != 0)
-      {
-        modified = true;
-        m_selection.insert(suggestion);
-      }
-    }
-    else if (it->second != suggestion.second)
-    {
-      modified = true;
-      if (suggestion.second == 0)
-      {
-        m_selection.erase(it);
-      }
-      else
-      {
-        it->second = suggestion.second;
-      }
-    }
+    modified |= this->setValue(suggestion.first, suggestion.second);
   }
   suggestions.clear();
   if (modified)
   {
-    this->observers()(source, shared_from_this());
+    this->notifyObservers(source);
   }
   return modified;
 }
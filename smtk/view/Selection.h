@@ -21,6 +21,7 @@
 #include <functional>
 #include <map>
 #include <set>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -100,10 +101,22 @@ namespace view
   * + upon a change to the selection's filter that
   *   results in a change to the selection.
   *
-  * While Observers are not usually informed when attempted
-  * changes to the selection have no effect, it is possible
-  * to get called when the selection is entirely replaced with
-  * an identical selection.
+  * Observers are only informed when the selection has changed;
+  * replacing the selection with an identical selection does not
+  * generate an event.
+  *
+  * Observers that only need to know what changed should register
+  * with deltaObservers() instead. Their callbacks are passed a
+  * SelectionDelta holding only the objects that were added to,
+  * removed from, or whose values changed in the selection, so that
+  * they need not rescan the entire selection after each event.
+  * Upon registration, the entire selection is reported as added.
+  *
+  * Changes are tracked as they are made, so the cost of an event
+  * is proportional to the number of objects whose selection changed
+  * rather than to the size of the selection (with the exception of
+  * replacement, which must remove every object not in the
+  * replacement set).
   *
   * ## Convenience Functions
   *
@@ -118,6 +131,9 @@ class SMTKCORE_EXPORT Selection : smtkEnableSharedPtr(Selection)
 public:
   using Observer = SelectionObserver;
   using Observers = SelectionObservers;
+  using Delta = SelectionDelta;
+  using DeltaObserver = SelectionDeltaObserver;
+  using DeltaObservers = SelectionDeltaObservers;
   using Component = smtk::resource::Component;
   using Object = smtk::resource::PersistentObject;
 
@@ -246,6 +262,30 @@ public:
     bool bitwise = false,
     bool postponeNotification = false);
 
+  /**\brief Toggle the selection of \a objects.
+    *
+    * Objects that have all of \a value's bits set have those bits cleared
+    * (and are removed from the selection if no bits remain); all other
+    * objects have \a value's bits set. The selection filter is not applied.
+    * The cost is proportional to the number of \a objects, not to the size
+    * of the selection.
+    *
+    * Returns true if the selection was modified.
+    */
+  template<typename T>
+  bool toggleSelection(
+    const T& objects,
+    const std::string& source,
+    int value,
+    bool postponeNotification = false);
+
+  /**\brief Notify observers of changes made with notification postponed.
+    *
+    * Returns true if the selection had changed since observers were last
+    * notified (in which case they are notified now).
+    */
+  bool notifyObservers(const std::string& source);
+
   /**\brief Reset values in the selection map so no entries contain the given bit \a value.
     *
     * This method assumes each value in the selection map is a bit vector.
@@ -331,6 +371,10 @@ public:
   Observers& observers() { return m_observers; }
   const Observers& observers() const { return m_observers; }
 
+  /// Return the observers that are passed only the changes to the selection.
+  DeltaObservers& deltaObservers() { return m_deltaObservers; }
+  const DeltaObservers& deltaObservers() const { return m_deltaObservers; }
+
   /** \brief Selection filtering.
     *
     */
@@ -386,13 +430,28 @@ protected:
     bool bitwise);
   bool refilter(const std::string& source);
 
+  /// Record \a object's selection value before it is first changed since
+  /// observers were last notified.
+  void recordChange(const Object::Ptr& object, int priorValue)
+  {
+    m_priorValues.emplace(object, priorValue);
+  }
+
+  /// Set \a object's selection value (removing it when \a value is 0),
+  /// recording the change.
+  bool setValue(const Object::Ptr& object, int value);
+
   SelectionAction m_defaultAction{ SelectionAction::FILTERED_REPLACE };
   //smtk::model::BitFlags m_modelEntityMask;
   bool m_meshSetMask;
   std::set<std::string> m_selectionSources;
   std::map<std::string, int> m_selectionValueLabels;
   SelectionMap m_selection;
+  // The values of objects changed since observers were last notified, as
+  // they were before the first change (0 for objects that were unselected).
+  SelectionMap m_priorValues;
   Observers m_observers;
+  DeltaObservers m_deltaObservers;
   SelectionFilter m_filter;
 };
 
@@ -453,56 +512,93 @@ bool Selection::modifySelection(
   {
     action = this->defaultAction();
   }
-  if (
-    !bitwise &&
-    (action == SelectionAction::FILTERED_REPLACE || action == SelectionAction::UNFILTERED_REPLACE))
+  // Replacing the selection may remove objects only to add them back, so
+  // whether it was modified is decided by comparing it to its prior state.
+  const bool replace =
+    action == SelectionAction::FILTERED_REPLACE || action == SelectionAction::UNFILTERED_REPLACE;
+  SelectionMap previous;
+  if (!bitwise && replace)
   {
-    modified = !m_selection.empty();
-    m_selection.clear();
+    for (const auto& entry : m_selection)
+    {
+      this->recordChange(entry.first, entry.second);
+    }
+    previous.swap(m_selection);
   }
-  else if (
-    bitwise &&
-    (action == SelectionAction::FILTERED_REPLACE || action == SelectionAction::UNFILTERED_REPLACE))
+  else if (bitwise && replace)
   {
-    // Remove unmatched objects from existing selection
+    previous = m_selection;
+    // Remove unmatched objects from existing selection. The replacement
+    // objects are hashed so that each test is constant-time.
+    std::unordered_set<Object::Ptr> replacements;
+    for (const auto& object : objects)
+    {
+      replacements.insert(object);
+    }
     int mask = ~value;
-    smtk::resource::PersistentObjectSet willErase;
-    for (auto& entry : m_selection)
+    for (auto it = m_selection.begin(); it != m_selection.end();)
     {
-      auto it = std::find(objects.begin(), objects.end(), entry.first);
-      // std::cout << "  " << entry.first->id() << "  " << (it == objects.end() ? "not in obj" : "in obj") << " " << entry.second << " " << (entry.second & mask);
-      if ((it == objects.end() && ((entry.second & mask) == 0)) || value == 0)
-      {
-        willErase.insert(entry.first);
-        // std::cout << "    erase obj\n";
-      }
-      else if (it == objects.end() && ((entry.second & mask) != 0))
-      {
-        entry.second &= mask;
-        modified = true;
-      }
-      else
+      const bool replaced = replacements.find(it->first) != replacements.end();
+      if ((!replaced && ((it->second & mask) == 0)) || value == 0)
       {
-        // std::cout << "    keep  obj\n";
+        this->recordChange(it->first, it->second);
+        it = m_selection.erase(it);
+        continue;
       }
-    }
-    // std::cout << "---\n";
-    if (!willErase.empty())
-    {
-      modified = true;
-      for (const auto& key : willErase)
+      else if (!replaced && ((it->second & value) != 0))
       {
-        m_selection.erase(key);
+        this->recordChange(it->first, it->second);
+        it->second &= mask;
       }
+      ++it;
     }
   }
   for (const auto& object : objects)
   {
     modified |= this->performAction(object, value, action, suggestions, bitwise);
   }
+  if (replace)
+  {
+    modified = m_selection != previous;
+  }
+  if (modified && !postponeNotification)
+  {
+    this->notifyObservers(source);
+  }
+  return modified;
+}
+
+template<typename T>
+bool Selection::toggleSelection(
+  const T& objects,
+  const std::string& source,
+  int value,
+  bool postponeNotification)
+{
+  bool modified = false;
+  if (value == 0)
+  {
+    return modified;
+  }
+  for (const auto& object : objects)
+  {
+    auto it = m_selection.find(object);
+    if (it == m_selection.end())
+    {
+      modified |= this->setValue(object, value);
+    }
+    else if ((it->second & value) == value)
+    {
+      modified |= this->setValue(object, it->second & ~value);
+    }
+    else
+    {
+      modified |= this->setValue(object, it->second | value);
+    }
+  }
   if (modified && !postponeNotification)
   {
-    this->observers()(source, shared_from_this());
+    this->notifyObservers(source);
   }
   return modified;
 }
@@ -15,6 +15,7 @@
 
 #include "smtk/common/Observers.h"
 
+#include <map>
 #include <string>
 
 namespace smtk
@@ -27,6 +28,31 @@ typedef std::function<void(const std::string&, SelectionPtr)> SelectionObserver;
 
 /// A class for holding SelectionObserver functors that observe selection events.
 typedef smtk::common::Observers<SelectionObserver> SelectionObservers;
+
+/**\brief The net change to a selection since its observers were last notified.
+  *
+  * Objects that were not selected before the change but are now appear in
+  * \a added and objects that were selected but are no longer appear in
+  * \a removed, each with the selection value they have (or had).
+  * Objects that remain selected with a different value appear in
+  * \a modified with their new value.
+  */
+struct SelectionDelta
+{
+  std::map<smtk::resource::PersistentObjectPtr, int> added;
+  std::map<smtk::resource::PersistentObjectPtr, int> removed;
+  std::map<smtk::resource::PersistentObjectPtr, int> modified;
+
+  bool empty() const { return added.empty() && removed.empty() && modified.empty(); }
+};
+
+/// Events that alter the selection trigger callbacks of this type with only
+/// the objects whose selection changed.
+typedef std::function<void(const std::string&, const SelectionDelta&, SelectionPtr)>
+  SelectionDeltaObserver;
+
+/// A class for holding SelectionDeltaObserver functors.
+typedef smtk::common::Observers<SelectionDeltaObserver> SelectionDeltaObservers;
 } // namespace view
 } // namespace smtk
 
@@ -15,6 +15,7 @@
 #include "smtk/view/Manager.h"
 #include "smtk/view/ObjectGroupPhraseContent.h"
 #include "smtk/view/PhraseModel.h"
+#include "smtk/view/PhraseTitleIndex.h"
 #include "smtk/view/ResourcePhraseContent.h"
 
 #include "smtk/model/AuxiliaryGeometry.h"
@@ -85,6 +86,7 @@ SubphraseGeneratorPtr SubphraseGenerator::create(
 SubphraseGenerator::SubphraseGenerator()
 {
   m_directLimit = -1;
+  m_pageSize = -1;
   m_skipAttributes = false;
   m_skipProperties = false;
 }
@@ -297,6 +299,19 @@ int MutabilityOfComponent(const T& comp)
   return static_cast<int>(smtk::view::PhraseContent::ContentType::TITLE);
 }
 
+// Top-level components of attribute resources only allow their color to be
+// edited; all others allow both their name and color to be edited.
+// This matches the choices made by SubphraseGenerator::componentsOfResource().
+int MutabilityOfResourceChildren(const smtk::resource::ResourcePtr& rsrc)
+{
+  if (std::dynamic_pointer_cast<smtk::attribute::Resource>(rsrc))
+  {
+    return static_cast<int>(smtk::view::PhraseContent::ContentType::COLOR);
+  }
+  return static_cast<int>(smtk::view::PhraseContent::ContentType::TITLE) |
+    static_cast<int>(smtk::view::PhraseContent::ContentType::COLOR);
+}
+
 template<typename T>
 int MutabilityOfObject(const T& obj)
 {
@@ -424,6 +439,73 @@ bool SubphraseGenerator::setDirectLimit(int val)
   return false;
 }
 
+int SubphraseGenerator::pageSize() const
+{
+  return m_pageSize;
+}
+
+bool SubphraseGenerator::setPageSize(int val)
+{
+  if (val == 0 || val == m_pageSize)
+  {
+    return false;
+  }
+  m_pageSize = val < 0 ? -1 : val;
+  return true;
+}
+
+void SubphraseGenerator::pageSubphrases(
+  const DescriptivePhrase::Ptr& src,
+  int begin,
+  int end,
+  DescriptivePhrases& result)
+{
+  smtk::resource::ResourcePtr rsrc = src ? src->relatedResource() : nullptr;
+  if (!rsrc || !src->isPaged() || begin < 0 || end <= begin)
+  {
+    return;
+  }
+  const auto& index = src->titleIndex();
+  int mutability = MutabilityOfResourceChildren(rsrc);
+  int remaining = end - begin;
+  int position = begin;
+  result.reserve(result.size() + remaining);
+  while (remaining > 0 && position < static_cast<int>(index->size()))
+  {
+    smtk::common::UUID uid = index->at(position).id;
+    auto comp = rsrc->find(uid);
+    if (!comp)
+    {
+      // The component was removed without the index being informed;
+      // drop it so the index stays consistent with the resource.
+      index->erase(uid);
+      continue;
+    }
+    result.push_back(ComponentPhraseContent::createPhrase(comp, mutability, src));
+    ++position;
+    --remaining;
+  }
+}
+
+bool SubphraseGenerator::isTopLevelComponent(
+  const smtk::resource::ComponentPtr& comp,
+  const smtk::resource::ResourcePtr& rsrc) const
+{
+  if (!comp || !rsrc || comp->resource() != rsrc)
+  {
+    return false;
+  }
+  // Model resources have only _free_ models as direct children.
+  // Attribute and mesh resources (and resources of unknown type)
+  // own all of their components directly.
+  if (std::dynamic_pointer_cast<smtk::model::Resource>(rsrc))
+  {
+    auto ment = std::dynamic_pointer_cast<smtk::model::Entity>(comp);
+    return ment && ment->isModel() && !smtk::model::Model(ment).owningModel().isValid();
+  }
+  return true;
+}
+
 bool SubphraseGenerator::shouldOmitProperty(
   DescriptivePhrase::Ptr parent,
   smtk::resource::PropertyType ptype,
@@ -466,8 +548,13 @@ SubphraseGenerator::Path SubphraseGenerator::indexOfObjectInParent(
   {
     return result;
   }
+  // Children of paged phrases are positioned by the phrase model using
+  // the parent's title index rather than by searching materialized phrases.
+  if (actualParent->isPaged())
+  {
+    return result;
+  }
 
-  smtk::resource::ResourcePtr rsrc;
   smtk::attribute::AttributePtr attr;
   smtk::mesh::ComponentPtr mcmp;
   smtk::model::EntityPtr ment;
@@ -475,29 +562,10 @@ SubphraseGenerator::Path SubphraseGenerator::indexOfObjectInParent(
   // Determine if the component is a direct-ish child of parent
   if (!actualParent->relatedComponent() && actualParent->relatedResource())
   {
-    rsrc = comp->resource();
-    // Attribute and mesh resources own all their components directly.
-    // Model resources have only _free_ models as direct children.
-    if (rsrc == actualParent->relatedResource())
+    if (this->isTopLevelComponent(comp, actualParent->relatedResource()))
     {
-      if (
-        std::dynamic_pointer_cast<smtk::attribute::Attribute>(comp) ||
-        std::dynamic_pointer_cast<smtk::mesh::Component>(comp) ||
-        ((ment = std::dynamic_pointer_cast<smtk::model::Entity>(comp)) && ment->isModel() &&
-         !smtk::model::Model(ment).owningModel().isValid()))
-      {
-        PreparePath(result, parentPath, IndexFromTitle(comp->name(), actualParent->subphrases()));
-        added = true;
-      }
-      else if (
-        !std::dynamic_pointer_cast<smtk::attribute::Resource>(rsrc) &&
-        !std::dynamic_pointer_cast<smtk::model::Resource>(rsrc) &&
-        !std::dynamic_pointer_cast<smtk::mesh::Resource>(rsrc))
-      {
-        // Resources of unknown type... plop all the components in the top-level
-        PreparePath(result, parentPath, IndexFromTitle(comp->name(), actualParent->subphrases()));
-        added = true;
-      }
+      PreparePath(result, parentPath, IndexFromTitle(comp->name(), actualParent->subphrases()));
+      added = true;
     }
   }
   if (
@@ -733,6 +801,12 @@ void SubphraseGenerator::componentsOfResource(
   smtk::resource::ResourcePtr rsrc,
   DescriptivePhrases& result)
 {
+  if (m_pageSize > 0)
+  {
+    this->pagedComponentsOfResource(src, rsrc, result);
+    return;
+  }
+
   auto modelRsrc = dynamic_pointer_cast<smtk::model::Resource>(rsrc);
   auto attrRsrc = dynamic_pointer_cast<smtk::attribute::Resource>(rsrc);
   auto meshRsrc = dynamic_pointer_cast<smtk::mesh::Resource>(rsrc);
@@ -793,6 +867,33 @@ void SubphraseGenerator::componentsOfResource(
   std::sort(result.begin(), result.end(), DescriptivePhrase::compareByTitle);
 }
 
+void SubphraseGenerator::pagedComponentsOfResource(
+  DescriptivePhrase::Ptr src,
+  smtk::resource::ResourcePtr rsrc,
+  DescriptivePhrases& result)
+{
+  if (!src || !rsrc)
+  {
+    return;
+  }
+  // Only record the sort key of each component; phrases are
+  // created for the first page and then only as requested.
+  std::vector<PhraseTitleIndex::Entry> entries;
+  smtk::resource::Component::Visitor visitor =
+    [this, &entries, &rsrc](const smtk::resource::Component::Ptr& component) {
+      if (component && component->id() && this->isTopLevelComponent(component, rsrc))
+      {
+        entries.push_back(PhraseTitleIndex::Entry{ component->name(), component->id() });
+      }
+    };
+  rsrc->visit(visitor);
+
+  auto index = PhraseTitleIndex::create();
+  index->assign(std::move(entries));
+  src->m_titleIndex = index;
+  this->pageSubphrases(src, 0, m_pageSize, result);
+}
+
 bool SubphraseGenerator::resourceHasChildren(const smtk::resource::ResourcePtr& rsrc) const
 {
   auto modelRsrc = dynamic_pointer_cast<smtk::model::Resource>(rsrc);
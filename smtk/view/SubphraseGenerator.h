@@ -129,6 +129,39 @@ public:
     */
   virtual bool setDirectLimit(int val);
 
+  /**\brief The number of component phrases to materialize at a time for large parents.
+    *
+    * When positive, the components of a resource are not all turned into phrases
+    * when the resource phrase's children are built. Instead, a PhraseTitleIndex
+    * holding the sorted titles of all the components is attached to the resource
+    * phrase and only the first pageSize() phrases are created.
+    * The PhraseModel materializes further pages on demand (see
+    * PhraseModel::fetchMoreSubphrases()) and keeps the index up to date as
+    * components are created, renamed, and expunged.
+    *
+    * A negative value (the default) disables paging.
+    */
+  ///@{
+  virtual int pageSize() const;
+  virtual bool setPageSize(int val);
+  ///@}
+
+  /**\brief Create phrases for the paged children of \a src in the range [\a begin, \a end[.
+    *
+    * The range refers to positions in \a src's titleIndex(); new phrases are appended
+    * to \a result. Entries in the index whose components no longer exist are dropped.
+    */
+  virtual void pageSubphrases(
+    const DescriptivePhrase::Ptr& src,
+    int begin,
+    int end,
+    DescriptivePhrases& result);
+
+  /// Return true if \a comp should be presented as an immediate child of \a rsrc.
+  virtual bool isTopLevelComponent(
+    const smtk::resource::ComponentPtr& comp,
+    const smtk::resource::ResourcePtr& rsrc) const;
+
   /**\brief Should the property of the given type and name be omitted from presentation?
     *
     * Subclasses should override this method.
@@ -195,6 +228,11 @@ protected:
     DescriptivePhrase::Ptr src,
     smtk::resource::ResourcePtr rsrc,
     DescriptivePhrases& result);
+  /// Index the top-level components of \a rsrc and populate \a result with the first page.
+  void pagedComponentsOfResource(
+    DescriptivePhrase::Ptr src,
+    smtk::resource::ResourcePtr rsrc,
+    DescriptivePhrases& result);
   /// Populate \a result with the active, public items of \a att with \a src as their parent.
   void itemsOfAttribute(
     DescriptivePhrase::Ptr src,
@@ -379,6 +417,7 @@ protected:
 #endif // 0
 
   int m_directLimit;
+  int m_pageSize;
   bool m_skipAttributes;
   bool m_skipProperties;
   WeakPhraseModelPtr m_model;
@@ -74,6 +74,7 @@ inline PySharedPtrClass< smtk::view::DescriptivePhrase > pybind11_init_smtk_view
     .def("isPropertyValueType", &smtk::view::DescriptivePhrase::isPropertyValueType)
     .def_static("compareByTypeThenTitle", &smtk::view::DescriptivePhrase::compareByTypeThenTitle, py::arg("a"), py::arg("b"))
     .def_static("compareByTitle", &smtk::view::DescriptivePhrase::compareByTitle, py::arg("a"), py::arg("b"))
+    .def_static("compareTitles", &smtk::view::DescriptivePhrase::compareTitles, py::arg("titleA"), py::arg("idA"), py::arg("titleB"), py::arg("idB"))
     ;
   return instance;
 }
@@ -73,6 +73,15 @@ inline PySharedPtrClass< smtk::view::Selection > pybind11_init_smtk_view_Selecti
         py::arg("action") = smtk::view::SelectionAction::DEFAULT,
         py::arg("bitwise") = false,
         py::arg("postponeNotification") = false)
+    .def("toggleSelection", (bool
+        (smtk::view::Selection::*)(const ::std::vector<smtk::resource::PersistentObject::Ptr>&,
+          const std::string&, int, bool))
+        &smtk::view::Selection::toggleSelection,
+        py::arg("objects"),
+        py::arg("source"),
+        py::arg("value"),
+        py::arg("postponeNotification") = false)
+    .def("notifyObservers", &smtk::view::Selection::notifyObservers, py::arg("source"))
     .def("resetSelectionBits", &smtk::view::Selection::resetSelectionBits)
     .def("visitSelection", (void (smtk::view::Selection::*)(::std::function<void (std::shared_ptr<smtk::resource::PersistentObject>, int)>)) &smtk::view::Selection::visitSelection, py::arg("visitor"))
     .def("setFilter", &smtk::view::Selection::setFilter, py::arg("fn"), py::arg("refilterSelection") = true)
@@ -0,0 +1,199 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/view/DescriptivePhrase.h"
+#include "smtk/view/PhraseModelObserver.h"
+#include "smtk/view/ResourcePhraseModel.h"
+#include "smtk/view/SubphraseGenerator.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace smtk::view;
+
+namespace
+{
+
+// Expose the handlers PhraseModel invokes after an operation completes.
+class ChangesPhraseModel : public ResourcePhraseModel
+{
+public:
+  smtkTypeMacro(ChangesPhraseModel);
+  smtkSuperclassMacro(ResourcePhraseModel);
+  smtkSharedPtrCreateMacro(smtk::view::PhraseModel);
+
+  using PhraseModel::handleCreated;
+  using PhraseModel::handleExpunged;
+  using PhraseModel::handleModified;
+  using ResourcePhraseModel::processResource;
+};
+
+// Record the coalesced updates reported to observers.
+struct Update
+{
+  DescriptivePhrasePtr parent;
+  PhraseModelDelta delta;
+  std::vector<std::string> removedTitles;
+};
+
+std::vector<Update> updates;
+DescriptivePhrasePtr watched;
+int otherEvents = 0;
+
+void observe(
+  DescriptivePhrasePtr parent,
+  PhraseModelEvent event,
+  const std::vector<int>& /*src*/,
+  const std::vector<int>& /*dst*/,
+  const std::vector<int>& range)
+{
+  if (event == PhraseModelEvent::ABOUT_TO_UPDATE)
+  {
+    Update update{ parent, PhraseModelDelta::decode(range), {} };
+    for (const auto& row : update.delta.removed)
+    {
+      update.removedTitles.push_back(parent->subphrases()[row]->title());
+    }
+    updates.push_back(update);
+  }
+  else if (event == PhraseModelEvent::UPDATE_FINISHED)
+  {
+    smtkTest(!updates.empty() && updates.back().parent == parent, "Unmatched update.");
+  }
+  else if (parent == watched)
+  {
+    ++otherEvents;
+  }
+}
+
+std::string name(int ii)
+{
+  std::ostringstream str;
+  str << "thing " << ii;
+  return str.str();
+}
+
+void checkSorted(const DescriptivePhrasePtr& parent, std::size_t expected)
+{
+  const auto& children = parent->subphrases();
+  smtkTest(
+    children.size() == expected,
+    "Expected " << expected << " children, got " << children.size() << ".");
+  for (std::size_t ii = 1; ii < children.size(); ++ii)
+  {
+    smtkTest(
+      !DescriptivePhrase::compareByTypeThenTitle(children[ii], children[ii - 1]),
+      "Children out of order at " << ii << " (" << children[ii - 1]->title() << ", "
+                                  << children[ii]->title() << ").");
+  }
+}
+
+void checkOneUpdate(const DescriptivePhrasePtr& parent, const std::string& what)
+{
+  smtkTest(updates.size() == 1, "Expected 1 update upon " << what << ", got " << updates.size());
+  smtkTest(updates[0].parent == parent, "Unexpected parent updated upon " << what << ".");
+  smtkTest(otherEvents == 0, "Unexpected per-row events upon " << what << ".");
+}
+
+} // namespace
+
+int unitPhraseModelChanges(int /*unused*/, char* /*unused*/[])
+{
+  auto attRsrc = smtk::attribute::Resource::create();
+  attRsrc->createDefinition("Thing");
+  std::vector<smtk::attribute::AttributePtr> things;
+  for (int ii = 10; ii < 20; ++ii)
+  {
+    things.push_back(attRsrc->createAttribute(name(2 * ii), "Thing"));
+  }
+
+  auto model = std::make_shared<ChangesPhraseModel>();
+  model->root()->findDelegate()->setModel(model);
+  model->processResource(attRsrc, true);
+  auto parent = model->root()->subphrases()[0];
+  checkSorted(parent, 10);
+  watched = parent;
+  auto key = model->observers().insert(&observe, "Record coalesced updates.");
+
+  // Renaming an attribute reports it as modified at its new (sorted) row
+  // without replacing its phrase.
+  auto renamedPhrase = parent->subphrases()[2];
+  attRsrc->rename(things[2], "thing 99");
+  model->handleModified({ things[2] });
+  checkOneUpdate(parent, "rename");
+  smtkTest(
+    updates[0].delta.removed.empty() && updates[0].delta.inserted.empty() &&
+      updates[0].delta.modified == std::vector<int>{ 9 },
+    "Unexpected delta upon rename.");
+  checkSorted(parent, 10);
+  smtkTest(parent->subphrases()[9] == renamedPhrase, "Renamed phrase was replaced.");
+  updates.clear();
+
+  // Creating many attributes interleaved with existing ones inserts them all
+  // with one update, keeping existing phrases.
+  DescriptivePhrases before = parent->subphrases();
+  smtk::resource::PersistentObjectSet created;
+  for (int ii = 0; ii < 400; ++ii)
+  {
+    created.insert(attRsrc->createAttribute(name(2 * ii + 1), "Thing"));
+  }
+  model->handleCreated(created);
+  checkOneUpdate(parent, "creation");
+  smtkTest(updates[0].delta.inserted.size() == 400, "Expected 400 insertions.");
+  checkSorted(parent, 410);
+  for (const auto& phrase : before)
+  {
+    smtkTest(
+      std::find(parent->subphrases().begin(), parent->subphrases().end(), phrase) !=
+        parent->subphrases().end(),
+      "Existing phrase " << phrase->title() << " was replaced upon creation.");
+  }
+  for (const auto& row : updates[0].delta.inserted)
+  {
+    smtkTest(
+      created.count(parent->subphrases()[row]->relatedComponent()) == 1,
+      "Row " << row << " was not inserted.");
+  }
+  updates.clear();
+
+  // Expunging attributes removes their phrases with one update; removed rows are
+  // reported before the children change.
+  smtk::resource::PersistentObjectSet expunged{ things[0], things[5], things[9] };
+  for (const auto& object : expunged)
+  {
+    attRsrc->removeAttribute(std::dynamic_pointer_cast<smtk::attribute::Attribute>(object));
+  }
+  model->handleExpunged(expunged);
+  checkOneUpdate(parent, "expunging");
+  smtkTest(updates[0].delta.removed.size() == 3, "Expected 3 removals.");
+  for (const auto& title : updates[0].removedTitles)
+  {
+    smtkTest(
+      title == name(20) || title == name(30) || title == name(38),
+      "Unexpected phrase " << title << " removed.");
+  }
+  checkSorted(parent, 407);
+  updates.clear();
+
+  // Changes to objects without phrases are ignored.
+  model->handleModified(expunged);
+  smtkTest(updates.empty() && otherEvents == 0, "Expunged objects should not be reported.");
+
+  model->observers().erase(key);
+  return 0;
+}
@@ -0,0 +1,89 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/view/PhraseTitleIndex.h"
+
+#include "smtk/common/UUID.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace smtk::view;
+using smtk::common::UUID;
+
+namespace
+{
+
+void checkOrder(const PhraseTitleIndex& index, const std::vector<std::string>& expected)
+{
+  smtkTest(
+    index.size() == expected.size(),
+    "Expected " << expected.size() << " entries, got " << index.size() << ".");
+  for (std::size_t ii = 0; ii < expected.size(); ++ii)
+  {
+    smtkTest(
+      index.at(ii).title == expected[ii],
+      "Expected \"" << expected[ii] << "\" at " << ii << ", got \"" << index.at(ii).title
+                    << "\".");
+    smtkTest(
+      index.find(index.at(ii).id) == static_cast<int>(ii), "Could not find entry at " << ii << ".");
+  }
+}
+
+} // namespace
+
+int unitPhraseTitleIndex(int /*unused*/, char* /*unused*/[])
+{
+  auto index = PhraseTitleIndex::create();
+  std::vector<UUID> ids;
+  std::vector<PhraseTitleIndex::Entry> entries;
+  for (const auto& title : { "face 10", "face 2", "edge 1", "vertex 3" })
+  {
+    ids.push_back(UUID::random());
+    entries.push_back(PhraseTitleIndex::Entry{ title, ids.back() });
+  }
+
+  // Bulk assignment sorts with the same mixed alphanumeric ordering as phrase titles.
+  index->assign(std::move(entries));
+  checkOrder(*index, { "edge 1", "face 2", "face 10", "vertex 3" });
+
+  // Insertion reports the new position and rejects duplicates.
+  UUID added = UUID::random();
+  test(index->insert(added, "face 3") == 2, "Unexpected insertion position.");
+  test(index->insert(added, "face 3") == -1, "Duplicate insertion should fail.");
+  checkOrder(*index, { "edge 1", "face 2", "face 3", "face 10", "vertex 3" });
+
+  // Renaming reports the old and new positions.
+  auto moved = index->retitle(added, "zone 1");
+  test(moved.first == 2 && moved.second == 4, "Unexpected positions upon retitling.");
+  checkOrder(*index, { "edge 1", "face 2", "face 10", "vertex 3", "zone 1" });
+  moved = index->retitle(added, "zone 1");
+  test(moved.first == 4 && moved.second == 4, "Retitling to the same title should not move.");
+
+  // Removal reports the old position.
+  test(index->erase(ids[2]) == 0, "Unexpected removal position.");
+  test(index->erase(ids[2]) == -1, "Removing a missing entry should fail.");
+  test(!index->contains(ids[2]), "Removed entry is still present.");
+  checkOrder(*index, { "face 2", "face 10", "vertex 3", "zone 1" });
+
+  // Identical titles are ordered by UUID so positions are stable.
+  UUID twin = UUID::random();
+  int twinPosition = index->insert(twin, "face 2");
+  int firstPosition = index->find(ids[1]);
+  test(twinPosition >= 0 && firstPosition >= 0, "Twins should both be present.");
+  test((twinPosition < firstPosition) == (twin < ids[1]), "Twins are not ordered by UUID.");
+
+  index->clear();
+  test(index->empty() && index->find(ids[0]) == -1, "Index should be empty after clearing.");
+
+  return 0;
+}
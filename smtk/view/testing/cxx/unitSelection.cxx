@@ -0,0 +1,192 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/view/Selection.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace smtk::view;
+
+namespace
+{
+
+using Objects = std::vector<smtk::resource::PersistentObjectPtr>;
+
+Objects makeObjects(const smtk::attribute::ResourcePtr& resource, std::size_t count)
+{
+  auto definition = resource->createDefinition("object");
+  Objects objects;
+  objects.reserve(count);
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    objects.push_back(resource->createAttribute(definition));
+  }
+  return objects;
+}
+
+Objects slice(const Objects& objects, std::size_t begin, std::size_t end)
+{
+  return Objects(objects.begin() + begin, objects.begin() + end);
+}
+
+// Record the events delivered to both kinds of observers.
+class Recorder
+{
+public:
+  Recorder(const Selection::Ptr& selection)
+  {
+    m_observer = selection->observers().insert(
+      [this](const std::string&, Selection::Ptr) { ++m_events; },
+      0,
+      true,
+      "unitSelection: count events");
+    m_deltaObserver = selection->deltaObservers().insert(
+      [this](const std::string& source, const SelectionDelta& delta, Selection::Ptr) {
+        ++m_deltaEvents;
+        m_source = source;
+        m_delta = delta;
+      },
+      0,
+      true,
+      "unitSelection: record deltas");
+  }
+
+  // Verify that exactly one event occurred since the last check and that its
+  // delta holds the given number of objects.
+  void check(std::size_t added, std::size_t removed, std::size_t modified, const char* what)
+  {
+    smtkTest(
+      m_events == 1 && m_deltaEvents == 1,
+      what << ": expected one event, got " << m_events << " and " << m_deltaEvents << ".");
+    smtkTest(
+      m_delta.added.size() == added && m_delta.removed.size() == removed &&
+        m_delta.modified.size() == modified,
+      what << ": expected " << added << "/" << removed << "/" << modified << " got "
+           << m_delta.added.size() << "/" << m_delta.removed.size() << "/"
+           << m_delta.modified.size() << ".");
+    m_events = 0;
+    m_deltaEvents = 0;
+  }
+
+  void checkNoEvent(const char* what)
+  {
+    smtkTest(m_events == 0 && m_deltaEvents == 0, what << ": expected no event.");
+  }
+
+  const SelectionDelta& delta() const { return m_delta; }
+  const std::string& source() const { return m_source; }
+
+private:
+  Selection::Observers::Key m_observer;
+  Selection::DeltaObservers::Key m_deltaObserver;
+  int m_events{ 0 };
+  int m_deltaEvents{ 0 };
+  std::string m_source;
+  SelectionDelta m_delta;
+};
+
+} // namespace
+
+int unitSelection(int /*unused*/, char** const /*unused*/)
+{
+  auto resource = smtk::attribute::Resource::create();
+  Objects objects = makeObjects(resource, 20000);
+  const std::string source = "unitSelection";
+
+  auto selection = Selection::create();
+  selection->setDefaultAction(SelectionAction::UNFILTERED_REPLACE);
+  Recorder recorder(selection);
+  recorder.check(0, 0, 0, "Registration");
+
+  // Replacing an empty selection adds every object.
+  selection->modifySelection(slice(objects, 0, 10000), source, 1);
+  recorder.check(10000, 0, 0, "Replace");
+  test(recorder.source() == source, "Expected the source of the change.");
+
+  // Small changes to a large selection report only the changed objects.
+  selection->modifySelection(
+    slice(objects, 10000, 10005), source, 1, SelectionAction::UNFILTERED_ADD);
+  recorder.check(5, 0, 0, "Add");
+  test(recorder.delta().added.count(objects[10002]) == 1, "Expected added object in delta.");
+
+  selection->modifySelection(
+    slice(objects, 0, 3), source, 1, SelectionAction::UNFILTERED_SUBTRACT);
+  recorder.check(0, 3, 0, "Subtract");
+  test(recorder.delta().removed.at(objects[1]) == 1, "Expected prior value of removed object.");
+
+  // Toggle two selected and two unselected objects.
+  Objects toggled = { objects[3], objects[4], objects[15000], objects[15001] };
+  selection->toggleSelection(toggled, source, 2);
+  recorder.check(2, 0, 2, "Toggle");
+  test(recorder.delta().modified.at(objects[3]) == 3, "Expected toggled bit to be set.");
+  selection->toggleSelection(toggled, source, 2);
+  recorder.check(0, 2, 2, "Toggle back");
+  test(recorder.delta().modified.at(objects[3]) == 1, "Expected toggled bit to be cleared.");
+
+  // Replacing the selection with an identical one is not an event.
+  Objects current;
+  selection->visitSelection(
+    [&current](const smtk::resource::PersistentObjectPtr& object, int) {
+      current.push_back(object);
+    });
+  test(!selection->modifySelection(current, source, 1), "Identical replacement reported.");
+  recorder.checkNoEvent("Identical replacement");
+  test(
+    !selection->modifySelection(current, source, 1, SelectionAction::UNFILTERED_REPLACE, true),
+    "Identical bitwise replacement reported.");
+  recorder.checkNoEvent("Identical bitwise replacement");
+
+  // Bitwise replacement of a large selection (by a mostly-overlapping set)
+  selection->modifySelection(
+    slice(objects, 5000, 20000), source, 1, SelectionAction::UNFILTERED_REPLACE, true);
+  recorder.check(9995, 4997, 0, "Bitwise replace");
+  test(selection->currentSelection().size() == 15000, "Unexpected selection size.");
+
+  // Changes with postponed notification are reported together and changes
+  // that are undone before notification are not reported at all.
+  selection->modifySelection(
+    slice(objects, 0, 10), source, 1, SelectionAction::UNFILTERED_ADD, false, true);
+  selection->modifySelection(
+    slice(objects, 0, 5), source, 1, SelectionAction::UNFILTERED_SUBTRACT, false, true);
+  recorder.checkNoEvent("Postponed");
+  test(selection->notifyObservers(source), "Expected postponed changes.");
+  recorder.check(5, 0, 0, "Postponed");
+  selection->modifySelection(
+    slice(objects, 0, 5), source, 1, SelectionAction::UNFILTERED_ADD, false, true);
+  selection->modifySelection(
+    slice(objects, 0, 5), source, 1, SelectionAction::UNFILTERED_SUBTRACT, false, true);
+  test(!selection->notifyObservers(source), "Expected no net change.");
+  recorder.checkNoEvent("Undone");
+
+  // Resetting bits removes objects with no other bits set.
+  selection->modifySelection(
+    slice(objects, 6000, 6010), source, 4, SelectionAction::UNFILTERED_ADD, true);
+  recorder.check(0, 0, 10, "Bitwise add");
+  selection->resetSelectionBits(source, 1);
+  recorder.check(0, 14995, 10, "Reset bits");
+  test(selection->currentSelection().size() == 10, "Expected only objects with other bits.");
+
+  // A filter that rejects everything empties the selection.
+  selection->setFilter(
+    [](const smtk::resource::PersistentObjectPtr&, int, Selection::SelectionMap&) {
+      return false;
+    });
+  recorder.check(0, 10, 0, "Refilter");
+  test(selection->currentSelection().empty(), "Expected an empty selection.");
+
+  return 0;
+}